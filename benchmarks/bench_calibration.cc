@@ -0,0 +1,103 @@
+// bench_calibration.cc - Benchmarks of the mock calibration of simulated hits
+//
+// This file is part of Falaise.
+//
+// Falaise is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Falaise is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Falaise.  If not, see <http://www.gnu.org/licenses/>.
+
+// Standard Library:
+#include <vector>
+
+// Third Party:
+#include <benchmark/benchmark.h>
+#include <bayeux/datatools/clhep_units.h>
+#include <bayeux/datatools/things.h>
+#include <bayeux/mygsl/rng.h>
+
+// This Project:
+#include "falaise/snemo/datamodels/data_model.h"
+#include "falaise/snemo/processing/geiger_regime.h"
+#include "falaise/snemo/processing/mock_calorimeter_s2c_module.h"
+#include "falaise/snemo/processing/mock_tracker_s2c_module.h"
+#include "fixtures.h"
+
+namespace {
+using falaise::benchmarks::kEventSeed;
+
+// Number of synthetic events cycled through by event level benchmarks
+const std::size_t kNumberOfEvents = 256;
+
+void BM_GeigerRegimeRandomTimeGivenRadius(benchmark::State& state) {
+  snemo::processing::geiger_regime gr;
+  mygsl::rng rng{"mt19937", static_cast<unsigned long>(kEventSeed)};
+  const double rmax = gr.getCellRadius();
+  const double dr = rmax / 1024;
+  double r = 0.0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(gr.getRandomTimeGivenRadius(rng, r));
+    r = (r + dr < rmax) ? r + dr : 0.0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GeigerRegimeRandomTimeGivenRadius);
+
+void BM_GeigerRegimeCalibrateRadiusFromTime(benchmark::State& state) {
+  snemo::processing::geiger_regime gr;
+  const double tmax = gr.getMaximumDriftTime();
+  const double dt = tmax / 1024;
+  double t = 0.0;
+  double radius = 0.0;
+  double sigma = 0.0;
+  for (auto _ : state) {
+    gr.calibrateRadiusFromTime(t, radius, sigma);
+    benchmark::DoNotOptimize(radius);
+    benchmark::DoNotOptimize(sigma);
+    t = (t + dt < tmax) ? t + dt : 0.0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GeigerRegimeCalibrateRadiusFromTime);
+
+// Full mock calibration chain, as configured in the default reconstruction pipeline
+void BM_MockCalibrationChain(benchmark::State& state) {
+  datatools::service_manager& services = falaise::benchmarks::services();
+  dpp::module_handle_dict_type noModules;
+  datatools::properties noConfig;
+
+  snemo::processing::mock_tracker_s2c_module trackerS2C;
+  trackerS2C.set_name("CalibrateTracker");
+  trackerS2C.initialize(noConfig, services, noModules);
+
+  snemo::processing::mock_calorimeter_s2c_module caloS2C;
+  caloS2C.set_name("CalibrateCalorimeters");
+  caloS2C.initialize(noConfig, services, noModules);
+
+  const std::vector<mctools::simulated_data> events =
+      falaise::benchmarks::make_simulated_events(kNumberOfEvents);
+  const std::string& sdLabel = snedm::labels::simulated_data();
+
+  std::size_t i = 0;
+  for (auto _ : state) {
+    datatools::things event;
+    event.add<mctools::simulated_data>(sdLabel) = events[i];
+    trackerS2C.process(event);
+    caloS2C.process(event);
+    benchmark::DoNotOptimize(event);
+    i = (i + 1) % events.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetLabel("events");
+}
+BENCHMARK(BM_MockCalibrationChain);
+
+}  // namespace
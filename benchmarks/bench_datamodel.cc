@@ -0,0 +1,58 @@
+// bench_datamodel.cc - Benchmarks of the allocation of data model objects
+//
+// This file is part of Falaise.
+//
+// Falaise is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Falaise is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Falaise.  If not, see <http://www.gnu.org/licenses/>.
+
+// Standard Library:
+#include <vector>
+
+// Third Party:
+#include <benchmark/benchmark.h>
+#include <bayeux/datatools/handle.h>
+
+// This Project:
+#include "falaise/snemo/datamodels/calibrated_tracker_hit.h"
+#include "falaise/snemo/datamodels/handle_pool.h"
+
+namespace {
+namespace sdm = snemo::datamodel;
+
+// Allocate and release the handles of a typical number of tracker hits per event
+template <typename Allocate>
+void allocate_hits(benchmark::State& state, Allocate allocate) {
+  const auto nHits = static_cast<std::size_t>(state.range(0));
+  std::vector<datatools::handle<sdm::calibrated_tracker_hit>> hits;
+  hits.reserve(nHits);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < nHits; ++i) {
+      hits.push_back(allocate());
+    }
+    benchmark::DoNotOptimize(hits.data());
+    hits.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * nHits);
+}
+
+void BM_MakeHandle(benchmark::State& state) {
+  allocate_hits(state, []() { return datatools::make_handle<sdm::calibrated_tracker_hit>(); });
+}
+BENCHMARK(BM_MakeHandle)->Arg(16)->Arg(256);
+
+void BM_MakePooledHandle(benchmark::State& state) {
+  allocate_hits(state, []() { return sdm::make_pooled_handle<sdm::calibrated_tracker_hit>(); });
+}
+BENCHMARK(BM_MakePooledHandle)->Arg(16)->Arg(256);
+
+}  // namespace
@@ -0,0 +1,197 @@
+// bench_geometry.cc - Benchmarks of geometry locators and field maps
+//
+// This file is part of Falaise.
+//
+// Falaise is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Falaise is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Falaise.  If not, see <http://www.gnu.org/licenses/>.
+
+// Standard Library:
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Third Party:
+#include <benchmark/benchmark.h>
+#include <bayeux/datatools/clhep_units.h>
+
+// This Project:
+#include "falaise/snemo/geometry/calo_locator.h"
+#include "falaise/snemo/geometry/gg_locator.h"
+#include "falaise/snemo/geometry/mapped_magnetic_field.h"
+#include "fixtures.h"
+
+namespace {
+using falaise::benchmarks::kEventSeed;
+
+// Number of distinct points cycled through by each benchmark
+const std::size_t kNumberOfPoints = 4096;
+
+// World points spread over the Geiger cells, within one cell radius of an anode wire
+std::vector<geomtools::vector_3d> make_cell_points(const snemo::geometry::gg_locator& ggloc) {
+  std::mt19937 gen{static_cast<std::mt19937::result_type>(kEventSeed)};
+  const double halfLength = 0.45 * ggloc.cellLength();
+  const double radius = 0.5 * ggloc.cellDiameter();
+  std::vector<geomtools::vector_3d> points;
+  points.reserve(kNumberOfPoints);
+  while (points.size() < kNumberOfPoints) {
+    const uint32_t side = std::uniform_int_distribution<uint32_t>{0, 1}(gen);
+    const uint32_t layer =
+        std::uniform_int_distribution<uint32_t>{0, uint32_t(ggloc.numberOfLayers(side) - 1)}(gen);
+    const uint32_t row =
+        std::uniform_int_distribution<uint32_t>{0, uint32_t(ggloc.numberOfRows(side) - 1)}(gen);
+    geomtools::vector_3d p = ggloc.getCellPosition(side, layer, row);
+    p.setX(p.x() + std::uniform_real_distribution<double>{-radius, radius}(gen));
+    p.setY(p.y() + std::uniform_real_distribution<double>{-radius, radius}(gen));
+    p.setZ(std::uniform_real_distribution<double>{-halfLength, halfLength}(gen));
+    points.push_back(ggloc.transformModuleToWorld(p));
+  }
+  return points;
+}
+
+// World points spread over the main wall calorimeter blocks
+std::vector<geomtools::vector_3d> make_block_points(const snemo::geometry::calo_locator& caloloc) {
+  std::mt19937 gen{static_cast<std::mt19937::result_type>(kEventSeed)};
+  const double halfWidth = 0.45 * caloloc.blockWidth();
+  const double halfHeight = 0.45 * caloloc.blockHeight();
+  std::vector<geomtools::vector_3d> points;
+  points.reserve(kNumberOfPoints);
+  while (points.size() < kNumberOfPoints) {
+    const uint32_t side = std::uniform_int_distribution<uint32_t>{0, 1}(gen);
+    const uint32_t column = std::uniform_int_distribution<uint32_t>{
+        0, uint32_t(caloloc.numberOfColumns(side) - 1)}(gen);
+    const uint32_t row =
+        std::uniform_int_distribution<uint32_t>{0, uint32_t(caloloc.numberOfRows(side) - 1)}(gen);
+    geomtools::vector_3d p = caloloc.getBlockPosition(side, column, row);
+    p.setY(p.y() + std::uniform_real_distribution<double>{-halfWidth, halfWidth}(gen));
+    p.setZ(p.z() + std::uniform_real_distribution<double>{-halfHeight, halfHeight}(gen));
+    points.push_back(caloloc.transformModuleToWorld(p));
+  }
+  return points;
+}
+
+void BM_GGLocatorFindCellGID(benchmark::State& state) {
+  const snemo::geometry::gg_locator& ggloc = falaise::benchmarks::locators().geigerLocator();
+  const std::vector<geomtools::vector_3d> points = make_cell_points(ggloc);
+  geomtools::geom_id gid;
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ggloc.findCellGID(points[i], gid));
+    i = (i + 1) % points.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GGLocatorFindCellGID);
+
+void BM_CaloLocatorFindBlockGID(benchmark::State& state) {
+  const snemo::geometry::calo_locator& caloloc = falaise::benchmarks::locators().caloLocator();
+  const std::vector<geomtools::vector_3d> points = make_block_points(caloloc);
+  geomtools::geom_id gid;
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(caloloc.findBlockGID(points[i], gid));
+    i = (i + 1) % points.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CaloLocatorFindBlockGID);
+
+// Field from the demonstrator map, as used by the simulation
+void initialize_field(snemo::geometry::mapped_magnetic_field& mmf) {
+  mmf.setMapMode(snemo::geometry::mapped_magnetic_field::map_mode_t::IMPORT_CSV_MAP_0);
+  mmf.setMapFilename(
+      "@falaise:snemo/demonstrator/geometry/GeometryPlugins/MagneticField/data/csv_map_0/"
+      "MapSmoothPlusDetail.csv");
+  mmf.setZeroFieldOutsideMap(true);
+  mmf.initialize_simple();
+}
+
+using kernel_t = snemo::geometry::mapped_magnetic_field::kernel_t;
+const int64_t kScalarKernel = static_cast<int64_t>(kernel_t::SCALAR);
+const int64_t kAVX2Kernel = static_cast<int64_t>(kernel_t::AVX2);
+
+// Select the interpolation kernel given as argument, skipping the benchmark if
+// the running CPU does not support it
+bool select_kernel(snemo::geometry::mapped_magnetic_field& mmf, benchmark::State& state,
+                   int64_t kernelArg) {
+  const auto kernel = static_cast<kernel_t>(kernelArg);
+  if (!snemo::geometry::mapped_magnetic_field::isKernelSupported(kernel)) {
+    state.SkipWithError("interpolation kernel not supported by this CPU");
+    return false;
+  }
+  mmf.setKernel(kernel);
+  return true;
+}
+
+// Points in the tracking volume, where the map is sampled during reconstruction
+std::vector<geomtools::vector_3d> make_field_points() {
+  std::mt19937 gen{static_cast<std::mt19937::result_type>(kEventSeed)};
+  std::uniform_real_distribution<double> x{-0.4 * CLHEP::m, 0.4 * CLHEP::m};
+  std::uniform_real_distribution<double> y{-2.5 * CLHEP::m, 2.5 * CLHEP::m};
+  std::uniform_real_distribution<double> z{-1.4 * CLHEP::m, 1.4 * CLHEP::m};
+  std::vector<geomtools::vector_3d> points;
+  points.reserve(kNumberOfPoints);
+  for (std::size_t i = 0; i < kNumberOfPoints; ++i) {
+    points.emplace_back(x(gen), y(gen), z(gen));
+  }
+  return points;
+}
+
+// Field at one point at a time, with the kernel given by state.range(0)
+void BM_MappedMagneticFieldCompute(benchmark::State& state) {
+  snemo::geometry::mapped_magnetic_field mmf;
+  initialize_field(mmf);
+  if (!select_kernel(mmf, state, state.range(0))) {
+    return;
+  }
+  const std::vector<geomtools::vector_3d> points = make_field_points();
+
+  geomtools::vector_3d B;
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mmf.compute_magnetic_field(points[i], 0.0, B));
+    benchmark::DoNotOptimize(B);
+    i = (i + 1) % points.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MappedMagneticFieldCompute)->ArgName("kernel")->Arg(kScalarKernel)->Arg(kAVX2Kernel);
+
+// Same points as BM_MappedMagneticFieldCompute, computed state.range(1) at a time
+void BM_MappedMagneticFieldComputeBatch(benchmark::State& state) {
+  snemo::geometry::mapped_magnetic_field mmf;
+  initialize_field(mmf);
+  if (!select_kernel(mmf, state, state.range(0))) {
+    return;
+  }
+  const std::vector<geomtools::vector_3d> points = make_field_points();
+  const std::size_t batchSize = state.range(1);
+  std::vector<std::vector<geomtools::vector_3d>> batches;
+  for (std::size_t first = 0; first < points.size(); first += batchSize) {
+    batches.emplace_back(points.begin() + first, points.begin() + first + batchSize);
+  }
+
+  std::vector<geomtools::vector_3d> fields;
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mmf.compute_magnetic_field(batches[i], 0.0, fields));
+    benchmark::DoNotOptimize(fields.data());
+    i = (i + 1) % batches.size();
+  }
+  state.SetItemsProcessed(state.iterations() * batchSize);
+}
+BENCHMARK(BM_MappedMagneticFieldComputeBatch)
+    ->ArgNames({"kernel", "batch"})
+    ->RangeMultiplier(8)
+    ->Ranges({{kScalarKernel, kAVX2Kernel}, {8, 4096}});
+
+}  // namespace
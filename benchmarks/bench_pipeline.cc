@@ -0,0 +1,164 @@
+// bench_pipeline.cc - Benchmarks of the reconstruction chain on whole event records
+//
+// This file is part of Falaise.
+//
+// Falaise is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Falaise is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Falaise.  If not, see <http://www.gnu.org/licenses/>.
+
+// Standard Library:
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Third Party:
+#include <benchmark/benchmark.h>
+#include <bayeux/datatools/things.h>
+
+// This Project:
+#include "falaise/snemo/datamodels/data_model.h"
+#include "falaise/snemo/datamodels/handle_pool.h"
+#include "falaise/snemo/processing/mock_calorimeter_s2c_module.h"
+#include "falaise/snemo/processing/mock_tracker_s2c_module.h"
+#include "fixtures.h"
+
+// Plugins:
+#include <CAT/cat_tracker_clustering_module.h>
+#include <TrackFit/trackfit_tracker_fitting_module.h>
+
+namespace {
+// Number of synthetic events cycled through by event level benchmarks
+const std::size_t kNumberOfEvents = 256;
+
+// Number of records waiting for the writer, as set by the flreconstruct writeBehindDepth
+const std::size_t kWriteBehindDepth = 8;
+
+// How the records are released once reconstructed
+enum release_mode {
+  kReleaseInPlace = 0,   // on the processing thread, blocks go back to its pool
+  kReleaseOnWriter = 1,  // on a writer thread, as by flreconstruct with write-behind
+  kReleaseToHeap = 2     // on the processing thread, emptying the pool after each event
+};
+
+// Thread releasing the records pushed to it
+class record_releaser {
+ public:
+  record_releaser()
+      : thread_{[this]() {
+          std::unique_lock<std::mutex> lock{mutex_};
+          while (true) {
+            cv_.wait(lock, [this]() { return closed_ || !records_.empty(); });
+            if (records_.empty()) {
+              return;
+            }
+            std::unique_ptr<datatools::things> record = std::move(records_.front());
+            records_.pop_front();
+            cv_.notify_all();
+            lock.unlock();
+            record.reset();
+            lock.lock();
+          }
+        }} {}
+
+  ~record_releaser() {
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      closed_ = true;
+    }
+    cv_.notify_all();
+    thread_.join();
+  }
+
+  void push(std::unique_ptr<datatools::things> record) {
+    std::unique_lock<std::mutex> lock{mutex_};
+    cv_.wait(lock, [this]() { return records_.size() < kWriteBehindDepth; });
+    records_.push_back(std::move(record));
+    cv_.notify_all();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::unique_ptr<datatools::things>> records_;
+  bool closed_ = false;
+  std::thread thread_;
+};
+
+// Calibrate, cluster and fit events, as the default reconstruction pipeline does.
+// Unlike BM_MakePooledHandle, this shows the cost of the allocations within a whole
+// event, and how it depends on the thread releasing the records (see release_mode)
+void BM_ReconstructionChain(benchmark::State& state) {
+  const auto mode = static_cast<release_mode>(state.range(0));
+  datatools::service_manager& services = falaise::benchmarks::services();
+  dpp::module_handle_dict_type noModules;
+  datatools::properties noConfig;
+
+  snemo::processing::mock_tracker_s2c_module trackerS2C;
+  trackerS2C.set_name("CalibrateTracker");
+  trackerS2C.initialize(noConfig, services, noModules);
+
+  snemo::processing::mock_calorimeter_s2c_module caloS2C;
+  caloS2C.set_name("CalibrateCalorimeters");
+  caloS2C.initialize(noConfig, services, noModules);
+
+  snemo::reconstruction::cat_tracker_clustering_module clustering;
+  clustering.set_name("CATClustering");
+  clustering.initialize(falaise::benchmarks::cat_configuration(), services, noModules);
+
+  snemo::reconstruction::trackfit_tracker_fitting_module fitting;
+  fitting.set_name("TrackFit");
+  fitting.initialize(noConfig, services, noModules);
+
+  const std::vector<mctools::simulated_data> events =
+      falaise::benchmarks::make_simulated_events(kNumberOfEvents);
+  const std::string& sdLabel = snedm::labels::simulated_data();
+  snemo::datamodel::handle_pool::release();
+
+  {
+    std::unique_ptr<record_releaser> releaser;
+    if (mode == kReleaseOnWriter) {
+      releaser.reset(new record_releaser);
+    }
+    std::size_t i = 0;
+    for (auto _ : state) {
+      std::unique_ptr<datatools::things> event{new datatools::things};
+      event->add<mctools::simulated_data>(sdLabel) = events[i];
+      trackerS2C.process(*event);
+      caloS2C.process(*event);
+      clustering.process(*event);
+      fitting.process(*event);
+      if (releaser) {
+        releaser->push(std::move(event));
+      } else {
+        event.reset();
+        if (mode == kReleaseToHeap) {
+          snemo::datamodel::handle_pool::release();
+        }
+      }
+      i = (i + 1) % events.size();
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetLabel("events");
+  snemo::datamodel::handle_pool::release();
+}
+BENCHMARK(BM_ReconstructionChain)
+    ->ArgName("release")
+    ->Arg(kReleaseInPlace)
+    ->Arg(kReleaseOnWriter)
+    ->Arg(kReleaseToHeap)
+    ->UseRealTime();
+
+}  // namespace
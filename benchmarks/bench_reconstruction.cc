@@ -0,0 +1,157 @@
+// bench_reconstruction.cc - Benchmarks of tracker clustering and track fitting
+//
+// This file is part of Falaise.
+//
+// Falaise is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Falaise is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Falaise.  If not, see <http://www.gnu.org/licenses/>.
+
+// Standard Library:
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Third Party:
+#include <benchmark/benchmark.h>
+#include <bayeux/datatools/clhep_units.h>
+#include <bayeux/datatools/properties.h>
+
+// This Project:
+#include "falaise/snemo/datamodels/tracker_clustering_data.h"
+#include "fixtures.h"
+
+// Plugins:
+#include <CAT/cat_driver.h>
+#include <TrackFit/helix_fit_mgr.h>
+#include <TrackFit/i_drift_time_calibration.h>
+
+namespace {
+using falaise::benchmarks::kEventSeed;
+
+// Number of synthetic events cycled through by event level benchmarks
+const std::size_t kNumberOfEvents = 256;
+
+void BM_CATClusterize(benchmark::State& state) {
+  snemo::reconstruction::cat_driver cat;
+  cat.set_geometry_manager(falaise::benchmarks::geometry());
+  cat.initialize(falaise::benchmarks::cat_configuration());
+
+  const std::vector<snemo::datamodel::TrackerHitHdlCollection> events =
+      falaise::benchmarks::make_calibrated_events(kNumberOfEvents);
+  const snemo::datamodel::CalorimeterHitHdlCollection noCaloHits;
+  snemo::datamodel::tracker_clustering_data clustering;
+
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cat.process(events[i], noCaloHits, clustering));
+    i = (i + 1) % events.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetLabel("events");
+  cat.reset();
+}
+BENCHMARK(BM_CATClusterize);
+
+// A track to fit: its Geiger hits and an initial guess of its helix parameters
+struct helix_track {
+  TrackFit::gg_hits_col hits;
+  TrackFit::helix_fit_params guess;
+};
+
+// Generate hits along random helices, following the TrackFit helix_fit_mgr test program
+std::vector<helix_track> make_helix_tracks(std::size_t nTracks, std::size_t nHits,
+                                           const TrackFit::default_drift_time_calibration& dtc) {
+  std::mt19937 gen{static_cast<std::mt19937::result_type>(kEventSeed)};
+  auto flat = [&gen](double a, double b) {
+    return std::uniform_real_distribution<double>{a, b}(gen);
+  };
+  auto gauss = [&gen](double mean, double sigma) {
+    return std::normal_distribution<double>{mean, sigma}(gen);
+  };
+
+  datatools::properties noConfig;
+  TrackFit::helix_fit_mgr::guess_utils guessMaker;
+  guessMaker.initialize(noConfig);
+
+  std::vector<helix_track> tracks;
+  while (tracks.size() < nTracks) {
+    const double r = flat(50. * CLHEP::cm, 200. * CLHEP::cm);
+    const double step = flat(50. * CLHEP::cm, 100. * CLHEP::cm);
+    const double x0 = flat(-25. * CLHEP::cm, 25. * CLHEP::cm);
+    const double y0 = flat(-25. * CLHEP::cm, 25. * CLHEP::cm);
+    const double z0 = flat(-50. * CLHEP::cm, 50. * CLHEP::cm);
+    const double dtheta = 3. * dtc.rmax / r;
+    double angle = flat(-150. * CLHEP::degree, 150. * CLHEP::degree);
+
+    helix_track track;
+    for (std::size_t i = 0; i < nHits; ++i, angle += dtheta) {
+      double driftRadius = flat(0.1 * CLHEP::mm, dtc.rmax);
+      const double ri = r + (flat(0., 1.) < 0.5 ? -driftRadius : driftRadius);
+      double driftTime = 0.0;
+      double sigma = 0.0;
+      dtc.radius_to_drift_time(driftRadius, driftTime, sigma);
+      driftTime = std::max(gauss(driftTime, 20.0 * CLHEP::ns), 20.0 * CLHEP::ns);
+      dtc.drift_time_to_radius(driftTime, driftRadius, sigma);
+
+      TrackFit::gg_hit hit;
+      hit.set_id(i);
+      hit.set_x(x0 + ri * std::cos(angle));
+      hit.set_y(y0 + ri * std::sin(angle));
+      hit.set_z(gauss(z0 + step * angle / (2. * M_PI), 2.5 * CLHEP::mm));
+      hit.set_sigma_z(2.5 * CLHEP::mm);
+      hit.set_r(driftRadius);
+      hit.set_sigma_r(sigma);
+      hit.set_t(driftTime);
+      hit.set_rmax(dtc.rmax);
+      track.hits.push_back(hit);
+    }
+
+    for (std::size_t g = 0; g < TrackFit::helix_fit_mgr::guess_utils::NUMBER_OF_GUESS; ++g) {
+      if (guessMaker.compute_guess(track.hits, g, track.guess, false)) {
+        tracks.push_back(track);
+        break;
+      }
+    }
+  }
+  return tracks;
+}
+
+void BM_HelixFit(benchmark::State& state) {
+  const TrackFit::default_drift_time_calibration dtc;
+  const std::vector<helix_track> tracks =
+      make_helix_tracks(kNumberOfEvents, static_cast<std::size_t>(state.range(0)), dtc);
+  datatools::properties config;
+  // Workspaces are shared across fits as in the trackfit_driver
+  TrackFit::fit_workspace_pool workspaces;
+
+  std::size_t i = 0;
+  for (auto _ : state) {
+    TrackFit::helix_fit_mgr fitter;
+    fitter.set_workspace_pool(workspaces);
+    fitter.set_hits(tracks[i].hits);
+    fitter.set_calibration(dtc);
+    fitter.set_t0(0.0 * CLHEP::ns);
+    fitter.set_fit_eps(1.e-2);
+    fitter.set_guess(tracks[i].guess);
+    fitter.init(config);
+    fitter.fit();
+    benchmark::DoNotOptimize(fitter.get_solution().ok);
+    fitter.reset();
+    i = (i + 1) % tracks.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetLabel("fits");
+}
+BENCHMARK(BM_HelixFit)->Arg(10)->Arg(50);
+
+}  // namespace
@@ -0,0 +1,36 @@
+// falaise_benchmarks.cc - Entry point of the Falaise benchmark suite
+//
+// This file is part of Falaise.
+//
+// Falaise is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Falaise is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Falaise.  If not, see <http://www.gnu.org/licenses/>.
+
+// Third Party:
+#include <benchmark/benchmark.h>
+
+// This Project:
+#include "falaise/falaise.h"
+
+// Falaise must be initialized for "@falaise:" resource paths to resolve,
+// so BENCHMARK_MAIN() cannot be used
+int main(int argc, char** argv) {
+  falaise::initialize(argc, argv);
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    falaise::terminate();
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  falaise::terminate();
+  return 0;
+}
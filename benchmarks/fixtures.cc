@@ -0,0 +1,211 @@
+// fixtures.cc - Implementation of shared inputs for the Falaise benchmarks
+//
+// This file is part of Falaise.
+//
+// Falaise is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Falaise is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Falaise.  If not, see <http://www.gnu.org/licenses/>.
+
+// Ourselves:
+#include "fixtures.h"
+
+// Standard Library:
+#include <algorithm>
+
+// Third Party:
+#include <bayeux/datatools/clhep_units.h>
+#include <bayeux/datatools/multi_properties.h>
+#include <bayeux/geomtools/geometry_service.h>
+#include <bayeux/mctools/base_step_hit.h>
+
+// This Project:
+#include "falaise/snemo/geometry/locator_helpers.h"
+#include "falaise/snemo/processing/detail/testing/event_generator.h"
+
+namespace falaise {
+namespace benchmarks {
+
+namespace {
+// Shoot events from the preclustering generator and pass each of them to f
+template <typename F>
+void shoot_events(std::size_t nEvents, long seed, F f) {
+  TrackerPreClustering::event_generator generator{seed};
+  std::vector<const TrackerPreClustering::gg_hit*> hits;
+  for (std::size_t i = 0; i < nEvents; ++i) {
+    hits.clear();
+    generator.shoot_event(hits);
+    f(hits);
+  }
+}
+
+// Return the world position of a point at drift radius r and height z in a cell
+geomtools::vector_3d world_point_in_cell(const snemo::geometry::gg_locator& ggloc,
+                                         const TrackerPreClustering::gg_hit& hit, double r) {
+  geomtools::vector_3d p = ggloc.getCellPosition(hit.side, hit.layer, hit.row);
+  p.setX(p.x() + r);
+  p.setZ(hit.z);
+  return ggloc.transformModuleToWorld(p);
+}
+}  // namespace
+
+datatools::service_manager& services() {
+  static datatools::service_manager* instance = [] {
+    auto* sm = new datatools::service_manager{"benchmarks", "Falaise benchmark services"};
+    datatools::multi_properties config;
+    config.add_section("geometry", "geomtools::geometry_service")
+        .store_path("manager.configuration_file",
+                    "@falaise:snemo/demonstrator/geometry/GeometryManager.conf");
+    sm->load(config);
+    sm->initialize();
+    return sm;
+  }();
+  return *instance;
+}
+
+const geomtools::manager& geometry() {
+  static const geomtools::manager& instance =
+      services().get<geomtools::geometry_service>("geometry").get_geom_manager();
+  return instance;
+}
+
+const snemo::geometry::locator_plugin& locators() {
+  static const snemo::geometry::locator_plugin* instance =
+      snemo::geometry::getSNemoLocator(geometry(), "");
+  return *instance;
+}
+
+datatools::properties cat_configuration() {
+  datatools::properties config;
+  config.store_real("CAT.magnetic_field", 25 * CLHEP::gauss);
+  config.store_string("CAT.level", "mute");
+  config.store_real("CAT.max_time", 5000.0 * CLHEP::ms);
+  config.store_real("CAT.small_radius", 2.0 * CLHEP::mm);
+  config.store_real("CAT.probmin", 0.0);
+  config.store_integer("CAT.nofflayers", 1);
+  config.store_integer("CAT.first_event", -1);
+  config.store_real("CAT.ratio", 10000.0);
+  config.store_real("CAT.driver.sigma_z_factor", 1.0);
+  return config;
+}
+
+std::vector<snemo::datamodel::TrackerHitHdlCollection> make_calibrated_events(
+    std::size_t nEvents, long seed) {
+  const snemo::geometry::gg_locator& ggloc = locators().geigerLocator();
+  std::vector<snemo::datamodel::TrackerHitHdlCollection> events;
+  events.reserve(nEvents);
+
+  shoot_events(nEvents, seed, [&](const std::vector<const TrackerPreClustering::gg_hit*>& hits) {
+    snemo::datamodel::TrackerHitHdlCollection event;
+    for (const auto* h : hits) {
+      geomtools::geom_id gid;
+      if (!ggloc.findCellGID(world_point_in_cell(ggloc, *h, 0.0), gid)) {
+        continue;
+      }
+      snemo::datamodel::TrackerHitHdl hdl{new snemo::datamodel::calibrated_tracker_hit};
+      snemo::datamodel::calibrated_tracker_hit& gghit = hdl.grab();
+      gghit.set_hit_id(event.size());
+      gghit.set_geom_id(gid);
+      geomtools::vector_3d cellPosition = ggloc.getCellPosition(h->side, h->layer, h->row);
+      gghit.set_xy(cellPosition.x(), cellPosition.y());
+      gghit.set_z(h->z);
+      gghit.set_sigma_z(h->dz);
+      gghit.set_delayed(h->delayed);
+      if (h->delayed) {
+        gghit.set_delayed_time(h->delayed_time, h->delayed_time_error);
+      } else {
+        gghit.set_r(h->r);
+        gghit.set_sigma_r(h->dr);
+      }
+      gghit.set_bottom_cathode_missing(h->missing_bottom_cathode);
+      gghit.set_top_cathode_missing(h->missing_top_cathode);
+      event.push_back(hdl);
+    }
+    events.push_back(std::move(event));
+  });
+
+  return events;
+}
+
+std::vector<mctools::simulated_data> make_simulated_events(std::size_t nEvents, long seed) {
+  const snemo::geometry::gg_locator& ggloc = locators().geigerLocator();
+  const snemo::geometry::calo_locator& caloloc = locators().caloLocator();
+  std::vector<mctools::simulated_data> events;
+  events.reserve(nEvents);
+
+  shoot_events(nEvents, seed, [&](const std::vector<const TrackerPreClustering::gg_hit*>& hits) {
+    events.emplace_back();
+    mctools::simulated_data& sd = events.back();
+    sd.add_step_hits("gg", hits.size());
+    sd.add_step_hits("calo", 2);
+
+    int minRow = static_cast<int>(ggloc.numberOfRows(0));
+    int maxRow = -1;
+    uint32_t side = 0;
+    for (const auto* h : hits) {
+      // Delayed hits have no drift radius, so start them halfway to the cell edge
+      const double r = h->delayed ? 0.25 * ggloc.cellDiameter() : h->r;
+      geomtools::vector_3d stop = world_point_in_cell(ggloc, *h, 0.0);
+      geomtools::geom_id gid;
+      if (!ggloc.findCellGID(stop, gid)) {
+        continue;
+      }
+      mctools::base_step_hit& step = sd.add_step_hit("gg");
+      step.set_hit_id(sd.get_number_of_step_hits("gg") - 1);
+      step.set_geom_id(gid);
+      step.set_position_start(world_point_in_cell(ggloc, *h, r));
+      step.set_position_stop(stop);
+      step.set_time_start(h->delayed ? h->delayed_time : 0.0);
+      step.set_time_stop(step.get_time_start());
+      step.set_track_id(1);
+      step.set_parent_track_id(0);
+      step.set_particle_name("e-");
+      minRow = std::min(minRow, h->row);
+      maxRow = std::max(maxRow, h->row);
+      side = h->side;
+    }
+
+    if (maxRow < 0) {
+      return;
+    }
+
+    // Map Geiger rows onto calorimeter columns of the same side
+    const double rowsPerColumn =
+        static_cast<double>(ggloc.numberOfRows(side)) / caloloc.numberOfColumns(side);
+    const uint32_t caloRow = caloloc.numberOfRows(side) / 2;
+    for (int row : {minRow, maxRow}) {
+      const auto column = std::min(static_cast<uint32_t>(row / rowsPerColumn),
+                                   static_cast<uint32_t>(caloloc.numberOfColumns(side) - 1));
+      geomtools::vector_3d blockCenter =
+          caloloc.transformModuleToWorld(caloloc.getBlockPosition(side, column, caloRow));
+      geomtools::geom_id gid;
+      if (!caloloc.findBlockGID(blockCenter, gid)) {
+        continue;
+      }
+      mctools::base_step_hit& step = sd.add_step_hit("calo");
+      step.set_hit_id(sd.get_number_of_step_hits("calo") - 1);
+      step.set_geom_id(gid);
+      step.set_position_start(blockCenter);
+      step.set_position_stop(blockCenter);
+      step.set_time_start(2.0 * CLHEP::ns);
+      step.set_time_stop(2.5 * CLHEP::ns);
+      step.set_energy_deposit(1.0 * CLHEP::MeV);
+      step.set_track_id(1);
+      step.set_parent_track_id(0);
+      step.set_particle_name("e-");
+    }
+  });
+
+  return events;
+}
+
+}  // namespace benchmarks
+}  // namespace falaise
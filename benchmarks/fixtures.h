@@ -0,0 +1,75 @@
+//! \file fixtures.h
+//! \brief Shared inputs for the Falaise benchmarks
+//
+// This file is part of Falaise.
+//
+// Falaise is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Falaise is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Falaise.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef FALAISE_BENCHMARKS_FIXTURES_H
+#define FALAISE_BENCHMARKS_FIXTURES_H
+
+// Standard Library:
+#include <cstddef>
+#include <vector>
+
+// Third Party:
+#include <bayeux/datatools/properties.h>
+#include <bayeux/datatools/service_manager.h>
+#include <bayeux/geomtools/manager.h>
+#include <bayeux/mctools/simulated_data.h>
+
+// This Project:
+#include "falaise/snemo/datamodels/calibrated_data.h"
+#include "falaise/snemo/geometry/locator_plugin.h"
+
+namespace falaise {
+namespace benchmarks {
+
+//! Seed used for all synthetic inputs, so that runs are comparable across builds
+constexpr long kEventSeed = 314159;
+
+//! Return the service manager holding the demonstrator geometry
+//!
+//! Services are initialized on first use, so that the (slow) geometry
+//! construction happens outside of any timed region as long as the
+//! benchmark calls it before its measurement loop.
+datatools::service_manager& services();
+
+//! Return the geometry manager of the demonstrator
+const geomtools::manager& geometry();
+
+//! Return the SuperNEMO locators of the demonstrator geometry
+const snemo::geometry::locator_plugin& locators();
+
+//! Return the configuration of the CAT clustering, as in the default reconstruction pipeline
+datatools::properties cat_configuration();
+
+//! Generate nEvents collections of calibrated Geiger hits
+//!
+//! Events are shot by the TrackerPreClustering::event_generator and their
+//! cells are placed in module 0 of the demonstrator.
+std::vector<snemo::datamodel::TrackerHitHdlCollection> make_calibrated_events(
+    std::size_t nEvents, long seed = kEventSeed);
+
+//! Generate nEvents simulated events with "gg" and "calo" step hits
+//!
+//! Geiger step hits are made from the same events as make_calibrated_events,
+//! with one calorimeter step hit at each end of the event's hit span.
+std::vector<mctools::simulated_data> make_simulated_events(std::size_t nEvents,
+                                                           long seed = kEventSeed);
+
+}  // namespace benchmarks
+}  // namespace falaise
+
+#endif  // FALAISE_BENCHMARKS_FIXTURES_H
@@ -42,6 +42,9 @@ void setup_data::_set_defaults() {
   level = "normal";
   SuperNemo = true;
   MaxTime = 5000.0 * CLHEP::ms;
+  MaxScenarioTime = 0.0;
+  MaxScenarioCandidates = 0;
+  nthreads = 1;
   SmallRadius = 2.0 * CLHEP::mm;
   TangentPhi = 20.0 * CLHEP::degree;
   TangentTheta = 160.0 * CLHEP::degree;
@@ -80,6 +83,18 @@ bool setup_data::check() const {
 }
 
 bool setup_data::_check_snemo() {
+  if (MaxScenarioTime < 0.0) {
+    _set_error_message("Invalid 'MaxScenarioTime'");
+    return false;
+  }
+  if (MaxScenarioCandidates < 0) {
+    _set_error_message("Invalid 'MaxScenarioCandidates'");
+    return false;
+  }
+  if (nthreads < 1) {
+    _set_error_message("Invalid 'nthreads'");
+    return false;
+  }
   if (SmallRadius <= 0.0) {
     _set_error_message("Invalid 'SmallRadius'");
     return false;
@@ -229,6 +244,9 @@ void sequentiator_configure(sequentiator &stor_, const setup_data &setup_) {
   // General parameters :
   stor_.set_PrintMode(false);
   stor_.set_MaxTime(setup_.MaxTime / CLHEP::ms);
+  stor_.set_MaxScenarioTime(setup_.MaxScenarioTime / CLHEP::ms);
+  stor_.set_MaxScenarioCandidates(setup_.MaxScenarioCandidates);
+  stor_.set_nthreads(setup_.nthreads);
   std::string leveltmp = setup_.level;
   boost::to_upper(leveltmp);
 
@@ -47,6 +47,18 @@ struct setup_data {
   /// Maximum computing time in ms
   double MaxTime;
 
+  /// Maximum computing time in ms of the search for the best scenario of an event
+  /// (default = 0 for no limit but MaxTime)
+  double MaxScenarioTime;
+
+  /// Maximum number of candidate scenarios tried for an event
+  /// (default = 0 for no limit)
+  int MaxScenarioCandidates;
+
+  /// Number of threads sequentiating the clusters of an event
+  /// (default = 1 to sequentiate them serially)
+  int nthreads;
+
   /// Ratio of 2nd best to best probability which is acceptable as 2nd solution
   double Ratio;
 
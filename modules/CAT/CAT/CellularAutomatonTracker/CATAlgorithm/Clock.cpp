@@ -2,107 +2,146 @@
 
 #include <CATAlgorithm/Clock.h>
 #include <algorithm>
+#include <vector>
 
 namespace CAT {
 
 using namespace std;
 
-//! Default constructor
-Clock::Clock() { return; }
-
-//! Default destructor
-Clock::~Clock() { return; }
+namespace {
+// Names of the timers, in the order of their declaration in timers.h
+const char *const timer_names[] = {
+    "Detector: fill_surfaces_rough",
+    "Detector: fill_surfaces_precise",
+    "Detector: draw_surfaces",
+    "Detector: continous",
+    "Sultan: initialize",
+    "Sultan: finalize",
+    "Sultan: read dst properties",
+    "Sultan: read event",
+    "Sultan: make calo hit",
+    "Sultan: prepare event",
+    "Sultan: reconstruct",
+    "Sultan: clusterize",
+    "Sultan: reconstruct_cluster",
+    "Sultan: order cells",
+    "clusterizer: initialize",
+    "clusterizer: finalize",
+    "clusterizer: read dst properties",
+    "clusterizer: read event",
+    "clusterizer: make calo hit",
+    "clusterizer: prepare event",
+    "clusterizer: clusterize",
+    "clusterizer: clusterize_after_sultan",
+    "clusterizer: is good couplet",
+    "clusterizer: get near cells",
+    "clusterizer: setup_clusters",
+    "clusterizer: order cells",
+    "sequentiator: initialize",
+    "sequentiator: finalize",
+    "sequentiator: read dst properties",
+    "sequentiator: sequentiate",
+    "sequentiator: sequentiate_after_sultan",
+    "sequentiator: reconstruct efficiency",
+    "sequentiator: make new sequence",
+    "sequentiator: make new sequence after sultan",
+    "sequentiator: increase_iterations",
+    "sequentiator: build_sequences_from_ambiguous_alternatives",
+    "sequentiator: make copy sequence",
+    "sequentiator: make copy sequence: part A",
+    "sequentiator: make copy sequence: part A: alpha",
+    "sequentiator: copy to lfn",
+    "sequentiator: make copy sequence: part A: beta",
+    "sequentiator: make copy sequence: evolve",
+    "sequentiator: manage copy sequence",
+    "sequentiator: get link index",
+    "sequentiator: set free level",
+    "sequentiator: make copy sequence after sultan",
+    "sequentiator: make copy sequence after sultan: part A",
+    "sequentiator: make copy sequence after sultan: part A: alpha",
+    "sequentiator: make copy sequence after sultan: part A: beta",
+    "sequentiator: make copy sequence after sultan: evolve",
+    "sequentiator: manage copy sequence after sultan",
+    "sequentiator: evolve",
+    "sequentiator: evolve: part A",
+    "sequentiator: evolve: part B",
+    "sequentiator: pick new cell",
+    "sequentiator: evolve: part B: set free level",
+    "sequentiator: evolve: part B: noc",
+    "sequentiator: evolve: part C",
+    "sequentiator: good first node",
+    "sequentiator: make families",
+    "sequentiator: make scenarios",
+    "sequentiator: can add family",
+    "sequentiator: copy logic scenario",
+    "sequentiator: copy scenario",
+    "sequentiator: copy logic sequence",
+    "sequentiator: copy sequence",
+    "sequentiator: calculate scenario",
+    "sequentiator: better scenario",
+    "sequentiator: interpret physics",
+    "sequentiator: interpret physics after sultan",
+    "sequentiator: add pair",
+    "sequentiator: clean up sequences",
+    "sequentiator: direct out of foil",
+    "sequentiator: direct scenarios out of foil",
+    "sequentiator: there is free sequence beginning with",
+    "sequentiator: match gaps",
+    "sequentiator: can match",
+};
+static_assert(sizeof(timer_names) / sizeof(timer_names[0]) ==
+                  static_cast<size_t>(timer::n_timers),
+              "each timer must have a name");
+}  // namespace
 
-void Clock::dump(ostream & /*a_out*/, const std::string & /*a_title*/,
-                 const std::string & /*a_indent*/, bool /*a_inherit*/) const {
-  {
-    // Trick to workaround the constness of the dump method :
-    // because 'this' is const, we cannot modify/sort the 'clockables_' STL collection,
-    // so we use 'mutable_this' :
-    Clock *mutable_this = const_cast<Clock *>(this);
-    std::sort(mutable_this->clockables_.begin(), mutable_this->clockables_.end(),
-              clockable::compare);
-  }
-  double max = clockables_.begin()->time_;
+const char *timer_name(timer t) { return timer_names[static_cast<size_t>(t)]; }
 
+//! Default constructor
+Clock::Clock() : enabled_(CAT_WITH_TIMERS) {
   for (size_t i = 0; i < clockables_.size(); i++) {
-    this->clockables_[i].dump(max);
+    clockables_[i].set_name(timer_names[i]);
   }
   return;
 }
 
-std::vector<clockable> &Clock::clockables() { return clockables_; }
+//! Default destructor
+Clock::~Clock() { return; }
 
-bool Clock::has(const std::string &name, size_t *index) const {
-  for (std::vector<clockable>::const_iterator iclock = clockables_.begin();
-       iclock != clockables_.end(); ++iclock) {
-    if (iclock->name() == name) {
-      *index = iclock - clockables_.begin();
-      return true;
-    }
+void Clock::dump(ostream &a_out, const std::string & /* a_title */,
+                 const std::string & /* a_indent */, bool /* a_inherit */) const {
+  // counters which never ran are not printed, by decreasing time
+  std::vector<const clockable *> ran;
+  for (const clockable &c : clockables_) {
+    if (c.calls_ > 0) ran.push_back(&c);
   }
-  return false;
-}
+  if (ran.empty()) return;
+  std::sort(ran.begin(), ran.end(), [](const clockable *c1, const clockable *c2) {
+    return clockable::compare(*c1, *c2);
+  });
 
-void Clock::start(const std::string &name, const std::string &mode) {
-  if (mode == "once") {
-    size_t index = 0;
-    if (has(name, &index)) {
-      std::clog << "CAT::Clock::start: problem: starting a clockable " << name
-                << " which is already there " << index << std::endl;
-      clockables()[index].start();
-    } else {
-      clockable newc(name);
-      clockables_.push_back(newc);
-      size_t s = clockables().size();
-      clockables()[s - 1].start();
-    }
-  } else if (mode == "cumulative") {
-    size_t index = 0;
-    if (has(name, &index))
-      clockables()[index].start();
-    else {
-      clockable newc(name);
-      clockables_.push_back(newc);
-      size_t s = clockables().size();
-      clockables()[s - 1].start();
-    }
-  } else if (mode == "restart") {
-    size_t index = 0;
-    if (has(name, &index)) {
-      clockables()[index].restart();
-    } else {
-      clockable newc(name);
-      clockables_.push_back(newc);
-      size_t s = clockables().size();
-      clockables()[s - 1].start();
-    }
+  double max = ran.front()->time_;
+  for (const clockable *c : ran) {
+    c->dump(max, a_out);
   }
   return;
 }
 
-void Clock::stop(const std::string &name) {
-  size_t index;
-  if (has(name, &index))
-    clockables()[index].stop();
-  else
-    std::clog << "CAT::Clock::stop: problem: can't stop clockable " << name
-              << " which is not there " << std::endl;
+void Clock::stop_all() {
+  for (clockable &c : clockables_) c.stop();
 }
 
-double Clock::read(const std::string &name) {
-  size_t index;
-  if (has(name, &index)) return clockables()[index].read();
-
-  std::clog << "CAT::Clock::stop: problem: request time of clockable " << name
-            << " which is not there " << std::endl;
-  return 0;
+void Clock::reset() {
+  for (clockable &c : clockables_) {
+    c = clockable(c.name());
+  }
 }
 
-void Clock::stop_all() {
-  for (std::vector<clockable>::iterator iclock = clockables_.begin(); iclock != clockables_.end();
-       ++iclock)
-    iclock->stop();
+void Clock::add(const Clock &other) {
+  for (size_t i = 0; i < clockables_.size(); i++) {
+    clockables_[i].time_ += other.clockables_[i].time_;
+    clockables_[i].lap_ += other.clockables_[i].lap_;
+    clockables_[i].calls_ += other.clockables_[i].calls_;
+  }
 }
 
 }  // namespace CAT
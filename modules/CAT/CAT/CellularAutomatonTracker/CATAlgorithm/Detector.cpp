@@ -106,7 +106,7 @@ void Detector::fill_surfaces_rough(std::vector<Cell>* cs) {
   // fill the rough histogram with all the legendre surfaces
   // belonging to each cell in cs
 
-  clock.start(" Detector: fill_surfaces_rough ", "cumulative");
+  clock.start(timer::detector_fill_surfaces_rough);
 
   m.message(" build rough surfaces for ", cs->size(), " cells ", mybhep::VERBOSE);
 
@@ -128,14 +128,14 @@ void Detector::fill_surfaces_rough(std::vector<Cell>* cs) {
     }
   }
 
-  clock.stop(" Detector: fill_surfaces_rough ");
+  clock.stop(timer::detector_fill_surfaces_rough);
 }
 
 void Detector::fill_surfaces_precise(Circle* h, std::vector<Cell>* cs) {
   // fill the precise histogram with all the legendre surfaces
   // belonging to each cell in cs
 
-  clock.start(" Detector: fill_surfaces_precise ", "cumulative");
+  clock.start(timer::detector_fill_surfaces_precise);
 
   m.message(" build precise surfaces for ", cs->size(), " cells ", mybhep::VERBOSE);
 
@@ -173,7 +173,7 @@ void Detector::fill_surfaces_precise(Circle* h, std::vector<Cell>* cs) {
     }
   }
 
-  clock.stop(" Detector: fill_surfaces_precise ");
+  clock.stop(timer::detector_fill_surfaces_precise);
 }
 
 void Detector::set_messenger(mybhep::prlevel l) {
@@ -182,7 +182,7 @@ void Detector::set_messenger(mybhep::prlevel l) {
 }
 
 void Detector::draw_surfaces(Circle* h, std::vector<Cell>* cs, size_t itrack) {
-  clock.start(" Detector: draw_surfaces ", "cumulative");
+  clock.start(timer::detector_draw_surfaces);
 
   double X0, Y0, R, sigma_X0, sigma_Y0, sigma_R;
   int ixmax_rough, iymax_rough, irmax_rough, ixmax_precise, iymax_precise, irmax_precise;
@@ -275,13 +275,13 @@ void Detector::draw_surfaces(Circle* h, std::vector<Cell>* cs, size_t itrack) {
     }
   }
 
-  clock.stop(" Detector: draw_surfaces ");
+  clock.stop(timer::detector_draw_surfaces);
 }
 
 bool Detector::continous(std::vector<Cell>* cs) {
   // check if cells in cs form a continous strip
 
-  clock.start(" Detector: continous ", "cumulative");
+  clock.start(timer::detector_continous);
 
   size_t n_breaks = 0;
   size_t next_index;
@@ -302,7 +302,7 @@ bool Detector::continous(std::vector<Cell>* cs) {
   m.message(" the ", cs->size(), " cells have ", n_breaks, " breaks, continous: ", ok,
             mybhep::VERBOSE);
 
-  clock.stop(" Detector: continous ");
+  clock.stop(timer::detector_continous);
 
   return ok;
 }
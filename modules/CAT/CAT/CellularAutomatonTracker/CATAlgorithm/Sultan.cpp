@@ -152,7 +152,7 @@ bool Sultan::initialize(const mybhep::sstore& store, const mybhep::gstore& /*gs*
   m.message("\n Beginning algorithm Sultan \n", mybhep::VERBOSE);
   fflush(stdout);
 
-  clock.start(" Sultan: initialize ");
+  clock.start(timer::sultan_initialize);
 
   //----------- read dst param -------------//
 
@@ -162,7 +162,7 @@ bool Sultan::initialize(const mybhep::sstore& store, const mybhep::gstore& /*gs*
 
   _initialize();
 
-  clock.stop(" Sultan: initialize ");
+  clock.stop(timer::sultan_initialize);
 
   return true;
 }
@@ -192,7 +192,7 @@ bool Sultan::initialize() {
 bool Sultan::finalize() {
   //*************************************************************
 
-  clock.start(" Sultan: finalize ");
+  clock.start(timer::sultan_finalize);
 
   m.message("\n Ending algorithm Sultan \n ", mybhep::NORMAL);
 
@@ -200,7 +200,7 @@ bool Sultan::finalize() {
   m.message("Skipped events: ", SkippedEvents, "(", 100. * SkippedEvents / InitialEvents, "%)",
             mybhep::NORMAL);
 
-  clock.stop(" Sultan: finalize ");
+  clock.stop(timer::sultan_finalize);
 
   detector_.finalize();
   clock.dump();
@@ -213,7 +213,7 @@ bool Sultan::finalize() {
 void Sultan::readDstProper(const mybhep::sstore& global, mybhep::EventManager2* /*eman*/) {
   //*************************************************************
 
-  clock.start(" Sultan: read dst properties ");
+  clock.start(timer::sultan_read_dst_properties);
 
   if (!global.find("GEOM_MODULES")) {
     _MaxBlockSize = 1;
@@ -386,7 +386,7 @@ void Sultan::readDstProper(const mybhep::sstore& global, mybhep::EventManager2*
     }
   }
 
-  clock.stop(" Sultan: read dst properties ");
+  clock.stop(timer::sultan_read_dst_properties);
 
   return;
 }
@@ -803,7 +803,7 @@ size_t Sultan::get_calo_hit_index(const topology::calorimeter_hit& c) {
 bool Sultan::read_event(mybhep::event& event_ref, topology::Tracked_data& tracked_data_) {
   //*******************************************************************
 
-  clock.start(" Sultan: read event ", "cumulative");
+  clock.start(timer::sultan_read_event);
 
   m.message(" sultan: reading event", mybhep::VERBOSE);
 
@@ -870,13 +870,13 @@ bool Sultan::read_event(mybhep::event& event_ref, topology::Tracked_data& tracke
       cells_.push_back(c);
     }
 
-    clock.start(" Sultan: make calo hit ", "cumulative");
+    clock.start(timer::sultan_make_calo_hit);
     const std::vector<mybhep::hit*>& chits = parts[0]->hits("cal");
     for (size_t ihit = 0; ihit < chits.size(); ihit++) {
       topology::calorimeter_hit ch = make_calo_hit(*chits[ihit], ihit);
       calorimeter_hits_.push_back(ch);
     }
-    clock.stop(" Sultan: make calo hit ");
+    clock.stop(timer::sultan_make_calo_hit);
 
     if (level >= mybhep::VVERBOSE) print_calos();
 
@@ -897,7 +897,7 @@ bool Sultan::read_event(mybhep::event& event_ref, topology::Tracked_data& tracke
 
   tracked_data_.set_nemo_sequences(nemo_sequences_);
 
-  clock.stop(" Sultan: read event ");
+  clock.stop(timer::sultan_read_event);
 
   return true;
 }
@@ -906,7 +906,7 @@ bool Sultan::read_event(mybhep::event& event_ref, topology::Tracked_data& tracke
 bool Sultan::prepare_event(topology::Tracked_data& tracked_data_) {
   //*******************************************************************
 
-  clock.start(" Sultan: prepare event ", "cumulative");
+  clock.start(timer::sultan_prepare_event);
 
   event_number++;
 
@@ -930,7 +930,7 @@ bool Sultan::prepare_event(topology::Tracked_data& tracked_data_) {
   tracked_data_.set_cells(cells_);
   detector_.set_cells(cells_);
 
-  clock.stop(" Sultan: prepare event ");
+  clock.stop(timer::sultan_prepare_event);
 
   return true;
 }
@@ -1114,7 +1114,7 @@ void Sultan::reconstruct(topology::Tracked_data& tracked_data_) {
 
   if (event_number < first_event_number) return;
 
-  clock.start(" Sultan: reconstruct ", "cumulative");
+  clock.start(timer::sultan_reconstruct);
 
   clusterize();
 
@@ -1129,7 +1129,7 @@ void Sultan::reconstruct(topology::Tracked_data& tracked_data_) {
   m.message(" sultan: reconstructed ", tracked_data_.get_sequences().size(), "tracks, leaving ",
             tracked_data_.get_unclustered_cells().size(), " unclustered hits", mybhep::VERBOSE);
 
-  clock.stop(" Sultan: reconstruct ");
+  clock.stop(timer::sultan_reconstruct);
 }
 
 //*******************************************************************
@@ -1140,7 +1140,7 @@ void Sultan::clusterize(void) {
   // - all have the same time character (fast or slow)
   // - are near some other cell in the cluster
 
-  clock.start(" Sultan: clusterize ", "cumulative");
+  clock.start(timer::sultan_clusterize);
 
   m.message(" sultan: fill clusters ", mybhep::VERBOSE);
 
@@ -1202,7 +1202,7 @@ void Sultan::clusterize(void) {
 
   m.message(" there are ", clusters_.size(), " clusters ", mybhep::VERBOSE);
 
-  clock.stop(" Sultan: clusterize ");
+  clock.stop(timer::sultan_clusterize);
 
   return;
 }
@@ -1211,7 +1211,7 @@ void Sultan::clusterize(void) {
 void Sultan::reconstruct_cluster(const std::vector<topology::Cell>& cluster) {
   //*******************************************************************
 
-  clock.start(" Sultan: reconstruct_cluster ", "cumulative");
+  clock.start(timer::sultan_reconstruct_cluster);
 
   m.message(" reconstruct cluster with ", cluster.size(), " cells ", mybhep::VERBOSE);
 
@@ -1275,7 +1275,7 @@ void Sultan::reconstruct_cluster(const std::vector<topology::Cell>& cluster) {
   delete phis;
   delete zs;
 
-  clock.stop(" Sultan: reconstruct_cluster ");
+  clock.stop(timer::sultan_reconstruct_cluster);
 
   return;
 }
@@ -1521,7 +1521,7 @@ topology::calorimeter_hit Sultan::make_calo_hit(const mybhep::hit& ahit, size_t
 void Sultan::order_cells() {
   //*************************************************************
 
-  clock.start(" Sultan: order cells ", "cumulative");
+  clock.start(timer::sultan_order_cells);
 
   if (cells_.size()) {
     if (level >= mybhep::VVERBOSE) {
@@ -1534,7 +1534,7 @@ void Sultan::order_cells() {
     std::sort(cells_.begin(), cells_.end());
   }
 
-  clock.stop(" Sultan: order cells ");
+  clock.stop(timer::sultan_order_cells);
 
   return;
 }
@@ -38,6 +38,12 @@ class broken_line : public tracking_object {
   //! Default destructor
   virtual ~broken_line();
 
+  //! copy and move constructors and assignments
+  broken_line(const broken_line &) = default;
+  broken_line(broken_line &&) = default;
+  broken_line &operator=(const broken_line &) = default;
+  broken_line &operator=(broken_line &&) = default;
+
   //! constructor
   broken_line(const std::vector<experimental_point> &eps, mybhep::prlevel level = mybhep::NORMAL,
               double probmin = 1.e-200);
@@ -29,8 +29,9 @@ experimental_point cell::build_from_cell(experimental_vector forward,
   return p;
 }
 
-experimental_point cell::angular_average(experimental_point epa, experimental_point epb,
-                                         experimental_double* angle) {
+experimental_point cell::angular_average(const experimental_point& epa,
+                                         const experimental_point& epb,
+                                         experimental_double* angle) const {
   if (print_level() >= mybhep::VVERBOSE)
     std::clog << "CAT::cell::angular_average: calculating angular average for cell " << id()
               << std::endl;
@@ -87,6 +87,12 @@ class cell : public tracking_object {
   //! Default destructor
   virtual ~cell(){};
 
+  //! copy and move constructors and assignments
+  cell(const cell &) = default;
+  cell(cell &&) = default;
+  cell &operator=(const cell &) = default;
+  cell &operator=(cell &&) = default;
+
   //! constructor
   cell(experimental_point& p, experimental_double r, size_t id, bool fast = true,
        double probmin = 1.e-200, mybhep::prlevel level = mybhep::NORMAL) {
@@ -401,7 +407,7 @@ class cell : public tracking_object {
   bool begun() const { return begun_; }
 
   //! get type
-  std::string type() { return type_; }
+  const std::string& type() const { return type_; }
 
   //! get cell number
   int cell_number() const {
@@ -429,8 +435,8 @@ class cell : public tracking_object {
 
  public:
   experimental_double distance(cell c) const;
-  experimental_point angular_average(experimental_point epa, experimental_point epb,
-                                     experimental_double* angle);
+  experimental_point angular_average(const experimental_point& epa, const experimental_point& epb,
+                                     experimental_double* angle) const;
   experimental_point build_from_cell(experimental_vector forward, experimental_vector transverse,
                                      experimental_double cos, int sign, bool replace_r,
                                      double maxr) const;
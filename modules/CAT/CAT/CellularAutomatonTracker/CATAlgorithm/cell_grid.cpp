@@ -0,0 +1,98 @@
+/* -*- mode: c++ -*- */
+
+#include <CATAlgorithm/cell_grid.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace CAT {
+namespace topology {
+
+namespace {
+// Largest number of bins built; the SuperNEMO tracker needs 2 x 9 x 113
+const long max_bins = 1L << 20;
+}  // namespace
+
+cell_grid::cell_grid()
+    : min_block_(0), min_layer_(0), min_iid_(0), n_blocks_(0), n_layers_(0), n_iids_(0) {}
+
+bool cell_grid::build(const std::vector<cell>& cells) {
+  clear();
+  if (cells.empty()) return true;
+
+  int max_block = cells.front().block();
+  int max_layer = std::abs(cells.front().layer());
+  int max_iid = cells.front().iid();
+  min_block_ = max_block;
+  min_layer_ = max_layer;
+  min_iid_ = max_iid;
+  for (std::vector<cell>::const_iterator icell = cells.begin(); icell != cells.end(); ++icell) {
+    min_block_ = std::min(min_block_, icell->block());
+    max_block = std::max(max_block, icell->block());
+    min_layer_ = std::min(min_layer_, std::abs(icell->layer()));
+    max_layer = std::max(max_layer, std::abs(icell->layer()));
+    min_iid_ = std::min(min_iid_, icell->iid());
+    max_iid = std::max(max_iid, icell->iid());
+  }
+
+  const long n_blocks = long(max_block) - min_block_ + 1;
+  const long n_layers = long(max_layer) - min_layer_ + 1;
+  const long n_iids = long(max_iid) - min_iid_ + 1;
+  if (n_blocks > max_bins || n_layers > max_bins || n_iids > max_bins ||
+      n_blocks * n_layers * n_iids > max_bins) {
+    clear();
+    return false;
+  }
+  n_blocks_ = n_blocks;
+  n_layers_ = n_layers;
+  n_iids_ = n_iids;
+
+  // counting sort of the cell indices by bin
+  start_.assign(n_blocks * n_layers * n_iids + 1, 0);
+  for (std::vector<cell>::const_iterator icell = cells.begin(); icell != cells.end(); ++icell) {
+    start_[bin(icell->block(), std::abs(icell->layer()), icell->iid()) + 1]++;
+  }
+  for (size_t b = 1; b < start_.size(); b++) {
+    start_[b] += start_[b - 1];
+  }
+  indices_.resize(cells.size());
+  std::vector<size_t> next(start_.begin(), start_.end() - 1);
+  for (size_t i = 0; i < cells.size(); i++) {
+    indices_[next[bin(cells[i].block(), std::abs(cells[i].layer()), cells[i].iid())]++] = i;
+  }
+  return true;
+}
+
+void cell_grid::clear() {
+  n_blocks_ = 0;
+  n_layers_ = 0;
+  n_iids_ = 0;
+  start_.clear();
+  indices_.clear();
+}
+
+bool cell_grid::empty() const { return start_.empty(); }
+
+long cell_grid::bin(int block, int layer, int iid) const {
+  const long b = long(block) - min_block_;
+  const long l = long(layer) - min_layer_;
+  const long r = long(iid) - min_iid_;
+  if (b < 0 || b >= n_blocks_ || l < 0 || l >= n_layers_ || r < 0 || r >= n_iids_) return -1;
+  return (b * n_layers_ + l) * n_iids_ + r;
+}
+
+void cell_grid::neighbours(const cell& c, std::vector<size_t>& near) const {
+  near.clear();
+  const int layer = std::abs(c.layer());
+  for (int dl = -1; dl <= 1; dl++) {
+    for (int dr = -1; dr <= 1; dr++) {
+      const long b = bin(c.block(), layer + dl, c.iid() + dr);
+      if (b < 0) continue;
+      near.insert(near.end(), indices_.begin() + start_[b], indices_.begin() + start_[b + 1]);
+    }
+  }
+  std::sort(near.begin(), near.end());
+}
+
+}  // namespace topology
+}  // namespace CAT
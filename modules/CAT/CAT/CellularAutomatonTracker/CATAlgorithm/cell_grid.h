@@ -0,0 +1,55 @@
+/* -*- mode: c++ -*- */
+#ifndef __CATAlgorithm__cell_grid_h
+#define __CATAlgorithm__cell_grid_h 1
+
+#include <cstddef>
+#include <vector>
+#include <CATAlgorithm/cell_base.h>
+
+namespace CAT {
+namespace topology {
+
+class cell_grid {
+  // a cell_grid indexes the cells of an event by (block, |layer|, iid), so
+  // that the cells around a given one are read from at most 9 bins instead
+  // of scanning all the cells
+
+ public:
+  //! Default constructor
+  cell_grid();
+
+  //! index cells, returns false (leaving the grid empty) if their
+  //! coordinates span a grid too large to be worth building
+  bool build(const std::vector<cell>& cells);
+
+  //! forget the indexed cells
+  void clear();
+
+  //! true if no cells are indexed
+  bool empty() const;
+
+  //! set near to the indices of the cells in the same block within one
+  //! layer and one iid of c, in increasing order. The result includes c
+  //! itself and any other cell at its position
+  void neighbours(const cell& c, std::vector<size_t>& near) const;
+
+ private:
+  //! bin of (block, layer, iid), or -1 if outside the grid
+  long bin(int block, int layer, int iid) const;
+
+  int min_block_;
+  int min_layer_;
+  int min_iid_;
+  int n_blocks_;
+  int n_layers_;
+  int n_iids_;
+
+  // cells of bin b are indices_[start_[b]] ... indices_[start_[b+1]-1]
+  std::vector<size_t> start_;
+  std::vector<size_t> indices_;
+};
+
+}  // namespace topology
+}  // namespace CAT
+
+#endif
@@ -67,6 +67,12 @@ class cell_triplet : public tracking_object {
   //! Default destructor
   virtual ~cell_triplet();
 
+  //! copy and move constructors and assignments
+  cell_triplet(const cell_triplet &) = default;
+  cell_triplet(cell_triplet &&) = default;
+  cell_triplet &operator=(const cell_triplet &) = default;
+  cell_triplet &operator=(cell_triplet &&) = default;
+
   //! constructor
   cell_triplet(cell_couplet &cca, cell_couplet &ccb);
 
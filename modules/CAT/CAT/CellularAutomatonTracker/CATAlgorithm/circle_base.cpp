@@ -433,8 +433,8 @@ bool circle::intersect_circle(circle c, experimental_point *ep, experimental_dou
   return true;
 }
 
-void circle::point_of_max_min_radius(experimental_point epa, experimental_point epb,
-                                     experimental_point *epmax, experimental_point *epmin) {
+void circle::point_of_max_min_radius(const experimental_point &epa, const experimental_point &epb,
+                                     experimental_point *epmax, experimental_point *epmin) const {
   // get the points of max and min radius (from the origin) along the arc of circle between epa and
   // epb
 
@@ -37,6 +37,12 @@ class circle : public tracking_object {
   //! Default destructor
   virtual ~circle();
 
+  //! copy and move constructors and assignments
+  circle(const circle &) = default;
+  circle(circle &&) = default;
+  circle &operator=(const circle &) = default;
+  circle &operator=(circle &&) = default;
+
   //! constructor
   circle(const experimental_point &center, const experimental_double &radius,
          mybhep::prlevel level = mybhep::NORMAL, double probmin = 1.e-200);
@@ -90,8 +96,8 @@ class circle : public tracking_object {
 
   // get the points of max and min radius (from the origin) along the arc of circle between epa and
   // epb
-  void point_of_max_min_radius(experimental_point epa, experimental_point epb,
-                               experimental_point *epmax, experimental_point *epmin);
+  void point_of_max_min_radius(const experimental_point &epa, const experimental_point &epb,
+                               experimental_point *epmax, experimental_point *epmin) const;
 };
 
 // average
@@ -3,48 +3,73 @@
 #ifndef __CATAlgorithm__clockable_h
 #define __CATAlgorithm__clockable_h 1
 
+#include <chrono>
+#include <cstddef>
 #include <iostream>
 #include <string>
-#include <sys/time.h>
 
 namespace CAT {
 
 class clockable {
   // a clockable is a time counter
 
-  struct timeval tv_begin_, tv_end_;
-  struct timezone tz_begin_, tz_end_;
+  std::chrono::steady_clock::time_point begin_;
+  bool running_;
 
- public:
-  std::string name_;
+  // name of the counter, a string literal
+  const char* name_;
 
+ public:
   // time in milliseconds
   double time_;
 
-  //! Default constructor
-  clockable(std::string name = "default");
+  // time in milliseconds accumulated since the last call to lap()
+  double lap_;
 
-  //! Default destructor
-  virtual ~clockable();
+  // number of times the counter was stopped
+  std::size_t calls_;
+
+  //! Default constructor
+  explicit clockable(const char* name = "default");
 
-  virtual void dump(double max = 1., std::ostream& a_out = std::clog,
-                    const std::string& a_title = "", const std::string& a_indent = "",
-                    bool a_inherit = false) const;
+  void dump(double max = 1., std::ostream& a_out = std::clog, const std::string& a_title = "",
+            const std::string& a_indent = "", bool a_inherit = false) const;
 
   //! set name
-  void set_name(std::string name);
+  void set_name(const char* name);
 
   //! get name
-  const std::string& name() const;
-
-  //! read time
-  double read();
-
-  void start();
-
-  void restart();
-
-  void stop();
+  const char* name() const;
+
+  //! read time, including the time elapsed since the last start if running
+  double read() const;
+
+  void start() {
+    begin_ = std::chrono::steady_clock::now();
+    running_ = true;
+  }
+
+  void restart() {
+    time_ = 0.;
+    start();
+  }
+
+  void stop() {
+    if (!running_) return;
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - begin_;
+    time_ += elapsed.count();
+    lap_ += elapsed.count();
+    ++calls_;
+    running_ = false;
+  }
+
+  //! return the time accumulated since the previous call, and restart accumulating
+  double lap() {
+    const double t = lap_;
+    lap_ = 0.;
+    return t;
+  }
 
   static bool compare(const clockable& c1, const clockable& c2);
 };
@@ -41,6 +41,12 @@ class cluster : public tracking_object {
   //! Default destructor
   virtual ~cluster();
 
+  //! copy and move constructors and assignments
+  cluster(const cluster &) = default;
+  cluster(cluster &&) = default;
+  cluster &operator=(const cluster &) = default;
+  cluster &operator=(cluster &&) = default;
+
   //! constructor from std::vector of nodes
   cluster(const std::vector<node> &nodes, mybhep::prlevel level = mybhep::NORMAL,
           double probmin = 1.e-200);
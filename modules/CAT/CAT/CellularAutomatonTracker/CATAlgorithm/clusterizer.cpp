@@ -195,7 +195,7 @@ bool clusterizer::initialize(const mybhep::sstore& store, const mybhep::gstore&
 
   m.message("CAT::clusterizer::initialize: Beginning algorithm clusterizer \n", mybhep::VERBOSE);
 
-  clock.start(" clusterizer: initialize ");
+  clock.start(timer::clusterizer_initialize);
 
   //----------- read dst param -------------//
 
@@ -205,7 +205,7 @@ bool clusterizer::initialize(const mybhep::sstore& store, const mybhep::gstore&
 
   _initialize();
 
-  clock.stop(" clusterizer: initialize ");
+  clock.stop(timer::clusterizer_initialize);
 
   return true;
 }
@@ -224,6 +224,9 @@ bool clusterizer::initialize() {
 
   //------- end of read pram -----------//
 
+  // the clocks are dumped at finalize, and are only operated when verbose
+  clock.set_enabled(level >= mybhep::VERBOSE);
+
   _initialize();
 
   m.message("CAT::clusterizer::initialize: Done.", mybhep::NORMAL);
@@ -248,7 +251,7 @@ void clusterizer::initializeHistos(void) {
 bool clusterizer::finalize() {
   //*************************************************************
 
-  clock.start(" clusterizer: finalize ");
+  clock.start(timer::clusterizer_finalize);
 
   m.message("CAT::clusterizer::finalize: Ending algorithm clusterizer...", mybhep::NORMAL);
 
@@ -259,7 +262,7 @@ bool clusterizer::finalize() {
   if (PrintMode) {
     finalizeHistos();
   }
-  clock.stop(" clusterizer: finalize ");
+  clock.stop(timer::clusterizer_finalize);
 
   if (level >= mybhep::NORMAL) {
     clock.dump();
@@ -285,7 +288,7 @@ void clusterizer::finalizeHistos(void) {
 void clusterizer::readDstProper(const mybhep::sstore& global, mybhep::EventManager2* /*eman */) {
   //*************************************************************
 
-  clock.start(" clusterizer: read dst properties ");
+  clock.start(timer::clusterizer_read_dst_properties);
 
   if (!global.find("GEOM_MODULES")) {
     _MaxBlockSize = 1;
@@ -496,7 +499,7 @@ void clusterizer::readDstProper(const mybhep::sstore& global, mybhep::EventManag
     }
   }
 
-  clock.stop(" clusterizer: read dst properties ");
+  clock.stop(timer::clusterizer_read_dst_properties);
 
   return;
 }
@@ -958,7 +961,7 @@ size_t clusterizer::get_calo_hit_index(const topology::calorimeter_hit& c) {
 bool clusterizer::read_event(mybhep::event& event_ref, topology::tracked_data& tracked_data_) {
   //*******************************************************************
 
-  clock.start(" clusterizer: read event ", "cumulative");
+  clock.start(timer::clusterizer_read_event);
 
   m.message("CAT::clusterizer::read_event: local_tracking: reading event", mybhep::VERBOSE);
 
@@ -1027,13 +1030,13 @@ bool clusterizer::read_event(mybhep::event& event_ref, topology::tracked_data& t
       cells_.push_back(c);
     }
 
-    clock.start(" clusterizer: make calo hit ", "cumulative");
+    clock.start(timer::clusterizer_make_calo_hit);
     const std::vector<mybhep::hit*>& chits = parts[0]->hits("cal");
     for (size_t ihit = 0; ihit < chits.size(); ihit++) {
       topology::calorimeter_hit ch = make_calo_hit(*chits[ihit], ihit);
       calorimeter_hits_.push_back(ch);
     }
-    clock.stop(" clusterizer: make calo hit ");
+    clock.stop(timer::clusterizer_make_calo_hit);
 
     if (level >= mybhep::VVERBOSE) print_calos();
 
@@ -1054,7 +1057,7 @@ bool clusterizer::read_event(mybhep::event& event_ref, topology::tracked_data& t
 
   tracked_data_.set_nemo_sequences(nemo_sequences_);
 
-  clock.stop(" clusterizer: read event ");
+  clock.stop(timer::clusterizer_read_event);
 
   return true;
 }
@@ -1063,7 +1066,7 @@ bool clusterizer::read_event(mybhep::event& event_ref, topology::tracked_data& t
 bool clusterizer::prepare_event(topology::tracked_data& tracked_data_) {
   //*******************************************************************
 
-  clock.start(" clusterizer: prepare event ", "cumulative");
+  clock.start(timer::clusterizer_prepare_event);
 
   event_number++;
   m.message("CAT::clusterizer::prepare_event: local_tracking: preparing event", event_number,
@@ -1084,7 +1087,7 @@ bool clusterizer::prepare_event(topology::tracked_data& tracked_data_) {
   tracked_data_.set_cells(cells_);
   tracked_data_.set_calos(calorimeter_hits_);
 
-  clock.stop(" clusterizer: prepare event ");
+  clock.stop(timer::clusterizer_prepare_event);
 
   return true;
 }
@@ -1282,7 +1285,7 @@ void clusterizer::clusterize(topology::tracked_data& tracked_data_) {
 
   if (event_number < first_event_number) return;
 
-  clock.start(" clusterizer: clusterize ", "cumulative");
+  clock.start(timer::clusterizer_clusterize);
 
   m.message("CAT::clusterizer::clusterize: local_tracking: fill clusters ", mybhep::VERBOSE);
 
@@ -1302,24 +1305,30 @@ void clusterizer::clusterize(topology::tracked_data& tracked_data_) {
   fast[0] = true;
   fast[1] = false;
 
-  std::map<int, unsigned int> flags;
+  // cells already added to a cluster, by index in cells_
+  std::vector<bool> flags;
+
+  // neighbours are found by position in SuperNEMO, where near_level only
+  // depends on it, and by scanning all the cells otherwise
+  if (SuperNemo) {
+    cell_grid_.build(cells_);
+  } else {
+    cell_grid_.clear();
+  }
 
   for (size_t ip = 0; ip < 2; ip++)  // loop on two sides of the foil
   {
     for (size_t iq = 0; iq < 2; iq++)  // loop on fast and slow hits
     {
-      for (size_t i = 0; i < cells_.size(); i++) {
-        flags[cells_[i].id()] = 0;
-      }
+      flags.assign(cells_.size(), false);
 
-      for (std::vector<topology::cell>::const_iterator icell = cells_.begin();
-           icell != cells_.end(); ++icell) {
+      for (size_t ic = 0; ic < cells_.size(); ic++) {
         // pick a cell c that was never added
-        const topology::cell& c = *icell;
+        const topology::cell& c = cells_[ic];
         if ((cell_side(c) * side[ip]) < 0) continue;
         if (c.fast() != fast[iq]) continue;
-        if (flags[c.id()] == 1) continue;
-        flags[c.id()] = 1;
+        if (flags[ic]) continue;
+        flags[ic] = true;
 
         // cell c will form a new cluster, i.e. a new list of nodes
         topology::cluster cluster_connected_to_c;
@@ -1329,28 +1338,29 @@ void clusterizer::clusterize(topology::tracked_data& tracked_data_) {
 
         // let's get the list of all the cells that can be reached from c
         // without jumps
-        std::vector<topology::cell> cells_connected_to_c;
-        cells_connected_to_c.push_back(c);
+        std::vector<size_t> cells_connected_to_c;
+        cells_connected_to_c.push_back(ic);
 
+        std::vector<size_t> cells_near_iconn;
         for (size_t i = 0; i < cells_connected_to_c.size(); i++) {  // loop on connected cells
           // take a connected cell (the first one is just c)
-          topology::cell cconn = cells_connected_to_c[i];
+          const topology::cell& cconn = cells_[cells_connected_to_c[i]];
 
           // the connected cell composes a new node
           topology::node newnode(cconn, level, probmin);
           std::vector<topology::cell_couplet> cc;
 
           // get the list of cells near the connected cell
-          std::vector<topology::cell> cells_near_iconn = get_near_cells(cconn);
+          get_near_cells(cconn, cells_near_iconn);
 
           m.message("CAT::clusterizer::clusterize: cluster ", clusters_.size(), " starts with ",
                     c.id(), " try to add cell ", cconn.id(),
                     " with n of neighbours = ", cells_near_iconn.size(), mybhep::VERBOSE);
-          for (std::vector<topology::cell>::const_iterator icnc = cells_near_iconn.begin();
+          for (std::vector<size_t>::const_iterator icnc = cells_near_iconn.begin();
                icnc != cells_near_iconn.end(); ++icnc) {
-            topology::cell cnc = *icnc;
+            const topology::cell& cnc = cells_[*icnc];
 
-            if (!is_good_couplet(&cconn, cnc, cells_near_iconn)) continue;
+            if (!is_good_couplet(cconn, cnc, cells_near_iconn)) continue;
 
             topology::cell_couplet ccnc(cconn, cnc, level, probmin);
             cc.push_back(ccnc);
@@ -1358,9 +1368,9 @@ void clusterizer::clusterize(topology::tracked_data& tracked_data_) {
             m.message("CAT::clusterizer::clusterize: ... creating couplet ", cconn.id(), " -> ",
                       cnc.id(), mybhep::VERBOSE);
 
-            if (flags[cnc.id()] != 1) {
-              flags[cnc.id()] = 1;
-              cells_connected_to_c.push_back(cnc);
+            if (!flags[*icnc]) {
+              flags[*icnc] = true;
+              cells_connected_to_c.push_back(*icnc);
             }
           }
           newnode.set_cc(cc);
@@ -1393,7 +1403,7 @@ void clusterizer::clusterize(topology::tracked_data& tracked_data_) {
   tracked_data_.set_cells(cells_);
   tracked_data_.set_clusters(clusters_);
 
-  clock.stop(" clusterizer: clusterize ");
+  clock.stop(timer::clusterizer_clusterize);
 
   return;
 }
@@ -1404,7 +1414,7 @@ void clusterizer::clusterize_after_sultan(topology::tracked_data& tracked_data_)
 
   if (event_number < first_event_number) return;
 
-  clock.start(" clusterizer: clusterize_after_sultan ", "cumulative");
+  clock.start(timer::clusterizer_clusterize_after_sultan);
 
   m.message("CAT::clusterizer::clusterize_after_sultan: local_tracking: fill clusters ",
             mybhep::VERBOSE);
@@ -1478,7 +1488,7 @@ void clusterizer::clusterize_after_sultan(topology::tracked_data& tracked_data_)
     print_clusters();
   }
 
-  clock.stop(" clusterizer: clusterize_after_sultan ");
+  clock.stop(timer::clusterizer_clusterize_after_sultan);
 
   return;
 }
@@ -1528,20 +1538,20 @@ void clusterizer::make_plots(topology::tracked_data& /* tracked_data_ */) {
 }
 
 //*************************************************************
-bool clusterizer::is_good_couplet(topology::cell* mainc, const topology::cell& candidatec,
-                                  const std::vector<topology::cell>& nearmain) {
+bool clusterizer::is_good_couplet(const topology::cell& mainc, const topology::cell& candidatec,
+                                  const std::vector<size_t>& nearmain) {
   //*************************************************************
 
   // the couplet mainc -> candidatec is good only if
   // there is no other cell that is near to both and can form a triplet between them
 
-  clock.start(" clusterizer: is good couplet ", "cumulative");
+  Clock::scope timing(clock, timer::clusterizer_is_good_couplet);
 
-  topology::cell a = *mainc;
+  const topology::cell& a = mainc;
 
-  for (std::vector<topology::cell>::const_iterator icell = nearmain.begin();
-       icell != nearmain.end(); ++icell) {
-    topology::cell b = *icell;
+  for (std::vector<size_t>::const_iterator icell = nearmain.begin(); icell != nearmain.end();
+       ++icell) {
+    const topology::cell& b = cells_[*icell];
     if (b.id() == candidatec.id()) continue;
 
     if (near_level(b, candidatec) == 0) continue;
@@ -1561,12 +1571,10 @@ bool clusterizer::is_good_couplet(topology::cell* mainc, const topology::cell& c
     if (ccc.joints().size() > 0) {
       m.message("CAT::clusterizer::is_good_couplet: ... ... yes it does: so couplet ", a.id(),
                 " and ", candidatec.id(), " is not good", mybhep::VERBOSE);
-      clock.stop(" clusterizer: is good couplet ");
       return false;
     }
   }
 
-  clock.stop(" clusterizer: is good couplet ");
   return true;
 }
 
@@ -1704,39 +1712,44 @@ size_t clusterizer::near_level(const topology::cell& c1, const topology::cell& c
   }
 }
 
-std::vector<topology::cell> clusterizer::get_near_cells(const topology::cell& c) {
-  clock.start(" clusterizer: get near cells ", "cumulative");
+void clusterizer::get_near_cells(const topology::cell& c, std::vector<size_t>& cells) {
+  Clock::scope timing(clock, timer::clusterizer_get_near_cells);
 
   m.message("CAT::clusterizer::get_near_cells: filling list of cells near cell ", c.id(), " fast ",
             c.fast(), " side ", cell_side(c), mybhep::VVERBOSE);
 
-  std::vector<topology::cell> cells;
+  cells.clear();
+
+  if (cell_grid_.empty()) {
+    near_candidates_.resize(cells_.size());
+    for (size_t k = 0; k < cells_.size(); k++) near_candidates_[k] = k;
+  } else {
+    cell_grid_.neighbours(c, near_candidates_);
+  }
 
-  for (std::vector<topology::cell>::iterator kcell = cells_.begin(); kcell != cells_.end();
-       ++kcell) {
-    if (kcell->id() == c.id()) continue;
+  for (std::vector<size_t>::const_iterator k = near_candidates_.begin();
+       k != near_candidates_.end(); ++k) {
+    const topology::cell& kcell = cells_[*k];
+    if (kcell.id() == c.id()) continue;
 
-    if (kcell->fast() != c.fast()) continue;
+    if (kcell.fast() != c.fast()) continue;
 
-    if (cell_side(*kcell) != cell_side(c)) continue;
+    if (cell_side(kcell) != cell_side(c)) continue;
 
-    size_t nl = near_level(c, *kcell);
+    size_t nl = near_level(c, kcell);
 
     if (nl > 0) {
       if (level >= mybhep::VVERBOSE) {
         std::clog << "*";
       }
 
-      topology::cell ck = *kcell;
-      cells.push_back(ck);
+      cells.push_back(*k);
     }
   }
 
   if (level >= mybhep::VVERBOSE) std::clog << " " << std::endl;
 
-  clock.stop(" clusterizer: get near cells ");
-
-  return cells;
+  return;
 }
 
 //*************************************************************
@@ -1756,7 +1769,7 @@ void clusterizer::setup_cells() {
 void clusterizer::setup_clusters() {
   //*************************************************************
 
-  clock.start(" clusterizer: setup_clusters ", "cumulative");
+  clock.start(timer::clusterizer_setup_clusters);
 
   // loop on clusters
   for (std::vector<topology::cluster>::iterator icl = clusters_.begin(); icl != clusters_.end();
@@ -1784,7 +1797,7 @@ void clusterizer::setup_clusters() {
     }
   }
 
-  clock.stop(" clusterizer: setup_clusters ");
+  clock.stop(timer::clusterizer_setup_clusters);
 
   return;
 }
@@ -1956,7 +1969,7 @@ topology::calorimeter_hit clusterizer::make_calo_hit(const mybhep::hit& ahit, si
 void clusterizer::order_cells() {
   //*************************************************************
 
-  clock.start(" clusterizer: order cells ", "cumulative");
+  clock.start(timer::clusterizer_order_cells);
 
   if (cells_.size()) {
     if (level >= mybhep::VVERBOSE) {
@@ -1969,7 +1982,7 @@ void clusterizer::order_cells() {
     std::sort(cells_.begin(), cells_.end());
   }
 
-  clock.stop(" clusterizer: order cells ");
+  clock.stop(timer::clusterizer_order_cells);
 
   return;
 }
@@ -23,6 +23,7 @@
 
 #include <CATAlgorithm/Clock.h>
 #include <CATAlgorithm/cell_base.h>
+#include <CATAlgorithm/cell_grid.h>
 #include <CATAlgorithm/cluster.h>
 #include <CATAlgorithm/calorimeter_hit.h>
 #include <CATAlgorithm/sequence_base.h>
@@ -107,7 +108,7 @@ class clusterizer {
   void fill_fast_information(mybhep::hit* h);
   int cell_side(const topology::cell& c);
   size_t near_level(const topology::cell& c1, const topology::cell& c2);
-  std::vector<topology::cell> get_near_cells(const topology::cell& c);
+  void get_near_cells(const topology::cell& c, std::vector<size_t>& cells);
   void setup_cells();
   void setup_clusters();
   topology::calorimeter_hit make_calo_hit(const mybhep::hit& ahit, size_t id);
@@ -209,8 +210,8 @@ class clusterizer {
 
   // histogram file
   std::string hfile;
-  bool is_good_couplet(topology::cell* mainc, const topology::cell& candidatec,
-                       const std::vector<topology::cell>& nearmain);
+  bool is_good_couplet(const topology::cell& mainc, const topology::cell& candidatec,
+                       const std::vector<size_t>& nearmain);
   size_t get_true_hit_index(mybhep::hit& hit, bool print);
   size_t get_nemo_hit_index(mybhep::hit& hit, bool print);
   size_t get_calo_hit_index(const topology::calorimeter_hit& c);
@@ -277,6 +278,9 @@ class clusterizer {
 
   void set_level(std::string v);
 
+  //! timers of the algorithm
+  Clock& get_clock() { return clock; }
+
   void set_len(double v);
 
   void set_vel(double v);
@@ -315,6 +319,8 @@ class clusterizer {
 
  private:
   std::vector<topology::cell> cells_;
+  topology::cell_grid cell_grid_;          // cells_ by position, when SuperNemo
+  std::vector<size_t> near_candidates_;  // work space of get_near_cells
   std::vector<topology::cluster> clusters_;
   std::vector<topology::calorimeter_hit> calorimeter_hits_;
   std::vector<topology::sequence> true_sequences_;
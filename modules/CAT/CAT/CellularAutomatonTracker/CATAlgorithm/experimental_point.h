@@ -41,6 +41,12 @@ class experimental_point {
   //! Default destructor
   virtual ~experimental_point();
 
+  //! copy and move constructors and assignments
+  experimental_point(const experimental_point &) = default;
+  experimental_point(experimental_point &&) = default;
+  experimental_point &operator=(const experimental_point &) = default;
+  experimental_point &operator=(experimental_point &&) = default;
+
   //! constructor
   experimental_point(const experimental_double &x, const experimental_double &y,
                      const experimental_double &z);
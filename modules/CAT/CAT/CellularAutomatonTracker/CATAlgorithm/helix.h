@@ -49,6 +49,12 @@ class helix : public tracking_object {
   //! Default destructor
   virtual ~helix(){};
 
+  //! copy and move constructors and assignments
+  helix(const helix &) = default;
+  helix(helix &&) = default;
+  helix &operator=(const helix &) = default;
+  helix &operator=(helix &&) = default;
+
   //! constructor
   helix(const experimental_point &center, const experimental_double &radius,
         const experimental_double &pitch, mybhep::prlevel level = mybhep::NORMAL,
@@ -394,8 +400,8 @@ class helix : public tracking_object {
     return inverted;
   }
 
-  void point_of_max_min_radius(experimental_point epa, experimental_point epb,
-                               experimental_point *epmax, experimental_point *epmin) {
+  void point_of_max_min_radius(const experimental_point &epa, const experimental_point &epb,
+                               experimental_point *epmax, experimental_point *epmin) const {
     get_circle().point_of_max_min_radius(epa, epb, epmax, epmin);
 
     return;
@@ -148,8 +148,9 @@ void joint::calculate_kinks() {
   return;
 }
 
-double joint::calculate_chi2(joint j, topology::cell A, topology::cell B, topology::cell C,
-                             joint *modified, bool A_is_on_gap, bool B_is_on_gap) const {
+double joint::calculate_chi2(const joint &j, const topology::cell &A, const topology::cell &B,
+                             const topology::cell &C, joint *modified, bool A_is_on_gap,
+                             bool B_is_on_gap) const {
   // this: A B C
   // j:    0 A B
 
@@ -51,6 +51,12 @@ class joint : public tracking_object {
   //! Default destructor
   virtual ~joint();
 
+  //! copy and move constructors and assignments
+  joint(const joint &) = default;
+  joint(joint &&) = default;
+  joint &operator=(const joint &) = default;
+  joint &operator=(joint &&) = default;
+
   //! constructor
   joint(const experimental_point &epa, const experimental_point &epb, const experimental_point &epc,
         mybhep::prlevel level = mybhep::NORMAL, double probmin = 1.e-200);
@@ -113,8 +119,9 @@ class joint : public tracking_object {
 
   bool operator<(const joint &j) const;
 
-  double calculate_chi2(joint j, topology::cell A, topology::cell B, topology::cell C,
-                        joint *modified, bool A_is_on_gap, bool B_is_on_gap) const;
+  double calculate_chi2(const joint &j, const topology::cell &A, const topology::cell &B,
+                        const topology::cell &C, joint *modified, bool A_is_on_gap,
+                        bool B_is_on_gap) const;
 
  private:
   void calculate_kinks();
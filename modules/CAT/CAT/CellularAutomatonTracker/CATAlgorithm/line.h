@@ -41,6 +41,12 @@ class line : public tracking_object {
   //! Default destructor
   virtual ~line();
 
+  //! copy and move constructors and assignments
+  line(const line &) = default;
+  line(line &&) = default;
+  line &operator=(const line &) = default;
+  line &operator=(line &&) = default;
+
   //! constructor
   line(const experimental_point& epa, const experimental_point& epb,
        mybhep::prlevel level = mybhep::NORMAL, double probmin = 1.e-200);
@@ -29,6 +29,12 @@ class logic_cell : public tracking_object {
   //! Default destructor
   virtual ~logic_cell(){};
 
+  //! copy and move constructors and assignments
+  logic_cell(const logic_cell &) = default;
+  logic_cell(logic_cell &&) = default;
+  logic_cell &operator=(const logic_cell &) = default;
+  logic_cell &operator=(logic_cell &&) = default;
+
   //! constructor
   logic_cell(size_t id) { id_ = id; }
 
@@ -56,6 +56,12 @@ class logic_scenario : public tracking_object {
   //! Default destructor
   virtual ~logic_scenario(){};
 
+  //! copy and move constructors and assignments
+  logic_scenario(const logic_scenario &) = default;
+  logic_scenario(logic_scenario &&) = default;
+  logic_scenario &operator=(const logic_scenario &) = default;
+  logic_scenario &operator=(logic_scenario &&) = default;
+
   //! constructor
   logic_scenario(const topology::scenario &sc) {
     for (std::vector<topology::sequence>::const_iterator iseq = sc.sequences_.begin();
@@ -77,6 +77,12 @@ class logic_sequence : public tracking_object {
   //! Default destructor
   virtual ~logic_sequence(){};
 
+  //! copy and move constructors and assignments
+  logic_sequence(const logic_sequence &) = default;
+  logic_sequence(logic_sequence &&) = default;
+  logic_sequence &operator=(const logic_sequence &) = default;
+  logic_sequence &operator=(logic_sequence &&) = default;
+
   //! constructor from sequence
   logic_sequence(const topology::sequence &s) {
     for (std::vector<node>::const_iterator in = s.nodes_.begin(); in != s.nodes_.end(); ++in)
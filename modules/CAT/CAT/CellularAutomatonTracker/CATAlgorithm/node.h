@@ -65,6 +65,12 @@ class node : public tracking_object {
   //! Default destructor
   virtual ~node();
 
+  //! copy and move constructors and assignments
+  node(const node &) = default;
+  node(node &&) = default;
+  node &operator=(const node &) = default;
+  node &operator=(node &&) = default;
+
   //! constructor
   node(const cell &c, const std::vector<cell_couplet> &cc, const std::vector<cell_triplet> &ccc);
 
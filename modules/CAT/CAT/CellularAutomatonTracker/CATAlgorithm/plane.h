@@ -46,6 +46,12 @@ class plane : public tracking_object {
   //! Default destructor
   virtual ~plane();
 
+  //! copy and move constructors and assignments
+  plane(const plane &) = default;
+  plane(plane &&) = default;
+  plane &operator=(const plane &) = default;
+  plane &operator=(plane &&) = default;
+
   //! constructor
   plane(const experimental_point &center, const experimental_vector &sizes,
         const experimental_vector &norm, mybhep::prlevel level = mybhep::NORMAL,
@@ -0,0 +1,100 @@
+/* -*- mode: c++ -*- */
+
+#include <CATAlgorithm/scenario_occupancy.h>
+
+namespace CAT {
+namespace topology {
+
+//! Default constructor
+scenario_occupancy::scenario_occupancy() : n_free_families_(0), n_overlaps_(0) {}
+
+scenario_occupancy::footprint scenario_occupancy::make_footprint(const sequence &seq,
+                                                                 size_t ncells, size_t ncalos) {
+  // visit the cells and calos in the order of scenario::calculate_n_overlaps,
+  // which stops looking at the calos of a sequence at the first one out of range
+  footprint f;
+  f.cells.reserve(seq.nodes_.size());
+  for (std::vector<node>::const_iterator in = seq.nodes_.begin(); in != seq.nodes_.end(); ++in) {
+    if (in->c().id() < ncells) f.cells.push_back(in->c().id());
+  }
+
+  if (seq.has_decay_helix_vertex() && seq.decay_helix_vertex_type() == "calo") {
+    if (seq.calo_helix_id() >= ncalos) return f;
+    f.overlap_calos.push_back(seq.calo_helix_id());
+    f.free_calos.push_back(seq.calo_helix_id());
+  }
+
+  if (seq.has_helix_vertex() && seq.helix_vertex_type() == "calo") {
+    if (seq.helix_vertex_id() >= ncalos) return f;
+    if (seq.helix_vertex_id() != seq.calo_helix_id())
+      f.overlap_calos.push_back(seq.helix_vertex_id());
+    f.free_calos.push_back(seq.helix_vertex_id());
+  }
+
+  if (seq.has_decay_tangent_vertex() && seq.decay_tangent_vertex_type() == "calo") {
+    if (seq.calo_tangent_id() >= ncalos) return f;
+    if (seq.calo_tangent_id() != seq.calo_helix_id() &&
+        seq.calo_tangent_id() != seq.helix_vertex_id())
+      f.overlap_calos.push_back(seq.calo_tangent_id());
+    f.free_calos.push_back(seq.calo_tangent_id());
+  }
+
+  if (seq.has_tangent_vertex() && seq.tangent_vertex_type() == "calo") {
+    if (seq.tangent_vertex_id() >= ncalos) return f;
+    if (seq.tangent_vertex_id() != seq.calo_helix_id() &&
+        seq.tangent_vertex_id() != seq.calo_tangent_id() &&
+        seq.tangent_vertex_id() != seq.helix_vertex_id())
+      f.overlap_calos.push_back(seq.tangent_vertex_id());
+    f.free_calos.push_back(seq.tangent_vertex_id());
+  }
+
+  return f;
+}
+
+void scenario_occupancy::reset(size_t ncells, size_t ncalos) {
+  cells_.assign(ncells, 0);
+  overlap_calos_.assign(ncalos, 0);
+  free_calos_.assign(ncalos, 0);
+  n_free_families_ = ncells + ncalos;
+  n_overlaps_ = 0;
+  return;
+}
+
+void scenario_occupancy::add(const footprint &f) {
+  for (std::vector<size_t>::const_iterator i = f.cells.begin(); i != f.cells.end(); ++i) {
+    if (cells_[*i]++)
+      n_overlaps_++;
+    else
+      n_free_families_--;
+  }
+  for (std::vector<size_t>::const_iterator i = f.overlap_calos.begin();
+       i != f.overlap_calos.end(); ++i) {
+    if (overlap_calos_[*i]++) n_overlaps_++;
+  }
+  for (std::vector<size_t>::const_iterator i = f.free_calos.begin(); i != f.free_calos.end();
+       ++i) {
+    if (!free_calos_[*i]++) n_free_families_--;
+  }
+  return;
+}
+
+void scenario_occupancy::remove(const footprint &f) {
+  for (std::vector<size_t>::const_iterator i = f.cells.begin(); i != f.cells.end(); ++i) {
+    if (--cells_[*i])
+      n_overlaps_--;
+    else
+      n_free_families_++;
+  }
+  for (std::vector<size_t>::const_iterator i = f.overlap_calos.begin();
+       i != f.overlap_calos.end(); ++i) {
+    if (--overlap_calos_[*i]) n_overlaps_--;
+  }
+  for (std::vector<size_t>::const_iterator i = f.free_calos.begin(); i != f.free_calos.end();
+       ++i) {
+    if (!--free_calos_[*i]) n_free_families_++;
+  }
+  return;
+}
+
+}  // namespace topology
+}  // namespace CAT
@@ -0,0 +1,69 @@
+/* -*- mode: c++ -*- */
+#ifndef __CATAlgorithm__scenario_occupancy_h
+#define __CATAlgorithm__scenario_occupancy_h 1
+
+#include <cstddef>
+#include <vector>
+
+#include <CATAlgorithm/sequence_base.h>
+
+namespace CAT {
+namespace topology {
+
+class scenario_occupancy {
+  // a scenario_occupancy counts how many sequences of a scenario use each
+  // cell and each calorimeter hit
+  //
+  // It keeps the numbers of free families and of overlaps of the scenario up
+  // to date as sequences are added and removed, so that trying a sequence
+  // costs a walk through its own cells rather than through all the cells of
+  // the scenario. The numbers are the ones scenario::calculate_n_free_families
+  // and scenario::calculate_n_overlaps return for the same sequences.
+
+ public:
+  // cells and calorimeter hits used by a sequence
+  struct footprint {
+    std::vector<size_t> cells;
+
+    // calos counted by calculate_n_overlaps
+    std::vector<size_t> overlap_calos;
+
+    // calos counted by calculate_n_free_families
+    std::vector<size_t> free_calos;
+  };
+
+  //! Default constructor
+  scenario_occupancy();
+
+  //! return the footprint of a sequence in an event of ncells cells and ncalos calos
+  static footprint make_footprint(const sequence &seq, size_t ncells, size_t ncalos);
+
+  //! forget all sequences, for an event of ncells cells and ncalos calos
+  void reset(size_t ncells, size_t ncalos);
+
+  //! count the cells and calos of a sequence
+  void add(const footprint &f);
+
+  //! uncount the cells and calos of a sequence which was added
+  void remove(const footprint &f);
+
+  //! get n free families
+  size_t n_free_families() const { return n_free_families_; }
+
+  //! get n overlaps
+  size_t n_overlaps() const { return n_overlaps_; }
+
+ private:
+  // number of sequences using each cell and calo
+  std::vector<size_t> cells_;
+  std::vector<size_t> overlap_calos_;
+  std::vector<size_t> free_calos_;
+
+  size_t n_free_families_;
+  size_t n_overlaps_;
+};
+
+}  // namespace topology
+}  // namespace CAT
+
+#endif  // __CATAlgorithm__scenario_occupancy_h
@@ -3057,8 +3057,10 @@ bool sequence::has_kink(void) const {
   return has_kink(&index);
 }
 
-void sequence::point_of_max_min_radius(experimental_point epa, experimental_point epb,
-                                       experimental_point *epmax, experimental_point *epmin) {
+void sequence::point_of_max_min_radius(const experimental_point &epa,
+                                       const experimental_point &epb,
+                                       experimental_point *epmax,
+                                       experimental_point *epmin) const {
   helix_.point_of_max_min_radius(epa, epb, epmax, epmin);
   return;
 }
@@ -108,6 +108,12 @@ class sequence : public tracking_object {
   //! Default destructor
   virtual ~sequence();
 
+  //! copy and move constructors and assignments
+  sequence(const sequence &) = default;
+  sequence(sequence &&) = default;
+  sequence &operator=(const sequence &) = default;
+  sequence &operator=(sequence &&) = default;
+
   //! constructor from std::vector of nodes
   sequence(const std::vector<node> &nodes, mybhep::prlevel level = mybhep::NORMAL,
            double probmin = 1.e-200);
@@ -461,8 +467,8 @@ class sequence : public tracking_object {
 
   bool helix_out_of_range(double lim);
 
-  void point_of_max_min_radius(experimental_point epa, experimental_point epb,
-                               experimental_point *epmax, experimental_point *epmin);
+  void point_of_max_min_radius(const experimental_point &epa, const experimental_point &epb,
+                               experimental_point *epmax, experimental_point *epmin) const;
 
   bool common_vertex_on_foil(const sequence *seqB, double *the_distance) const;
 
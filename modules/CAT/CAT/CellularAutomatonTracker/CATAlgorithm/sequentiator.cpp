@@ -1,4 +1,6 @@
 #include "CATAlgorithm/sequentiator.h"
+#include <algorithm>
+#include <map>
 #include <vector>
 #include <mybhep/system_of_units.h>
 #include <sys/time.h>
@@ -50,6 +52,10 @@ void sequentiator::_set_defaults() {
   NemoraOutput = false;
   N3_MC = false;
   MaxTime = std::numeric_limits<double>::quiet_NaN();
+  MaxScenarioTime = std::numeric_limits<double>::quiet_NaN();
+  MaxScenarioCandidates = 0;
+  scenario_candidates_ = 0;
+  nthreads = 1;
   //    doDriftWires = true;
   //    DriftWires.clear ();
   eman = 0;
@@ -137,7 +143,7 @@ bool sequentiator::initialize(const mybhep::sstore &store, const mybhep::gstore
   m.message("CAT::sequentiator::initialize: Beginning algorithm sequentiator", mybhep::VERBOSE);
   fflush(stdout);
 
-  clock.start(" sequentiator: initialize ");
+  clock.start(timer::sequentiator_initialize);
 
   //----------- read dst param -------------//
 
@@ -147,6 +153,8 @@ bool sequentiator::initialize(const mybhep::sstore &store, const mybhep::gstore
 
   if (PrintMode) initializeHistos();
 
+  make_workers();
+
   nevent = 0;
   InitialEvents = 0;
   SkippedEvents = 0;
@@ -163,7 +171,7 @@ bool sequentiator::initialize(const mybhep::sstore &store, const mybhep::gstore
     }
   */
 
-  clock.stop(" sequentiator: initialize ");
+  clock.stop(timer::sequentiator_initialize);
 
   return true;
 }
@@ -183,8 +191,13 @@ bool sequentiator::initialize(void) {
 
   //------- end of read pram -----------//
 
+  // the clocks are dumped at finalize, and are only operated when verbose
+  clock.set_enabled(level >= mybhep::VERBOSE);
+
   if (PrintMode) initializeHistos();
 
+  make_workers();
+
   nevent = 0;
   InitialEvents = 0;
   SkippedEvents = 0;
@@ -282,11 +295,11 @@ bool sequentiator::finalize() {
   m.message("CAT::sequentiator::finalize: Skipped events: ", SkippedEvents, "(",
             100. * SkippedEvents / InitialEvents, "%)", mybhep::NORMAL);
 
-  clock.start(" sequentiator: finalize ");
+  clock.start(timer::sequentiator_finalize);
 
   if (PrintMode) finalizeHistos();
 
-  clock.stop(" sequentiator: finalize ");
+  clock.stop(timer::sequentiator_finalize);
 
   if (level >= mybhep::NORMAL) {
     print_clocks();
@@ -322,7 +335,7 @@ void sequentiator::finalizeHistos(void) {
 void sequentiator::readDstProper(const mybhep::sstore &global, mybhep::EventManager2 * /*eman*/) {
   //*************************************************************
 
-  clock.start(" sequentiator: read dst properties ");
+  clock.start(timer::sequentiator_read_dst_properties);
 
   if (!global.find("GEOM_MODULES")) {
     _MaxBlockSize = 1;
@@ -414,6 +427,12 @@ void sequentiator::readDstProper(const mybhep::sstore &global, mybhep::EventMana
   fflush(stdout);
   m.message("CAT::sequentiator::readDstProper: maximum time", MaxTime, " ms ", mybhep::NORMAL);
   fflush(stdout);
+  m.message("CAT::sequentiator::readDstProper: maximum time of the scenario search",
+            MaxScenarioTime, " ms ", mybhep::VERBOSE);
+  fflush(stdout);
+  m.message("CAT::sequentiator::readDstProper: maximum number of candidate scenarios",
+            MaxScenarioCandidates, mybhep::VERBOSE);
+  fflush(stdout);
   m.message("CAT::sequentiator::readDstProper: xsize is read as", xsize, "mm", mybhep::VERBOSE);
   fflush(stdout);
   m.message("CAT::sequentiator::readDstProper: ysize is read as", ysize, "mm", mybhep::VERBOSE);
@@ -446,7 +465,7 @@ void sequentiator::readDstProper(const mybhep::sstore &global, mybhep::EventMana
           "CAT::sequentiator::readDstProper: +++ NEMO3 GG ERROR, GLOBAL PROPERTY NOT FOUND IN DST",
           pname, mybhep::NORMAL);
       fflush(stdout);
-      clock.stop(" sequentiator: read dst properties ");
+      clock.stop(timer::sequentiator_read_dst_properties);
       exit(1);
     }
 
@@ -458,7 +477,7 @@ void sequentiator::readDstProper(const mybhep::sstore &global, mybhep::EventMana
           "CAT::sequentiator::readDstProper: +++ NEMO3 GG ERROR, GLOBAL PROPERTY NOT FOUND IN DST",
           pname, mybhep::NORMAL);
       fflush(stdout);
-      clock.stop(" sequentiator: read dst properties ");
+      clock.stop(timer::sequentiator_read_dst_properties);
       exit(1);
     }
 
@@ -470,7 +489,7 @@ void sequentiator::readDstProper(const mybhep::sstore &global, mybhep::EventMana
           "CAT::sequentiator::readDstProper: +++ NEMO3 GG ERROR, GLOBAL PROPERTY NOT FOUND IN DST",
           pname, mybhep::NORMAL);
       fflush(stdout);
-      clock.stop(" sequentiator: read dst properties ");
+      clock.stop(timer::sequentiator_read_dst_properties);
       exit(1);
     }
 
@@ -482,7 +501,7 @@ void sequentiator::readDstProper(const mybhep::sstore &global, mybhep::EventMana
           "CAT::sequentiator::readDstProper: +++ NEMO3 GG ERROR, GLOBAL PROPERTY NOT FOUND IN DST",
           pname, mybhep::NORMAL);
       fflush(stdout);
-      clock.stop(" sequentiator: read dst properties ");
+      clock.stop(timer::sequentiator_read_dst_properties);
       exit(1);
     }
 
@@ -494,7 +513,7 @@ void sequentiator::readDstProper(const mybhep::sstore &global, mybhep::EventMana
           "CAT::sequentiator::readDstProper: +++ NEMO3 GG ERROR, GLOBAL PROPERTY NOT FOUND IN DST",
           pname, mybhep::NORMAL);
       fflush(stdout);
-      clock.stop(" sequentiator: read dst properties ");
+      clock.stop(timer::sequentiator_read_dst_properties);
       exit(1);
     }
 
@@ -506,7 +525,7 @@ void sequentiator::readDstProper(const mybhep::sstore &global, mybhep::EventMana
           "CAT::sequentiator::readDstProper: +++ NEMO3 GG ERROR, GLOBAL PROPERTY NOT FOUND IN DST",
           pname, mybhep::NORMAL);
       fflush(stdout);
-      clock.stop(" sequentiator: read dst properties ");
+      clock.stop(timer::sequentiator_read_dst_properties);
       exit(1);
     }
 
@@ -518,7 +537,7 @@ void sequentiator::readDstProper(const mybhep::sstore &global, mybhep::EventMana
           "CAT::sequentiator::readDstProper: +++ NEMO3 GG ERROR, GLOBAL PROPERTY NOT FOUND IN DST",
           pname, mybhep::NORMAL);
       fflush(stdout);
-      clock.stop(" sequentiator: read dst properties ");
+      clock.stop(timer::sequentiator_read_dst_properties);
       exit(1);
     }
 
@@ -530,7 +549,7 @@ void sequentiator::readDstProper(const mybhep::sstore &global, mybhep::EventMana
           "CAT::sequentiator::readDstProper: +++ NEMO3 GG ERROR, GLOBAL PROPERTY NOT FOUND IN DST",
           pname, mybhep::NORMAL);
       fflush(stdout);
-      clock.stop(" sequentiator: read dst properties ");
+      clock.stop(timer::sequentiator_read_dst_properties);
       exit(1);
     }
 
@@ -542,7 +561,7 @@ void sequentiator::readDstProper(const mybhep::sstore &global, mybhep::EventMana
           "CAT::sequentiator::readDstProper: +++ NEMO3 GG ERROR, GLOBAL PROPERTY NOT FOUND IN DST",
           pname, mybhep::NORMAL);
       fflush(stdout);
-      clock.stop(" sequentiator: read dst properties ");
+      clock.stop(timer::sequentiator_read_dst_properties);
       exit(1);
     }
 
@@ -554,7 +573,7 @@ void sequentiator::readDstProper(const mybhep::sstore &global, mybhep::EventMana
           "CAT::sequentiator::readDstProper: +++ NEMO3 GG ERROR, GLOBAL PROPERTY NOT FOUND IN DST",
           pname, mybhep::NORMAL);
       fflush(stdout);
-      clock.stop(" sequentiator: read dst properties ");
+      clock.stop(timer::sequentiator_read_dst_properties);
       exit(1);
     }
 
@@ -566,12 +585,12 @@ void sequentiator::readDstProper(const mybhep::sstore &global, mybhep::EventMana
           "CAT::sequentiator::readDstProper: +++ NEMO3 GG ERROR, GLOBAL PROPERTY NOT FOUND IN DST",
           pname, mybhep::NORMAL);
       fflush(stdout);
-      clock.stop(" sequentiator: read dst properties ");
+      clock.stop(timer::sequentiator_read_dst_properties);
       exit(1);
     }
   }
 
-  clock.stop(" sequentiator: read dst properties ");
+  clock.stop(timer::sequentiator_read_dst_properties);
 
   return;
 }
@@ -626,8 +645,9 @@ bool sequentiator::sequentiate(topology::tracked_data &tracked_data_) {
     return true;
   }
 
-  clock.start(" sequentiator: sequentiate ", "cumulative");
-  clock.start(" sequentiator: sequentiation ", "restart");
+  clock.start(timer::sequentiator_sequentiate);
+  sequentiation_clock.restart();
+  tracked_data_.set_truncated(false);
 
   m.message("CAT::sequentiator::sequentiate: sequentiate... ", mybhep::VVERBOSE);
   fflush(stdout);
@@ -645,14 +665,7 @@ bool sequentiator::sequentiate(topology::tracked_data &tracked_data_) {
 
   tracked_data_.scenarios_.clear();
 
-  for (vector<topology::cluster>::iterator icluster = the_clusters.begin();
-       icluster != the_clusters.end(); ++icluster) {
-    topology::cluster &a_cluster = *icluster;
-
-    local_cluster_ = &(*icluster);
-
-    sequentiate_cluster(a_cluster);
-  }
+  sequentiate_clusters(the_clusters);
 
   if (late()) {
     tracked_data_.set_skipped(true);
@@ -692,7 +705,7 @@ bool sequentiator::sequentiate(topology::tracked_data &tracked_data_) {
   m.message("CAT::sequentiator::sequentiate: sequentiation done ", mybhep::VVERBOSE);
   fflush(stdout);
 
-  clock.stop(" sequentiator: sequentiate ");
+  clock.stop(timer::sequentiator_sequentiate);
 
   return true;
 }
@@ -714,8 +727,9 @@ bool sequentiator::sequentiate_after_sultan(topology::tracked_data &tracked_data
     return true;
   }
 
-  clock.start(" sequentiator: sequentiate_after_sultan ", "cumulative");
-  clock.start(" sequentiator: sequentiation ", "restart");
+  clock.start(timer::sequentiator_sequentiate_after_sultan);
+  sequentiation_clock.restart();
+  tracked_data_.set_truncated(false);
 
   // set_clusters(tracked_data_.get_clusters());
   vector<topology::cluster> &the_clusters = tracked_data_.get_clusters();
@@ -774,13 +788,13 @@ bool sequentiator::sequentiate_after_sultan(topology::tracked_data &tracked_data
 
   // make_plots(tracked_data_);
 
-  clock.stop(" sequentiator: sequentiate_after_sultan ");
+  clock.stop(timer::sequentiator_sequentiate_after_sultan);
 
   return true;
 }
 
 //*************************************************************
-void sequentiator::plot_hard_scattering(topology::tracked_data /*__tracked_data*/) {
+void sequentiator::plot_hard_scattering(const topology::tracked_data & /*__tracked_data*/) {
   //*************************************************************
 
   /*
@@ -830,15 +844,15 @@ void sequentiator::plot_hard_scattering(topology::tracked_data /*__tracked_data*
 }
 
 //*************************************************************
-void sequentiator::make_plots(topology::tracked_data /*__tracked_data*/) {
+void sequentiator::make_plots(const topology::tracked_data & /*__tracked_data*/) {
   //*************************************************************
 
   /*
     if( PrintMode ){
 
-    clock.start(" sequentiator: reconstruct efficiency ","cumulative");
+    clock.start(timer::sequentiator_reconstruct_efficiency);
     rec_efficiency(__tracked_data.get_true_sequences());
-    clock.stop(" sequentiator: reconstruct efficiency ");
+    clock.stop(timer::sequentiator_reconstruct_efficiency);
 
     plot_hard_scattering(__tracked_data);
 
@@ -876,6 +890,71 @@ void sequentiator::make_plots(topology::tracked_data /*__tracked_data*/) {
   return;
 }
 
+//*************************************************************
+void sequentiator::sequentiate_clusters(std::vector<topology::cluster> &clusters) {
+  //*************************************************************
+  // Clusters share no cell, so that the sequences of a cluster are built and
+  // cleaned up apart from those of the other clusters, possibly on several
+  // threads. They are then merged in the order of the clusters, with the
+  // family numbers they would have had if the clusters were sequentiated in turn.
+
+  std::vector<std::vector<topology::sequence> > sequences_of_cluster(clusters.size());
+  std::vector<int> families_of_cluster(clusters.size());
+
+  // worker 0 is this sequentiator, the others are the copies made at
+  // initialization, which follow the event and the clock of this one
+  if (!workers_.pool) make_workers();
+  for (std::unique_ptr<sequentiator> &worker : workers_.copies) {
+    worker->event_number = event_number;
+    worker->sequentiation_clock = sequentiation_clock;
+    worker->clock.set_enabled(clock.is_enabled());
+  }
+
+  workers_.pool->run(clusters.size(), [&](size_t iworker, size_t icluster) {
+    sequentiator &worker = iworker ? *workers_.copies[iworker - 1] : *this;
+    worker.sequences_.clear();
+    worker.NFAMILY = -1;
+    worker.NCOPY = 0;
+    worker.local_cluster_ = &clusters[icluster];
+    worker.sequentiate_cluster(clusters[icluster]);
+    families_of_cluster[icluster] = worker.NFAMILY + 1;
+    sequences_of_cluster[icluster] = std::move(worker.sequences_);
+  });
+
+  sequences_.clear();
+  for (size_t icluster = 0; icluster < clusters.size(); ++icluster) {
+    for (topology::sequence &s : sequences_of_cluster[icluster]) {
+      shift_family(s, NFAMILY + 1);
+      sequences_.push_back(std::move(s));
+    }
+    NFAMILY += families_of_cluster[icluster];
+  }
+
+  for (std::unique_ptr<sequentiator> &worker : workers_.copies) {
+    clock.add(worker->clock);
+    worker->clock.reset();
+  }
+
+  return;
+}
+
+//*************************************************************
+void sequentiator::make_workers() {
+  //*************************************************************
+  // this sequentiator is worker 0 and runs on the calling thread
+
+  workers_.pool.reset();
+  workers_.copies.clear();
+  const size_t nworkers = std::max<size_t>(1, nthreads);
+  for (size_t iworker = 1; iworker < nworkers; ++iworker) {
+    workers_.copies.emplace_back(new sequentiator(*this));
+    workers_.copies.back()->clock.reset();
+  }
+  workers_.pool.reset(new task_pool(nworkers));
+
+  return;
+}
+
 //*************************************************************
 void sequentiator::sequentiate_cluster(topology::cluster &cluster_) {
   //*************************************************************
@@ -917,7 +996,7 @@ void sequentiator::make_new_sequence(topology::node &first_node) {
 
   if (late()) return;
 
-  clock.start(" sequentiator: make new sequence ", "cumulative");
+  clock.start(timer::sequentiator_make_new_sequence);
 
   //  A node is added to the newsequence. It has the given cell but no other
   //  requirement. The free level is set to true.
@@ -953,16 +1032,17 @@ void sequentiator::make_new_sequence(topology::node &first_node) {
     add_pair(newsequence);
   }
 
-  clock.stop(" sequentiator: make new sequence ");
+  clock.stop(timer::sequentiator_make_new_sequence);
 
   return;
 }
 
 //*************************************************************
-topology::joint sequentiator::find_best_matching_joint(topology::joint j,
-                                                       std::vector<topology::joint> js,
-                                                       topology::cell A, topology::cell B,
-                                                       topology::cell C, double *chi2,
+topology::joint sequentiator::find_best_matching_joint(const topology::joint &j,
+                                                       const std::vector<topology::joint> &js,
+                                                       const topology::cell &A,
+                                                       const topology::cell &B,
+                                                       const topology::cell &C, double *chi2,
                                                        bool A_is_on_gap, bool B_is_on_gap) {
   //*************************************************************
 
@@ -990,7 +1070,7 @@ void sequentiator::make_new_sequence_after_sultan() {
 
   if (late()) return;
 
-  clock.start(" sequentiator: make new sequence after sultan ", "cumulative");
+  clock.start(timer::sequentiator_make_new_sequence_after_sultan);
 
   size_t s = local_cluster_->nodes().size();
   NCOPY = 0;
@@ -1035,7 +1115,7 @@ void sequentiator::make_new_sequence_after_sultan() {
   }
 
   if (s == 3) {
-    std::vector<topology::joint> joints = local_cluster_->nodes()[1].ccc()[0].joints();
+    const std::vector<topology::joint> &joints = local_cluster_->nodes()[1].ccc()[0].joints();
     m.message(" CAT::sequentiator::make_new_sequence_after_sultan: make sequence with size ", s,
               " and ", joints.size(), " joints ", mybhep::VERBOSE);
     for (std::vector<topology::joint>::const_iterator ij = joints.begin(); ij != joints.end();
@@ -1078,18 +1158,18 @@ void sequentiator::make_new_sequence_after_sultan() {
 
   clean_up_sequences();
 
-  clock.stop(" sequentiator: make new sequence after sultan ");
+  clock.stop(timer::sequentiator_make_new_sequence_after_sultan);
 
   return;
 }
 
 //*************************************************************
 bool sequentiator::increase_iterations(
-    std::vector<std::vector<topology::broken_line> > sets_of_bl_alternatives,
+    const std::vector<std::vector<topology::broken_line> > &sets_of_bl_alternatives,
     std::vector<size_t> *iterations, int *block_which_is_increasing, int *first_augmented_block) {
   //*************************************************************
 
-  clock.start(" sequentiator: increase_iterations ", "cumulative");
+  clock.start(timer::sequentiator_increase_iterations);
 
   iterations->at(*block_which_is_increasing)++;
   if (iterations->at(*block_which_is_increasing) ==
@@ -1097,7 +1177,7 @@ bool sequentiator::increase_iterations(
     iterations->at(*block_which_is_increasing) = 0;
     int prev_block = *block_which_is_increasing - 1;
     if (prev_block < 0) {
-      clock.stop(" sequentiator: increase_iterations ");
+      clock.stop(timer::sequentiator_increase_iterations);
       return false;
     }
     while (true) {
@@ -1107,31 +1187,31 @@ bool sequentiator::increase_iterations(
         prev_block--;
         if (prev_block < 0) break;
       } else {
-        clock.stop(" sequentiator: increase_iterations ");
+        clock.stop(timer::sequentiator_increase_iterations);
         return true;
       }
     }
     if (prev_block < 0) {
-      clock.stop(" sequentiator: increase_iterations ");
+      clock.stop(timer::sequentiator_increase_iterations);
       return false;
     }
     if (prev_block < *first_augmented_block) *first_augmented_block = prev_block;
   }
 
-  clock.stop(" sequentiator: increase_iterations ");
+  clock.stop(timer::sequentiator_increase_iterations);
   return true;
 }
 
 //*************************************************************
 bool sequentiator::build_sequences_from_ambiguous_alternatives(
-    std::vector<std::vector<topology::broken_line> > sets_of_bl_alternatives,
+    const std::vector<std::vector<topology::broken_line> > &sets_of_bl_alternatives,
     std::vector<topology::sequence> *seqs) {
   //*************************************************************
 
   bool conserve_clustering_from_removal = true;
   bool conserve_clustering_from_reordering = false;
 
-  clock.start(" sequentiator: build_sequences_from_ambiguous_alternatives ", "cumulative");
+  clock.start(timer::sequentiator_build_sequences_from_ambiguous_alternatives);
 
   if (level >= mybhep::VERBOSE) {
     std::clog << " CAT::cluster::build_sequences_from_ambiguous_alternatives: there are "
@@ -1166,7 +1246,7 @@ bool sequentiator::build_sequences_from_ambiguous_alternatives(
       inode->set_ep(base_bl.eps_[inode - best_seq.nodes_.begin()]);
     }
     seqs->push_back(best_seq);
-    clock.stop(" sequentiator: build_sequences_from_ambiguous_alternatives ");
+    clock.stop(timer::sequentiator_build_sequences_from_ambiguous_alternatives);
     return true;
   }
 
@@ -1253,7 +1333,7 @@ bool sequentiator::build_sequences_from_ambiguous_alternatives(
 
   seqs->push_back(best_seq);
 
-  clock.stop(" sequentiator: build_sequences_from_ambiguous_alternatives ");
+  clock.stop(timer::sequentiator_build_sequences_from_ambiguous_alternatives);
   return found;
 }
 
@@ -1268,6 +1348,26 @@ void sequentiator::make_name(topology::sequence &sequence_) {
   return;
 }
 
+//*************************************************************
+void sequentiator::shift_family(topology::sequence &sequence_, int offset) {
+  //*************************************************************
+  // names made by make_name are track_FAMILY_COPY
+
+  if (!offset) return;
+
+  std::vector<std::string> names = sequence_.names();
+  for (std::vector<std::string>::iterator iname = names.begin(); iname != names.end(); ++iname) {
+    if (iname->compare(0, 6, "track_") != 0) continue;
+    const size_t i2 = iname->find("_", 6);
+    if (i2 == std::string::npos) continue;
+    const int family = mybhep::int_from_string(iname->substr(6, i2 - 6));
+    *iname = "track_" + mybhep::to_string(family + offset) + iname->substr(i2);
+  }
+  sequence_.set_names(names);
+
+  return;
+}
+
 //*************************************************************
 void sequentiator::make_copy_sequence(topology::node &first_node) {
   //*************************************************************
@@ -1280,14 +1380,14 @@ void sequentiator::make_copy_sequence(topology::node &first_node) {
          << "Entering..." << endl;
   }
 
-  clock.start(" sequentiator: make copy sequence ", "cumulative");
+  clock.start(timer::sequentiator_make_copy_sequence);
 
   size_t isequence;
   while (there_is_free_sequence_beginning_with(first_node.c(), &isequence)) {
     if (late()) return;
 
-    clock.start(" sequentiator: make copy sequence: part A ", "cumulative");
-    clock.start(" sequentiator: make copy sequence: part A: alpha ", "cumulative");
+    clock.start(timer::sequentiator_make_copy_sequence_part_a);
+    clock.start(timer::sequentiator_make_copy_sequence_part_a_alpha);
 
     m.message("CAT::sequentiator::make_copy_sequence: begin, with cell", first_node.c().id(),
               ", parallel track ", sequences_.size(), " to track ", isequence, mybhep::VERBOSE);
@@ -1299,13 +1399,13 @@ void sequentiator::make_copy_sequence(topology::node &first_node) {
       print_a_sequence(sequences_[isequence]);
     }
 
-    clock.stop(" sequentiator: make copy sequence: part A: alpha ");
-    clock.start(" sequentiator: copy to lfn ", "cumulative");
+    clock.stop(timer::sequentiator_make_copy_sequence_part_a_alpha);
+    clock.start(timer::sequentiator_copy_to_lfn);
     size_t ilink, ilfn;
     topology::sequence newcopy = sequences_[isequence].copy_to_last_free_node(&ilfn, &ilink);
-    clock.stop(" sequentiator: copy to lfn ");
+    clock.stop(timer::sequentiator_copy_to_lfn);
 
-    clock.start(" sequentiator: make copy sequence: part A: beta ", "cumulative");
+    clock.start(timer::sequentiator_make_copy_sequence_part_a_beta);
     m.message("CAT::sequentiator::make_copy_sequence: copied from sequence  ", isequence,
               mybhep::VVERBOSE);
     fflush(stdout);
@@ -1320,19 +1420,19 @@ void sequentiator::make_copy_sequence(topology::node &first_node) {
       print_a_sequence(newcopy);
     }
 
-    clock.stop(" sequentiator: make copy sequence: part A: beta ");
-    clock.start(" sequentiator: make copy sequence: evolve ", "cumulative");
+    clock.stop(timer::sequentiator_make_copy_sequence_part_a_beta);
+    clock.start(timer::sequentiator_make_copy_sequence_evolve);
 
     bool updated = true;
     while (updated) updated = evolve(newcopy);
-    clock.stop(" sequentiator: make copy sequence: evolve ");
+    clock.stop(timer::sequentiator_make_copy_sequence_evolve);
 
     if (late()) return;
 
     if (level >= mybhep::VVERBOSE) print_a_sequence(newcopy);
 
-    clock.stop(" sequentiator: make copy sequence: part A ");
-    clock.start(" sequentiator: manage copy sequence ", "cumulative");
+    clock.stop(timer::sequentiator_make_copy_sequence_part_a);
+    clock.start(timer::sequentiator_manage_copy_sequence);
 
     if (local_devel) {
       clog << "DEVEL: "
@@ -1354,9 +1454,9 @@ void sequentiator::make_copy_sequence(topology::node &first_node) {
       // is set to used in the original
       if (newcopy.nodes().size() > ilfn + 1) {
         if (!sequences_[isequence].nodes().empty()) {
-          clock.start(" sequentiator: get link index ", "cumulative");
+          clock.start(timer::sequentiator_get_link_index);
           size_t it1 = newcopy.get_link_index_of_cell(ilfn, newcopy.nodes()[ilfn + 1].c());
-          clock.stop(" sequentiator: get link index ");
+          clock.stop(timer::sequentiator_get_link_index);
           m.message("CAT::sequentiator::make_copy_sequence: setting as used original node ", ilfn,
                     "  cc ", it1, mybhep::VVERBOSE);
           if (ilfn == 0)
@@ -1366,16 +1466,16 @@ void sequentiator::make_copy_sequence(topology::node &first_node) {
         }
         /*
           if( sequences_[isequence].nodes().size() > 1 && ilfn > 0){
-          clock.start(" sequentiator: get link index ","cumulative");
+          clock.start(timer::sequentiator_get_link_index);
           size_t it2 = newcopy.get_link_index_of_cell(1, newcopy.nodes()[2].c());
-          clock.stop(" sequentiator: get link index ");
+          clock.stop(timer::sequentiator_get_link_index);
           m.message(" setting as used original node 1  ccc ", it2, mybhep::VVERBOSE);
           sequences_[isequence].nodes_[1].ccc_[it2].set_all_used();
           }
         */
-        clock.start(" sequentiator: set free level ", "cumulative");
+        clock.start(timer::sequentiator_set_free_level);
         sequences_[isequence].set_free_level();
-        clock.stop(" sequentiator: set free level ");
+        clock.stop(timer::sequentiator_set_free_level);
       }
 
       // not adding: case 2: new sequence contained
@@ -1510,9 +1610,9 @@ void sequentiator::make_copy_sequence(topology::node &first_node) {
               }
           }
 
-          clock.start(" sequentiator: set free level ", "cumulative");
+          clock.start(timer::sequentiator_set_free_level);
           newcopy.set_free_level();
-          clock.stop(" sequentiator: set free level ");
+          clock.stop(timer::sequentiator_set_free_level);
 
           sequences_.erase(sequences_.begin() + isequence);
           m.message("CAT::sequentiator::make_copy_sequence: erased original sequence ", isequence,
@@ -1536,12 +1636,12 @@ void sequentiator::make_copy_sequence(topology::node &first_node) {
       }  // end of case 3
     }
 
-    clock.stop(" sequentiator: manage copy sequence ");
+    clock.stop(timer::sequentiator_manage_copy_sequence);
   }
 
   NCOPY = 0;
 
-  clock.stop(" sequentiator: make copy sequence ");
+  clock.stop(timer::sequentiator_make_copy_sequence);
 
   return;
 }
@@ -1559,14 +1659,14 @@ void sequentiator::make_copy_sequence_after_sultan() {
          << "Entering..." << endl;
   }
 
-  clock.start(" sequentiator: make copy sequence after sultan ", "cumulative");
+  clock.start(timer::sequentiator_make_copy_sequence_after_sultan);
 
   size_t isequence;
   while (there_is_free_sequence_beginning_with(first_node.c(), &isequence)) {
     if (late()) return;
 
-    clock.start(" sequentiator: make copy sequence after sultan: part A ", "cumulative");
-    clock.start(" sequentiator: make copy sequence after sultan: part A: alpha ", "cumulative");
+    clock.start(timer::sequentiator_make_copy_sequence_after_sultan_part_a);
+    clock.start(timer::sequentiator_make_copy_sequence_after_sultan_part_a_alpha);
 
     m.message("CAT::sequentiator::make_copy_sequence_after_sultan: begin, with cell",
               first_node.c().id(), ", parallel track ", sequences_.size(), " to track ", isequence,
@@ -1580,13 +1680,13 @@ void sequentiator::make_copy_sequence_after_sultan() {
       print_a_sequence(sequences_[isequence]);
     }
 
-    clock.stop(" sequentiator: make copy sequence after sultan: part A: alpha ");
-    clock.start(" sequentiator: copy to lfn ", "cumulative");
+    clock.stop(timer::sequentiator_make_copy_sequence_after_sultan_part_a_alpha);
+    clock.start(timer::sequentiator_copy_to_lfn);
     size_t ilink, ilfn;
     topology::sequence newcopy = sequences_[isequence].copy_to_last_free_node(&ilfn, &ilink);
-    clock.stop(" sequentiator: copy to lfn ");
+    clock.stop(timer::sequentiator_copy_to_lfn);
 
-    clock.start(" sequentiator: make copy sequence after sultan: part A: beta ", "cumulative");
+    clock.start(timer::sequentiator_make_copy_sequence_after_sultan_part_a_beta);
     m.message("CAT::sequentiator::make_copy_sequence_after_sultan: copied from sequence  ",
               isequence, mybhep::VVERBOSE);
     fflush(stdout);
@@ -1601,19 +1701,19 @@ void sequentiator::make_copy_sequence_after_sultan() {
       print_a_sequence(newcopy);
     }
 
-    clock.stop(" sequentiator: make copy sequence after sultan: part A: beta ");
-    clock.start(" sequentiator: make copy sequence after sultan: evolve ", "cumulative");
+    clock.stop(timer::sequentiator_make_copy_sequence_after_sultan_part_a_beta);
+    clock.start(timer::sequentiator_make_copy_sequence_after_sultan_evolve);
 
     bool updated = true;
     while (updated) updated = evolve(newcopy);
-    clock.stop(" sequentiator: make copy sequence after sultan: evolve ");
+    clock.stop(timer::sequentiator_make_copy_sequence_after_sultan_evolve);
 
     if (late()) return;
 
     if (level >= mybhep::VVERBOSE) print_a_sequence(newcopy);
 
-    clock.stop(" sequentiator: make copy sequence after sultan: part A ");
-    clock.start(" sequentiator: manage copy sequence after sultan ", "cumulative");
+    clock.stop(timer::sequentiator_make_copy_sequence_after_sultan_part_a);
+    clock.start(timer::sequentiator_manage_copy_sequence_after_sultan);
 
     if (local_devel) {
       clog << "DEVEL: "
@@ -1635,9 +1735,9 @@ void sequentiator::make_copy_sequence_after_sultan() {
       // is set to used in the original
       if (newcopy.nodes().size() > ilfn + 1) {
         if (!sequences_[isequence].nodes().empty()) {
-          clock.start(" sequentiator: get link index ", "cumulative");
+          clock.start(timer::sequentiator_get_link_index);
           size_t it1 = newcopy.get_link_index_of_cell(ilfn, newcopy.nodes()[ilfn + 1].c());
-          clock.stop(" sequentiator: get link index ");
+          clock.stop(timer::sequentiator_get_link_index);
           m.message(
               "CAT::sequentiator::make_copy_sequence_after_sultan: setting as used original node ",
               ilfn, "  cc ", it1, mybhep::VVERBOSE);
@@ -1648,16 +1748,16 @@ void sequentiator::make_copy_sequence_after_sultan() {
         }
         /*
           if( sequences_[isequence].nodes().size() > 1 && ilfn > 0){
-          clock.start(" sequentiator: get link index ","cumulative");
+          clock.start(timer::sequentiator_get_link_index);
           size_t it2 = newcopy.get_link_index_of_cell(1, newcopy.nodes()[2].c());
-          clock.stop(" sequentiator: get link index ");
+          clock.stop(timer::sequentiator_get_link_index);
           m.message(" setting as used original node 1  ccc ", it2, mybhep::VVERBOSE);
           sequences_[isequence].nodes_[1].ccc_[it2].set_all_used();
           }
         */
-        clock.start(" sequentiator: set free level ", "cumulative");
+        clock.start(timer::sequentiator_set_free_level);
         sequences_[isequence].set_free_level();
-        clock.stop(" sequentiator: set free level ");
+        clock.stop(timer::sequentiator_set_free_level);
       }
 
       // not adding: case 2: new sequence contained
@@ -1794,9 +1894,9 @@ void sequentiator::make_copy_sequence_after_sultan() {
               }
           }
 
-          clock.start(" sequentiator: set free level ", "cumulative");
+          clock.start(timer::sequentiator_set_free_level);
           newcopy.set_free_level();
-          clock.stop(" sequentiator: set free level ");
+          clock.stop(timer::sequentiator_set_free_level);
 
           sequences_.erase(sequences_.begin() + isequence);
           m.message("CAT::sequentiator::make_copy_sequence_after_sultan: erased original sequence ",
@@ -1820,12 +1920,12 @@ void sequentiator::make_copy_sequence_after_sultan() {
       }  // end of case 3
     }
 
-    clock.stop(" sequentiator: manage copy sequence after sultan ");
+    clock.stop(timer::sequentiator_manage_copy_sequence_after_sultan);
   }
 
   NCOPY = 0;
 
-  clock.stop(" sequentiator: make copy sequence after sultan ");
+  clock.stop(timer::sequentiator_make_copy_sequence_after_sultan);
 
   return;
 }
@@ -1843,10 +1943,9 @@ void sequentiator::make_copy_sequence_after_nemor() {
 bool sequentiator::late(void) {
   //*************************************************************
 
-  if (clock.read(" sequentiator: sequentiation ") >= MaxTime) {
-    m.message("CAT::sequentiator::late: execution time ",
-              clock.read(" sequentiator: sequentiation "), " ms  greater than MaxTime", MaxTime,
-              " quitting! ", mybhep::NORMAL);
+  if (sequentiation_clock.read() >= MaxTime) {
+    m.message("CAT::sequentiator::late: execution time ", sequentiation_clock.read(),
+              " ms  greater than MaxTime", MaxTime, " quitting! ", mybhep::NORMAL);
 
     //      clock.stop_all();
 
@@ -1877,9 +1976,9 @@ bool sequentiator::evolve(topology::sequence &sequence) {
 
   if (late()) return false;
 
-  clock.start(" sequentiator: evolve ", "cumulative");
+  clock.start(timer::sequentiator_evolve);
 
-  clock.start(" sequentiator: evolve: part A ", "cumulative");
+  clock.start(timer::sequentiator_evolve_part_a);
 
   const size_t sequence_size = sequence.nodes().size();
 
@@ -1898,38 +1997,38 @@ bool sequentiator::evolve(topology::sequence &sequence) {
     m.message("CAT::sequentiator::evolve: problem: sequence has length ", sequence_size,
               "... stop evolving ", mybhep::NORMAL);
     fflush(stdout);
-    clock.stop(" sequentiator: evolve: part A ");
-    clock.stop(" sequentiator: evolve ");
+    clock.stop(timer::sequentiator_evolve_part_a);
+    clock.stop(timer::sequentiator_evolve);
     return false;
   }
 
   if (level >= mybhep::VVERBOSE) print_a_sequence(sequence);
 
   if (sequence_size == 3) {
-    clock.start(" sequentiator: get link index ", "cumulative");
+    clock.start(timer::sequentiator_get_link_index);
     size_t it1 = sequence.get_link_index_of_cell(0, sequence.nodes()[1].c());
     if (it1 >= sequence.nodes_[0].cc_.size()) {
       m.message("CAT::sequentiator::evolve: problem: it1 ", it1, " nodes size ",
                 sequence.nodes_.size(), " cc size ", sequence.nodes_[0].cc_.size(), mybhep::NORMAL);
       fflush(stdout);
-      clock.stop(" sequentiator: evolve: part A ");
-      clock.stop(" sequentiator: evolve ");
+      clock.stop(timer::sequentiator_evolve_part_a);
+      clock.stop(timer::sequentiator_evolve);
       return false;
     }
     sequence.nodes_[0].cc_[it1].set_all_used();
 
-    clock.stop(" sequentiator: get link index ");
+    clock.stop(timer::sequentiator_get_link_index);
   }
 
-  clock.stop(" sequentiator: evolve: part A ");
-  clock.start(" sequentiator: evolve: part B ", "cumulative");
+  clock.stop(timer::sequentiator_evolve_part_a);
+  clock.start(timer::sequentiator_evolve_part_b);
 
   // check if there is a possible link
   size_t ilink;
   topology::experimental_point newp;
-  clock.start(" sequentiator: pick new cell ", "cumulative");
+  clock.start(timer::sequentiator_pick_new_cell);
   bool there_is_link = sequence.pick_new_cell(&ilink, &newp, *local_cluster_);
-  clock.stop(" sequentiator: pick new cell ");
+  clock.stop(timer::sequentiator_pick_new_cell);
 
   if (local_devel) {
     clog << "DEVEL: "
@@ -1941,13 +2040,13 @@ bool sequentiator::evolve(topology::sequence &sequence) {
     m.message("CAT::sequentiator::evolve: no links could be added... stop evolving ",
               mybhep::VERBOSE);
     fflush(stdout);
-    clock.start(" sequentiator: evolve: part B: set free level ", "cumulative");
-    clock.start(" sequentiator: set free level ", "cumulative");
+    clock.start(timer::sequentiator_evolve_part_b_set_free_level);
+    clock.start(timer::sequentiator_set_free_level);
     sequence.set_free_level();
-    clock.stop(" sequentiator: set free level ");
-    clock.stop(" sequentiator: evolve: part B: set free level ");
-    clock.stop(" sequentiator: evolve: part B ");
-    clock.stop(" sequentiator: evolve ");
+    clock.stop(timer::sequentiator_set_free_level);
+    clock.stop(timer::sequentiator_evolve_part_b_set_free_level);
+    clock.stop(timer::sequentiator_evolve_part_b);
+    clock.stop(timer::sequentiator_evolve);
 
     if (sequence.nodes().size() == 1) {
       topology::experimental_point ep(sequence.nodes_[0].c().ep());
@@ -1960,14 +2059,14 @@ bool sequentiator::evolve(topology::sequence &sequence) {
   }
 
   topology::cell newcell = sequence.last_node().links()[ilink];
-  clock.start(" sequentiator: evolve: part B: noc ", "cumulative");
+  clock.start(timer::sequentiator_evolve_part_b_noc);
   topology::node newnode = local_cluster_->node_of_cell(newcell);
   //  topology::node newnode = local_cluster_->nodes()[local_cluster_->node_index_of_cell(newcell)];
-  clock.stop(" sequentiator: evolve: part B: noc ");
+  clock.stop(timer::sequentiator_evolve_part_b_noc);
   newnode.set_free(false);  // standard initialization
 
-  clock.stop(" sequentiator: evolve: part B ");
-  clock.start(" sequentiator: evolve: part C ", "cumulative");
+  clock.stop(timer::sequentiator_evolve_part_b);
+  clock.start(timer::sequentiator_evolve_part_c);
 
   if (sequence_size == 1) {
     // since it's the 2nd cell, only the four
@@ -1975,12 +2074,12 @@ bool sequentiator::evolve(topology::sequence &sequence) {
     // this link has no freedom left
 
     sequence.nodes_.push_back(newnode);
-    clock.start(" sequentiator: set free level ", "cumulative");
+    clock.start(timer::sequentiator_set_free_level);
     sequence.set_free_level();
-    clock.stop(" sequentiator: set free level ");
+    clock.stop(timer::sequentiator_set_free_level);
 
-    clock.stop(" sequentiator: evolve: part C ");
-    clock.stop(" sequentiator: evolve ");
+    clock.stop(timer::sequentiator_evolve_part_c);
+    clock.stop(timer::sequentiator_evolve);
     return true;
   }
 
@@ -1990,12 +2089,12 @@ bool sequentiator::evolve(topology::sequence &sequence) {
   m.message("CAT::sequentiator::evolve: points have been added ", mybhep::VERBOSE);
   fflush(stdout);
 
-  clock.start(" sequentiator: set free level ", "cumulative");
+  clock.start(timer::sequentiator_set_free_level);
   sequence.set_free_level();
-  clock.stop(" sequentiator: set free level ");
+  clock.stop(timer::sequentiator_set_free_level);
 
-  clock.stop(" sequentiator: evolve: part C ");
-  clock.stop(" sequentiator: evolve ");
+  clock.stop(timer::sequentiator_evolve_part_c);
+  clock.stop(timer::sequentiator_evolve);
   return true;
 }
 
@@ -2003,7 +2102,7 @@ bool sequentiator::evolve(topology::sequence &sequence) {
 bool sequentiator::good_first_node(topology::node &node_) {
   //*************************************************************
 
-  clock.start(" sequentiator: good first node ", "cumulative");
+  clock.start(timer::sequentiator_good_first_node);
 
   const string type = node_.topological_type();
 
@@ -2074,7 +2173,7 @@ bool sequentiator::good_first_node(topology::node &node_) {
     }
   }
 
-  clock.stop(" sequentiator: good first node ");
+  clock.stop(timer::sequentiator_good_first_node);
   return true;
 }
 
@@ -2082,7 +2181,7 @@ bool sequentiator::good_first_node(topology::node &node_) {
 void sequentiator::make_families() {
   //*************************************************************
 
-  clock.start(" sequentiator: make families ", "cumulative");
+  clock.start(timer::sequentiator_make_families);
 
   families_.clear();
 
@@ -2121,7 +2220,7 @@ void sequentiator::make_families() {
     }
   }
 
-  clock.stop(" sequentiator: make families ");
+  clock.stop(timer::sequentiator_make_families);
 
   return;
 }
@@ -2148,10 +2247,28 @@ void sequentiator::print_families(void) {
 bool sequentiator::make_scenarios(topology::tracked_data &td, bool after_sultan) {
   //*************************************************************
 
-  clock.start(" sequentiator: make scenarios ", "cumulative");
+  clock.start(timer::sequentiator_make_scenarios);
 
   if (level >= mybhep::VERBOSE) print_families();
 
+  // Scenarios are tried with the occupancy of the cells and calos by their
+  // sequences, updated as sequences are added, rather than recounted each time
+  const size_t ncells = td.get_cells().size();
+  const size_t ncalos = td.get_calos().size();
+  std::map<std::string, size_t> first_of_name;
+  footprints_.clear();
+  name_index_.clear();
+  for (std::vector<topology::sequence>::iterator iseq = sequences_.begin();
+       iseq != sequences_.end(); ++iseq) {
+    footprints_.push_back(topology::scenario_occupancy::make_footprint(*iseq, ncells, ncalos));
+    name_index_.push_back(
+        first_of_name.insert(std::make_pair(iseq->name(), iseq - sequences_.begin()))
+            .first->second);
+  }
+
+  scenario_candidates_ = 0;
+  scenario_clock.restart();
+
   size_t jmin, nfree, noverlaps;
   double Chi2;
   int ndof;
@@ -2162,6 +2279,11 @@ bool sequentiator::make_scenarios(topology::tracked_data &td, bool after_sultan)
       return false;
     }
 
+    if (over_scenario_budget()) {
+      td.set_truncated(true);
+      break;
+    }
+
     m.message("CAT::sequentiator::make_scenarios: begin scenario with sequence ", iseq->name(),
               mybhep::VVERBOSE);
     if (level >= mybhep::VVERBOSE) print_a_sequence(*iseq, after_sultan);
@@ -2169,9 +2291,11 @@ bool sequentiator::make_scenarios(topology::tracked_data &td, bool after_sultan)
     topology::scenario sc;
     sc.level_ = level;
     sc.set_probmin(probmin);
-    sc.sequences_.push_back(*iseq);
-    sc.calculate_n_free_families(td.get_cells(), td.get_calos());
-    sc.calculate_n_overlaps(td.get_cells(), td.get_calos());
+    occupancy_.reset(ncells, ncalos);
+    in_scenario_.assign(sequences_.size(), false);
+    add_to_scenario(sc, iseq - sequences_.begin());
+    sc.set_n_free_families(occupancy_.n_free_families());
+    sc.set_n_overlaps(occupancy_.n_overlaps());
     sc.calculate_chi2();
 
     while (can_add_family(sc, &jmin, &nfree, &Chi2, &noverlaps, &ndof, td, after_sultan)) {
@@ -2180,7 +2304,7 @@ bool sequentiator::make_scenarios(topology::tracked_data &td, bool after_sultan)
       if (level >= mybhep::VVERBOSE) print_a_sequence(sequences_[jmin], after_sultan);
       m.message("CAT::sequentiator::make_scenarios: nfree ", nfree, " noverls ", noverlaps,
                 " Chi2 ", Chi2, mybhep::VVERBOSE);
-      sc.sequences_.push_back(sequences_[jmin]);
+      add_to_scenario(sc, jmin);
       sc.set_n_free_families(nfree);
       sc.set_helix_chi2(Chi2);
       sc.set_ndof(ndof);
@@ -2195,6 +2319,12 @@ bool sequentiator::make_scenarios(topology::tracked_data &td, bool after_sultan)
     return false;
   }
 
+  if (td.truncated()) {
+    m.message("CAT::sequentiator::make_scenarios: search stopped after ", scenario_candidates_,
+              " candidates and ", scenario_clock.read(), " ms, with ", scenarios_.size(), " of ",
+              sequences_.size(), " scenarios ", mybhep::NORMAL);
+  }
+
   direct_scenarios_out_of_foil();
 
   if (level >= mybhep::VERBOSE) print_scenarios(after_sultan);
@@ -2208,12 +2338,12 @@ bool sequentiator::make_scenarios(topology::tracked_data &td, bool after_sultan)
 
     td.scenarios_.push_back(scenarios_[index_tmp]);
 
-    clock.stop(" sequentiator: make scenarios ");
+    clock.stop(timer::sequentiator_make_scenarios);
     return true;
   }
 
   m.message("CAT::sequentiator::make_scenarios: not made scenario ", mybhep::VERBOSE);
-  clock.stop(" sequentiator: make scenarios ");
+  clock.stop(timer::sequentiator_make_scenarios);
 
   return false;
 }
@@ -2253,83 +2383,120 @@ bool sequentiator::can_add_family(topology::scenario &sc, size_t *jmin, size_t *
 
   if (late()) return false;
 
-  clock.start(" sequentiator: can add family ", "cumulative");
+  clock.start(timer::sequentiator_can_add_family);
 
   bool ok = false;
 
   if (sc.n_free_families() == 0) {
-    clock.stop(" sequentiator: can add family ");
+    clock.stop(timer::sequentiator_can_add_family);
     return false;
   }
 
-#if 0
-    clock.start(" sequentiator: copy logic scenario ", "cumulative");
-    topology::logic_scenario tmpmin = topology::logic_scenario(sc);
-    topology::logic_scenario tmpsave = tmpmin;
-    clock.stop(" sequentiator: copy logic scenario ");
-    topology::logic_scenario tmp;
-#else
-  clock.start(" sequentiator: copy scenario ", "cumulative");
-  topology::scenario tmpmin = sc;
-  clock.stop(" sequentiator: copy scenario ");
-  topology::scenario tmp = sc;
-#endif
-
-  std::map<string, int> scnames;
-  for (std::vector<topology::sequence>::iterator iseq = sc.sequences_.begin();
-       iseq != sc.sequences_.end(); ++iseq)
-    scnames[iseq->name()] = iseq - sc.sequences_.begin();
+  // The best scenario so far is sc, or sc with sequence *jmin added once ok.
+  // scenario::better_scenario_than ranks scenarios on their overlaps and free
+  // families first, which the occupancy gives for each candidate: a candidate
+  // which is worse on them is dropped without building it, one which is better
+  // is kept without building it, and only on a tie are both built to be
+  // compared on their vertexes and chi2.
+  size_t best_nfree = sc.n_free_families();
+  size_t best_noverlaps = sc.n_overlaps();
+  topology::scenario tmpmin;
+  bool tmpmin_is_built = false;
+
+  for (size_t j = 0; j < sequences_.size(); ++j) {
+    if (in_scenario_[name_index_[j]]) continue;
+
+    if (over_scenario_budget()) {
+      td.set_truncated(true);
+      break;
+    }
+    ++scenario_candidates_;
 
-  for (std::vector<topology::sequence>::iterator jseq = sequences_.begin();
-       jseq != sequences_.end(); ++jseq) {
-    if (scnames.count(jseq->name())) continue;
-
-#if 0
-        clock.start(" sequentiator: copy logic scenario ", "cumulative");
-        tmp = tmpsave;
-        clock.stop(" sequentiator: copy logic scenario ");
-        clock.start(" sequentiator: copy logic sequence ", "cumulative");
-        tmp.sequences_.push_back(topology::logic_sequence(*jseq));
-        clock.stop(" sequentiator: copy logic sequence ");
-#else
-    clock.start(" sequentiator: copy scenario ", "cumulative");
-    tmp = sc;
-    clock.stop(" sequentiator: copy scenario ");
-    clock.start(" sequentiator: copy sequence ", "cumulative");
-    tmp.sequences_.push_back(*jseq);
-    clock.stop(" sequentiator: copy sequence ");
-#endif
-
-    clock.start(" sequentiator: calculate scenario ", "cumulative");
-    tmp.calculate_n_free_families(td.get_cells(), td.get_calos());
-    tmp.calculate_n_overlaps(td.get_cells(), td.get_calos());
-    tmp.calculate_chi2();
-    clock.stop(" sequentiator: calculate scenario ");
-
-    m.message("CAT::sequentiator::can_add_family: ...try to add sequence ", jseq->name(),
-              mybhep::VVERBOSE);
-    if (level >= mybhep::VVERBOSE) print_a_sequence(*jseq, after_sultan);
-    m.message("CAT::sequentiator::can_add_family: ...nfree ", tmp.n_free_families(), " noverls ",
-              tmp.n_overlaps(), " chi2 ", tmp.helix_chi2(), " prob ", tmp.helix_Prob(),
+    const topology::sequence &seq = sequences_[j];
+
+    clock.start(timer::sequentiator_calculate_scenario);
+    occupancy_.add(footprints_[j]);
+    const size_t tmp_nfree = occupancy_.n_free_families();
+    const size_t tmp_noverlaps = occupancy_.n_overlaps();
+    occupancy_.remove(footprints_[j]);
+    const double tmp_chi2 = sc.helix_chi2() + seq.helix_chi2();
+    clock.stop(timer::sequentiator_calculate_scenario);
+
+    m.message("CAT::sequentiator::can_add_family: ...try to add sequence ", seq.name(),
               mybhep::VVERBOSE);
+    if (level >= mybhep::VVERBOSE) print_a_sequence(seq, after_sultan);
+    m.message("CAT::sequentiator::can_add_family: ...nfree ", tmp_nfree, " noverls ",
+              tmp_noverlaps, " chi2 ", tmp_chi2, mybhep::VVERBOSE);
+
+    clock.start(timer::sequentiator_better_scenario);
+    const long delta = (long)(tmp_noverlaps + 2 * tmp_nfree) -
+                       (long)(best_noverlaps + 2 * best_nfree);
+    bool better = delta < 0;
+    if (delta == 0) {
+      clock.start(timer::sequentiator_copy_scenario);
+      topology::scenario tmp = sc;
+      if (ok && !tmpmin_is_built) {
+        tmpmin = sc;
+        tmpmin.sequences_.push_back(sequences_[*jmin]);
+        tmpmin.set_n_free_families(best_nfree);
+        tmpmin.set_n_overlaps(best_noverlaps);
+        tmpmin.calculate_chi2();
+        tmpmin_is_built = true;
+      }
+      clock.stop(timer::sequentiator_copy_scenario);
+      clock.start(timer::sequentiator_copy_sequence);
+      tmp.sequences_.push_back(seq);
+      clock.stop(timer::sequentiator_copy_sequence);
+      tmp.set_n_free_families(tmp_nfree);
+      tmp.set_n_overlaps(tmp_noverlaps);
+      tmp.calculate_chi2();
+
+      better = tmp.better_scenario_than(ok ? tmpmin : sc, 2. * CellDistance);
+      if (better) {
+        tmpmin = std::move(tmp);
+        tmpmin_is_built = true;
+      }
+    } else if (better) {
+      tmpmin_is_built = false;
+    }
 
-    clock.start(" sequentiator: better scenario ", "cumulative");
-    if (tmp.better_scenario_than(tmpmin, 2. * CellDistance)) {
-      *jmin = jseq - sequences_.begin();
-      *nfree = tmp.n_free_families();
-      *noverlaps = tmp.n_overlaps();
-      *Chi2 = tmp.helix_chi2();
-      *ndof = tmp.ndof();
-      tmpmin = tmp;
+    if (better) {
+      *jmin = j;
+      *nfree = tmp_nfree;
+      *noverlaps = tmp_noverlaps;
+      *Chi2 = tmp_chi2;
+      *ndof = sc.ndof() + seq.ndof();
+      best_nfree = tmp_nfree;
+      best_noverlaps = tmp_noverlaps;
       ok = true;
     }
-    clock.stop(" sequentiator: better scenario ");
+    clock.stop(timer::sequentiator_better_scenario);
   }
 
-  clock.stop(" sequentiator: can add family ");
+  clock.stop(timer::sequentiator_can_add_family);
   return ok;
 }
 
+//*************************************************************
+bool sequentiator::over_scenario_budget() {
+  //*************************************************************
+
+  if (MaxScenarioCandidates > 0 && scenario_candidates_ >= MaxScenarioCandidates) return true;
+
+  return scenario_clock.read() >= MaxScenarioTime;
+}
+
+//*************************************************************
+void sequentiator::add_to_scenario(topology::scenario &sc, size_t j) {
+  //*************************************************************
+
+  sc.sequences_.push_back(sequences_[j]);
+  occupancy_.add(footprints_[j]);
+  in_scenario_[name_index_[j]] = true;
+
+  return;
+}
+
 //*************************************************************
 topology::plane sequentiator::get_foil_plane() {
   //*************************************************************
@@ -2438,7 +2605,7 @@ void sequentiator::refine_sequences_near_walls(std::vector<topology::calorimeter
 }
 
 //*************************************************************
-bool sequentiator::belongs_to_other_family(topology::cell c, topology::sequence *iseq) {
+bool sequentiator::belongs_to_other_family(const topology::cell &c, topology::sequence *iseq) {
   //*************************************************************
 
   for (std::vector<topology::sequence>::iterator jseq = sequences_.begin();
@@ -2455,7 +2622,7 @@ bool sequentiator::belongs_to_other_family(topology::cell c, topology::sequence
 void sequentiator::interpret_physics(std::vector<topology::calorimeter_hit> &calos) {
   //*************************************************************
 
-  clock.start(" sequentiator: interpret physics ", "cumulative");
+  clock.start(timer::sequentiator_interpret_physics);
 
   m.message("CAT::sequentiator::interpret_physics: interpreting physics of ", sequences_.size(),
             " sequences with ", calos.size(), " calorimeter hits ", mybhep::VVERBOSE);
@@ -2872,7 +3039,7 @@ void sequentiator::interpret_physics(std::vector<topology::calorimeter_hit> &cal
     continue;
   }
 
-  clock.stop(" sequentiator: interpret physics ");
+  clock.stop(timer::sequentiator_interpret_physics);
 
   return;
 }
@@ -3182,7 +3349,7 @@ void sequentiator::interpret_physics_after_sultan(std::vector<topology::calorime
 
   // for sultan, conserve_clustering_from_removal_of_cells should be false (N3), true (SN)
   // for nemor, conserve_clustering_from_removal_of_cells should be true
-  clock.start(" sequentiator: interpret physics after sultan ", "cumulative");
+  clock.start(timer::sequentiator_interpret_physics_after_sultan);
 
   m.message("CAT::sequentiator::interpret_physics_after_sultan: interpreting physics of ",
             sequences_.size(), " sequences with ", calos.size(), " calorimeter hits ",
@@ -3315,7 +3482,7 @@ void sequentiator::interpret_physics_after_sultan(std::vector<topology::calorime
     continue;
   }
 
-  clock.stop(" sequentiator: interpret physics after sultan ");
+  clock.stop(timer::sequentiator_interpret_physics_after_sultan);
 
   return;
 }
@@ -3493,7 +3660,7 @@ void sequentiator::print_a_scenario(const topology::scenario &scenario, bool aft
 void sequentiator::add_pair(const topology::sequence &newsequence) {
   //*************************************************************
 
-  clock.start(" sequentiator: add pair ", "cumulative");
+  clock.start(timer::sequentiator_add_pair);
 
   m.message("CAT::sequentiator::add_pair: Entering... ", mybhep::VVERBOSE);
   fflush(stdout);
@@ -3501,7 +3668,7 @@ void sequentiator::add_pair(const topology::sequence &newsequence) {
   if (newsequence.nodes().size() != 2) {
     m.message("CAT::sequentiator::add_pair: problem: pair has size ", newsequence.nodes().size(),
               mybhep::NORMAL);
-    clock.stop(" sequentiator: add pair ");
+    clock.stop(timer::sequentiator_add_pair);
     return;
   }
 
@@ -3510,12 +3677,12 @@ void sequentiator::add_pair(const topology::sequence &newsequence) {
     m.message("CAT::sequentiator::add_pair: problem: node ", newsequence.nodes_[0].c().id(),
               " has no pair ", newsequence.nodes()[0].c().id(), "-",
               newsequence.nodes()[1].c().id(), mybhep::NORMAL);
-    clock.stop(" sequentiator: add pair ");
+    clock.stop(timer::sequentiator_add_pair);
     return;
   }
 
-  topology::node na = newsequence.nodes()[0];
-  topology::node nb = newsequence.nodes()[1];
+  const topology::node &na = newsequence.nodes()[0];
+  const topology::node &nb = newsequence.nodes()[1];
 
   std::vector<topology::node> nodes;
   nodes.push_back(na);
@@ -3544,9 +3711,9 @@ void sequentiator::add_pair(const topology::sequence &newsequence) {
         iccc->set_all_used();
     }
 
-    clock.start(" sequentiator: set free level ", "cumulative");
+    clock.start(timer::sequentiator_set_free_level);
     pair.set_free_level();
-    clock.stop(" sequentiator: set free level ");
+    clock.stop(timer::sequentiator_set_free_level);
 
     make_name(pair);
     sequences_.push_back(pair);
@@ -3563,7 +3730,7 @@ void sequentiator::add_pair(const topology::sequence &newsequence) {
     if (erased) erased = clean_up_sequences();
   }
 
-  clock.stop(" sequentiator: add pair ");
+  clock.stop(timer::sequentiator_add_pair);
   return;
 }
 
@@ -3571,10 +3738,10 @@ void sequentiator::add_pair(const topology::sequence &newsequence) {
 bool sequentiator::clean_up_sequences() {
   //*************************************************************
 
-  clock.start(" sequentiator: clean up sequences ", "cumulative");
+  clock.start(timer::sequentiator_clean_up_sequences);
 
   if (sequences_.size() < 2) {
-    clock.stop(" sequentiator: clean up sequences ");
+    clock.stop(timer::sequentiator_clean_up_sequences);
     return false;
   }
 
@@ -3649,8 +3816,8 @@ bool sequentiator::clean_up_sequences() {
          in++) {
       if (changed) continue;
       if (in - iseq->nodes_.begin() + 1 >= (int)iseq->nodes_.size()) break;
-      topology::node nA = *in;
-      topology::node nB = iseq->nodes_[in - iseq->nodes_.begin() + 1];
+      const topology::node &nA = *in;
+      const topology::node &nB = *(in + 1);
       if (!sequence_is_within_range(nA, nB, *iseq)) {
         m.message("CAT::sequentiator::clean_up_sequences: erased sequence ",
                   iseq - sequences_.begin(), " not in range", mybhep::VERBOSE);
@@ -3746,7 +3913,7 @@ bool sequentiator::clean_up_sequences() {
     continue;
   }
 
-  clock.stop(" sequentiator: clean up sequences ");
+  clock.stop(timer::sequentiator_clean_up_sequences);
   return changed;
 }
 
@@ -3763,7 +3930,7 @@ double sequentiator::distance_from_foil(const topology::experimental_point &ep)
 bool sequentiator::direct_out_of_foil(void) {
   //*************************************************************
 
-  clock.start(" sequentiator: direct out of foil ", "cumulative");
+  clock.start(timer::sequentiator_direct_out_of_foil);
 
   for (std::vector<topology::sequence>::iterator iseq = sequences_.begin();
        iseq != sequences_.end(); ++iseq) {
@@ -3790,7 +3957,7 @@ bool sequentiator::direct_out_of_foil(void) {
     }
 
   */
-  clock.stop(" sequentiator: direct out of foil ");
+  clock.stop(timer::sequentiator_direct_out_of_foil);
 
   return true;
 }
@@ -3799,7 +3966,7 @@ bool sequentiator::direct_out_of_foil(void) {
 bool sequentiator::direct_scenarios_out_of_foil(void) {
   //*************************************************************
 
-  clock.start(" sequentiator: direct scenarios out of foil ", "cumulative");
+  clock.start(timer::sequentiator_direct_scenarios_out_of_foil);
 
   for (std::vector<topology::scenario>::iterator isc = scenarios_.begin(); isc != scenarios_.end();
        ++isc) {
@@ -3815,7 +3982,7 @@ bool sequentiator::direct_scenarios_out_of_foil(void) {
       }
     }
   }
-  clock.stop(" sequentiator: direct scenarios out of foil ");
+  clock.stop(timer::sequentiator_direct_scenarios_out_of_foil);
 
   return true;
 }
@@ -3824,19 +3991,19 @@ bool sequentiator::direct_scenarios_out_of_foil(void) {
 bool sequentiator::there_is_free_sequence_beginning_with(const topology::cell &c, size_t *index) {
   //*************************************************************
 
-  clock.start(" sequentiator: there is free sequence beginning with ", "cumulative");
+  clock.start(timer::sequentiator_there_is_free_sequence_beginning_with);
 
   for (std::vector<topology::sequence>::iterator iseq = sequences_.begin();
        iseq != sequences_.end(); ++iseq)
     if (iseq->nodes()[0].c().id() == c.id()) {
       if (iseq->Free()) {
         *index = iseq - sequences_.begin();
-        clock.stop(" sequentiator: there is free sequence beginning with ");
+        clock.stop(timer::sequentiator_there_is_free_sequence_beginning_with);
         return true;
       }
     }
 
-  clock.stop(" sequentiator: there is free sequence beginning with ");
+  clock.stop(timer::sequentiator_there_is_free_sequence_beginning_with);
   return false;
 }
 
@@ -4273,16 +4440,17 @@ void sequentiator::FillGGResiduals(topology::sequence & /*tp*/, topology::sequen
 }
 
 //*************************************************************
-bool sequentiator::sequence_is_within_range(topology::node nodeA, topology::node nodeB,
-                                            topology::sequence seq) {
+bool sequentiator::sequence_is_within_range(const topology::node &nodeA,
+                                            const topology::node &nodeB,
+                                            const topology::sequence &seq) {
   //*************************************************************
 
   if (gaps_Z.size() == 0) return true;
 
-  topology::experimental_point epA = nodeA.ep();
-  topology::experimental_point epB = nodeB.ep();
-  topology::cell cA = nodeA.c();
-  topology::cell cB = nodeB.c();
+  const topology::experimental_point &epA = nodeA.ep();
+  const topology::experimental_point &epB = nodeB.ep();
+  const topology::cell &cA = nodeA.c();
+  const topology::cell &cB = nodeB.c();
 
   int gnA = gap_number(cA);
   int gnB = gap_number(cB);
@@ -4417,7 +4585,7 @@ bool sequentiator::match_gaps(std::vector<topology::calorimeter_hit> &calos) {
   // if( gaps_Z.size() <= 1 ) return true;
   if (sequences_.size() < 2) return true;
 
-  clock.start(" sequentiator: match gaps ", "cumulative");
+  clock.start(timer::sequentiator_match_gaps);
 
   if (level >= mybhep::VERBOSE) {
     print_families();
@@ -4490,7 +4658,7 @@ bool sequentiator::match_gaps(std::vector<topology::calorimeter_hit> &calos) {
     if (!matched[mybhep::int_from_string(iseq->family())]) newseqs.push_back(*iseq);
   }
 
-  set_sequences(newseqs);
+  set_sequences(std::move(newseqs));
   make_families();
 
   // free(matched);
@@ -4510,7 +4678,7 @@ bool sequentiator::can_match(topology::sequence &s, size_t *jmin, bool &bestinve
 
   if (late()) return false;
 
-  clock.start(" sequentiator: can match ", "cumulative");
+  clock.start(timer::sequentiator_can_match);
 
   bool ok = false;
   double limit_diagonal = sqrt(2.) * cos(M_PI / 8.) * CellDistance;
@@ -4690,7 +4858,7 @@ bool sequentiator::can_match(topology::sequence &s, size_t *jmin, bool &bestinve
     }
   }
 
-  clock.stop(" sequentiator: can match ");
+  clock.stop(timer::sequentiator_can_match);
   return ok;
 }
 
@@ -4700,7 +4868,7 @@ bool sequentiator::select_nemo_tracks(topology::tracked_data &__tracked_data) {
 
   if (SuperNemo) return true;
 
-  std::vector<topology::sequence> nemo_sequences = __tracked_data.get_nemo_sequences();
+  const std::vector<topology::sequence> &nemo_sequences = __tracked_data.get_nemo_sequences();
 
   m.message("CAT::sequentiator::select_nemo_track: selecting events based on nemo tracks ",
             mybhep::VVERBOSE);
@@ -4725,7 +4893,7 @@ bool sequentiator::select_nemo_tracks(topology::tracked_data &__tracked_data) {
     return false;
   }
 
-  std::vector<topology::calorimeter_hit> calos = __tracked_data.get_calos();
+  const std::vector<topology::calorimeter_hit> &calos = __tracked_data.get_calos();
 
   if (nemo_sequences[0].calo_helix_id() == nemo_sequences[1].calo_helix_id()) {
     m.message("CAT::sequentiator::select_nemo_track: reject: same calo ",
@@ -4733,8 +4901,8 @@ bool sequentiator::select_nemo_tracks(topology::tracked_data &__tracked_data) {
     return false;
   }
 
-  topology::calorimeter_hit caloA = calos[nemo_sequences[0].calo_helix_id()];
-  topology::calorimeter_hit caloB = calos[nemo_sequences[1].calo_helix_id()];
+  const topology::calorimeter_hit &caloA = calos[nemo_sequences[0].calo_helix_id()];
+  const topology::calorimeter_hit &caloB = calos[nemo_sequences[1].calo_helix_id()];
 
   if (caloA.e().value() < 0.2) {
     m.message("CAT::sequentiator::select_nemo_track: reject: 1st calo has energy ",
@@ -27,6 +27,8 @@
 #endif
 
 #include <iostream>
+#include <memory>
+#include <utility>
 #include <vector>
 #include <stdio.h>
 #include <stdlib.h>
@@ -48,7 +50,9 @@
 #include <CATAlgorithm/tracked_data_base.h>
 #include <CATAlgorithm/helix.h>
 #include <CATAlgorithm/scenario.h>
+#include <CATAlgorithm/scenario_occupancy.h>
 #include <CATAlgorithm/logic_scenario.h>
+#include <CATAlgorithm/task_pool.h>
 
 namespace CAT {
 class sequentiator {
@@ -69,6 +73,7 @@ class sequentiator {
   void readDstProper(void);
 
   bool sequentiate(topology::tracked_data &tracked_data);
+  void sequentiate_clusters(std::vector<topology::cluster> &clusters);
   void sequentiate_cluster(topology::cluster &cluster);
   bool sequentiate_after_sultan(topology::tracked_data &tracked_data,
                                 bool conserve_clustering_from_removal_of_cells);
@@ -81,8 +86,8 @@ class sequentiator {
   bool evolve(topology::sequence &sequence);
   void fill_links(topology::sequence *sequence);
   bool good_first_node(topology::node &node_);
-  void make_plots(topology::tracked_data __tracked_data);
-  void plot_hard_scattering(topology::tracked_data __tracked_data);
+  void make_plots(const topology::tracked_data &__tracked_data);
+  void plot_hard_scattering(const topology::tracked_data &__tracked_data);
   bool good_first_to_be_matched(topology::sequence &seq);
   bool match_gaps(std::vector<topology::calorimeter_hit> &calos);
   void match_to_calorimeter(std::vector<topology::calorimeter_hit> &calos,
@@ -93,18 +98,14 @@ class sequentiator {
   const std::vector<topology::cluster> &get_clusters() const { return clusters_; }
 
   //! set clusters
-  void set_clusters(std::vector<topology::cluster> clusters) {
-    clusters_.clear();
-    clusters_ = clusters;
-  }
+  void set_clusters(std::vector<topology::cluster> clusters) { clusters_ = std::move(clusters); }
 
   //! get sequences
   const std::vector<topology::sequence> &get_sequences() const { return sequences_; }
 
   //! set sequences
   void set_sequences(std::vector<topology::sequence> sequences) {
-    sequences_.clear();
-    sequences_ = sequences;
+    sequences_ = std::move(sequences);
   }
 
   bool late();
@@ -194,6 +195,29 @@ class sequentiator {
     return;
   }
 
+  //! maximum time in ms of the search for the best scenario of an event, 0 for no limit
+  void set_MaxScenarioTime(double v) {
+    if (v <= 0.0) {
+      MaxScenarioTime = std::numeric_limits<double>::quiet_NaN();
+    } else {
+      MaxScenarioTime = v;
+    }
+    return;
+  }
+
+  //! maximum number of candidate scenarios tried for an event, 0 for no limit
+  void set_MaxScenarioCandidates(size_t v) {
+    MaxScenarioCandidates = v;
+    return;
+  }
+
+  //! number of threads sequentiating the clusters of an event, 1 to run serially
+  //! The threads are started at initialization
+  void set_nthreads(size_t v) {
+    nthreads = v;
+    return;
+  }
+
   void set_PrintMode(bool v) {
     PrintMode = v;
     return;
@@ -267,6 +291,9 @@ class sequentiator {
     return;
   }
 
+  //! timers of the algorithm
+  Clock &get_clock() { return clock; }
+
   void set_len(double v) {
     len = v;
     return;
@@ -359,6 +386,12 @@ class sequentiator {
 
   Clock clock;
 
+  // time of the current sequentiation, to check it against MaxTime
+  clockable sequentiation_clock;
+
+  // time of the current search for scenarios, to check it against MaxScenarioTime
+  clockable scenario_clock;
+
   mybhep::prlevel level;
 
   mybhep::messenger m;
@@ -412,6 +445,9 @@ class sequentiator {
   bool NemoraOutput;
   bool N3_MC;
   double MaxTime;
+  double MaxScenarioTime;
+  size_t MaxScenarioCandidates;
+  size_t nthreads;
   bool SuperNemoChannel; /** New initialization modeof the algorithm
                           *  for SuperNEMO and usage from Channel by
                           *  Falaise and Hereward.
@@ -458,12 +494,42 @@ class sequentiator {
   std::vector<std::vector<size_t> > families_;
   std::vector<topology::scenario> scenarios_;
 
+  // work space of the search for scenarios: the footprint of each sequence, the
+  // index of the first sequence of the same name, the occupancy of the scenario
+  // being built and which names are in it, and the number of candidates tried
+  std::vector<topology::scenario_occupancy::footprint> footprints_;
+  std::vector<size_t> name_index_;
+  topology::scenario_occupancy occupancy_;
+  std::vector<bool> in_scenario_;
+  size_t scenario_candidates_;
+
+  // copies of this sequentiator with their own scratch state and the pool of
+  // threads they run on, made at initialization. A copy of a sequentiator makes
+  // workers of its own
+  struct parallel_workers {
+    std::vector<std::unique_ptr<sequentiator> > copies;
+    std::unique_ptr<task_pool> pool;
+
+    parallel_workers() {}
+    parallel_workers(const parallel_workers &) {}
+    parallel_workers &operator=(const parallel_workers &) {
+      pool.reset();
+      copies.clear();
+      return *this;
+    }
+  };
+  parallel_workers workers_;
+
+  void make_workers();
+
   bool make_scenarios(topology::tracked_data &td, bool after_sultan = false);
+  bool over_scenario_budget();
+  void add_to_scenario(topology::scenario &sc, size_t j);
   void interpret_physics(std::vector<topology::calorimeter_hit> &calos);
   void interpret_physics_after_sultan(std::vector<topology::calorimeter_hit> &calos,
                                       bool conserve_clustering_from_removal_of_cells);
   void refine_sequences_near_walls(std::vector<topology::calorimeter_hit> &calos);
-  bool belongs_to_other_family(topology::cell c, topology::sequence *iseq);
+  bool belongs_to_other_family(const topology::cell &c, topology::sequence *iseq);
   topology::plane get_foil_plane();
   topology::circle get_foil_circle();
   void print_sequences() const;
@@ -478,6 +544,7 @@ class sequentiator {
   size_t getCommonHits(topology::sequence &tp, topology::sequence &dp);
   void FillGGResiduals(topology::sequence &tp, topology::sequence &dp);
   void make_name(topology::sequence &seq);
+  void shift_family(topology::sequence &seq, int offset);
   bool near(const topology::cell &c, topology::calorimeter_hit &ch);
   double distance_from_foil(const topology::experimental_point &ep);
   bool direct_out_of_foil(void);
@@ -495,16 +562,20 @@ class sequentiator {
                  int &with_kink, int &cells_to_delete,
                  std::vector<topology::calorimeter_hit> &calos);
   bool select_nemo_tracks(topology::tracked_data &__tracked_data);
-  bool sequence_is_within_range(topology::node nodeA, topology::node nodeB, topology::sequence seq);
-  topology::joint find_best_matching_joint(topology::joint j, std::vector<topology::joint> js,
-                                           topology::cell A, topology::cell B, topology::cell C,
-                                           double *chi2, bool A_in_on_gap, bool B_is_on_gap);
+  bool sequence_is_within_range(const topology::node &nodeA, const topology::node &nodeB,
+                                const topology::sequence &seq);
+  topology::joint find_best_matching_joint(const topology::joint &j,
+                                           const std::vector<topology::joint> &js,
+                                           const topology::cell &A, const topology::cell &B,
+                                           const topology::cell &C, double *chi2,
+                                           bool A_in_on_gap, bool B_is_on_gap);
   bool build_sequences_from_ambiguous_alternatives(
-      std::vector<std::vector<topology::broken_line> > sets_of_bl_alternatives,
+      const std::vector<std::vector<topology::broken_line> > &sets_of_bl_alternatives,
       std::vector<topology::sequence> *seqs);
-  bool increase_iterations(std::vector<std::vector<topology::broken_line> > sets_of_bl_alternatives,
-                           std::vector<size_t> *iterations, int *block_which_is_increasing,
-                           int *first_augmented_block);
+  bool increase_iterations(
+      const std::vector<std::vector<topology::broken_line> > &sets_of_bl_alternatives,
+      std::vector<size_t> *iterations, int *block_which_is_increasing,
+      int *first_augmented_block);
   size_t near_level(const topology::cell &c1, const topology::cell &c2);
   void reassign_cells_based_on_helix(topology::sequence *seq);
 
@@ -0,0 +1,97 @@
+/* -*- mode: c++ -*- */
+#ifndef __CATAlgorithm__timers_h
+#define __CATAlgorithm__timers_h 1
+
+#include <cstddef>
+
+namespace CAT {
+
+// Timers of the CAT algorithms, each addressing one counter of a Clock.
+// Their names are listed in the same order in Clock.cpp
+enum class timer : size_t {
+  detector_fill_surfaces_rough,
+  detector_fill_surfaces_precise,
+  detector_draw_surfaces,
+  detector_continous,
+  sultan_initialize,
+  sultan_finalize,
+  sultan_read_dst_properties,
+  sultan_read_event,
+  sultan_make_calo_hit,
+  sultan_prepare_event,
+  sultan_reconstruct,
+  sultan_clusterize,
+  sultan_reconstruct_cluster,
+  sultan_order_cells,
+  clusterizer_initialize,
+  clusterizer_finalize,
+  clusterizer_read_dst_properties,
+  clusterizer_read_event,
+  clusterizer_make_calo_hit,
+  clusterizer_prepare_event,
+  clusterizer_clusterize,
+  clusterizer_clusterize_after_sultan,
+  clusterizer_is_good_couplet,
+  clusterizer_get_near_cells,
+  clusterizer_setup_clusters,
+  clusterizer_order_cells,
+  sequentiator_initialize,
+  sequentiator_finalize,
+  sequentiator_read_dst_properties,
+  sequentiator_sequentiate,
+  sequentiator_sequentiate_after_sultan,
+  sequentiator_reconstruct_efficiency,
+  sequentiator_make_new_sequence,
+  sequentiator_make_new_sequence_after_sultan,
+  sequentiator_increase_iterations,
+  sequentiator_build_sequences_from_ambiguous_alternatives,
+  sequentiator_make_copy_sequence,
+  sequentiator_make_copy_sequence_part_a,
+  sequentiator_make_copy_sequence_part_a_alpha,
+  sequentiator_copy_to_lfn,
+  sequentiator_make_copy_sequence_part_a_beta,
+  sequentiator_make_copy_sequence_evolve,
+  sequentiator_manage_copy_sequence,
+  sequentiator_get_link_index,
+  sequentiator_set_free_level,
+  sequentiator_make_copy_sequence_after_sultan,
+  sequentiator_make_copy_sequence_after_sultan_part_a,
+  sequentiator_make_copy_sequence_after_sultan_part_a_alpha,
+  sequentiator_make_copy_sequence_after_sultan_part_a_beta,
+  sequentiator_make_copy_sequence_after_sultan_evolve,
+  sequentiator_manage_copy_sequence_after_sultan,
+  sequentiator_evolve,
+  sequentiator_evolve_part_a,
+  sequentiator_evolve_part_b,
+  sequentiator_pick_new_cell,
+  sequentiator_evolve_part_b_set_free_level,
+  sequentiator_evolve_part_b_noc,
+  sequentiator_evolve_part_c,
+  sequentiator_good_first_node,
+  sequentiator_make_families,
+  sequentiator_make_scenarios,
+  sequentiator_can_add_family,
+  sequentiator_copy_logic_scenario,
+  sequentiator_copy_scenario,
+  sequentiator_copy_logic_sequence,
+  sequentiator_copy_sequence,
+  sequentiator_calculate_scenario,
+  sequentiator_better_scenario,
+  sequentiator_interpret_physics,
+  sequentiator_interpret_physics_after_sultan,
+  sequentiator_add_pair,
+  sequentiator_clean_up_sequences,
+  sequentiator_direct_out_of_foil,
+  sequentiator_direct_scenarios_out_of_foil,
+  sequentiator_there_is_free_sequence_beginning_with,
+  sequentiator_match_gaps,
+  sequentiator_can_match,
+  n_timers  // number of timers, keep last
+};
+
+//! name of timer t
+const char* timer_name(timer t);
+
+}  // namespace CAT
+
+#endif  // __CATAlgorithm__timers_h
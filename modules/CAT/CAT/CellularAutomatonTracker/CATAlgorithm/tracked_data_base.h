@@ -57,6 +57,9 @@ class tracked_data : public tracking_object {
   // is event skipped?
   bool skipped_;
 
+  // was the search for scenarios stopped by its time or candidate budget?
+  bool truncated_;
+
   //! Default constructor
   tracked_data() {
     appname_ = "tracked_data: ";
@@ -68,11 +71,18 @@ class tracked_data : public tracking_object {
     // nemo_sequences_.clear();
     selected_ = true;
     skipped_ = false;
+    truncated_ = false;
   }
 
   //! Default destructor
   virtual ~tracked_data(){};
 
+  //! copy and move constructors and assignments
+  tracked_data(const tracked_data &) = default;
+  tracked_data(tracked_data &&) = default;
+  tracked_data &operator=(const tracked_data &) = default;
+  tracked_data &operator=(tracked_data &&) = default;
+
   //! constructor
   tracked_data(const std::vector<cell>& cells, const std::vector<calorimeter_hit>& calos,
                const std::vector<cluster>& clusters, const std::vector<scenario>& scenarios,
@@ -90,6 +100,7 @@ class tracked_data : public tracking_object {
     nemo_sequences_ = nemo_sequences;
     selected_ = true;
     skipped_ = false;
+    truncated_ = false;
   }
 
   /*** dump ***/
@@ -146,6 +157,9 @@ class tracked_data : public tracking_object {
   //! set skipped
   void set_skipped(bool skipped) { skipped_ = skipped; }
 
+  //! set truncated
+  void set_truncated(bool truncated) { truncated_ = truncated; }
+
   //! get cells
   std::vector<cell>& get_cells() { return cells_; }
 
@@ -182,10 +196,14 @@ class tracked_data : public tracking_object {
   //! get skipped
   bool skipped() const { return skipped_; }
 
+  //! get truncated
+  bool truncated() const { return truncated_; }
+
   void reset() {
     cells_.clear();
     clusters_.clear();
     scenarios_.clear();
+    truncated_ = false;
   }
 };
 }  // namespace topology
@@ -47,134 +47,40 @@ class messenger {
   void set_level(prlevel clevel) { level_ = clevel; }
   /// Returns the print level
   prlevel level() const { return level_; }
-  /// Sends a message
-  /** The specified print level must be equal or smaller than the print level
-   * set to the messenger. For example, if the messenger is set to VVERBOSE
-   * any message will be printed. Instead, if the messenger is set to MUTE
-   * only messages flagged as MUTE will print
+  /// Returns true if messages of print level clevel are output
+  bool is_active(prlevel clevel) const { return clevel <= level_; }
+  /// Sends a message followed by variables d1, d2...
+  /** The specified print level, the last argument, must be equal or smaller
+   * than the print level set to the messenger. For example, if the messenger
+   * is set to VVERBOSE any message will be printed. Instead, if the messenger
+   * is set to MUTE only messages flagged as MUTE will print.
+   *
+   * The message and variables are only formatted when the message is
+   * printed: a string literal message is not converted to a std::string.
    *\ingroup base
    */
-  inline void message(const std::string& the_message, prlevel clevel) const {
-    if (clevel <= level_) std::clog << the_message << std::endl;
-  }
-  /// Sends a message followed by variable d
-  /** The specified print level must be equal or smaller than the print level
-   * set to the messenger.
-   *\ingroup base
-   */
-  template <class T>
-  inline void message(const std::string& the_message, const T& d, prlevel clevel) const {
-    if (clevel <= level_) std::clog << the_message << " " << d << std::endl;
+  template <class M, class... Args>
+  inline void message(const M& the_message, const Args&... args) const {
+    if (is_active(last_level(args...))) {
+      std::clog << the_message;
+      print_values(args...);
+    }
   }
 
-  /// Sends a message followed by variable d1 and d2
-  /** The specified print level must be equal or smaller than the print level
-   * set to the messenger.
-   *\ingroup base
-   */
-  template <class A, class B>
-  inline void message(const std::string& the_message, const A& d1, const B& d2,
-                      prlevel clevel) const {
-    if (clevel <= level_) std::clog << the_message << " " << d1 << " " << d2 << std::endl;
-  }
-  /// Sends a message followed by variable d1 d2 and d3
-  /** The specified print level must be equal or smaller than the print level
-   * set to the messenger.
-   *\ingroup base
-   */
-  template <class A, class B, class C>
-  inline void message(const std::string& the_message, const A& d1, const B& d2, const C& d3,
-                      prlevel clevel) const {
-    if (clevel <= level_)
-      std::clog << the_message << " " << d1 << " " << d2 << " " << d3 << std::endl;
-  }
-  /// Sends a message followed by variable d1 d2, d3 and d4
-  /** The specified print level must be equal or smaller than the print level
-   * set to the messenger.
-   *\ingroup base
-   */
-  template <class A, class B, class C, class D>
-  inline void message(const std::string& the_message, const A& d1, const B& d2, const C& d3,
-                      const D& d4, prlevel clevel) const {
-    if (clevel <= level_)
-      std::clog << the_message << " " << d1 << " " << d2 << " " << d3 << " " << d4 << std::endl;
-  }
-  /// Sends a message followed by variable d1 d2, d3 d4 and d5
-  /** The specified print level must be equal or smaller than the print level
-   * set to the messenger.
-   *\ingroup base
-   */
-  template <class A, class B, class C, class D, class E>
-  inline void message(const std::string& the_message, const A& d1, const B& d2, const C& d3,
-                      const D& d4, const E& d5, prlevel clevel) const {
-    if (clevel <= level_)
-      std::clog << the_message << " " << d1 << " " << d2 << " " << d3 << " " << d4 << " " << d5
-                << std::endl;
+ private:
+  /// Returns the print level closing the arguments of a message
+  static prlevel last_level(prlevel clevel) { return clevel; }
+  template <class T, class... Args>
+  static prlevel last_level(const T&, const Args&... args) {
+    return last_level(args...);
   }
 
-  /// Sends a message followed by variable d1 d2, d3 d4, d5, and d6
-  /** The specified print level must be equal or smaller than the print level
-   * set to the messenger.
-   *\ingroup base
-   */
-  template <class A, class B, class C, class D, class E, class F>
-  inline void message(const std::string& the_message, const A& d1, const B& d2, const C& d3,
-                      const D& d4, const E& d5, const F& d6, prlevel clevel) const {
-    if (clevel <= level_)
-      std::clog << the_message << " " << d1 << " " << d2 << " " << d3 << " " << d4 << " " << d5
-                << " " << d6 << std::endl;
-  }
-  /// Sends a message followed by variable d1 d2, d3 d4, d5, and d6 d7
-  /** The specified print level must be equal or smaller than the print level
-   * set to the messenger.
-   *\ingroup base
-   */
-  template <class A, class B, class C, class D, class E, class F, class G>
-  inline void message(const std::string& the_message, const A& d1, const B& d2, const C& d3,
-                      const D& d4, const E& d5, const F& d6, const G& d7, prlevel clevel) const {
-    if (clevel <= level_)
-      std::clog << the_message << " " << d1 << " " << d2 << " " << d3 << " " << d4 << " " << d5
-                << " " << d6 << " " << d7 << std::endl;
-  }
-  /// Sends a message followed by variable d1 d2, d3 d4, d5, d7 d8
-  /** The specified print level must be equal or smaller than the print level
-   * set to the messenger.
-   *\ingroup base
-   */
-  template <class A, class B, class C, class D, class E, class F, class G, class H>
-  inline void message(const std::string& the_message, const A& d1, const B& d2, const C& d3,
-                      const D& d4, const E& d5, const F& d6, const G& d7, const H& d8,
-                      prlevel clevel) const {
-    if (clevel <= level_)
-      std::clog << the_message << " " << d1 << " " << d2 << " " << d3 << " " << d4 << " " << d5
-                << " " << d6 << " " << d7 << " " << d8 << std::endl;
-  }
-  /// Sends a message followed by variable d1 d2, d3 d4, d5, d7 d8 d9
-  /** The specified print level must be equal or smaller than the print level
-   * set to the messenger.
-   *\ingroup base
-   */
-  template <class A, class B, class C, class D, class E, class F, class G, class H, class I>
-  inline void message(const std::string& the_message, const A& d1, const B& d2, const C& d3,
-                      const D& d4, const E& d5, const F& d6, const G& d7, const H& d8, const I& d9,
-                      prlevel clevel) const {
-    if (clevel <= level_)
-      std::clog << the_message << " " << d1 << " " << d2 << " " << d3 << " " << d4 << " " << d5
-                << " " << d6 << " " << d7 << " " << d8 << " " << d9 << std::endl;
-  }
-  /// Sends a message followed by variable d1 d2, d3 d4, d5, d7 d8 d9 d10
-  /** The specified print level must be equal or smaller than the print level
-   * set to the messenger.
-   *\ingroup base
-   */
-  template <class A, class B, class C, class D, class E, class F, class G, class H, class I,
-            class J>
-  inline void message(const std::string& the_message, const A& d1, const B& d2, const C& d3,
-                      const D& d4, const E& d5, const F& d6, const G& d7, const H& d8, const I& d9,
-                      const J& d10, prlevel clevel) const {
-    if (clevel <= level_)
-      std::clog << the_message << " " << d1 << " " << d2 << " " << d3 << " " << d4 << " " << d5
-                << " " << d6 << " " << d7 << " " << d8 << " " << d9 << " " << d10 << std::endl;
+  /// Prints the variables of a message, separated by spaces
+  static void print_values(prlevel) { std::clog << std::endl; }
+  template <class T, class... Args>
+  static void print_values(const T& d, const Args&... args) {
+    std::clog << " " << d;
+    print_values(args...);
   }
 };
 }  // namespace mybhep
@@ -2,108 +2,127 @@
 
 #include <sultan/Clock.h>
 #include <algorithm>
+#include <vector>
 
 namespace SULTAN {
 
 using namespace std;
 
-//! Default constructor
-Clock::Clock() { return; }
+namespace {
+// Names of the timers, in the order of their declaration in timers.h
+const char *const timer_names[] = {
+    "clusterizer: finalize",
+    "clusterizer: prepare event",
+    "clusterizer: clusterize",
+    "clusterizer: get near cells",
+    "clusterizer: setup_clusters",
+    "experimental_legendre_vector: add_helix_to_clusters",
+    "experimental_legendre_vector: add_a_helix_to_clusters",
+    "experimental_legendre_vector: merge_cluster_of_index",
+    "experimental_legendre_vector: merge_the_cluster_of_index",
+    "experimental_legendre_vector: fill_accumulator",
+    "experimental_legendre_vector: max",
+    "sultan: finalize",
+    "sultan: sequentiate",
+    "sultan: assign_helices_to_clusters",
+    "sultan: assign_helices_to_sequences",
+    "sultan: reduce_clusters",
+    "sultan: sequentiate_after_cat",
+    "sultan: assign_nodes_based_on_experimental_helix",
+    "sultan: continous",
+    "sultan: get_longest_piece",
+    "sultan: form_triplets_from_cells",
+    "sultan: form_triplets_from_cells_with_endpoints",
+    "sultan: form_helices_from_triplets",
+    "sultan: form_helices_from_triplets : print_event_display",
+    "sultan: sequentiate_cluster_with_experimental_vector",
+    "sultan: sequentiate_cluster_with_experimental_vector: helix loop: clean",
+    "sultan: sequentiate_cluster_with_experimental_vector: helix loop: add helix",
+    "sultan: sequentiate_cluster_with_experimental_vector: helix loop: max",
+    "sultan: sequentiate_cluster_with_experimental_vector: helix loop: assign",
+    "sultan: sequentiate_cluster_with_experimental_vector_2",
+    "sultan: sequentiate_cluster_with_experimental_vector_2: helix loop: clean",
+    "sultan: sequentiate_cluster_with_experimental_vector_2: helix loop: add helix to clusters",
+    "sultan: sequentiate_cluster_with_experimental_vector_2: helix loop: max",
+    "sultan: sequentiate_cluster_with_experimental_vector_2: helix loop: assign",
+    "sultan: sequentiate_cluster_with_experimental_vector_3",
+    "sultan: sequentiate_cluster_with_experimental_vector_3: helix loop: clean",
+    "sultan: sequentiate_cluster_with_experimental_vector_3: helix loop: add helix",
+    "sultan: sequentiate_cluster_with_experimental_vector_3: helix loop: max",
+    "sultan: sequentiate_cluster_with_experimental_vector_3: helix loop: assign",
+    "sultan: sequentiate_cluster_with_experimental_vector_4",
+    "sultan: sequentiate_cluster_with_experimental_vector_4: helix loop: clean",
+    "sultan: sequentiate_cluster_with_experimental_vector_4: helix loop: add helix to clusters",
+    "sultan: sequentiate_cluster_with_experimental_vector_4: helix loop: find clusters",
+    "sultan: sequentiate_cluster_with_experimental_vector_4: helix loop: assign",
+    "sultan: get_clusters_of_cells_to_be_used_as_end_points",
+    "sultan: reduce_cluster__with_2_endpoints",
+    "sultan: reduce_cluster__with_2_clusters_of_endpoints",
+    "sultan: reduce_cluster__with_vector_of_clusters_of_endpoints",
+    "sultan: reduce_cluster_based_on_endpoints",
+    "sultan: make scenarios",
+    "sultan: get_helix_cluster_from",
+    "sultan: add_cells_to_helix_cluster_from",
+    "sultan: helix_is_near_cell",
+    "sultan: get_line_cluster_from",
+    "sultan: add_cells_to_line_cluster_from",
+    "sultan: get_line_clusters_from",
+    "sultan: get_helix_clusters_from",
+    "sultan: get_clusters_from",
+};
+static_assert(sizeof(timer_names) / sizeof(timer_names[0]) ==
+                  static_cast<size_t>(timer::n_timers),
+              "each timer must have a name");
+}  // namespace
+
+const char *timer_name(timer t) { return timer_names[static_cast<size_t>(t)]; }
 
-//! Default destructor
-Clock::~Clock() { return; }
-
-void Clock::dump(ostream & /* a_out */, const std::string & /* a_title */,
-                 const std::string & /* a_indent */, bool /* a_inherit */) const {
-  // Trick to workaround the constness of the dump method :
-  // because 'this' is const, we cannot modify/sort the 'clockables_' STL collection,
-  // so we use 'mutable_this' :
-  Clock *mutable_this = const_cast<Clock *>(this);
-  if (mutable_this->clockables_.size()) {
-    std::sort(mutable_this->clockables_.begin(), mutable_this->clockables_.end(),
-              clockable::compare);
-
-    double max = clockables_.begin()->time_;
-
-    for (size_t i = 0; i < clockables_.size(); i++) {
-      this->clockables_[i].dump(max);
-    }
+//! Default constructor
+Clock::Clock() : enabled_(SULTAN_WITH_TIMERS) {
+  for (size_t i = 0; i < clockables_.size(); i++) {
+    clockables_[i].set_name(timer_names[i]);
   }
   return;
 }
 
-std::vector<clockable> &Clock::clockables() { return clockables_; }
+//! Default destructor
+Clock::~Clock() { return; }
 
-bool Clock::has(const std::string &name, size_t *index) const {
-  for (std::vector<clockable>::const_iterator iclock = clockables_.begin();
-       iclock != clockables_.end(); ++iclock) {
-    if (iclock->name() == name) {
-      *index = iclock - clockables_.begin();
-      return true;
-    }
+void Clock::dump(ostream &a_out, const std::string & /* a_title */,
+                 const std::string & /* a_indent */, bool /* a_inherit */) const {
+  // counters which never ran are not printed, by decreasing time
+  std::vector<const clockable *> ran;
+  for (const clockable &c : clockables_) {
+    if (c.calls_ > 0) ran.push_back(&c);
   }
-  return false;
-}
-
-void Clock::start(const std::string &name, const std::string &mode) {
-  if (mode == "once") {
-    size_t index = 0;
-    if (has(name, &index)) {
-      std::clog << "SULTAN::Clock::start: problem: starting a clockable " << name
-                << " which is already there " << index << std::endl;
-      clockables()[index].start();
-    } else {
-      clockable newc(name);
-      clockables_.push_back(newc);
-      size_t s = clockables().size();
-      clockables()[s - 1].start();
-    }
-  } else if (mode == "cumulative") {
-    size_t index = 0;
-    if (has(name, &index))
-      clockables()[index].start();
-    else {
-      clockable newc(name);
-      clockables_.push_back(newc);
-      size_t s = clockables().size();
-      clockables()[s - 1].start();
-    }
-  } else if (mode == "restart") {
-    size_t index = 0;
-    if (has(name, &index)) {
-      clockables()[index].restart();
-    } else {
-      clockable newc(name);
-      clockables_.push_back(newc);
-      size_t s = clockables().size();
-      clockables()[s - 1].start();
-    }
+  if (ran.empty()) return;
+  std::sort(ran.begin(), ran.end(), [](const clockable *c1, const clockable *c2) {
+    return clockable::compare(*c1, *c2);
+  });
+
+  double max = ran.front()->time_;
+  for (const clockable *c : ran) {
+    c->dump(max, a_out);
   }
   return;
 }
 
-void Clock::stop(const std::string &name) {
-  size_t index;
-  if (has(name, &index))
-    clockables()[index].stop();
-  else
-    std::clog << "SULTAN::Clock::start: problem: can't stop clockable '" << name
-              << "' which is not there " << std::endl;
+void Clock::stop_all() {
+  for (clockable &c : clockables_) c.stop();
 }
 
-double Clock::read(const std::string &name) {
-  size_t index;
-  if (has(name, &index)) return clockables()[index].read();
-
-  std::clog << "SULTAN::Clock::read: problem: request time of clockable '" << name
-            << "' which is not there " << std::endl;
-  return 0;
+void Clock::reset() {
+  for (clockable &c : clockables_) {
+    c = clockable(c.name());
+  }
 }
 
-void Clock::stop_all() {
-  for (std::vector<clockable>::iterator iclock = clockables_.begin(); iclock != clockables_.end();
-       ++iclock)
-    iclock->stop();
+void Clock::add(const Clock &other) {
+  for (size_t i = 0; i < clockables_.size(); i++) {
+    clockables_[i].time_ += other.clockables_[i].time_;
+    clockables_[i].lap_ += other.clockables_[i].lap_;
+    clockables_[i].calls_ += other.clockables_[i].calls_;
+  }
 }
 
 }  // namespace SULTAN
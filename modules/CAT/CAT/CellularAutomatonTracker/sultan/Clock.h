@@ -2,22 +2,47 @@
 #ifndef __sultan__Clock_h
 #define __sultan__Clock_h 1
 
+#include <sultan/SULTAN_config.h>
 #include <sultan/clockable.h>
-#include <vector>
+#include <sultan/timers.h>
+#include <array>
 #include <iostream>
 #include <string>
 
 namespace SULTAN {
 
 class Clock {
-  // a Clock is a time counter
+  // a Clock is a set of time counters, one per timer
+  //
+  // Counters are addressed by their timer identifier, so that starting and
+  // stopping them is a few instructions. They are only operated when the
+  // clock is enabled, and compiled out when SULTAN is built without timers
+  // (SULTAN_WITH_TIMERS is 0).
 
  private:
-  // list of clockable objects
-  std::vector<clockable> clockables_;
+  // one clockable object per timer
+  std::array<clockable, static_cast<size_t>(timer::n_timers)> clockables_;
+
+  bool enabled_;
+
+  clockable &at(timer t) { return clockables_[static_cast<size_t>(t)]; }
 
  public:
-  //! Default constructor
+  //! Time the enclosing scope with a timer
+  class scope {
+   public:
+    scope(Clock &clock, timer t) : clock_(clock), timer_(t) { clock_.start(timer_); }
+    ~scope() { clock_.stop(timer_); }
+
+    scope(const scope &) = delete;
+    scope &operator=(const scope &) = delete;
+
+   private:
+    Clock &clock_;
+    timer timer_;
+  };
+
+  //! Default constructor, the clock is enabled
   Clock();
 
   //! Default destructor
@@ -26,17 +51,58 @@ class Clock {
   virtual void dump(std::ostream &a_out = std::clog, const std::string &a_title = "",
                     const std::string &a_indent = "", bool a_inherit = false) const;
 
-  std::vector<clockable> &clockables();
+  //! Start or stop operating the counters
+  void set_enabled(bool enabled) { enabled_ = enabled && SULTAN_WITH_TIMERS; }
 
-  bool has(const std::string &name, size_t *index) const;
+  //! Return true if the counters are operated
+  bool is_enabled() const { return enabled_; }
 
-  void start(const std::string &name, const std::string &mode = "once");
+  //! Start accumulating time in the counter of t
+  void start(timer t) {
+#if SULTAN_WITH_TIMERS
+    if (enabled_) at(t).start();
+#else
+    (void)t;
+#endif
+  }
 
-  void stop(const std::string &name);
+  //! Reset the counter of t and start accumulating time in it
+  void restart(timer t) {
+#if SULTAN_WITH_TIMERS
+    if (enabled_) at(t).restart();
+#else
+    (void)t;
+#endif
+  }
 
-  double read(const std::string &name);
+  //! Stop accumulating time in the counter of t
+  void stop(timer t) {
+#if SULTAN_WITH_TIMERS
+    if (enabled_) at(t).stop();
+#else
+    (void)t;
+#endif
+  }
+
+  //! Return the time of the counter of t, in ms
+  double read(timer t) const { return clockables_[static_cast<size_t>(t)].read(); }
 
   void stop_all();
+
+  //! Reset all counters
+  void reset();
+
+  //! Add the times and calls of the counters of other, e.g. of a copy used by another thread
+  void add(const Clock &other);
+
+  //! Call f(name, time) for each counter which was stopped since the previous call,
+  //! with the time in ms it accumulated since then
+  template <typename F>
+  void for_each_lap(F f) {
+    for (clockable &c : clockables_) {
+      if (c.lap_ > 0.) f(c.name(), c.lap());
+    }
+  }
 };
 
 }  // namespace SULTAN
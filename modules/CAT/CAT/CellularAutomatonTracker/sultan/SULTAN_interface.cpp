@@ -38,6 +38,7 @@ void setup_data::_set_defaults() {
   sequentiator_level = "normal";
   SuperNemo = true;
   max_time = 5000.0;  // ms
+  nthreads = 1;
   print_event_display = false;
   use_clocks = false;
   use_endpoints = true;
@@ -85,6 +86,10 @@ bool setup_data::_check_snemo() {
     _set_error_message("Invalid 'max_time'");
     return false;
   }
+  if (nthreads < 1) {
+    _set_error_message("Invalid 'nthreads'");
+    return false;
+  }
   if (probmin < 0.0) {
     _set_error_message("Invalid 'probmin'");
     return false;
@@ -221,6 +226,7 @@ void sultan_configure(sultan &stor_, const setup_data &setup_) {
 
   // General parameters :
   stor_.set_max_time(setup_.max_time);
+  stor_.set_nthreads(setup_.nthreads);
   stor_.set_print_event_display(setup_.print_event_display);
   stor_.set_use_clocks(setup_.use_clocks);
   stor_.set_use_endpoints(setup_.use_endpoints);
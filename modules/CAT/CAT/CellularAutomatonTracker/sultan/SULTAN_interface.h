@@ -50,6 +50,10 @@ struct setup_data {
   /// Maximum computing time in ms
   double max_time;
 
+  /// Number of threads sequentiating the clusters of an event
+  /// (default = 1 to sequentiate them serially)
+  int nthreads;
+
   /// print an event display in the helix space?
   bool print_event_display;
 
@@ -45,6 +45,12 @@ class calorimeter_hit : public tracking_object {
   //! Default destructor
   virtual ~calorimeter_hit();
 
+  //! copy and move constructors and assignments
+  calorimeter_hit(const calorimeter_hit &) = default;
+  calorimeter_hit(calorimeter_hit &&) = default;
+  calorimeter_hit &operator=(const calorimeter_hit &) = default;
+  calorimeter_hit &operator=(calorimeter_hit &&) = default;
+
   //! constructor
   calorimeter_hit(const plane& pl, const experimental_double& e, const experimental_double& t,
                   size_t id, double layer, mybhep::prlevel level = mybhep::NORMAL,
@@ -74,6 +74,12 @@ class cell : public tracking_object {
   //! Default destructor
   virtual ~cell(){};
 
+  //! copy and move constructors and assignments
+  cell(const cell &) = default;
+  cell(cell &&) = default;
+  cell &operator=(const cell &) = default;
+  cell &operator=(cell &&) = default;
+
   //! constructor
   cell(experimental_point& p, experimental_double r, size_t id, bool fast = true,
        double probmin = 1.e-200, mybhep::prlevel level = mybhep::NORMAL) {
@@ -234,7 +240,7 @@ class cell : public tracking_object {
   const bool& fast() const { return fast_; }
 
   //! get type
-  std::string type() { return type_; }
+  const std::string& type() const { return type_; }
 
   //! get cell number
   int cell_number() const {
@@ -45,6 +45,12 @@ class cell_couplet : public tracking_object {
   //! Default destructor
   virtual ~cell_couplet();
 
+  //! copy and move constructors and assignments
+  cell_couplet(const cell_couplet &) = default;
+  cell_couplet(cell_couplet &&) = default;
+  cell_couplet &operator=(const cell_couplet &) = default;
+  cell_couplet &operator=(cell_couplet &&) = default;
+
   //! constructor
   cell_couplet(const cell &ca, const cell &cb, mybhep::prlevel level = mybhep::NORMAL,
                double probmin = 1.e-200);
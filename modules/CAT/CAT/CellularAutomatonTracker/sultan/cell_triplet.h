@@ -38,6 +38,12 @@ class cell_triplet : public tracking_object {
   //! Default destructor
   virtual ~cell_triplet();
 
+  //! copy and move constructors and assignments
+  cell_triplet(const cell_triplet &) = default;
+  cell_triplet(cell_triplet &&) = default;
+  cell_triplet &operator=(const cell_triplet &) = default;
+  cell_triplet &operator=(cell_triplet &&) = default;
+
   //! constructor
   cell_triplet(const cell &ca, const cell &cb, const cell &cc,
                mybhep::prlevel level = mybhep::NORMAL, double probmin = 1.e-200);
@@ -42,6 +42,12 @@ class cluster_of_experimental_helices : public tracking_object {
   //! Default destructor
   virtual ~cluster_of_experimental_helices(){};
 
+  //! copy and move constructors and assignments
+  cluster_of_experimental_helices(const cluster_of_experimental_helices &) = default;
+  cluster_of_experimental_helices(cluster_of_experimental_helices &&) = default;
+  cluster_of_experimental_helices &operator=(const cluster_of_experimental_helices &) = default;
+  cluster_of_experimental_helices &operator=(cluster_of_experimental_helices &&) = default;
+
   /*** dump ***/
   virtual void dump(std::ostream& a_out = std::clog, const std::string& a_title = "",
                     const std::string& a_indent = "", bool /*a_inherit*/ = false) const {
@@ -84,6 +84,9 @@ bool clusterizer::initialize() {
 
   read_properties();
 
+  // the clocks are dumped at finalize, and are only operated when verbose
+  clock.set_enabled(level >= mybhep::VERBOSE);
+
   nevent = 0;
   initial_events = 0;
   skipped_events = 0;
@@ -97,7 +100,7 @@ bool clusterizer::initialize() {
 bool clusterizer::finalize() {
   //*************************************************************
 
-  clock.start(" clusterizer: finalize ");
+  clock.start(timer::clusterizer_finalize);
 
   m.message("SULTAN::clusterizer::finalize: Ending algorithm clusterizer", mybhep::NORMAL);
 
@@ -105,7 +108,7 @@ bool clusterizer::finalize() {
   m.message("SULTAN::clusterizer::finalize: Skipped events: ", skipped_events, "(",
             100. * skipped_events / initial_events, "%)", mybhep::NORMAL);
 
-  clock.stop(" clusterizer: finalize ");
+  clock.stop(timer::clusterizer_finalize);
 
   clock.dump();
 
@@ -148,7 +151,7 @@ void clusterizer::read_properties() {
 bool clusterizer::prepare_event(topology::tracked_data& tracked_data_) {
   //*******************************************************************
 
-  clock.start(" clusterizer: prepare event ", "cumulative");
+  clock.start(timer::clusterizer_prepare_event);
 
   event_number++;
   m.message("SULTAN::clusterizer::prepare_event: local_tracking: preparing event", event_number,
@@ -169,7 +172,7 @@ bool clusterizer::prepare_event(topology::tracked_data& tracked_data_) {
 
   if (level >= mybhep::VVERBOSE) print_cells();
 
-  clock.stop(" clusterizer: prepare event ");
+  clock.stop(timer::clusterizer_prepare_event);
 
   return true;
 }
@@ -202,17 +205,17 @@ void clusterizer::print_clusters(void) const {
 void clusterizer::clusterize(topology::tracked_data& tracked_data_) {
   //*******************************************************************
 
-  clock.start(" clusterizer: clusterize ", "cumulative");
+  clock.start(timer::clusterizer_clusterize);
 
   if (event_number < first_event_number) {
-    clock.stop(" clusterizer: clusterize ");
+    clock.stop(timer::clusterizer_clusterize);
     return;
   }
 
   m.message("SULTAN::clusterizer::clusterize: local_tracking: fill clusters ", mybhep::VERBOSE);
 
   if (cells_.empty()) {
-    clock.stop(" clusterizer: clusterize ");
+    clock.stop(timer::clusterizer_clusterize);
     return;
   }
 
@@ -309,7 +312,7 @@ void clusterizer::clusterize(topology::tracked_data& tracked_data_) {
   tracked_data_.set_cells(cells_);
   tracked_data_.set_clusters(clusters_);
 
-  clock.stop(" clusterizer: clusterize ");
+  clock.stop(timer::clusterizer_clusterize);
 
   return;
 }
@@ -333,7 +336,7 @@ int clusterizer::cell_side(const topology::cell& c) {
 std::vector<topology::cell> clusterizer::get_near_cells(const topology::cell& c) {
   //*************************************************************
 
-  clock.start(" clusterizer: get near cells ", "cumulative");
+  Clock::scope timing(clock, timer::clusterizer_get_near_cells);
 
   m.message("SULTAN::clusterizer::get_near_cells: filling list of cells near cell ", c.id(),
             " fast ", c.fast(), " side ", cell_side(c), mybhep::VVERBOSE);
@@ -362,8 +365,6 @@ std::vector<topology::cell> clusterizer::get_near_cells(const topology::cell& c)
 
   if (level >= mybhep::VVERBOSE) std::clog << " " << std::endl;
 
-  clock.stop(" clusterizer: get near cells ");
-
   return cells;
 }
 
@@ -384,7 +385,7 @@ void clusterizer::setup_cells() {
 void clusterizer::setup_clusters() {
   //*************************************************************
 
-  clock.start(" clusterizer: setup_clusters ", "cumulative");
+  clock.start(timer::clusterizer_setup_clusters);
 
   // loop on clusters
   for (std::vector<topology::cluster>::iterator icl = clusters_.begin(); icl != clusters_.end();
@@ -400,7 +401,7 @@ void clusterizer::setup_clusters() {
     }
   }
 
-  clock.stop(" clusterizer: setup_clusters ");
+  clock.stop(timer::clusterizer_setup_clusters);
 
   return;
 }
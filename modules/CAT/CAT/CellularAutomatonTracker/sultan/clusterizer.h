@@ -40,6 +40,7 @@ class clusterizer {
   void set_nofflayers(size_t v);
   void set_first_event(int v);
   void set_level(std::string v);
+  Clock& get_clock() { return clock; }  // timers of the algorithm
   void set_cell_distance(double v);
   void set_SuperNemoChannel(bool v);
   void set_foil_radius(double v);
@@ -29,7 +29,8 @@ void experimental_helix::add_ids(std::vector<size_t> ids) {
   for (std::vector<size_t>::const_iterator fid = ids.begin(); fid != ids.end(); ++fid) add_id(*fid);
 }
 
-void experimental_helix::distance_from_cell_measurement(topology::cell c, experimental_double *DR,
+void experimental_helix::distance_from_cell_measurement(const topology::cell &c,
+                                                        experimental_double *DR,
                                                         experimental_double *DH) const {
   //////////////////////////////////////////////////////////////////////////
   //   center_of_helix              radius_of_helix    center_of_cell
@@ -62,7 +63,8 @@ void experimental_helix::distance_from_cell_measurement(topology::cell c, experi
   return;
 }
 
-void experimental_helix::distance_from_cell_center(topology::cell c, experimental_double *DR,
+void experimental_helix::distance_from_cell_center(const topology::cell &c,
+                                                   experimental_double *DR,
                                                    experimental_double *DH) const {
   //////////////////////////////////////////////////////////////////////////
   //   center_of_helix              radius_of_helix    center_of_cell
@@ -86,8 +88,8 @@ void experimental_helix::distance_from_cell_center(topology::cell c, experimenta
   return;
 }
 
-void experimental_helix::get_phi_of_point(topology::experimental_point input_p,
-                                          topology::experimental_point *p, double *angle) {
+void experimental_helix::get_phi_of_point(const topology::experimental_point &input_p,
+                                          topology::experimental_point *p, double *angle) const {
   *p = this->position(input_p);
   // angle of cell center wrt circle center
   *angle =
@@ -44,6 +44,12 @@ class experimental_helix : public tracking_object {
   //! Default destructor
   virtual ~experimental_helix(){};
 
+  //! copy and move constructors and assignments
+  experimental_helix(const experimental_helix &) = default;
+  experimental_helix(experimental_helix &&) = default;
+  experimental_helix &operator=(const experimental_helix &) = default;
+  experimental_helix &operator=(experimental_helix &&) = default;
+
   //! constructor
   experimental_helix(experimental_point ep, experimental_double R, experimental_double H,
                      mybhep::prlevel level = mybhep::NORMAL, double probmin = 1.e-200) {
@@ -142,10 +148,10 @@ class experimental_helix : public tracking_object {
 
   void add_ids(std::vector<size_t> ids);
 
-  void distance_from_cell_measurement(topology::cell c, experimental_double *DR,
+  void distance_from_cell_measurement(const topology::cell &c, experimental_double *DR,
                                       experimental_double *DH) const;
 
-  void distance_from_cell_center(topology::cell c, experimental_double *DR,
+  void distance_from_cell_center(const topology::cell &c, experimental_double *DR,
                                  experimental_double *DH) const;
 
   bool different_cells(topology::experimental_helix b) const;
@@ -167,8 +173,8 @@ class experimental_helix : public tracking_object {
     return phi;
   }
 
-  void get_phi_of_point(topology::experimental_point input_p, topology::experimental_point *p,
-                        double *angle);
+  void get_phi_of_point(const topology::experimental_point &input_p,
+                        topology::experimental_point *p, double *angle) const;
 
   bool is_less_than__optimist(const topology::experimental_helix a, double nsigma) const;
 
@@ -3,13 +3,35 @@
 #include <algorithm>
 #include <sultan/experimental_legendre_vector.h>
 
+namespace {
+
+// Index of the bin of width w containing v, false if there is none
+bool bin_of(double v, double w, long* index) {
+  const double b = std::floor(v / w);
+  if (!(std::abs(b) < 1.e15)) return false;
+  *index = static_cast<long>(b);
+  return true;
+}
+
+// Median of a, which is reordered
+double median(std::vector<double>* a) {
+  if (a->empty()) return 0.;
+  std::nth_element(a->begin(), a->begin() + a->size() / 2, a->end());
+  return (*a)[a->size() / 2];
+}
+
+}  // namespace
+
 namespace SULTAN {
 namespace topology {
 
 using namespace std;
 using namespace mybhep;
 
-void experimental_legendre_vector::set_helices(std::vector<experimental_helix> a) { helices_ = a; }
+void experimental_legendre_vector::set_helices(std::vector<experimental_helix> a) {
+  helices_ = a;
+  accumulator_is_filled_ = false;
+}
 
 std::vector<experimental_helix> experimental_legendre_vector::helices() { return helices_; }
 
@@ -33,33 +55,127 @@ int experimental_legendre_vector::get_index_of_largest_cluster() {
   return index_of_largest_cluster_;
 }
 
-void experimental_legendre_vector::add_helix(experimental_helix a) { helices_.push_back(a); }
+void experimental_legendre_vector::add_helix(experimental_helix a) {
+  helices_.push_back(a);
+  accumulator_is_filled_ = false;
+}
 
 void experimental_legendre_vector::reset() {
   helices_.clear();
   clusters_.clear();
   index_of_largest_cluster_ = -1;
+  accumulator_is_filled_ = false;
+}
+
+bool experimental_legendre_vector::is_neighbour(const experimental_helix& a,
+                                                const experimental_helix& b) const {
+  experimental_double d = a.x0() - b.x0();
+  if (std::abs(d.value()) > nsigmas_ * d.error()) return false;
+  d = a.y0() - b.y0();
+  if (std::abs(d.value()) > nsigmas_ * d.error()) return false;
+  d = a.z0() - b.z0();
+  if (std::abs(d.value()) > nsigmas_ * d.error()) return false;
+  d = a.R() - b.R();
+  if (std::abs(d.value()) > nsigmas_ * d.error()) return false;
+  d = a.H() - b.H();
+  if (std::abs(d.value()) > nsigmas_ * d.error()) return false;
+  return a.different_cells(b);
 }
 
 void experimental_legendre_vector::get_neighbours(experimental_helix a,
                                                   std::vector<experimental_helix>* neighbours) {
-  experimental_double dx, dy, dz, dR, dH;
   neighbours->clear();
   for (std::vector<experimental_helix>::const_iterator ip = helices_.begin(); ip != helices_.end();
        ++ip) {
-    if (!a.different_cells(*ip)) continue;
-    dx = a.x0() - ip->x0();
-    if (std::abs(dx.value()) > get_nsigmas() * dx.error()) continue;
-    dy = a.y0() - ip->y0();
-    if (std::abs(dy.value()) > get_nsigmas() * dy.error()) continue;
-    dz = a.z0() - ip->z0();
-    if (std::abs(dz.value()) > get_nsigmas() * dz.error()) continue;
-    dR = a.R() - ip->R();
-    if (std::abs(dR.value()) > get_nsigmas() * dR.error()) continue;
-    dH = a.H() - ip->H();
-    if (std::abs(dH.value()) > get_nsigmas() * dH.error()) continue;
-    neighbours->push_back(*ip);
+    if (is_neighbour(a, *ip)) neighbours->push_back(*ip);
+  }
+  return;
+}
+
+void experimental_legendre_vector::fill_accumulator() {
+  clock.start(timer::experimental_legendre_vector_fill_accumulator);
+
+  bins_.clear();
+  unbinned_.clear();
+
+  // bins are as wide as the neighbourhood of two helices of median errors
+  std::vector<bool> binnable(helices_.size());
+  std::vector<double> errors_x0, errors_y0;
+  max_error_x0_ = 0.;
+  max_error_y0_ = 0.;
+  for (size_t i = 0; i < helices_.size(); i++) {
+    const experimental_double x0 = helices_[i].x0();
+    const experimental_double y0 = helices_[i].y0();
+    binnable[i] = std::isfinite(x0.value()) && std::isfinite(x0.error()) &&
+                  std::isfinite(y0.value()) && std::isfinite(y0.error());
+    if (!binnable[i]) continue;
+    errors_x0.push_back(std::abs(x0.error()));
+    errors_y0.push_back(std::abs(y0.error()));
+    max_error_x0_ = std::max(max_error_x0_, std::abs(x0.error()));
+    max_error_y0_ = std::max(max_error_y0_, std::abs(y0.error()));
+  }
+  bin_x0_ = nsigmas_ * std::sqrt(2.) * median(&errors_x0);
+  bin_y0_ = nsigmas_ * std::sqrt(2.) * median(&errors_y0);
+
+  long ix, iy;
+  for (size_t i = 0; i < helices_.size(); i++) {
+    if (binnable[i] && bin_of(helices_[i].x0().value(), bin_x0_, &ix) &&
+        bin_of(helices_[i].y0().value(), bin_y0_, &iy))
+      bins_[std::make_pair(ix, iy)].push_back(i);
+    else
+      unbinned_.push_back(i);
+  }
+
+  accumulator_is_filled_ = true;
+
+  clock.stop(timer::experimental_legendre_vector_fill_accumulator);
+  return;
+}
+
+void experimental_legendre_vector::get_neighbour_indices(size_t i,
+                                                         std::vector<size_t>* neighbours) {
+  if (!accumulator_is_filled_) fill_accumulator();
+
+  const experimental_helix& a = helices_[i];
+  neighbours->clear();
+
+  // a helix whose centre is farther than nsigmas * sqrt(error_a^2 + max_error^2)
+  // cannot be a neighbour, and one more bin on each side absorbs the rounding
+  const double reach_x0 =
+      nsigmas_ * std::sqrt(std::pow(a.x0().error(), 2) + std::pow(max_error_x0_, 2));
+  const double reach_y0 =
+      nsigmas_ * std::sqrt(std::pow(a.y0().error(), 2) + std::pow(max_error_y0_, 2));
+  long ix_min, ix_max, iy_min, iy_max;
+  bool use_bins = bin_of(a.x0().value() - reach_x0, bin_x0_, &ix_min) &&
+                  bin_of(a.x0().value() + reach_x0, bin_x0_, &ix_max) &&
+                  bin_of(a.y0().value() - reach_y0, bin_y0_, &iy_min) &&
+                  bin_of(a.y0().value() + reach_y0, bin_y0_, &iy_max);
+  // visiting more bins than there are helices is slower than trying them all
+  use_bins = use_bins && (double)(ix_max - ix_min + 3) * (double)(iy_max - iy_min + 3) <=
+                             (double)helices_.size();
+
+  if (use_bins) {
+    std::map<std::pair<long, long>, std::vector<size_t> >::const_iterator ib;
+    for (long ix = ix_min - 1; ix <= ix_max + 1; ix++) {
+      for (long iy = iy_min - 1; iy <= iy_max + 1; iy++) {
+        ib = bins_.find(std::make_pair(ix, iy));
+        if (ib != bins_.end())
+          neighbours->insert(neighbours->end(), ib->second.begin(), ib->second.end());
+      }
+    }
+    neighbours->insert(neighbours->end(), unbinned_.begin(), unbinned_.end());
+    // keep the neighbours in the order of the helices
+    std::sort(neighbours->begin(), neighbours->end());
+  } else {
+    for (size_t j = 0; j < helices_.size(); j++) neighbours->push_back(j);
+  }
+
+  size_t n = 0;
+  for (std::vector<size_t>::const_iterator j = neighbours->begin(); j != neighbours->end(); ++j) {
+    if (is_neighbour(a, helices_[*j])) (*neighbours)[n++] = *j;
   }
+  neighbours->resize(n);
+
   return;
 }
 
@@ -186,9 +302,11 @@ experimental_helix experimental_legendre_vector::gaussian_max(size_t n_iteration
 }
 
 experimental_helix experimental_legendre_vector::max(std::vector<experimental_helix>* neighbours) {
+  clock.start(timer::experimental_legendre_vector_max);
+
   experimental_helix r;
   size_t nmax = 0;
-  std::vector<experimental_helix> neis;
+  std::vector<size_t> neis, neis_best;
   for (std::vector<experimental_helix>::const_iterator ip = helices_.begin(); ip != helices_.end();
        ++ip) {
     if (ip->isnan() || ip->isinf()) {
@@ -200,15 +318,21 @@ experimental_helix experimental_legendre_vector::max(std::vector<experimental_he
       continue;
     }
 
-    get_neighbours(*ip, &neis);
+    get_neighbour_indices(ip - helices_.begin(), &neis);
 
     if (neis.size() > nmax) {
       nmax = neis.size();
-      *neighbours = neis;
+      neis_best.swap(neis);
       r = *ip;
     }
   }
 
+  if (nmax > 0) {
+    neighbours->clear();
+    for (std::vector<size_t>::const_iterator j = neis_best.begin(); j != neis_best.end(); ++j)
+      neighbours->push_back(helices_[*j]);
+  }
+
   if (nmax == 0) r = helices_.front();
 
   if (r.isnan() || r.isinf()) {
@@ -219,6 +343,7 @@ experimental_helix experimental_legendre_vector::max(std::vector<experimental_he
     }
   }
 
+  clock.stop(timer::experimental_legendre_vector_max);
   return r;
 }
 
@@ -262,23 +387,22 @@ experimental_helix experimental_legendre_vector::max(std::vector<size_t>* neighb
   experimental_helix r;
   // size_t n = 0;
   size_t nmax = 0;
-  std::vector<experimental_helix> neis, neis_best;
+  std::vector<size_t> neis, neis_best;
   for (std::vector<experimental_helix>::const_iterator ip = helices_.begin(); ip != helices_.end();
        ++ip) {
-    get_neighbours(*ip, &neis);
+    get_neighbour_indices(ip - helices_.begin(), &neis);
 
     if (neis.size() > nmax) {
       nmax = neis.size();
-      neis_best = neis;
+      neis_best.swap(neis);
       r = *ip;
     }
   }
 
   neighbouring_cells->clear();
   std::vector<size_t> ids;
-  for (std::vector<experimental_helix>::const_iterator ip = neis_best.begin();
-       ip != neis_best.end(); ++ip) {
-    ids = ip->ids();
+  for (std::vector<size_t>::const_iterator ip = neis_best.begin(); ip != neis_best.end(); ++ip) {
+    ids = helices_[*ip].ids();
     for (std::vector<size_t>::const_iterator id = ids.begin(); id != ids.end(); ++id) {
       if (std::find(neighbouring_cells->begin(), neighbouring_cells->end(), *id) ==
           neighbouring_cells->end())
@@ -350,7 +474,7 @@ cluster_of_experimental_helices experimental_legendre_vector::max_cluster(experi
 }
 
 void experimental_legendre_vector::add_helix_to_clusters(experimental_helix a) {
-  clock.start(" experimental_legendre_vector: add_helix_to_clusters ", "cumulative");
+  clock.start(timer::experimental_legendre_vector_add_helix_to_clusters);
 
   bool a_maximum_is_already_defined = (index_of_largest_cluster_ >= 0);
 
@@ -367,7 +491,7 @@ void experimental_legendre_vector::add_helix_to_clusters(experimental_helix a) {
   if (!a_maximum_is_already_defined) {
     create_cluster(a);
     index_of_largest_cluster_ = 0;
-    clock.stop(" experimental_legendre_vector: add_helix_to_clusters ");
+    clock.stop(timer::experimental_legendre_vector_add_helix_to_clusters);
     return;
   }
 
@@ -401,12 +525,12 @@ void experimental_legendre_vector::add_helix_to_clusters(experimental_helix a) {
     create_cluster(a);
   }
 
-  clock.stop(" experimental_legendre_vector: add_helix_to_clusters ");
+  clock.stop(timer::experimental_legendre_vector_add_helix_to_clusters);
   return;
 }
 
 void experimental_legendre_vector::add_a_helix_to_clusters(experimental_helix a) {
-  clock.start(" experimental_legendre_vector: add_a_helix_to_clusters ", "cumulative");
+  clock.start(timer::experimental_legendre_vector_add_a_helix_to_clusters);
 
   if (print_level() >= mybhep::VVERBOSE) {
     std::clog << " add helix ";
@@ -420,7 +544,7 @@ void experimental_legendre_vector::add_a_helix_to_clusters(experimental_helix a)
 
   if (!clusters_.size()) {
     create_cluster(a);
-    clock.stop(" experimental_legendre_vector: add_a_helix_to_clusters ");
+    clock.stop(timer::experimental_legendre_vector_add_a_helix_to_clusters);
     return;
   }
 
@@ -451,12 +575,12 @@ void experimental_legendre_vector::add_a_helix_to_clusters(experimental_helix a)
     create_cluster(a);
   }
 
-  clock.stop(" experimental_legendre_vector: add_helix_to_clusters ");
+  clock.stop(timer::experimental_legendre_vector_add_helix_to_clusters);
   return;
 }
 
 void experimental_legendre_vector::merge_cluster_of_index(size_t i) {
-  clock.start(" experimental_legendre_vector: merge_cluster_of_index ", "cumulative");
+  clock.start(timer::experimental_legendre_vector_merge_cluster_of_index);
 
   cluster_of_experimental_helices _ic = clusters_[i];
   for (std::vector<cluster_of_experimental_helices>::const_iterator jc = clusters_.begin();
@@ -494,18 +618,18 @@ void experimental_legendre_vector::merge_cluster_of_index(size_t i) {
 
   return;
 
-  clock.stop(" experimental_legendre_vector: merge_cluster_of_index ");
+  clock.stop(timer::experimental_legendre_vector_merge_cluster_of_index);
 }
 
 void experimental_legendre_vector::merge_the_cluster_of_index(size_t i) {
-  clock.start(" experimental_legendre_vector: merge_the_cluster_of_index ", "cumulative");
+  clock.start(timer::experimental_legendre_vector_merge_the_cluster_of_index);
 
   if (i >= clusters_.size()) {
     if (print_level() >= mybhep::NORMAL) {
       std::clog << " problem: trying to merge cluster " << i
                 << " which is not there, cluster size = " << clusters_.size() << std::endl;
     }
-    clock.stop(" experimental_legendre_vector: merge_the_cluster_of_index ");
+    clock.stop(timer::experimental_legendre_vector_merge_the_cluster_of_index);
     return;
   }
 
@@ -534,7 +658,7 @@ void experimental_legendre_vector::merge_the_cluster_of_index(size_t i) {
     std::clog << " " << std::endl;
   }
 
-  clock.stop(" experimental_legendre_vector: merge_the_cluster_of_index ");
+  clock.stop(timer::experimental_legendre_vector_merge_the_cluster_of_index);
   return;
 }
 
@@ -689,6 +813,7 @@ void experimental_legendre_vector::reset_helices_errors() {
     ip->set_R(experimental_double(ip->R().value(), Rerror));
     ip->set_H(experimental_double(ip->H().value(), Herror));
   }
+  accumulator_is_filled_ = false;
 
   return;
 }
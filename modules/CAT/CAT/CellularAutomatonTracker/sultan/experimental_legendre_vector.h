@@ -3,6 +3,9 @@
 #define __sultan__EXPERIMENTALLEGENDRE_VECTOR
 #include <iostream>
 #include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
 #include <sultan/Clock.h>
 #include <mybhep/utilities.h>
 #include <sultan/experimental_helix.h>
@@ -27,6 +30,18 @@ class experimental_legendre_vector : public tracking_object {
   double Rdist_;
   double Hdist_;
 
+  // accumulator of the helices in bins of their centre (x0, y0), to look for
+  // the neighbours of a helix in the bins around it rather than among all the
+  // helices; helices whose centre or its error is not finite are kept aside,
+  // and tried for every helix
+  bool accumulator_is_filled_;
+  double bin_x0_;
+  double bin_y0_;
+  double max_error_x0_;
+  double max_error_y0_;
+  std::map<std::pair<long, long>, std::vector<size_t> > bins_;
+  std::vector<size_t> unbinned_;
+
  protected:
   Clock clock;
 
@@ -45,6 +60,11 @@ class experimental_legendre_vector : public tracking_object {
     z0dist_ = mybhep::default_min;
     Rdist_ = mybhep::default_min;
     Hdist_ = mybhep::default_min;
+    accumulator_is_filled_ = false;
+    bin_x0_ = 0.;
+    bin_y0_ = 0.;
+    max_error_x0_ = 0.;
+    max_error_y0_ = 0.;
   }
 
   //! Default destructor
@@ -96,8 +116,14 @@ class experimental_legendre_vector : public tracking_object {
 
   void reset();
 
+  bool is_neighbour(const experimental_helix& a, const experimental_helix& b) const;
+
   void get_neighbours(experimental_helix a, std::vector<experimental_helix>* neighbours);
 
+  void fill_accumulator();
+
+  void get_neighbour_indices(size_t i, std::vector<size_t>* neighbours);
+
   void get_neighbours_ids(experimental_helix a, size_t* nids);
 
   void get_neighbour_ids(experimental_helix a, size_t* nids);
@@ -128,6 +154,9 @@ class experimental_legendre_vector : public tracking_object {
 
   void print_clocks();
 
+  Clock& get_clock() { return clock; }
+  const Clock& get_clock() const { return clock; }
+
   bool assign_cell(size_t cell_id);
 
   void reset_helices_errors();
@@ -15,7 +15,8 @@ topology::experimental_point experimental_line::position(topology::experimental_
   return (epa_ + dir_ * s).point_from_vector();
 }
 
-double experimental_line::distance_from_cell_measurement(topology::cell c, experimental_double *DR,
+double experimental_line::distance_from_cell_measurement(const topology::cell &c,
+                                                         experimental_double *DR,
                                                          experimental_double *DH) const {
   //////////////////////////////////////////////////////////////////////////////////////
   //    foot_on_line              radius_of_cell    center_of_cell   radius_of_cell
@@ -34,7 +35,8 @@ double experimental_line::distance_from_cell_measurement(topology::cell c, exper
   return parameter;
 }
 
-double experimental_line::distance_from_cell_center(topology::cell c, experimental_double *DR,
+double experimental_line::distance_from_cell_center(const topology::cell &c,
+                                                    experimental_double *DR,
                                                     experimental_double *DH) const {
   //////////////////////////////////////////////////////////////////////////////////////
   //    foot_on_line              radius_of_cell    center_of_cell   radius_of_cell
@@ -42,6 +42,12 @@ class experimental_line : public tracking_object {
   //! Default destructor
   virtual ~experimental_line(){};
 
+  //! copy and move constructors and assignments
+  experimental_line(const experimental_line &) = default;
+  experimental_line(experimental_line &&) = default;
+  experimental_line &operator=(const experimental_line &) = default;
+  experimental_line &operator=(experimental_line &&) = default;
+
   //! constructor
   experimental_line(experimental_point epa, experimental_point epb,
                     mybhep::prlevel level = mybhep::NORMAL, double probmin = 1.e-200) {
@@ -94,10 +100,11 @@ class experimental_line : public tracking_object {
 
   topology::experimental_point position(topology::experimental_double s) const;
 
-  double distance_from_cell_measurement(topology::cell c, topology::experimental_double *DR,
+  double distance_from_cell_measurement(const topology::cell &c,
+                                        topology::experimental_double *DR,
                                         topology::experimental_double *DH) const;
 
-  double distance_from_cell_center(topology::cell c, topology::experimental_double *DR,
+  double distance_from_cell_center(const topology::cell &c, topology::experimental_double *DR,
                                    topology::experimental_double *DH) const;
 
   topology::experimental_vector dir() const { return dir_; }
@@ -31,6 +31,12 @@ class experimental_vector {
   //! Default destructor
   virtual ~experimental_vector();
 
+  //! copy and move constructors and assignments
+  experimental_vector(const experimental_vector &) = default;
+  experimental_vector(experimental_vector &&) = default;
+  experimental_vector &operator=(const experimental_vector &) = default;
+  experimental_vector &operator=(experimental_vector &&) = default;
+
   //! constructor from coordinates
   experimental_vector(const experimental_double& x, const experimental_double& y,
                       const experimental_double& z);
@@ -40,6 +40,12 @@ class node : public tracking_object {
   //! Default destructor
   virtual ~node();
 
+  //! copy and move constructors and assignments
+  node(const node &) = default;
+  node(node &&) = default;
+  node &operator=(const node &) = default;
+  node &operator=(node &&) = default;
+
   //! constructor
   node(const cell& c, mybhep::prlevel level = mybhep::NORMAL, double probmin = 1.e-200);
 
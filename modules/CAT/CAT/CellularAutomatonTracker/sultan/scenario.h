@@ -32,6 +32,12 @@ class scenario : public tracking_object {
   //! Default destructor
   virtual ~scenario();
 
+  //! copy and move constructors and assignments
+  scenario(const scenario &) = default;
+  scenario(scenario &&) = default;
+  scenario &operator=(const scenario &) = default;
+  scenario &operator=(scenario &&) = default;
+
   //! constructor
   scenario(const std::vector<sequence>& seqs, mybhep::prlevel level = mybhep::NORMAL,
            double probmin = 1.e-200);
@@ -45,6 +45,12 @@ class sequence : public tracking_object {
   //! Default destructor
   virtual ~sequence();
 
+  //! copy and move constructors and assignments
+  sequence(const sequence &) = default;
+  sequence(sequence &&) = default;
+  sequence &operator=(const sequence &) = default;
+  sequence &operator=(sequence &&) = default;
+
   //! constructor from std::vector of nodes
   sequence(const std::vector<node> &nodes, mybhep::prlevel level = mybhep::NORMAL,
            double probmin = 1.e-200);
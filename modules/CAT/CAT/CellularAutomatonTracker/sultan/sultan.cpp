@@ -3,6 +3,7 @@
 #include <vector>
 #include <cmath>
 #include <sstream>
+#include <iterator>
 #include <limits>
 #include <sys/time.h>
 
@@ -49,6 +50,7 @@ void sultan::_set_defaults() {
   ncells_between_triplet_range = 0;
   SuperNemoChannel = false;
   max_time = std::numeric_limits<double>::quiet_NaN();
+  nthreads = 1;
   print_event_display = false;
   use_clocks = false;
   use_endpoints = true;
@@ -75,18 +77,23 @@ bool sultan::initialize(void) {
 
   read_properties();
 
+  clock.set_enabled(use_clocks);
+
   nevent = 0;
   event_number = -1;
   skipped_events = 0;
-  experimental_legendre_vector = new topology::experimental_legendre_vector(level, probmin);
-  experimental_legendre_vector->set_nsigmas(nsigmas);
+  experimental_legendre_vector = topology::experimental_legendre_vector(level, probmin);
+  experimental_legendre_vector.set_nsigmas(nsigmas);
+  experimental_legendre_vector.get_clock().set_enabled(use_clocks);
   std::vector<topology::node> nodes;
-  full_cluster_ = new topology::cluster(nodes, level, probmin);
-  leftover_cluster_ = new topology::cluster(nodes, level, probmin);
-  assigned_cluster_ = new topology::cluster(nodes, level, probmin);
+  full_cluster_ = topology::cluster(nodes, level, probmin);
+  leftover_cluster_ = topology::cluster(nodes, level, probmin);
+  assigned_cluster_ = topology::cluster(nodes, level, probmin);
 
   if (print_event_display) root_file_ = new TFile("a.root", "RECREATE");
 
+  make_workers();
+
   //    clock.stop(" sultan: initialize ");
 
   return true;
@@ -96,7 +103,7 @@ bool sultan::initialize(void) {
 bool sultan::finalize() {
   //*************************************************************
 
-  if (use_clocks) clock.start(" sultan: finalize ");
+  clock.start(timer::sultan_finalize);
 
   if (print_event_display) {
     root_file_->Close();
@@ -109,17 +116,17 @@ bool sultan::finalize() {
   m.message("SULTAN:sultan::finalize: Input events: ", event_number, mybhep::NORMAL);
   m.message("SULTAN:sultan::finalize: Skipped events: ", skipped_events, "(",
             100. * skipped_events / event_number, "%)", mybhep::NORMAL);
-  // if( use_clocks ){
-  double sequentiation_time = clock.read(" sultan: sequentiate ");
-  m.message("SULTAN:sultan::finalize: sequentiation time =: ", sequentiation_time,
-            " ms = ", sequentiation_time / event_number, " ms/event ", mybhep::NORMAL);
-  //}
+  if (clock.is_enabled()) {
+    double sequentiation_time = clock.read(timer::sultan_sequentiate);
+    m.message("SULTAN:sultan::finalize: sequentiation time =: ", sequentiation_time, " ms = ",
+              sequentiation_time / event_number, " ms/event ", mybhep::NORMAL);
+  }
 
-  if (use_clocks) clock.stop(" sultan: finalize ");
+  clock.stop(timer::sultan_finalize);
 
   if (use_clocks) {
     print_clocks();
-    experimental_legendre_vector->print_clocks();
+    experimental_legendre_vector.print_clocks();
   }
 
   return true;
@@ -234,64 +241,75 @@ void sultan::make_sequences_from_clusters() {
 void sultan::assign_helices_to_clusters() {
   //*************************************************************
 
-  if (use_clocks) clock.start(" sultan: assign_helices_to_clusters ", "cumulative");
+  clock.start(timer::sultan_assign_helices_to_clusters);
 
-  // size_t n_iterations = 10;
-  std::vector<topology::experimental_helix> the_helices;
-  std::vector<topology::experimental_helix> neighbours;
   m.message("SULTAN::sultan::reduce_clusters: assign helices to ", made_clusters_.size(),
             " clusters ", mybhep::VERBOSE);
-  for (std::vector<topology::cluster>::iterator iclu = made_clusters_.begin();
-       iclu != made_clusters_.end(); ++iclu) {
-    *leftover_cluster_ = *iclu;
-    if (leftover_cluster_->nodes_.size() < min_ncells_in_cluster) {
-      for (std::vector<topology::node>::iterator inode = iclu->nodes_.begin();
-           inode != iclu->nodes_.end(); ++inode) {
-        inode->set_ep(inode->c().ep());
-      }
 
-      continue;
-    }
-    experimental_legendre_vector->reset();
-    neighbours.clear();
-    // form_triplets_from_cells_with_endpoints();
-    form_triplets_from_cells();
-    form_helices_from_triplets(&the_helices, iclu - made_clusters_.begin());
-    if (!the_helices.size()) {
-      for (std::vector<topology::node>::iterator inode = iclu->nodes_.begin();
-           inode != iclu->nodes_.end(); ++inode) {
-        inode->set_ep(inode->c().ep());
-      }
+  // clusters are independent, each worker assigns helices with its own scratch state
+  workers_.pool->run(made_clusters_.size(), [&](size_t iworker, size_t icluster) {
+    sultan &worker = iworker ? *workers_.copies[iworker - 1] : *this;
+    worker.assign_helix_to_cluster(made_clusters_[icluster], icluster);
+  });
+  add_clocks_of_workers();
 
-      continue;
+  clock.stop(timer::sultan_assign_helices_to_clusters);
+
+  return;
+}
+
+//*************************************************************
+void sultan::assign_helix_to_cluster(topology::cluster &cluster, size_t icluster) {
+  //*************************************************************
+
+  // size_t n_iterations = 10;
+  std::vector<topology::experimental_helix> the_helices;
+  std::vector<topology::experimental_helix> neighbours;
+  leftover_cluster_ = cluster;
+  if (leftover_cluster_.nodes_.size() < min_ncells_in_cluster) {
+    for (std::vector<topology::node>::iterator inode = cluster.nodes_.begin();
+         inode != cluster.nodes_.end(); ++inode) {
+      inode->set_ep(inode->c().ep());
     }
-    for (std::vector<topology::experimental_helix>::const_iterator hh = the_helices.begin();
-         hh != the_helices.end(); ++hh) {
-      experimental_legendre_vector->add_helix(*hh);
+
+    return;
+  }
+  experimental_legendre_vector.reset();
+  // form_triplets_from_cells_with_endpoints();
+  form_triplets_from_cells();
+  form_helices_from_triplets(&the_helices, icluster);
+  if (!the_helices.size()) {
+    for (std::vector<topology::node>::iterator inode = cluster.nodes_.begin();
+         inode != cluster.nodes_.end(); ++inode) {
+      inode->set_ep(inode->c().ep());
     }
-    m.message("SULTAN::sultan::reduce_clusters: cluster ", iclu - made_clusters_.begin(), " has ",
-              leftover_cluster_->nodes_.size(), " nodes, ", triplets_.size(), " triplets, ",
-              the_helices.size(), " helices ", mybhep::VERBOSE);
-    if (level >= mybhep::VERBOSE) {
-      for (std::vector<topology::cell_triplet>::const_iterator tr = triplets_.begin();
-           tr != triplets_.end(); ++tr) {
-        tr->print_ids();
-      }
-      std::clog << " " << std::endl;
+
+    return;
+  }
+  for (std::vector<topology::experimental_helix>::const_iterator hh = the_helices.begin();
+       hh != the_helices.end(); ++hh) {
+    experimental_legendre_vector.add_helix(*hh);
+  }
+  m.message("SULTAN::sultan::reduce_clusters: cluster ", icluster, " has ",
+            leftover_cluster_.nodes_.size(), " nodes, ", triplets_.size(), " triplets, ",
+            the_helices.size(), " helices ", mybhep::VERBOSE);
+  if (level >= mybhep::VERBOSE) {
+    for (std::vector<topology::cell_triplet>::const_iterator tr = triplets_.begin();
+         tr != triplets_.end(); ++tr) {
+      tr->print_ids();
     }
-    // experimental_legendre_vector->reset_helices_errors();
-    // experimental_legendre_vector->calculate_metric();
-    topology::experimental_helix b = experimental_legendre_vector->max(&neighbours);
-    // topology::experimental_helix b = experimental_legendre_vector->max_with_ids();
-    // topology::experimental_helix b = experimental_legendre_vector->max_with_metric();
-    // b = experimental_legendre_vector->gaussian_max(n_iterations, b);
-    iclu->set_helix(b);
-    // iclu->recalculate_R();
-    // iclu->recalculate(n_iterations);
-    iclu->set_cluster_type("helix");
+    std::clog << " " << std::endl;
   }
-
-  if (use_clocks) clock.stop(" sultan: assign_helices_to_clusters ");
+  // experimental_legendre_vector.reset_helices_errors();
+  // experimental_legendre_vector.calculate_metric();
+  topology::experimental_helix b = experimental_legendre_vector.max(&neighbours);
+  // topology::experimental_helix b = experimental_legendre_vector.max_with_ids();
+  // topology::experimental_helix b = experimental_legendre_vector.max_with_metric();
+  // b = experimental_legendre_vector.gaussian_max(n_iterations, b);
+  cluster.set_helix(b);
+  // cluster.recalculate_R();
+  // cluster.recalculate(n_iterations);
+  cluster.set_cluster_type("helix");
 
   return;
 }
@@ -354,7 +372,7 @@ topology::plane sultan::get_foil_plane() {
 void sultan::assign_helices_to_sequences() {
   //*************************************************************
 
-  if (use_clocks) clock.start(" sultan: assign_helices_to_sequences ", "cumulative");
+  clock.start(timer::sultan_assign_helices_to_sequences);
 
   std::vector<topology::experimental_helix> the_helices;
   std::vector<topology::experimental_helix> neighbours;
@@ -371,9 +389,9 @@ void sultan::assign_helices_to_sequences() {
     if (iseq->nodes_.size() < min_ncells_in_cluster) {
       continue;
     }
-    experimental_legendre_vector->reset();
+    experimental_legendre_vector.reset();
     neighbours.clear();
-    leftover_cluster_->set_nodes(iseq->nodes());
+    leftover_cluster_.set_nodes(iseq->nodes());
     form_triplets_from_cells(true);
     form_helices_from_triplets(&the_helices, iseq - sequences_.begin(), true);
     if (!the_helices.size()) {
@@ -381,7 +399,7 @@ void sultan::assign_helices_to_sequences() {
     }
     for (std::vector<topology::experimental_helix>::const_iterator hh = the_helices.begin();
          hh != the_helices.end(); ++hh) {
-      experimental_legendre_vector->add_helix(*hh);
+      experimental_legendre_vector.add_helix(*hh);
     }
     m.message("SULTAN::sultan::assign_helices_to_sequences: sequence ", iseq - sequences_.begin(),
               " has ", iseq->nodes_.size(), " nodes, ", triplets_.size(), " triplets, ",
@@ -393,7 +411,7 @@ void sultan::assign_helices_to_sequences() {
       }
       std::clog << " " << std::endl;
     }
-    topology::experimental_helix b = experimental_legendre_vector->max(&neighbours);
+    topology::experimental_helix b = experimental_legendre_vector.max(&neighbours);
     if (level >= mybhep::VERBOSE) {
       std::clog << "SULTAN::sultan::assign_helices_to_sequences: sequence "
                 << iseq - sequences_.begin() << " receives the following helix: ";
@@ -406,7 +424,7 @@ void sultan::assign_helices_to_sequences() {
       iseq->calculate_momentum(bfield, SuperNemoChannel, foil_radius);
   }
 
-  if (use_clocks) clock.stop(" sultan: assign_helices_to_sequences ");
+  clock.stop(timer::sultan_assign_helices_to_sequences);
 
   return;
 }
@@ -415,36 +433,24 @@ void sultan::assign_helices_to_sequences() {
 void sultan::reduce_clusters() {
   //*************************************************************
 
-  if (use_clocks) clock.start(" sultan: reduce_clusters ", "cumulative");
-
-  for (vector<topology::cluster>::iterator icluster = clusters_.begin();
-       icluster != clusters_.end(); ++icluster) {
-    // initialize clusters
-    *full_cluster_ = *icluster;
-    *leftover_cluster_ = *full_cluster_;
-    status();
-    m.message("SULTAN::sultan::reduce_clusters: prepare to reduce cluster ",
-              icluster - clusters_.begin(), " of ", clusters_.size(), " having",
-              icluster->nodes_.size(), "gg cells ", mybhep::VERBOSE);
-
-    if (use_endpoints) {
-      // form clusters between endpoints (foil, calo hits)
-      reduce_cluster_based_on_endpoints(icluster - clusters_.begin());
-    }
-
-    if (use_legendre) {
-      // look for cluster with largest number of triplet-neighbours
-      sequentiate_cluster_with_experimental_vector(icluster - clusters_.begin());
+  clock.start(timer::sultan_reduce_clusters);
 
-      // keep track in smarter way of which cluster has the largest number of triplet-neighbours
-      // sequentiate_cluster_with_experimental_vector_2(a_cluster, icluster - clusters_.begin());
+  // input clusters are independent: each worker reduces clusters with its own scratch
+  // state, and the clusters made out of each of them are merged in the input order
+  std::vector<std::vector<topology::cluster> > made_clusters_of_cluster(clusters_.size());
+  prepare_workers();
+  workers_.pool->run(clusters_.size(), [&](size_t iworker, size_t icluster) {
+    sultan &worker = iworker ? *workers_.copies[iworker - 1] : *this;
+    worker.made_clusters_.clear();
+    worker.reduce_cluster(clusters_[icluster], icluster);
+    made_clusters_of_cluster[icluster] = std::move(worker.made_clusters_);
+  });
+  add_clocks_of_workers();
 
-      // look for cluster with largest number of cell-neighbours
-      // sequentiate_cluster_with_experimental_vector_3(a_cluster, icluster - clusters_.begin());
-
-      // put helices in clusters, assign each cell to the cluster with the largest n of cells
-      // sequentiate_cluster_with_experimental_vector_4(a_cluster, icluster - clusters_.begin());
-    }
+  made_clusters_.clear();
+  for (std::vector<topology::cluster> &cs : made_clusters_of_cluster) {
+    made_clusters_.insert(made_clusters_.end(), std::make_move_iterator(cs.begin()),
+                          std::make_move_iterator(cs.end()));
   }
 
   if (use_endpoints && assign_helices_to_clusters_) {
@@ -454,10 +460,97 @@ void sultan::reduce_clusters() {
   // turn clusters to sequences
   m.message("SULTAN::sultan::reduce_clusters: make sequences", mybhep::VERBOSE);
   make_sequences_from_clusters();
-  sequences_ = clean_up(sequences_);
+  sequences_ = clean_up(std::move(sequences_));
   status();
 
-  if (use_clocks) clock.stop(" sultan: reduce_clusters ");
+  clock.stop(timer::sultan_reduce_clusters);
+
+  return;
+}
+
+//*************************************************************
+void sultan::reduce_cluster(const topology::cluster &cluster, size_t icluster) {
+  //*************************************************************
+
+  // initialize clusters
+  full_cluster_ = cluster;
+  leftover_cluster_ = full_cluster_;
+  status();
+  m.message("SULTAN::sultan::reduce_cluster: prepare to reduce cluster ", icluster, " of ",
+            clusters_.size(), " having", cluster.nodes_.size(), "gg cells ", mybhep::VERBOSE);
+
+  if (use_endpoints) {
+    // form clusters between endpoints (foil, calo hits)
+    reduce_cluster_based_on_endpoints(icluster);
+  }
+
+  if (use_legendre) {
+    // look for cluster with largest number of triplet-neighbours
+    sequentiate_cluster_with_experimental_vector(icluster);
+
+    // keep track in smarter way of which cluster has the largest number of triplet-neighbours
+    // sequentiate_cluster_with_experimental_vector_2(a_cluster, icluster);
+
+    // look for cluster with largest number of cell-neighbours
+    // sequentiate_cluster_with_experimental_vector_3(a_cluster, icluster);
+
+    // put helices in clusters, assign each cell to the cluster with the largest n of cells
+    // sequentiate_cluster_with_experimental_vector_4(a_cluster, icluster);
+  }
+
+  return;
+}
+
+//*************************************************************
+void sultan::make_workers() {
+  //*************************************************************
+  // this sultan is the first worker. The event display is written by one thread only
+
+  workers_.pool.reset();
+  workers_.copies.clear();
+  size_t nworkers = std::max<size_t>(1, nthreads);
+  if (print_event_display) nworkers = 1;
+  for (size_t iworker = 1; iworker < nworkers; ++iworker) {
+    workers_.copies.emplace_back(new sultan(*this));
+    workers_.copies.back()->clock.reset();
+    workers_.copies.back()->experimental_legendre_vector.get_clock().reset();
+  }
+  workers_.pool.reset(new task_pool(nworkers));
+
+  return;
+}
+
+//*************************************************************
+void sultan::prepare_workers() {
+  //*************************************************************
+  // workers start the event with empty scratch state, the calorimeter hits and
+  // the clock of this sultan
+
+  if (!workers_.pool) make_workers();
+  for (std::unique_ptr<sultan> &worker : workers_.copies) {
+    worker->reset();
+    worker->calos_ = calos_;
+    worker->event_number = event_number;
+    worker->sequentiation_clock = sequentiation_clock;
+    worker->clock.set_enabled(clock.is_enabled());
+    worker->experimental_legendre_vector.get_clock().set_enabled(
+        experimental_legendre_vector.get_clock().is_enabled());
+  }
+
+  return;
+}
+
+//*************************************************************
+void sultan::add_clocks_of_workers() {
+  //*************************************************************
+
+  for (std::unique_ptr<sultan> &worker : workers_.copies) {
+    clock.add(worker->clock);
+    worker->clock.reset();
+    Clock &legendre_clock = worker->experimental_legendre_vector.get_clock();
+    experimental_legendre_vector.get_clock().add(legendre_clock);
+    legendre_clock.reset();
+  }
 
   return;
 }
@@ -469,8 +562,8 @@ void sultan::reset() {
   made_clusters_.clear();
   sequences_.clear();
   scenarios_.clear();
-  full_cluster_->nodes_.clear();
-  leftover_cluster_->nodes_.clear();
+  full_cluster_.nodes_.clear();
+  leftover_cluster_.nodes_.clear();
   triplets_.clear();
 }
 
@@ -480,10 +573,9 @@ bool sultan::sequentiate(topology::tracked_data &tracked_data_) {
   // main method
 
   // start clocks
-  // if( use_clocks ){
-  clock.start(" sultan: sequentiate ", "cumulative");
-  //}
-  clock.start(" sultan: sequentiation ", "restart");  // use this one to check late
+  clock.start(timer::sultan_sequentiate);
+  // use this one to check late, whether the clocks are enabled or not
+  sequentiation_clock.restart();
 
   // count events
   event_number++;
@@ -491,8 +583,7 @@ bool sultan::sequentiate(topology::tracked_data &tracked_data_) {
   if (event_number < first_event_number) {
     m.message("SULTAN::sultan::sequentiate: local_tracking: skip event", event_number,
               " first event is ", first_event_number, mybhep::VERBOSE);
-    // if( use_clocks )
-    clock.stop(" sultan: sequentiate ");
+    clock.stop(timer::sultan_sequentiate);
     return true;
   }
 
@@ -506,8 +597,7 @@ bool sultan::sequentiate(topology::tracked_data &tracked_data_) {
     iclu->set_print_level(level);
   }
   if (clusters_.empty()) {
-    // if( use_clocks )
-    clock.stop(" sultan: sequentiate ");
+    clock.stop(timer::sultan_sequentiate);
     return true;
   }
   cells_ = tracked_data_.get_cells();
@@ -522,8 +612,7 @@ bool sultan::sequentiate(topology::tracked_data &tracked_data_) {
   // quit if it's too late
   if (late()) {
     skipped_events++;
-    // if( use_clocks )
-    clock.stop(" sultan: sequentiate ");
+    clock.stop(timer::sultan_sequentiate);
     return false;
   }
 
@@ -533,8 +622,7 @@ bool sultan::sequentiate(topology::tracked_data &tracked_data_) {
             " scenarios and ", sequences_.size(), " sequences for this event ", mybhep::VERBOSE);
 
   // stop clock
-  // if( use_clocks )
-  clock.stop(" sultan: sequentiate ");
+  clock.stop(timer::sultan_sequentiate);
 
   return true;
 }
@@ -545,18 +633,16 @@ bool sultan::sequentiate_after_cat(topology::tracked_data &tracked_data_) {
   // main method
 
   // start clocks
-  // if( use_clocks ){
-  clock.start(" sultan: sequentiate_after_cat ", "cumulative");
-  //}
-  clock.start(" sultan: sequentiation ", "restart");  // use this one to check late
+  clock.start(timer::sultan_sequentiate_after_cat);
+  // use this one to check late, whether the clocks are enabled or not
+  sequentiation_clock.restart();
 
   m.message("SULTAN::sultan::sequentiate_after_cat:  preparing event", event_number,
             mybhep::VERBOSE);
   if (event_number < first_event_number) {
     m.message("SULTAN::sultan::sequentiate_after_cat: local_tracking: skip event", event_number,
               " first event is ", first_event_number, mybhep::VERBOSE);
-    // if( use_clocks )
-    clock.stop(" sultan: sequentiate_after_cat ");
+    clock.stop(timer::sultan_sequentiate_after_cat);
     return true;
   }
 
@@ -564,8 +650,7 @@ bool sultan::sequentiate_after_cat(topology::tracked_data &tracked_data_) {
   std::vector<SULTAN::topology::scenario> scenarios = tracked_data_.get_scenarios();
   if (scenarios.size() == 0) {
     m.message("SULTAN::sultan::sequentiate_after_cat:  no scenarios", mybhep::VERBOSE);
-    // if( use_clocks )
-    clock.stop(" sultan: sequentiate ");
+    clock.stop(timer::sultan_sequentiate);
     return true;
   }
 
@@ -581,8 +666,7 @@ bool sultan::sequentiate_after_cat(topology::tracked_data &tracked_data_) {
   tracked_data_.set_scenarios(scenarios);
 
   // stop clock
-  // if( use_clocks )
-  clock.stop(" sultan: sequentiate_after_cat ");
+  clock.stop(timer::sultan_sequentiate_after_cat);
 
   return true;
 }
@@ -592,7 +676,7 @@ bool sultan::assign_nodes_based_on_experimental_helix(
     topology::experimental_helix *b, std::vector<topology::experimental_helix> *helices) {
   //*************************************************************
 
-  if (use_clocks) clock.start(" sultan: assign_nodes_based_on_experimental_helix ", "cumulative");
+  clock.start(timer::sultan_assign_nodes_based_on_experimental_helix);
 
   topology::experimental_double dr, dh;
   topology::cluster assigned_cluster;
@@ -607,8 +691,8 @@ bool sultan::assign_nodes_based_on_experimental_helix(
   double dhmin = mybhep::plus_infinity;
 
   // loop on cells in full cluster
-  for (vector<topology::node>::iterator inode = full_cluster_->nodes_.begin();
-       inode != full_cluster_->nodes_.end(); ++inode) {
+  for (vector<topology::node>::iterator inode = full_cluster_.nodes_.begin();
+       inode != full_cluster_.nodes_.end(); ++inode) {
     if (level >= mybhep::VVERBOSE) {
       std::clog << "SULTAN::sultan::assign_nodes_based_on_experimental_helix: cell "
                 << inode->c().id() << " [";
@@ -674,13 +758,13 @@ bool sultan::assign_nodes_based_on_experimental_helix(
     assigned_cluster.set_helix(*b);
     // add cluster to list of clusters
     made_clusters_.push_back(assigned_cluster);
-    leftover_cluster_->remove_nodes(assigned_cluster.nodes());
+    leftover_cluster_.remove_nodes(assigned_cluster.nodes());
     m.message("SULTAN::sultan::sequentiate_cluster_with_experimental_vector:  finished cluster [",
               made_clusters_.size() - 1, "] with ", assigned_cluster.nodes_.size(), " nodes, so ",
-              leftover_cluster_->nodes_.size(), " remain unassigned", mybhep::VERBOSE);
+              leftover_cluster_.nodes_.size(), " remain unassigned", mybhep::VERBOSE);
   }
 
-  if (use_clocks) clock.stop(" sultan: assign_nodes_based_on_experimental_helix ");
+  clock.stop(timer::sultan_assign_nodes_based_on_experimental_helix);
 
   return ok;
 }
@@ -690,12 +774,12 @@ bool sultan::assign_nodes_based_on_experimental_helix(topology::experimental_hel
                                                       std::vector<size_t> *neighbouring_cells) {
   //*************************************************************
 
-  if (use_clocks) clock.start(" sultan: assign_nodes_based_on_experimental_helix ", "cumulative");
+  clock.start(timer::sultan_assign_nodes_based_on_experimental_helix);
 
   topology::experimental_double dr, dh;
-  vector<topology::node> leftover_nodes_copy = leftover_cluster_->nodes_;
-  assigned_cluster_->nodes_.clear();
-  leftover_cluster_->nodes_.clear();
+  vector<topology::node> leftover_nodes_copy = leftover_cluster_.nodes_;
+  assigned_cluster_.nodes_.clear();
+  leftover_cluster_.nodes_.clear();
   topology::experimental_point p;
   // size_t best_helix_index;
   topology::cluster assigned_cluster;
@@ -705,8 +789,8 @@ bool sultan::assign_nodes_based_on_experimental_helix(topology::experimental_hel
   // double drmin = mybhep::plus_infinity;
   // double dhmin = mybhep::plus_infinity;
 
-  for (vector<topology::node>::iterator inode = full_cluster_->nodes_.begin();
-       inode != full_cluster_->nodes_.end(); ++inode) {
+  for (vector<topology::node>::iterator inode = full_cluster_.nodes_.begin();
+       inode != full_cluster_.nodes_.end(); ++inode) {
     if (level >= mybhep::VVERBOSE) {
       std::clog << "SULTAN::sultan::assign_nodes_based_on_experimental_helix: cell "
                 << inode->c().id() << " [";
@@ -734,7 +818,7 @@ bool sultan::assign_nodes_based_on_experimental_helix(topology::experimental_hel
                     inode->c().ep().x().value() - b->x0().value());
       inode->set_circle_phi(angle);
       inode->set_ep(p);
-      assigned_cluster_->nodes_.push_back(*inode);
+      assigned_cluster_.nodes_.push_back(*inode);
     } else {
       if (level >= mybhep::VVERBOSE) {
         std::clog << "SULTAN::sultan::assign_nodes_based_on_experimental_helix: is not near "
@@ -742,22 +826,22 @@ bool sultan::assign_nodes_based_on_experimental_helix(topology::experimental_hel
       }
       if (std::find(leftover_nodes_copy.begin(), leftover_nodes_copy.end(), *inode) !=
           leftover_nodes_copy.end())
-        leftover_cluster_->nodes_.push_back(*inode);
+        leftover_cluster_.nodes_.push_back(*inode);
     }
   }
 
   bool ok = check_continous_cells(&assigned_cluster, b);
 
   m.message("SULTAN::sultan::assign_nodes_based_on_experimental_helix: associated ",
-            assigned_cluster_->nodes_.size(), " nodes to this helix out of ",
-            full_cluster_->nodes_.size(), " so ", leftover_cluster_->nodes_.size(),
+            assigned_cluster_.nodes_.size(), " nodes to this helix out of ",
+            full_cluster_.nodes_.size(), " so ", leftover_cluster_.nodes_.size(),
             " remain unassigned - initially there were ", leftover_nodes_copy.size(),
             " -, continous ", ok, mybhep::VERBOSE);
 
-  if (use_clocks) clock.stop(" sultan: assign_nodes_based_on_experimental_helix ");
+  clock.stop(timer::sultan_assign_nodes_based_on_experimental_helix);
 
-  return ok && (leftover_cluster_->nodes_.size() < leftover_nodes_copy.size()) &&
-         (assigned_cluster_->nodes_.size());
+  return ok && (leftover_cluster_.nodes_.size() < leftover_nodes_copy.size()) &&
+         (assigned_cluster_.nodes_.size());
 }
 
 //*************************************************************
@@ -769,7 +853,7 @@ bool sultan::check_continous_cells(topology::cluster *given_cluster,
   // - otherwise it becomes its longest continous piece
   // - if it is continous and good, return true
 
-  if (use_clocks) clock.start(" sultan: continous ", "cumulative");
+  clock.start(timer::sultan_continous);
 
   size_t min_length = 3;
 
@@ -815,17 +899,17 @@ bool sultan::check_continous_cells(topology::cluster *given_cluster,
          inode != given_cluster->nodes_.end(); ++inode)
       b->add_id(inode->c().id());
 
-  if (use_clocks) clock.stop(" sultan: continous ");
+  clock.stop(timer::sultan_continous);
 
   return ok;
 }
 
 //*************************************************************
-bool sultan::get_longest_piece(topology::cluster *given_cluster, topology::node a, topology::node b,
-                               topology::cluster *longest_piece) {
+bool sultan::get_longest_piece(topology::cluster *given_cluster, const topology::node &a,
+                               const topology::node &b, topology::cluster *longest_piece) {
   //*************************************************************
 
-  if (use_clocks) clock.start(" sultan: get_longest_piece ", "cumulative");
+  clock.start(timer::sultan_get_longest_piece);
 
   size_t min_length = 2;
 
@@ -841,11 +925,11 @@ bool sultan::get_longest_piece(topology::cluster *given_cluster, topology::node
         longest_piece->nodes_.back().c().id() == b.c().id()) ||
        (longest_piece->nodes_.back().c().id() == a.c().id() &&
         longest_piece->nodes_.front().c().id() == b.c().id()))) {
-    if (use_clocks) clock.stop(" sultan: get_longest_piece ");
+    clock.stop(timer::sultan_get_longest_piece);
     return true;
   }
 
-  if (use_clocks) clock.stop(" sultan: get_longest_piece ");
+  clock.stop(timer::sultan_get_longest_piece);
   return false;
 }
 
@@ -856,17 +940,17 @@ bool sultan::form_triplets_from_cells(bool after_cat) {
   // to produce triplets (A, B, C) such that
   // the distances A-B and B-C are in specified range
 
-  if (use_clocks) clock.start(" sultan: form_triplets_from_cells ", "cumulative");
+  clock.start(timer::sultan_form_triplets_from_cells);
 
   reset_triplets();
 
   m.message("SULTAN::sultan::form_triplets_from_cells: calculate triples for ",
-            leftover_cluster_->nodes_.size(), " nodes, minimum ", min_ncells_in_cluster,
+            leftover_cluster_.nodes_.size(), " nodes, minimum ", min_ncells_in_cluster,
             " min layer in triplet ", min_layer_for_triplet, mybhep::VVERBOSE);
 
-  if (leftover_cluster_->nodes_.size() < min_ncells_in_cluster) {
+  if (leftover_cluster_.nodes_.size() < min_ncells_in_cluster) {
     // not enough cells to form a cluster
-    if (use_clocks) clock.stop(" sultan: form_triplets_from_cells ");
+    clock.stop(timer::sultan_form_triplets_from_cells);
     return false;
   }
 
@@ -881,8 +965,8 @@ bool sultan::form_triplets_from_cells(bool after_cat) {
   double dmin1, dmin2;
   size_t min_triplet_layer;
 
-  for (std::vector<topology::node>::const_iterator inode = leftover_cluster_->nodes_.begin();
-       inode != leftover_cluster_->nodes_.end() - 2; ++inode) {
+  for (std::vector<topology::node>::const_iterator inode = leftover_cluster_.nodes_.begin();
+       inode != leftover_cluster_.nodes_.end() - 2; ++inode) {
     if (!SuperNemoChannel) block1 = inode->c().block();
 
     if (after_cat) {
@@ -895,7 +979,7 @@ bool sultan::form_triplets_from_cells(bool after_cat) {
     }
 
     for (std::vector<topology::node>::const_iterator jnode = inode + 1;
-         jnode != leftover_cluster_->nodes_.end() - 1; ++jnode) {
+         jnode != leftover_cluster_.nodes_.end() - 1; ++jnode) {
       if (jnode == inode) continue;
 
       if (SuperNemoChannel)
@@ -917,7 +1001,7 @@ bool sultan::form_triplets_from_cells(bool after_cat) {
       }
 
       for (std::vector<topology::node>::const_iterator knode = jnode + 1;
-           knode != leftover_cluster_->nodes_.end(); ++knode) {
+           knode != leftover_cluster_.nodes_.end(); ++knode) {
         if (knode == inode) continue;
         if (knode == jnode) continue;
 
@@ -960,10 +1044,10 @@ bool sultan::form_triplets_from_cells(bool after_cat) {
     }
   }
 
-  if (use_clocks) clock.stop(" sultan: form_triplets_from_cells ");
+  clock.stop(timer::sultan_form_triplets_from_cells);
 
   m.message("SULTAN::sultan::form_triplets_from_cells: sultan: the ",
-            leftover_cluster_->nodes_.size(), " cells have been combined into ", triplets_.size(),
+            leftover_cluster_.nodes_.size(), " cells have been combined into ", triplets_.size(),
             " triplets ", mybhep::VERBOSE);
 
   return true;
@@ -975,32 +1059,32 @@ bool sultan::form_triplets_from_cells_with_endpoints() {
   // combine leftover_cluster nodes
   // to produce triplets (A, B, C) with A and C fixed
 
-  if (use_clocks) clock.start(" sultan: form_triplets_from_cells_with_endpoints ", "cumulative");
+  clock.start(timer::sultan_form_triplets_from_cells_with_endpoints);
 
   reset_triplets();
 
   m.message("SULTAN::sultan::form_triplets_from_cells_with_endpoints: calculate triples for ",
-            leftover_cluster_->nodes_.size(), " nodes, minimum ", min_ncells_in_cluster,
+            leftover_cluster_.nodes_.size(), " nodes, minimum ", min_ncells_in_cluster,
             mybhep::VVERBOSE);
 
-  if (leftover_cluster_->nodes_.size() < min_ncells_in_cluster) {
+  if (leftover_cluster_.nodes_.size() < min_ncells_in_cluster) {
     // not enough cells to form a cluster
-    if (use_clocks) clock.stop(" sultan: form_triplets_from_cells_with_endpoints ");
+    clock.stop(timer::sultan_form_triplets_from_cells_with_endpoints);
     return false;
   }
 
   topology::cell_triplet *ccc;
 
-  const topology::cell A = leftover_cluster_->nodes_.begin()->c();
-  const topology::cell C = leftover_cluster_->nodes_.back().c();
+  const topology::cell A = leftover_cluster_.nodes_.begin()->c();
+  const topology::cell C = leftover_cluster_.nodes_.back().c();
 
   if (A.id() == C.id()) {
-    if (use_clocks) clock.stop(" sultan: form_triplets_from_cells_with_endpoints ");
+    clock.stop(timer::sultan_form_triplets_from_cells_with_endpoints);
     return false;
   }
 
-  for (std::vector<topology::node>::const_iterator jnode = leftover_cluster_->nodes_.begin();
-       jnode != leftover_cluster_->nodes_.end(); ++jnode) {
+  for (std::vector<topology::node>::const_iterator jnode = leftover_cluster_.nodes_.begin();
+       jnode != leftover_cluster_.nodes_.end(); ++jnode) {
     if (jnode->c().id() == A.id()) continue;
     if (jnode->c().id() == C.id()) continue;
 
@@ -1012,10 +1096,10 @@ bool sultan::form_triplets_from_cells_with_endpoints() {
     m.message(" adding triplet, total ", triplets_.size(), mybhep::VVERBOSE);
   }
 
-  if (use_clocks) clock.stop(" sultan: form_triplets_from_cells_with_endpoints ");
+  clock.stop(timer::sultan_form_triplets_from_cells_with_endpoints);
 
   m.message("SULTAN::sultan::form_triplets_from_cells_with_endpoints: sultan: the ",
-            leftover_cluster_->nodes_.size(), " cells have been combined into ", triplets_.size(),
+            leftover_cluster_.nodes_.size(), " cells have been combined into ", triplets_.size(),
             " triplets ", mybhep::VERBOSE);
 
   return true;
@@ -1026,7 +1110,7 @@ bool sultan::form_helices_from_triplets(std::vector<topology::experimental_helix
                                         size_t icluster, bool after_cat) {
   //*************************************************************
 
-  if (use_clocks) clock.start(" sultan: form_helices_from_triplets ", "cumulative");
+  clock.start(timer::sultan_form_helices_from_triplets);
 
   m.message("SULTAN::sultan::form_helices_from_triplets:  calculate helices for ", triplets_.size(),
             " triplets ", mybhep::VVERBOSE);
@@ -1034,7 +1118,7 @@ bool sultan::form_helices_from_triplets(std::vector<topology::experimental_helix
   the_helices->clear();
 
   if (triplets_.size() == 0) {
-    if (use_clocks) clock.stop(" sultan: form_helices_from_triplets ");
+    clock.stop(timer::sultan_form_helices_from_triplets);
     return false;
   }
 
@@ -1136,11 +1220,10 @@ bool sultan::form_helices_from_triplets(std::vector<topology::experimental_helix
               " helices, total ", the_helices->size(), mybhep::VVERBOSE);
   }
 
-  if (use_clocks) clock.stop(" sultan: form_helices_from_triplets ");
+  clock.stop(timer::sultan_form_helices_from_triplets);
 
   if (print_event_display && event_number < 10) {
-    if (use_clocks)
-      clock.start(" sultan: form_helices_from_triplets : print_event_display ", "cumulative");
+    clock.start(timer::sultan_form_helices_from_triplets_print_event_display);
 
     root_file_->cd();
 
@@ -1218,7 +1301,7 @@ bool sultan::form_helices_from_triplets(std::vector<topology::experimental_helix
       root_tree->Write();
       delete root_tree;
     }
-    if (use_clocks) clock.stop(" sultan: form_helices_from_triplets : print_event_display ");
+    clock.stop(timer::sultan_form_helices_from_triplets_print_event_display);
   }
 
   m.message("SULTAN::sultan::form_helices_from_triplets:  sultan: the", triplets_.size(),
@@ -1231,22 +1314,21 @@ bool sultan::form_helices_from_triplets(std::vector<topology::experimental_helix
 void sultan::sequentiate_cluster_with_experimental_vector(size_t icluster) {
   //*************************************************************
 
-  if (use_clocks)
-    clock.start(" sultan: sequentiate_cluster_with_experimental_vector ", "cumulative");
+  clock.start(timer::sultan_sequentiate_with_vector);
 
   // reset
-  experimental_legendre_vector->reset();
+  experimental_legendre_vector.reset();
 
   if (level >= mybhep::VERBOSE) {
     std::clog << "SULTAN::sultan::sequentiate_cluster_with_experimental_vector:  sequentiate "
                  "cluster with "
-              << full_cluster_->nodes_.size() << " nodes " << std::endl;
+              << full_cluster_.nodes_.size() << " nodes " << std::endl;
     fflush(stdout);
   }
 
   // need at least 3 nodes
-  if (full_cluster_->nodes_.size() < 3) {
-    if (use_clocks) clock.stop(" sultan: sequentiate_cluster_with_experimental_vector ");
+  if (full_cluster_.nodes_.size() < 3) {
+    clock.stop(timer::sultan_sequentiate_with_vector);
     return;
   }
 
@@ -1261,56 +1343,46 @@ void sultan::sequentiate_cluster_with_experimental_vector(size_t icluster) {
   // while loop: keep trying as long as
   // one can form triplets and helices out of them
   while (form_triplets_from_cells() && form_helices_from_triplets(&the_helices, icluster)) {
-    if (use_clocks)
-      clock.start(" sultan: sequentiate_cluster_with_experimental_vector: helix loop: clean ",
-                  "cumulative");
+    clock.start(timer::sultan_sequentiate_with_vector_helix_loop_clean);
 
     // reset
-    experimental_legendre_vector->reset();
+    experimental_legendre_vector.reset();
     neighbours.clear();
-    n_of_leftover_nodes = leftover_cluster_->nodes_.size();
+    n_of_leftover_nodes = leftover_cluster_.nodes_.size();
 
     if (level >= mybhep::VERBOSE) {
       std::clog << "SULTAN::sultan::sequentiate_cluster_with_experimental_vector:  leg vector has "
-                << experimental_legendre_vector->helices().size() << " helices " << std::endl;
+                << experimental_legendre_vector.helices().size() << " helices " << std::endl;
       fflush(stdout);
     }
 
     // quit if no helices were built
     if (!the_helices.size()) {
-      if (use_clocks)
-        clock.stop(" sultan: sequentiate_cluster_with_experimental_vector: helix loop: clean ");
+      clock.stop(timer::sultan_sequentiate_with_vector_helix_loop_clean);
       break;
     }
-    if (use_clocks)
-      clock.stop(" sultan: sequentiate_cluster_with_experimental_vector: helix loop: clean ");
+    clock.stop(timer::sultan_sequentiate_with_vector_helix_loop_clean);
 
-    if (use_clocks)
-      clock.start(" sultan: sequentiate_cluster_with_experimental_vector: helix loop: add helix ",
-                  "cumulative");
+    clock.start(timer::sultan_sequentiate_with_vector_helix_loop_add_helix);
 
     // add all helices to legendre_vector
     for (std::vector<topology::experimental_helix>::const_iterator hh = the_helices.begin();
          hh != the_helices.end(); ++hh) {
-      experimental_legendre_vector->add_helix(*hh);
+      experimental_legendre_vector.add_helix(*hh);
     }
 
-    if (use_clocks)
-      clock.stop(" sultan: sequentiate_cluster_with_experimental_vector: helix loop: add helix ");
+    clock.stop(timer::sultan_sequentiate_with_vector_helix_loop_add_helix);
 
-    if (use_clocks)
-      clock.start(" sultan: sequentiate_cluster_with_experimental_vector: helix loop: max ",
-                  "cumulative");
+    clock.start(timer::sultan_sequentiate_with_vector_helix_loop_max);
     // get the best helix in the vector
-    b = experimental_legendre_vector->max(&neighbours);
+    b = experimental_legendre_vector.max(&neighbours);
 
     if (!b.ids().size()) {
       m.message(
           "SULTAN::sultan::sequentiate_cluster_with_experimental_vector:  could not make a track ",
           mybhep::VERBOSE);
       fflush(stdout);
-      if (use_clocks)
-        clock.stop(" sultan: sequentiate_cluster_with_experimental_vector: helix loop: max ");
+      clock.stop(timer::sultan_sequentiate_with_vector_helix_loop_max);
       break;
     }
 
@@ -1321,11 +1393,8 @@ void sultan::sequentiate_cluster_with_experimental_vector(size_t icluster) {
                 << neighbours.size() << " helices " << std::endl;
     }
 
-    if (use_clocks) {
-      clock.stop(" sultan: sequentiate_cluster_with_experimental_vector: helix loop: max ");
-      clock.start(" sultan: sequentiate_cluster_with_experimental_vector: helix loop: assign ",
-                  "cumulative");
-    }
+    clock.stop(timer::sultan_sequentiate_with_vector_helix_loop_max);
+    clock.start(timer::sultan_sequentiate_with_vector_helix_loop_assign);
 
     // assign all nodes you can to this helix
     bool ok = assign_nodes_based_on_experimental_helix(&b, &neighbours);
@@ -1335,17 +1404,15 @@ void sultan::sequentiate_cluster_with_experimental_vector(size_t icluster) {
           "SULTAN::sultan::sequentiate_cluster_with_experimental_vector:  could not make a track ",
           mybhep::VERBOSE);
       fflush(stdout);
-      if (use_clocks)
-        clock.stop(" sultan: sequentiate_cluster_with_experimental_vector: helix loop: assign ");
+      clock.stop(timer::sultan_sequentiate_with_vector_helix_loop_assign);
       break;
     }
 
-    if (use_clocks)
-      clock.stop(" sultan: sequentiate_cluster_with_experimental_vector: helix loop: assign ");
+    clock.stop(timer::sultan_sequentiate_with_vector_helix_loop_assign);
 
     if (print_event_display) break;
 
-    if (leftover_cluster_->nodes_.size() == n_of_leftover_nodes) {
+    if (leftover_cluster_.nodes_.size() == n_of_leftover_nodes) {
       m.message(
           "SULTAN::sultan::sequentiate_cluster_with_experimental_vector: leftover nodes have not "
           "been reduced; break ",
@@ -1355,7 +1422,7 @@ void sultan::sequentiate_cluster_with_experimental_vector(size_t icluster) {
     }
   }
 
-  if (use_clocks) clock.stop(" sultan: sequentiate_cluster_with_experimental_vector ");
+  clock.stop(timer::sultan_sequentiate_with_vector);
 
   return;
 }
@@ -1365,13 +1432,12 @@ void sultan::sequentiate_cluster_with_experimental_vector_2(topology::cluster &c
                                                             size_t icluster) {
   //*************************************************************
 
-  if (use_clocks)
-    clock.start(" sultan: sequentiate_cluster_with_experimental_vector_2 ", "cumulative");
+  clock.start(timer::sultan_sequentiate_with_vector_2);
 
-  experimental_legendre_vector->reset();
+  experimental_legendre_vector.reset();
 
   if (cluster_.nodes_.size() < 3) {
-    if (use_clocks) clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_2 ");
+    clock.stop(timer::sultan_sequentiate_with_vector_2);
     return;
   }
 
@@ -1379,7 +1445,7 @@ void sultan::sequentiate_cluster_with_experimental_vector_2(topology::cluster &c
     std::clog << "SULTAN::sultan::sequentiate_cluster_with_experimental_vector_2: sequentiate "
                  "cluster with "
               << cluster_.nodes_.size() << " nodes, leg vector has "
-              << experimental_legendre_vector->helices().size() << " helices " << std::endl;
+              << experimental_legendre_vector.helices().size() << " helices " << std::endl;
     fflush(stdout);
   }
 
@@ -1398,55 +1464,42 @@ void sultan::sequentiate_cluster_with_experimental_vector_2(topology::cluster &c
   bool found;
 
   while (form_triplets_from_cells() && form_helices_from_triplets(&the_helices, icluster)) {
-    if (use_clocks)
-      clock.start(" sultan: sequentiate_cluster_with_experimental_vector_2: helix loop: clean ",
-                  "cumulative");
+    clock.start(timer::sultan_sequentiate_with_vector_2_helix_loop_clean);
 
-    assigned_cluster_->nodes_.clear();
-    experimental_legendre_vector->reset();
+    assigned_cluster_.nodes_.clear();
+    experimental_legendre_vector.reset();
 
     if (level >= mybhep::VERBOSE) {
       std::clog << "SULTAN::sultan::sequentiate_cluster_with_experimental_vector_2:  there are "
                 << leftover_nodes.size() << " leftover nodes and "
-                << assigned_cluster_->nodes_.size() << " assigned nodes, the leg vector has "
-                << experimental_legendre_vector->helices().size() << " helices and "
+                << assigned_cluster_.nodes_.size() << " assigned nodes, the leg vector has "
+                << experimental_legendre_vector.helices().size() << " helices and "
                 << the_helices.size() << " have been prepared " << std::endl;
       fflush(stdout);
     }
 
     if (!the_helices.size()) {
-      if (use_clocks)
-        clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_2: helix loop: clean ");
+      clock.stop(timer::sultan_sequentiate_with_vector_2_helix_loop_clean);
       break;
     }
-    if (use_clocks)
-      clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_2: helix loop: clean ");
+    clock.stop(timer::sultan_sequentiate_with_vector_2_helix_loop_clean);
 
-    if (use_clocks)
-      clock.start(
-          " sultan: sequentiate_cluster_with_experimental_vector_2: helix loop: add helix to "
-          "clusters ",
-          "cumulative");
+    clock.start(timer::sultan_sequentiate_with_vector_2_helix_loop_add_helix_to_clusters);
 
     for (std::vector<topology::experimental_helix>::const_iterator hh = the_helices.begin();
          hh != the_helices.end(); ++hh) {
-      experimental_legendre_vector->add_helix_to_clusters(*hh);
+      experimental_legendre_vector.add_helix_to_clusters(*hh);
 
-      if (experimental_legendre_vector->max_cluster(&b, &found).helices().size() >=
+      if (experimental_legendre_vector.max_cluster(&b, &found).helices().size() >=
           the_helices.size() / 2.)
         break;
     }
 
-    if (use_clocks) {
-      clock.stop(
-          " sultan: sequentiate_cluster_with_experimental_vector_2: helix loop: add helix to "
-          "clusters ");
-      clock.start(" sultan: sequentiate_cluster_with_experimental_vector_2: helix loop: max ",
-                  "cumulative");
-    }
+    clock.stop(timer::sultan_sequentiate_with_vector_2_helix_loop_add_helix_to_clusters);
+    clock.start(timer::sultan_sequentiate_with_vector_2_helix_loop_max);
 
     found = false;
-    best_cluster = experimental_legendre_vector->max_cluster(&b, &found);
+    best_cluster = experimental_legendre_vector.max_cluster(&b, &found);
 
     if (!found) {
       m.message(
@@ -1454,8 +1507,7 @@ void sultan::sequentiate_cluster_with_experimental_vector_2(topology::cluster &c
           "track ",
           mybhep::VERBOSE);
       fflush(stdout);
-      if (use_clocks)
-        clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_2: helix loop: max ");
+      clock.stop(timer::sultan_sequentiate_with_vector_2_helix_loop_max);
       break;
     }
 
@@ -1472,16 +1524,13 @@ void sultan::sequentiate_cluster_with_experimental_vector_2(topology::cluster &c
       b.dump();
     }
 
-    if (use_clocks) {
-      clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_2: helix loop: max ");
-      clock.start(" sultan: sequentiate_cluster_with_experimental_vector_2: helix loop: assign ",
-                  "cumulative");
-    }
+    clock.stop(timer::sultan_sequentiate_with_vector_2_helix_loop_max);
+    clock.start(timer::sultan_sequentiate_with_vector_2_helix_loop_assign);
 
     bool ok = assign_nodes_based_on_experimental_helix(&b, &neighbours);
 
     if (ok) {
-      s = new topology::sequence(assigned_cluster_->nodes_, level, probmin);
+      s = new topology::sequence(assigned_cluster_.nodes_, level, probmin);
       make_name(*s);
       center = new topology::experimental_point(b.x0(), b.y0(), b.z0());
       radius.set(b.R());
@@ -1499,18 +1548,16 @@ void sultan::sequentiate_cluster_with_experimental_vector_2(topology::cluster &c
           "track ",
           mybhep::VERBOSE);
       fflush(stdout);
-      if (use_clocks)
-        clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_2: helix loop: assign ");
+      clock.stop(timer::sultan_sequentiate_with_vector_2_helix_loop_assign);
       break;
     }
 
-    if (use_clocks)
-      clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_2: helix loop: assign ");
+    clock.stop(timer::sultan_sequentiate_with_vector_2_helix_loop_assign);
 
     if (print_event_display) break;
   }
 
-  if (use_clocks) clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_2 ");
+  clock.stop(timer::sultan_sequentiate_with_vector_2);
 
   return;
 }
@@ -1520,13 +1567,12 @@ void sultan::sequentiate_cluster_with_experimental_vector_3(topology::cluster &c
                                                             size_t icluster) {
   //*************************************************************
 
-  if (use_clocks)
-    clock.start(" sultan: sequentiate_cluster_with_experimental_vector_3 ", "cumulative");
+  clock.start(timer::sultan_sequentiate_with_vector_3);
 
-  experimental_legendre_vector->reset();
+  experimental_legendre_vector.reset();
 
   if (cluster_.nodes_.size() < 3) {
-    if (use_clocks) clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_3 ");
+    clock.stop(timer::sultan_sequentiate_with_vector_3);
     return;
   }
 
@@ -1534,7 +1580,7 @@ void sultan::sequentiate_cluster_with_experimental_vector_3(topology::cluster &c
     std::clog << "SULTAN::sultan::sequentiate_cluster_with_experimental_vector_3:  sequentiate "
                  "cluster with "
               << cluster_.nodes_.size() << " nodes, leg vector has "
-              << experimental_legendre_vector->helices().size() << " helices " << std::endl;
+              << experimental_legendre_vector.helices().size() << " helices " << std::endl;
     fflush(stdout);
   }
 
@@ -1550,45 +1596,36 @@ void sultan::sequentiate_cluster_with_experimental_vector_3(topology::cluster &c
   leftover_nodes = cluster_.nodes_;
 
   while (form_triplets_from_cells() && form_helices_from_triplets(&the_helices, icluster)) {
-    if (use_clocks)
-      clock.start(" sultan: sequentiate_cluster_with_experimental_vector_3: helix loop: clean ",
-                  "cumulative");
+    clock.start(timer::sultan_sequentiate_with_vector_3_helix_loop_clean);
 
-    assigned_cluster_->nodes_.clear();
-    experimental_legendre_vector->reset();
+    assigned_cluster_.nodes_.clear();
+    experimental_legendre_vector.reset();
     neighbouring_cells.clear();
 
     if (level >= mybhep::VERBOSE) {
       std::clog
           << "SULTAN::sultan::sequentiate_cluster_with_experimental_vector_3:  leg vector has "
-          << experimental_legendre_vector->helices().size() << " helices " << std::endl;
+          << experimental_legendre_vector.helices().size() << " helices " << std::endl;
       fflush(stdout);
     }
 
     if (!the_helices.size()) {
-      if (use_clocks)
-        clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_3: helix loop: clean ");
+      clock.stop(timer::sultan_sequentiate_with_vector_3_helix_loop_clean);
       break;
     }
-    if (use_clocks)
-      clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_3: helix loop: clean ");
+    clock.stop(timer::sultan_sequentiate_with_vector_3_helix_loop_clean);
 
-    if (use_clocks)
-      clock.start(" sultan: sequentiate_cluster_with_experimental_vector_3: helix loop: add helix ",
-                  "cumulative");
+    clock.start(timer::sultan_sequentiate_with_vector_3_helix_loop_add_helix);
 
     for (std::vector<topology::experimental_helix>::const_iterator hh = the_helices.begin();
          hh != the_helices.end(); ++hh) {
-      experimental_legendre_vector->add_helix(*hh);
+      experimental_legendre_vector.add_helix(*hh);
     }
 
-    if (use_clocks) {
-      clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_3: helix loop: add helix ");
-      clock.start(" sultan: sequentiate_cluster_with_experimental_vector_3: helix loop: max ",
-                  "cumulative");
-    }
+    clock.stop(timer::sultan_sequentiate_with_vector_3_helix_loop_add_helix);
+    clock.start(timer::sultan_sequentiate_with_vector_3_helix_loop_max);
 
-    b = experimental_legendre_vector->max(&neighbouring_cells);
+    b = experimental_legendre_vector.max(&neighbouring_cells);
 
     if (!b.ids().size()) {
       m.message(
@@ -1596,8 +1633,7 @@ void sultan::sequentiate_cluster_with_experimental_vector_3(topology::cluster &c
           "track ",
           mybhep::VERBOSE);
       fflush(stdout);
-      if (use_clocks)
-        clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_3: helix loop: max ");
+      clock.stop(timer::sultan_sequentiate_with_vector_3_helix_loop_max);
       break;
     }
 
@@ -1608,16 +1644,13 @@ void sultan::sequentiate_cluster_with_experimental_vector_3(topology::cluster &c
                 << neighbouring_cells.size() << " cells to this cluster " << std::endl;
     }
 
-    if (use_clocks) {
-      clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_3: helix loop: max ");
-      clock.start(" sultan: sequentiate_cluster_with_experimental_vector_3: helix loop: assign ",
-                  "cumulative");
-    }
+    clock.stop(timer::sultan_sequentiate_with_vector_3_helix_loop_max);
+    clock.start(timer::sultan_sequentiate_with_vector_3_helix_loop_assign);
 
     bool ok = assign_nodes_based_on_experimental_helix(&b, &neighbouring_cells);
 
     if (ok) {
-      s = new topology::sequence(assigned_cluster_->nodes_, level, probmin);
+      s = new topology::sequence(assigned_cluster_.nodes_, level, probmin);
       make_name(*s);
       center = new topology::experimental_point(b.x0(), b.y0(), b.z0());
       radius.set(b.R());
@@ -1635,18 +1668,16 @@ void sultan::sequentiate_cluster_with_experimental_vector_3(topology::cluster &c
           "track ",
           mybhep::VERBOSE);
       fflush(stdout);
-      if (use_clocks)
-        clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_3: helix loop: assign ");
+      clock.stop(timer::sultan_sequentiate_with_vector_3_helix_loop_assign);
       break;
     }
 
-    if (use_clocks)
-      clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_3: helix loop: assign ");
+    clock.stop(timer::sultan_sequentiate_with_vector_3_helix_loop_assign);
 
     if (print_event_display) break;
   }
 
-  if (use_clocks) clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_3 ");
+  clock.stop(timer::sultan_sequentiate_with_vector_3);
 
   return;
 }
@@ -1656,16 +1687,12 @@ void sultan::sequentiate_cluster_with_experimental_vector_4(topology::cluster &c
                                                             size_t icluster) {
   //*************************************************************
 
-  if (use_clocks)
-    clock.start(" sultan: sequentiate_cluster_with_experimental_vector_4 ", "cumulative");
+  clock.start(timer::sultan_sequentiate_with_vector_4);
 
-  experimental_legendre_vector->reset();
+  experimental_legendre_vector.reset();
 
   if (cluster_.nodes_.size() < 3) {
-    if (use_clocks)
-      clock.stop(
-          "SULTAN::sultan::sequentiate_cluster_with_experimental_vector_4:  sultan: "
-          "sequentiate_cluster_with_experimental_vector_4 ");
+    clock.stop(timer::sultan_sequentiate_with_vector_4);
     return;
   }
 
@@ -1686,17 +1713,14 @@ void sultan::sequentiate_cluster_with_experimental_vector_4(topology::cluster &c
   form_triplets_from_cells();
   form_helices_from_triplets(&the_helices, icluster);
 
-  if (use_clocks)
-    clock.start(" sultan: sequentiate_cluster_with_experimental_vector_4: helix loop: clean ",
-                "cumulative");
+  clock.start(timer::sultan_sequentiate_with_vector_4_helix_loop_clean);
 
-  experimental_legendre_vector->reset();
+  experimental_legendre_vector.reset();
 
-  if (use_clocks)
-    clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_4: helix loop: clean ");
+  clock.stop(timer::sultan_sequentiate_with_vector_4_helix_loop_clean);
 
   if (!the_helices.size()) {
-    if (use_clocks) clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_4 ");
+    clock.stop(timer::sultan_sequentiate_with_vector_4);
     m.message(
         "SULTAN::sultan::sequentiate_cluster_with_experimental_vector_4: could not make a track ",
         mybhep::VERBOSE);
@@ -1704,39 +1728,29 @@ void sultan::sequentiate_cluster_with_experimental_vector_4(topology::cluster &c
     return;
   }
 
-  if (use_clocks)
-    clock.start(
-        " sultan: sequentiate_cluster_with_experimental_vector_4: helix loop: add helix to "
-        "clusters ",
-        "cumulative");
+  clock.start(timer::sultan_sequentiate_with_vector_4_helix_loop_add_helix_to_clusters);
 
   // bool force_neighbours_to_have_different_ids = false;
   for (std::vector<topology::experimental_helix>::const_iterator hh = the_helices.begin();
        hh != the_helices.end(); ++hh) {
-    experimental_legendre_vector->add_helix_to_clusters(*hh);
+    experimental_legendre_vector.add_helix_to_clusters(*hh);
   }
 
   if (level >= mybhep::VERBOSE) {
     std::clog << "SULTAN::sultan::sequentiate_cluster_with_experimental_vector_4: sultan: the "
               << the_helices.size() << " helices have been combined into "
-              << experimental_legendre_vector->clusters().size() << " clusters of helices "
+              << experimental_legendre_vector.clusters().size() << " clusters of helices "
               << std::endl;
   }
 
-  if (use_clocks) {
-    clock.stop(
-        " sultan: sequentiate_cluster_with_experimental_vector_4: helix loop: add helix to "
-        "clusters ");
-    clock.start(
-        " sultan: sequentiate_cluster_with_experimental_vector_4: helix loop: find clusters ",
-        "cumulative");
-  }
+  clock.stop(timer::sultan_sequentiate_with_vector_4_helix_loop_add_helix_to_clusters);
+  clock.start(timer::sultan_sequentiate_with_vector_4_helix_loop_find_clusters);
 
   bool assigned_node;
   std::vector<topology::node> unclustered_hits;
   for (std::vector<topology::node>::const_iterator in = cluster_.nodes_.begin();
        in != cluster_.nodes_.end(); ++in) {
-    assigned_node = experimental_legendre_vector->assign_cell(in->c().id());
+    assigned_node = experimental_legendre_vector.assign_cell(in->c().id());
     if (level >= mybhep::VVERBOSE) {
       std::clog << "SULTAN::sultan::sequentiate_cluster_with_experimental_vector_4: cell "
                 << in->c().id() << " assigned " << assigned_node << " to cluster " << std::endl;
@@ -1744,17 +1758,13 @@ void sultan::sequentiate_cluster_with_experimental_vector_4(topology::cluster &c
     if (!assigned_node) unclustered_hits.push_back(*in);
   }
 
-  if (use_clocks) {
-    clock.stop(
-        " sultan: sequentiate_cluster_with_experimental_vector_4: helix loop: find clusters ");
-    clock.start(" sultan: sequentiate_cluster_with_experimental_vector_4: helix loop: assign ",
-                "cumulative");
-  }
+  clock.stop(timer::sultan_sequentiate_with_vector_4_helix_loop_find_clusters);
+  clock.start(timer::sultan_sequentiate_with_vector_4_helix_loop_assign);
 
   std::vector<size_t> ids;
   std::vector<topology::node> nodes;
   std::vector<topology::cluster_of_experimental_helices> best_clusters =
-      experimental_legendre_vector->clusters();
+      experimental_legendre_vector.clusters();
 
   std::vector<topology::sequence> sequences;
   for (std::vector<topology::cluster_of_experimental_helices>::const_iterator ic =
@@ -1815,13 +1825,13 @@ void sultan::sequentiate_cluster_with_experimental_vector_4(topology::cluster &c
 #endif
 
   m.message("SULTAN::sultan::sequentiate_cluster_with_experimental_vector_4: sultan: the ",
-            experimental_legendre_vector->clusters().size(),
+            experimental_legendre_vector.clusters().size(),
             " clusters of helices have been reduced to ", sequences.size(),
             " candidate sequences; ", unclustered_hits.size(), " hits remain unclustered ",
             mybhep::VERBOSE);
   fflush(stdout);
 
-  sequences = clean_up(sequences);
+  sequences = clean_up(std::move(sequences));
 
   m.message(
       "SULTAN::sultan::sequentiate_cluster_with_experimental_vector_4: sultan: after clean_up, ",
@@ -1840,16 +1850,14 @@ void sultan::sequentiate_cluster_with_experimental_vector_4(topology::cluster &c
   sequences_.insert(sequences_.end(), sequences.begin(), sequences.end());
   ;
 
-  if (use_clocks) {
-    clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_4: helix loop: assign ");
-    clock.stop(" sultan: sequentiate_cluster_with_experimental_vector_4 ");
-  }
+  clock.stop(timer::sultan_sequentiate_with_vector_4_helix_loop_assign);
+  clock.stop(timer::sultan_sequentiate_with_vector_4);
 
   return;
 }
 
 //*************************************************************
-int sultan::check_if_cell_is_near_calo(topology::cell c) {
+int sultan::check_if_cell_is_near_calo(const topology::cell &c) {
   //*************************************************************
 
   std::string cview;
@@ -1920,11 +1928,10 @@ std::vector<topology::cluster> sultan::get_clusters_of_cells_to_be_used_as_end_p
   m.message(
       "SULTAN::sultan::get_clusters_of_cells_to_be_used_as_end_points: looking for clusters of "
       "endpoints in a cluster of ",
-      leftover_cluster_->nodes_.size(), " cells, with ", calos_.size(), " calo hits",
+      leftover_cluster_.nodes_.size(), " cells, with ", calos_.size(), " calo hits",
       mybhep::VVERBOSE);
 
-  if (use_clocks)
-    clock.start(" sultan: get_clusters_of_cells_to_be_used_as_end_points ", "cumulative");
+  clock.start(timer::sultan_get_clusters_of_cells_to_be_used_as_end_points);
 
   std::vector<topology::cluster> clusters;
 
@@ -1934,8 +1941,8 @@ std::vector<topology::cluster> sultan::get_clusters_of_cells_to_be_used_as_end_p
   int on_calo_hit;
 
   // loop on all leftover nodes
-  for (std::vector<topology::node>::const_iterator inode = leftover_cluster_->nodes_.begin();
-       inode < leftover_cluster_->nodes_.end(); ++inode) {
+  for (std::vector<topology::node>::const_iterator inode = leftover_cluster_.nodes_.begin();
+       inode < leftover_cluster_.nodes_.end(); ++inode) {
     on_foil = inode->c_.is_near_foil();
     on_calo = inode->c_.is_near_calo(n_layers);
     on_xcalo = inode->c_.is_near_xcalo(n_cell_columns);
@@ -2006,7 +2013,7 @@ std::vector<topology::cluster> sultan::get_clusters_of_cells_to_be_used_as_end_p
 
   m.message("SULTAN::sultan::get_clusters_of_cells_to_be_used_as_end_points: ", clusters.size(),
             " clusters of endpoints have been found in a cluster of ",
-            leftover_cluster_->nodes_.size(), " cells ", mybhep::VERBOSE);
+            leftover_cluster_.nodes_.size(), " cells ", mybhep::VERBOSE);
   if (level >= mybhep::VERBOSE) {
     for (std::vector<topology::cluster>::iterator iclu = clusters.begin(); iclu != clusters.end();
          ++iclu) {
@@ -2028,7 +2035,7 @@ std::vector<topology::cluster> sultan::get_clusters_of_cells_to_be_used_as_end_p
     }
   }
 
-  if (use_clocks) clock.stop(" sultan: get_clusters_of_cells_to_be_used_as_end_points ");
+  clock.stop(timer::sultan_get_clusters_of_cells_to_be_used_as_end_points);
 
   return clusters;
 }
@@ -2042,7 +2049,7 @@ void sultan::reduce_cluster__with_2_endpoints(size_t icluster, bool *cluster_is_
   m.message("SULTAN::sultan::reduce_cluster__with_2_endpoints: ", mybhep::VVERBOSE);
   // put in cs_given_endpoints all clusters between inode and jnode
 
-  if (use_clocks) clock.start(" sultan: reduce_cluster__with_2_endpoints ", "cumulative");
+  clock.start(timer::sultan_reduce_cluster_with_2_endpoints);
 
   *cs_given_endpoints = get_clusters_from(*inode, *jnode, icluster, cluster_is_finished);
 
@@ -2057,13 +2064,13 @@ void sultan::reduce_cluster__with_2_endpoints(size_t icluster, bool *cluster_is_
 
     std::clog << ") cells " << std::endl;
   }
-  *cs_given_endpoints = clean_up(*cs_given_endpoints);
+  *cs_given_endpoints = clean_up(std::move(*cs_given_endpoints));
   m.message("SULTAN::sultan::reduce_cluster__with_2_endpoints:  after cleaning ",
             cs_given_endpoints->size(), " clusters remain with endpoints : ", inode->c().id(),
             " - ", jnode->c().id(), " cluster_is_finished: ", *cluster_is_finished,
             mybhep::VERBOSE);
 
-  if (use_clocks) clock.stop(" sultan: reduce_cluster__with_2_endpoints ");
+  clock.stop(timer::sultan_reduce_cluster_with_2_endpoints);
 
   return;
 }
@@ -2081,8 +2088,7 @@ void sultan::reduce_cluster__with_2_clusters_of_endpoints(size_t icluster,
       jnodes.size(), " nodes ", mybhep::VVERBOSE);
   // we expect at most 1 cluster between 2 clusters of endpoints
 
-  if (use_clocks)
-    clock.start(" sultan: reduce_cluster__with_2_clusters_of_endpoints ", "cumulative");
+  clock.start(timer::sultan_reduce_cluster_with_2_clusters_of_endpoints);
 
   std::vector<topology::cluster> cs_given_endpoints;
   std::vector<topology::cluster> cs_given_clusters_of_endpoints;
@@ -2116,7 +2122,7 @@ void sultan::reduce_cluster__with_2_clusters_of_endpoints(size_t icluster,
             " clusters of cells have been done between 2 clusters of endpoints ", mybhep::VERBOSE);
 
   if (cs_given_clusters_of_endpoints.size()) {
-    cs_given_clusters_of_endpoints = clean_up(cs_given_clusters_of_endpoints);
+    cs_given_clusters_of_endpoints = clean_up(std::move(cs_given_clusters_of_endpoints));
     topology::cluster best_cluster = get_best_cluster_from(cs_given_clusters_of_endpoints);
     cs->push_back(best_cluster);
     m.message("SULTAN::sultan::reduce_cluster__with_2_clusters_of_endpoints:  after cleaning ",
@@ -2125,7 +2131,7 @@ void sultan::reduce_cluster__with_2_clusters_of_endpoints(size_t icluster,
               cs->size(), mybhep::VERBOSE);
   }
 
-  if (use_clocks) clock.stop(" sultan: reduce_cluster__with_2_clusters_of_endpoints ");
+  clock.stop(timer::sultan_reduce_cluster_with_2_clusters_of_endpoints);
 
   return;
 }
@@ -2133,11 +2139,10 @@ void sultan::reduce_cluster__with_2_clusters_of_endpoints(size_t icluster,
 //*************************************************************
 void sultan::reduce_cluster__with_vector_of_clusters_of_endpoints(
     size_t icluster, std::vector<topology::cluster> *cs,
-    std::vector<topology::cluster> clusters_of_endpoints, bool *cluster_is_finished) {
+    const std::vector<topology::cluster> &clusters_of_endpoints, bool *cluster_is_finished) {
   //*************************************************************
 
-  if (use_clocks)
-    clock.start(" sultan: reduce_cluster__with_vector_of_clusters_of_endpoints ", "cumulative");
+  clock.start(timer::sultan_reduce_cluster_with_vector_of_clusters_of_endpoints);
 
   // loop on 1st cluster of endpoints
   for (std::vector<topology::cluster>::const_iterator iclu = clusters_of_endpoints.begin();
@@ -2168,7 +2173,7 @@ void sultan::reduce_cluster__with_vector_of_clusters_of_endpoints(
     }
   }
 
-  if (use_clocks) clock.stop(" sultan: reduce_cluster__with_vector_of_clusters_of_endpoints ");
+  clock.stop(timer::sultan_reduce_cluster_with_vector_of_clusters_of_endpoints);
 
   return;
 }
@@ -2182,23 +2187,23 @@ std::vector<topology::cluster> sultan::make_unclustered_hits(
 
   std::vector<topology::cluster> cs;
   // separate unclustered hits into clusters based solely on nearness
-  if (leftover_cluster_->nodes_.size()) {
+  if (leftover_cluster_.nodes_.size()) {
     if (level >= mybhep::VVERBOSE) {
       std::clog << "SULTAN::sultan::make_unclustered_hits: make unclustered hits for "
-                << leftover_cluster_->nodes_.size() << " hits: (";
-      for (std::vector<topology::node>::const_iterator inode = leftover_cluster_->nodes_.begin();
-           inode != leftover_cluster_->nodes_.end(); ++inode)
+                << leftover_cluster_.nodes_.size() << " hits: (";
+      for (std::vector<topology::node>::const_iterator inode = leftover_cluster_.nodes_.begin();
+           inode != leftover_cluster_.nodes_.end(); ++inode)
         std::clog << inode->c().id() << " ";
       std::clog << ") without endpoint ? " << (bool)(endpoints == 0) << std::endl;
     }
 
-    leftover_cluster_->self_order(endpoints);
-    leftover_cluster_->break_into_continous_pieces(nofflayers, cell_distance);
-    vector<size_t> length_of_piece = leftover_cluster_->length_of_piece();
-    std::vector<size_t> the_first_cell_of_piece = leftover_cluster_->first_cell_of_piece();
+    leftover_cluster_.self_order(endpoints);
+    leftover_cluster_.break_into_continous_pieces(nofflayers, cell_distance);
+    vector<size_t> length_of_piece = leftover_cluster_.length_of_piece();
+    std::vector<size_t> the_first_cell_of_piece = leftover_cluster_.first_cell_of_piece();
 
     m.message("SULTAN::sultan::make_unclustered_hits:  leftover hits = ",
-              leftover_cluster_->nodes_.size(), " broken into ", length_of_piece.size(),
+              leftover_cluster_.nodes_.size(), " broken into ", length_of_piece.size(),
               " pieces with ", the_first_cell_of_piece.size(), " first cells ", mybhep::VERBOSE);
     fflush(stdout);
 
@@ -2218,7 +2223,7 @@ std::vector<topology::cluster> sultan::make_unclustered_hits(
 
       if (*il < minimum_length) continue;
 
-      topology::cluster c = leftover_cluster_->get_cluster_with_first_last(first, last);
+      topology::cluster c = leftover_cluster_.get_cluster_with_first_last(first, last);
       c.set_cluster_type("neighbouring_cells");
       cs.push_back(c);
     }
@@ -2233,7 +2238,7 @@ std::vector<topology::cluster> sultan::make_unclustered_hits(
 
 //*************************************************************
 std::vector<topology::node> sultan::get_furthest_end_points(
-    std::vector<topology::cluster> clusters_of_endpoints) {
+    const std::vector<topology::cluster> &clusters_of_endpoints) {
   //*************************************************************
 
   std::vector<topology::node> nodes;
@@ -2281,7 +2286,7 @@ void sultan::reduce_cluster_based_on_endpoints(size_t icluster) {
   // output: a vector of clusters
 
   // start clock
-  if (use_clocks) clock.start(" sultan: reduce_cluster_based_on_endpoints ", "cumulative");
+  clock.start(timer::sultan_reduce_cluster_based_on_endpoints);
 
   // define variables
   std::vector<topology::cluster> cs, newly_made_clusters;
@@ -2297,14 +2302,14 @@ void sultan::reduce_cluster_based_on_endpoints(size_t icluster) {
     // count iterations
     iteration++;
     m.message("SULTAN::sultan::reduce_cluster_based_on_endpoints: iteration ", iteration,
-              " sequentiate cluster of ", leftover_cluster_->nodes().size(), " leftover gg cells ",
+              " sequentiate cluster of ", leftover_cluster_.nodes().size(), " leftover gg cells ",
               mybhep::VERBOSE);
     status();
 
     // setup
     cs.clear();
     cluster_is_finished = false;
-    n_of_leftover_cells = leftover_cluster_->nodes().size();
+    n_of_leftover_cells = leftover_cluster_.nodes().size();
 
     // get the clusters of endpoints for this input cluster of neighbouring cells
     clusters_of_endpoints = get_clusters_of_cells_to_be_used_as_end_points();
@@ -2326,14 +2331,14 @@ void sultan::reduce_cluster_based_on_endpoints(size_t icluster) {
 
     // add clusters just made to the vector of made clusters
     m.message("SULTAN::sultan::reduce_cluster_based_on_endpoints:  the ",
-              full_cluster_->nodes().size(), " cells have been reduced to ", cs.size(),
+              full_cluster_.nodes().size(), " cells have been reduced to ", cs.size(),
               " clusters, to be added to ", newly_made_clusters.size(),
               " newly made clusters so far ", mybhep::VERBOSE);
     fflush(stdout);
-    cs = clean_up(cs);
+    cs = clean_up(std::move(cs));
     assign_nodes_of_clusters(cs);
     newly_made_clusters.insert(newly_made_clusters.end(), cs.begin(), cs.end());
-    newly_made_clusters = clean_up(newly_made_clusters);
+    newly_made_clusters = clean_up(std::move(newly_made_clusters));
     m.message("SULTAN::sultan::reduce_cluster_based_on_endpoints:  after clean_up, ",
               newly_made_clusters.size(), "newly made clusters remain", mybhep::VERBOSE);
     fflush(stdout);
@@ -2357,10 +2362,10 @@ void sultan::reduce_cluster_based_on_endpoints(size_t icluster) {
     // AND some clusters have been obtained in this round
     // AND the leftover cells have decreased
     there_are_nodes_to_clusterize = !cluster_is_finished && cs.size() &&
-                                    (leftover_cluster_->nodes().size() < n_of_leftover_cells);
+                                    (leftover_cluster_.nodes().size() < n_of_leftover_cells);
 
     m.message("SULTAN::sultan::reduce_cluster_based_on_endpoints:  status: newly made size: ",
-              newly_made_clusters.size(), " leftover:", leftover_cluster_->nodes().size(),
+              newly_made_clusters.size(), " leftover:", leftover_cluster_.nodes().size(),
               " cluster_is_finished:", cluster_is_finished,
               " there_are_nodes_to_clusterize:", there_are_nodes_to_clusterize, mybhep::VERBOSE);
     fflush(stdout);
@@ -2385,13 +2390,13 @@ void sultan::reduce_cluster_based_on_endpoints(size_t icluster) {
 
   status();
 
-  if (use_clocks) clock.stop(" sultan: reduce_cluster_based_on_endpoints ");
+  clock.stop(timer::sultan_reduce_cluster_based_on_endpoints);
 
   return;
 }
 
 //*************************************************************
-void sultan::assign_nodes_of_clusters(std::vector<topology::cluster> clusters) {
+void sultan::assign_nodes_of_clusters(const std::vector<topology::cluster> &clusters) {
   //*************************************************************
 
   for (std::vector<topology::cluster>::const_iterator iclu = clusters.begin();
@@ -2435,7 +2440,8 @@ std::vector<topology::sequence> sultan::clean_up(std::vector<topology::sequence>
 
   if (seqs.size() <= 1) return seqs;
 
-  std::vector<topology::sequence> cleaned_sequences;
+  std::vector<bool> clean;
+  clean.reserve(seqs.size());
 
   for (std::vector<topology::sequence>::const_iterator is = seqs.begin(); is != seqs.end(); ++is) {
     bool this_sequence_is_clean = true;
@@ -2455,10 +2461,19 @@ std::vector<topology::sequence> sultan::clean_up(std::vector<topology::sequence>
       }
     }
 
-    if (this_sequence_is_clean) cleaned_sequences.push_back(*is);
+    clean.push_back(this_sequence_is_clean);
+  }
+
+  // move the clean sequences to the front, in order
+  size_t ncleaned = 0;
+  for (size_t i = 0; i < seqs.size(); ++i) {
+    if (!clean[i]) continue;
+    if (ncleaned != i) seqs[ncleaned] = std::move(seqs[i]);
+    ++ncleaned;
   }
+  seqs.erase(seqs.begin() + ncleaned, seqs.end());
 
-  return cleaned_sequences;
+  return seqs;
 }
 
 //*************************************************************
@@ -2467,7 +2482,8 @@ std::vector<topology::cluster> sultan::clean_up(std::vector<topology::cluster> c
 
   if (cs.size() <= 1) return cs;
 
-  std::vector<topology::cluster> cleaned_clusters;
+  std::vector<bool> clean;
+  clean.reserve(cs.size());
 
   for (std::vector<topology::cluster>::const_iterator is = cs.begin(); is != cs.end(); ++is) {
     bool this_cluster_is_clean = true;
@@ -2486,10 +2502,19 @@ std::vector<topology::cluster> sultan::clean_up(std::vector<topology::cluster> c
       }
     }
 
-    if (this_cluster_is_clean) cleaned_clusters.push_back(*is);
+    clean.push_back(this_cluster_is_clean);
   }
 
-  return cleaned_clusters;
+  // move the clean clusters to the front, in order
+  size_t ncleaned = 0;
+  for (size_t i = 0; i < cs.size(); ++i) {
+    if (!clean[i]) continue;
+    if (ncleaned != i) cs[ncleaned] = std::move(cs[i]);
+    ++ncleaned;
+  }
+  cs.erase(cs.begin() + ncleaned, cs.end());
+
+  return cs;
 }
 
 //*************************************************************
@@ -2507,8 +2532,8 @@ void sultan::make_name(topology::sequence &sequence_) {
 bool sultan::late(void) {
   //*************************************************************
 
-  if (clock.read(" sultan: sequentiation ") >= max_time) {
-    m.message("SULTAN::sultan::late: execution time ", clock.read(" sultan: sequentiation "),
+  if (sequentiation_clock.read() >= max_time) {
+    m.message("SULTAN::sultan::late: execution time ", sequentiation_clock.read(),
               " ms  greater than max_time", max_time, " quitting! ", mybhep::NORMAL);
     return true;
   }
@@ -2560,7 +2585,7 @@ void sultan::print_a_sequence(const topology::sequence &sequence) const {
 bool sultan::make_scenarios(topology::tracked_data &td) {
   //*************************************************************
 
-  if (use_clocks) clock.start(" sultan: make scenarios ", "cumulative");
+  clock.start(timer::sultan_make_scenarios);
 
   if (sequences_.size()) {
     topology::scenario sc;
@@ -2576,7 +2601,7 @@ bool sultan::make_scenarios(topology::tracked_data &td) {
     td.scenarios_.push_back(sc);
   }
 
-  if (use_clocks) clock.stop(" sultan: make scenarios ");
+  clock.stop(timer::sultan_make_scenarios);
 
   return true;
 }
@@ -2611,11 +2636,11 @@ void sultan::print_a_scenario(const topology::scenario &scenario) const {
 }
 
 //*************************************************************
-topology::cluster sultan::get_helix_cluster_from(topology::cell_triplet t,
-                                                 topology::experimental_helix helix) {
+topology::cluster sultan::get_helix_cluster_from(const topology::cell_triplet &t,
+                                                 const topology::experimental_helix &helix) {
   //*************************************************************
   // make a cluster with the nodes intercepted by helix
-  if (use_clocks) clock.start(" sultan: get_helix_cluster_from ", "cumulative");
+  clock.start(timer::sultan_get_helix_cluster_from);
   m.message(
       "SULTAN::sultan::get_helix_cluster_from: , make a cluster with the nodes intercepted by "
       "helix through ",
@@ -2632,8 +2657,8 @@ topology::cluster sultan::get_helix_cluster_from(topology::cell_triplet t,
   bool chosen;
 
   // loop on cells in the cluster
-  for (std::vector<topology::node>::iterator inode = leftover_cluster_->nodes_.begin();
-       inode != leftover_cluster_->nodes_.end(); ++inode) {
+  for (std::vector<topology::node>::iterator inode = leftover_cluster_.nodes_.begin();
+       inode != leftover_cluster_.nodes_.end(); ++inode) {
     chosen = helix_is_near_cell(t, helix, &DR, &DH, &(*inode));
 
     if (level >= mybhep::VVERBOSE) {
@@ -2660,12 +2685,12 @@ topology::cluster sultan::get_helix_cluster_from(topology::cell_triplet t,
 
   if (c.is_good()) {
     // add to cluster from full nodes
-    c = add_cells_to_helix_cluster_from(c, t, helix);
+    c = add_cells_to_helix_cluster_from(std::move(c), t, helix);
 
     topology::cluster longest_piece;
 
     if (get_longest_piece(&c, t.ca(), t.cc(), &longest_piece)) {
-      c = longest_piece;
+      c = std::move(longest_piece);
     } else {
       c.nodes_.clear();
     }
@@ -2673,34 +2698,33 @@ topology::cluster sultan::get_helix_cluster_from(topology::cell_triplet t,
     c.nodes_.clear();
   }
 
-  if (use_clocks) clock.stop(" sultan: get_helix_cluster_from ");
+  clock.stop(timer::sultan_get_helix_cluster_from);
   return c;
 }
 
 //*************************************************************
-topology::cluster sultan::add_cells_to_helix_cluster_from(topology::cluster cluster,
-                                                          topology::cell_triplet t,
-                                                          topology::experimental_helix helix) {
+topology::cluster sultan::add_cells_to_helix_cluster_from(
+    topology::cluster c, const topology::cell_triplet &t,
+    const topology::experimental_helix &helix) {
   //*************************************************************
   // make a cluster with the nodes intercepted by helix
-  if (use_clocks) clock.start(" sultan: add_cells_to_helix_cluster_from ", "cumulative");
+  clock.start(timer::sultan_add_cells_to_helix_cluster_from);
   m.message(
       "SULTAN::sultan::add_cells_to_helix_cluster_from: , make a cluster with the nodes "
       "intercepted by helix ",
       mybhep::VVERBOSE);
 
-  topology::cluster c = cluster;
   topology::experimental_double DR, DH;
 
   bool chosen;
 
   // loop on cells in the cluster
-  for (std::vector<topology::node>::iterator inode = full_cluster_->nodes_.begin();
-       inode != full_cluster_->nodes_.end(); ++inode) {
+  for (std::vector<topology::node>::iterator inode = full_cluster_.nodes_.begin();
+       inode != full_cluster_.nodes_.end(); ++inode) {
     bool node_already_in_cluster = false;
 
-    for (std::vector<topology::node>::const_iterator jnode = leftover_cluster_->nodes_.begin();
-         jnode != leftover_cluster_->nodes_.end(); ++jnode) {
+    for (std::vector<topology::node>::const_iterator jnode = leftover_cluster_.nodes_.begin();
+         jnode != leftover_cluster_.nodes_.end(); ++jnode) {
       if (inode->c().id() == jnode->c().id()) {
         node_already_in_cluster = true;
         break;
@@ -2721,12 +2745,13 @@ topology::cluster sultan::add_cells_to_helix_cluster_from(topology::cluster clus
       "with ",
       c.nodes().size(), " nodes", mybhep::VVERBOSE);
 
-  if (use_clocks) clock.stop(" sultan: add_cells_to_helix_cluster_from ");
+  clock.stop(timer::sultan_add_cells_to_helix_cluster_from);
   return c;
 }
 
 //*************************************************************
-bool sultan::line_is_near_cell(topology::experimental_line line, topology::experimental_double *DR,
+bool sultan::line_is_near_cell(const topology::experimental_line &line,
+                               topology::experimental_double *DR,
                                topology::experimental_double *DH, topology::node *node) {
   //*************************************************************
 
@@ -2768,12 +2793,13 @@ bool sultan::line_is_near_cell(topology::experimental_line line, topology::exper
 }
 
 //*************************************************************
-bool sultan::helix_is_near_cell(topology::cell_triplet t, topology::experimental_helix helix,
+bool sultan::helix_is_near_cell(const topology::cell_triplet &t,
+                                const topology::experimental_helix &helix,
                                 topology::experimental_double *DR,
                                 topology::experimental_double *DH, topology::node *node) {
   //*************************************************************
 
-  if (use_clocks) clock.start(" sultan: helix_is_near_cell ", "cumulative");
+  clock.start(timer::sultan_helix_is_near_cell);
 
   bool chosen = false;
 
@@ -2787,11 +2813,11 @@ bool sultan::helix_is_near_cell(topology::cell_triplet t, topology::experimental
             " from helix ", mybhep::VVERBOSE);
 
   if (!DR->is_zero__optimist(nsigma_r)) {
-    if (use_clocks) clock.stop(" sultan: helix_is_near_cell ");
+    clock.stop(timer::sultan_helix_is_near_cell);
     return chosen;
   }
   if (!DH->is_zero__optimist(nsigma_z)) {
-    if (use_clocks) clock.stop(" sultan: helix_is_near_cell ");
+    clock.stop(timer::sultan_helix_is_near_cell);
     return chosen;
   }
 
@@ -2808,7 +2834,7 @@ bool sultan::helix_is_near_cell(topology::cell_triplet t, topology::experimental
   helix.get_phi_of_point(node->c().ep(), &p_circle, &angle);
 
   if (angle < angle_a || angle > angle_b) {
-    if (use_clocks) clock.stop(" sultan: helix_is_near_cell ");
+    clock.stop(timer::sultan_helix_is_near_cell);
     return chosen;
   }
 
@@ -2822,20 +2848,21 @@ bool sultan::helix_is_near_cell(topology::cell_triplet t, topology::experimental
   node->set_circle_phi(angle);
   node->set_ep(p_circle);
 
-  if (use_clocks) clock.stop(" sultan: helix_is_near_cell ");
+  clock.stop(timer::sultan_helix_is_near_cell);
 
   return chosen;
 }
 
 //*************************************************************
-topology::cluster sultan::get_line_cluster_from(topology::node a_node, topology::node b_node) {
+topology::cluster sultan::get_line_cluster_from(const topology::node &a_node,
+                                                const topology::node &b_node) {
   //*************************************************************
   // get cluster with cells intercepted by line ab
   m.message("SULTAN::sultan::get_line_cluster_from: get cluster with cells intercepted by line ab ",
-            a_node.c().id(), "-", b_node.c().id(), " in ", leftover_cluster_->nodes_.size(),
+            a_node.c().id(), "-", b_node.c().id(), " in ", leftover_cluster_.nodes_.size(),
             " leftover cells ", mybhep::VVERBOSE);
 
-  if (use_clocks) clock.start(" sultan: get_line_cluster_from ", "cumulative");
+  clock.start(timer::sultan_get_line_cluster_from);
 
   /////////////////////////////////
   ///   built thick line a->b   ///
@@ -2859,8 +2886,8 @@ topology::cluster sultan::get_line_cluster_from(topology::node a_node, topology:
   /////////////////////////////////////
 
   topology::cluster c;
-  a_node.set_circle_phi(0);
   c.nodes_.push_back(a_node);
+  c.nodes_.back().set_circle_phi(0);
 
   topology::experimental_double DR, DH;
 
@@ -2871,8 +2898,8 @@ topology::cluster sultan::get_line_cluster_from(topology::node a_node, topology:
 
   bool chosen;
   // loop on cells in the cluster
-  for (std::vector<topology::node>::iterator inode = leftover_cluster_->nodes_.begin();
-       inode != leftover_cluster_->nodes_.end(); ++inode) {
+  for (std::vector<topology::node>::iterator inode = leftover_cluster_.nodes_.begin();
+       inode != leftover_cluster_.nodes_.end(); ++inode) {
     if (inode->c().id() == a_node.c().id()) continue;
     if (inode->c().id() == b_node.c().id()) continue;
 
@@ -2889,18 +2916,18 @@ topology::cluster sultan::get_line_cluster_from(topology::node a_node, topology:
     std::clog << " " << std::endl;
   }
 
-  b_node.set_circle_phi(1);
   c.nodes_.push_back(b_node);
+  c.nodes_.back().set_circle_phi(1);
 
   m.message("SULTAN::sultan::get_line_cluster_from: the line ", a_node.c().id(), " - ",
             b_node.c().id(), " intercepts ", c.nodes_.size(), " nodes ", mybhep::VVERBOSE);
 
   if (c.is_good()) {
-    c = add_cells_to_line_cluster_from(line, a_node.c().id(), b_node.c().id(), c);
+    c = add_cells_to_line_cluster_from(line, a_node.c().id(), b_node.c().id(), std::move(c));
 
     topology::cluster longest_piece;
     if (get_longest_piece(&c, a_node, b_node, &longest_piece)) {
-      c = longest_piece;
+      c = std::move(longest_piece);
     } else {
       c.nodes_.clear();
     }
@@ -2908,37 +2935,38 @@ topology::cluster sultan::get_line_cluster_from(topology::node a_node, topology:
     c.nodes_.clear();
   }
 
-  if (use_clocks) clock.stop(" sultan: get_line_cluster_from ");
+  clock.stop(timer::sultan_get_line_cluster_from);
   return c;
 }
 
 //*************************************************************
-topology::cluster sultan::add_cells_to_line_cluster_from(topology::experimental_line line,
+topology::cluster sultan::add_cells_to_line_cluster_from(const topology::experimental_line &line,
                                                          size_t ida, size_t idb,
-                                                         topology::cluster cluster) {
+                                                         topology::cluster c) {
   //*************************************************************
   // add to line (obtained from cluster) cells from full_cluster
-  if (use_clocks) clock.start(" sultan: add_cells_to_line_cluster_from ", "cumulative");
+  clock.start(timer::sultan_add_cells_to_line_cluster_from);
   m.message(
       "SULTAN::sultan::add_cells_to_line_cluster_from: get cluster with cells intercepted by line "
       "ab ",
       mybhep::VVERBOSE);
 
-  topology::cluster c = cluster;
+  // the nodes of the given cluster
+  const size_t ngiven = c.nodes_.size();
 
   topology::experimental_double dist_hor, dist_vert;
   bool chosen;
 
   // loop on cells in the full cluster
-  for (std::vector<topology::node>::iterator inode = full_cluster_->nodes_.begin();
-       inode != full_cluster_->nodes_.end(); ++inode) {
+  for (std::vector<topology::node>::iterator inode = full_cluster_.nodes_.begin();
+       inode != full_cluster_.nodes_.end(); ++inode) {
     if (inode->c().id() == ida) continue;
     if (inode->c().id() == idb) continue;
 
     bool node_already_in_cluster = false;
 
-    for (std::vector<topology::node>::iterator jnode = cluster.nodes_.begin();
-         jnode != cluster.nodes_.end(); ++jnode) {
+    for (std::vector<topology::node>::const_iterator jnode = c.nodes_.begin();
+         jnode != c.nodes_.begin() + ngiven; ++jnode) {
       if (inode->c().id() == jnode->c().id()) {
         node_already_in_cluster = true;
         break;
@@ -2961,12 +2989,12 @@ topology::cluster sultan::add_cells_to_line_cluster_from(topology::experimental_
   m.message("SULTAN::sultan::add_cells_to_line_cluster_from: the line intercepts ", c.nodes_.size(),
             " nodes ", mybhep::VVERBOSE);
 
-  if (use_clocks) clock.stop(" sultan: add_cells_to_line_cluster_from ");
+  clock.stop(timer::sultan_add_cells_to_line_cluster_from);
   return c;
 }
 
 //*************************************************************
-topology::cluster sultan::get_best_cluster_from(std::vector<topology::cluster> cs) {
+topology::cluster sultan::get_best_cluster_from(const std::vector<topology::cluster> &cs) {
   //*************************************************************
 
   // choose 1 best cluster from cs
@@ -2991,18 +3019,19 @@ topology::cluster sultan::get_best_cluster_from(std::vector<topology::cluster> c
 }
 
 //*************************************************************
-void sultan::get_line_clusters_from(topology::node a, topology::node b, size_t /*icluster*/,
-                                    bool *cluster_is_finished, std::vector<topology::cluster> *cs) {
+void sultan::get_line_clusters_from(const topology::node &a, const topology::node &b,
+                                    size_t /*icluster*/, bool *cluster_is_finished,
+                                    std::vector<topology::cluster> *cs) {
   //*************************************************************
   // get all clusters based on line (a, b), with X in leftover cluster
   // all clusters returned are "good"
 
-  if (use_clocks) clock.start(" sultan: get_line_clusters_from ", "cumulative");
+  clock.start(timer::sultan_get_line_clusters_from);
 
   m.message(
       "SULTAN::sultan::get_line_clusters_from: get all clusters based on line (a, b), with X in "
       "cluster of",
-      leftover_cluster_->nodes().size(), " cells ", mybhep::VVERBOSE);
+      leftover_cluster_.nodes().size(), " cells ", mybhep::VVERBOSE);
 
   topology::cluster c = get_line_cluster_from(a, b);
   if (!c.is_good()) {
@@ -3010,7 +3039,7 @@ void sultan::get_line_clusters_from(topology::node a, topology::node b, size_t /
       std::clog << "SULTAN::sultan::get_line_clusters_from:  " << a.c().id() << " -> " << b.c().id()
                 << " not clusterized as line " << std::endl;
     }
-    if (use_clocks) clock.stop(" sultan: get_line_clusters_from ");
+    clock.stop(timer::sultan_get_line_clusters_from);
     return;
   }
 
@@ -3029,43 +3058,43 @@ void sultan::get_line_clusters_from(topology::node a, topology::node b, size_t /
     std::clog << ")" << std::endl;
   }
 
-  if (c.nodes().size() == full_cluster_->nodes().size()) {
+  if (c.nodes().size() == full_cluster_.nodes().size()) {
     m.message("SULTAN::sultan::get_line_clusters_from: all", c.nodes().size(),
               "cells of cluster have been assigned as a line ", mybhep::VERBOSE);
     *cluster_is_finished = true;
   }
 
-  if (use_clocks) clock.stop(" sultan: get_line_clusters_from ");
+  clock.stop(timer::sultan_get_line_clusters_from);
   return;
 }
 
 //*************************************************************
-void sultan::get_helix_clusters_from(topology::node a, topology::node b, size_t icluster,
-                                     bool *cluster_is_finished,
+void sultan::get_helix_clusters_from(const topology::node &a, const topology::node &b,
+                                     size_t icluster, bool *cluster_is_finished,
                                      std::vector<topology::cluster> *cs) {
   //*************************************************************
   // get all clusters based on helices built on triplets (a, X, b), with X in leftover cluster
   // all clusters returned are "good"
 
-  if (use_clocks) clock.start(" sultan: get_helix_clusters_from ", "cumulative");
+  clock.start(timer::sultan_get_helix_clusters_from);
 
   m.message(
       "SULTAN::sultan::get_helix_clusters_from: get all clusters based on helices built on "
       "triplets (a, X, b), with X in cluster of",
-      leftover_cluster_->nodes().size(), " cells ", mybhep::VVERBOSE);
+      leftover_cluster_.nodes().size(), " cells ", mybhep::VVERBOSE);
 
   std::vector<topology::experimental_helix> helices;
 
   // loop on cells in the cluster of leftover nodes for form a triplet (a, X, b)
   double distance12, distance23;
-  std::vector<topology::node>::iterator inode = leftover_cluster_->nodes_.begin();
-  while (inode != leftover_cluster_->nodes_.end()) {
-    if (inode - leftover_cluster_->nodes_.begin() + 1 > (int)leftover_cluster_->nodes_.size())
+  std::vector<topology::node>::iterator inode = leftover_cluster_.nodes_.begin();
+  while (inode != leftover_cluster_.nodes_.end()) {
+    if (inode - leftover_cluster_.nodes_.begin() + 1 > (int)leftover_cluster_.nodes_.size())
       break;
 
     m.message("SULTAN::sultan::get_helix_clusters_from:  ... build helices for triplet ( ",
               a.c().id(), ", ", inode->c().id(), ", ", b.c().id(), ") using node ",
-              inode - leftover_cluster_->nodes_.begin(), " of ", leftover_cluster_->nodes_.size(),
+              inode - leftover_cluster_.nodes_.begin(), " of ", leftover_cluster_.nodes_.size(),
               mybhep::VVERBOSE);
 
     if (inode->c().id() == a.c().id()) {
@@ -3126,7 +3155,7 @@ void sultan::get_helix_clusters_from(topology::node a, topology::node b, size_t
       if (!c.is_good()) continue;
 
       if (level >= mybhep::VERBOSE) {
-        std::vector<topology::node> the_nodes = c.nodes();
+        const std::vector<topology::node> &the_nodes = c.nodes();
         std::clog << "SULTAN::sultan::get_helix_clusters_from:  helix " << ihelix - helices.begin()
                   << " for triplet ( " << a.c().id() << ", " << inode->c().id() << ", "
                   << b.c().id() << ") makes a good cluster of " << c.nodes().size()
@@ -3139,16 +3168,16 @@ void sultan::get_helix_clusters_from(topology::node a, topology::node b, size_t
 
       c.set_cluster_type("helix");
 
-      if (c.nodes().size() == full_cluster_->nodes_.size()) {
+      if (c.nodes().size() == full_cluster_.nodes_.size()) {
         m.message("SULTAN::sultan::get_helix_clusters_from:  all", c.nodes().size(),
                   "cells of cluster have been assigned as helix ", mybhep::VERBOSE);
         *cluster_is_finished = true;
         // assign_nodes_of_cluster(c);
-        cs->push_back(c);
-        if (use_clocks) clock.stop(" sultan: get_helix_clusters_from ");
+        cs->push_back(std::move(c));
+        clock.stop(timer::sultan_get_helix_clusters_from);
         return;
       } else {
-        csh.push_back(c);
+        csh.push_back(std::move(c));
       }
 
     }  // finish loop on helices from (a, X, b)
@@ -3167,11 +3196,11 @@ void sultan::get_helix_clusters_from(topology::node a, topology::node b, size_t
       m.message("SULTAN::sultan::get_helix_clusters_from: cells assigned as helix ",
                 mybhep::VERBOSE);
 
-      if (cmax.nodes().size() == full_cluster_->nodes_.size()) {
+      if (cmax.nodes().size() == full_cluster_.nodes_.size()) {
         m.message("SULTAN::sultan::get_helix_clusters_from:  all", cmax.nodes().size(),
                   "cells of cluster have been assigned as helix ", mybhep::VERBOSE);
         *cluster_is_finished = true;
-        if (use_clocks) clock.stop(" sultan: get_helix_clusters_from ");
+        clock.stop(timer::sultan_get_helix_clusters_from);
         return;
       }
     }
@@ -3179,25 +3208,25 @@ void sultan::get_helix_clusters_from(topology::node a, topology::node b, size_t
     ++inode;
   }  // finish loop on cell X in (a, X, b)
 
-  if (use_clocks) clock.stop(" sultan: get_helix_clusters_from ");
+  clock.stop(timer::sultan_get_helix_clusters_from);
   return;
 }
 
 //*************************************************************
-void sultan::assign_nodes_of_cluster(topology::cluster c) {
+void sultan::assign_nodes_of_cluster(const topology::cluster &c) {
   //*************************************************************
 
-  leftover_cluster_->remove_nodes(c.nodes());
+  leftover_cluster_.remove_nodes(c.nodes());
 }
 
 //*************************************************************
-std::vector<topology::cluster> sultan::get_clusters_from(topology::node a, topology::node b,
-                                                         size_t icluster,
+std::vector<topology::cluster> sultan::get_clusters_from(const topology::node &a,
+                                                         const topology::node &b, size_t icluster,
                                                          bool *cluster_is_finished) {
   //*************************************************************
   // get all clusters with endpoints a and b
 
-  if (use_clocks) clock.start(" sultan: get_clusters_from ", "cumulative");
+  clock.start(timer::sultan_get_clusters_from);
 
   if (level >= mybhep::VERBOSE) {
     bool on_foil, on_calo, on_xcalo;
@@ -3223,7 +3252,7 @@ std::vector<topology::cluster> sultan::get_clusters_from(topology::node a, topol
     if (on_calo) std::clog << "(calo)";
     if (on_xcalo) std::clog << "(xcalo)";
 
-    std::clog << " from full cluster with " << full_cluster_->nodes().size() << " gg cells "
+    std::clog << " from full cluster with " << full_cluster_.nodes().size() << " gg cells "
               << std::endl;
   }
 
@@ -3233,12 +3262,12 @@ std::vector<topology::cluster> sultan::get_clusters_from(topology::node a, topol
   status();
 
   if (!clusterize_with_helix_model) {
-    if (use_clocks) clock.stop(" sultan: get_clusters_from ");
+    clock.stop(timer::sultan_get_clusters_from);
     return cs;
   }
 
   if (*cluster_is_finished) {
-    if (use_clocks) clock.stop(" sultan: get_clusters_from ");
+    clock.stop(timer::sultan_get_clusters_from);
     return cs;
   }
 
@@ -3263,7 +3292,7 @@ std::vector<topology::cluster> sultan::get_clusters_from(topology::node a, topol
     }
   }
 
-  if (use_clocks) clock.stop(" sultan: get_clusters_from ");
+  clock.stop(timer::sultan_get_clusters_from);
   return cs;
 }
 
@@ -3276,9 +3305,9 @@ void sultan::status() {
               << ", scenarios returned by sultan: " << scenarios_.size()
               << ", sequences: " << sequences_.size() << ", cluster: " << made_clusters_.size()
               << ", gg cells: " << cells_.size() << ", calo hits: " << calos_.size()
-              << ", cluster under study: " << full_cluster_->nodes_.size()
+              << ", cluster under study: " << full_cluster_.nodes_.size()
               << ", triplets under study: " << triplets_.size()
-              << ", leftover cluster under study: " << leftover_cluster_->nodes_.size()
+              << ", leftover cluster under study: " << leftover_cluster_.nodes_.size()
               << std::endl;
   }
 
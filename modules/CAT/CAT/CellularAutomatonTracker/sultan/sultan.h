@@ -8,6 +8,8 @@
 #include <cstdlib>
 #include <cmath>
 #include <limits>
+#include <memory>
+#include <utility>
 
 #include <boost/cstdint.hpp>
 
@@ -32,6 +34,7 @@
 #include <sultan/scenario.h>
 #include <sultan/cell_triplet.h>
 #include <sultan/experimental_legendre_vector.h>
+#include <sultan/task_pool.h>
 
 namespace SULTAN {
 class sultan {
@@ -64,7 +67,7 @@ class sultan {
   void reduce_cluster_based_on_endpoints(size_t icluster);
   void reduce_cluster__with_vector_of_clusters_of_endpoints(
       size_t icluster, std::vector<topology::cluster> *cs,
-      std::vector<topology::cluster> clusters_of_endpoints, bool *cluster_is_finished);
+      const std::vector<topology::cluster> &clusters_of_endpoints, bool *cluster_is_finished);
   void reduce_cluster__with_2_clusters_of_endpoints(size_t icluster, bool *cluster_is_finished,
                                                     const std::vector<topology::node> &inodes,
                                                     const std::vector<topology::node> &jnodes,
@@ -81,41 +84,47 @@ class sultan {
   void print_a_scenario(const topology::scenario &scenario) const;
   bool make_scenarios(topology::tracked_data &td);
   bool check_continous_cells(topology::cluster *given_cluster, topology::experimental_helix *b);
-  bool get_longest_piece(topology::cluster *given_cluster, topology::node a, topology::node b,
-                         topology::cluster *longest_piece);
+  bool get_longest_piece(topology::cluster *given_cluster, const topology::node &a,
+                         const topology::node &b, topology::cluster *longest_piece);
   std::vector<topology::sequence> clean_up(std::vector<topology::sequence> seqs);
   std::vector<topology::cluster> clean_up(std::vector<topology::cluster> clusters);
-  void assign_nodes_of_clusters(std::vector<topology::cluster> clusters);
+  void assign_nodes_of_clusters(const std::vector<topology::cluster> &clusters);
   std::vector<topology::cluster> get_clusters_of_cells_to_be_used_as_end_points();
-  topology::cluster get_helix_cluster_from(topology::cell_triplet t,
-                                           topology::experimental_helix helix);
-  topology::cluster add_cells_to_helix_cluster_from(topology::cluster c, topology::cell_triplet t,
-                                                    topology::experimental_helix helix);
-  void assign_nodes_of_cluster(topology::cluster c);
-  topology::cluster get_line_cluster_from(topology::node a, topology::node b);
-  topology::cluster add_cells_to_line_cluster_from(topology::experimental_line line, size_t ida,
-                                                   size_t idb, topology::cluster cluster);
-  void get_line_clusters_from(topology::node a, topology::node b, size_t icluster,
+  topology::cluster get_helix_cluster_from(const topology::cell_triplet &t,
+                                           const topology::experimental_helix &helix);
+  topology::cluster add_cells_to_helix_cluster_from(topology::cluster c,
+                                                    const topology::cell_triplet &t,
+                                                    const topology::experimental_helix &helix);
+  void assign_nodes_of_cluster(const topology::cluster &c);
+  topology::cluster get_line_cluster_from(const topology::node &a, const topology::node &b);
+  topology::cluster add_cells_to_line_cluster_from(const topology::experimental_line &line,
+                                                   size_t ida, size_t idb,
+                                                   topology::cluster cluster);
+  void get_line_clusters_from(const topology::node &a, const topology::node &b, size_t icluster,
                               bool *cluster_is_finished, std::vector<topology::cluster> *cs);
-  void get_helix_clusters_from(topology::node a, topology::node b, size_t icluster,
+  void get_helix_clusters_from(const topology::node &a, const topology::node &b, size_t icluster,
                                bool *cluster_is_finished, std::vector<topology::cluster> *cs);
-  std::vector<topology::cluster> get_clusters_from(topology::node a, topology::node b,
-                                                   size_t icluster, bool *cluster_is_finished);
+  std::vector<topology::cluster> get_clusters_from(const topology::node &a,
+                                                   const topology::node &b, size_t icluster,
+                                                   bool *cluster_is_finished);
   void create_sequence_from_cluster(std::vector<topology::sequence> *sequences,
                                     const topology::cluster &c);
   void get_angle_of_point(topology::experimental_point *p, double *angle);
   std::vector<topology::cluster> make_unclustered_hits(std::vector<topology::node> *endpoints);
   void make_sequences_from_clusters();
   void reset();
-  bool line_is_near_cell(topology::experimental_line line, topology::experimental_double *DR,
-                         topology::experimental_double *DH, topology::node *node);
-  bool helix_is_near_cell(topology::cell_triplet t, topology::experimental_helix helix,
+  bool line_is_near_cell(const topology::experimental_line &line,
+                         topology::experimental_double *DR, topology::experimental_double *DH,
+                         topology::node *node);
+  bool helix_is_near_cell(const topology::cell_triplet &t,
+                          const topology::experimental_helix &helix,
                           topology::experimental_double *DR, topology::experimental_double *DH,
                           topology::node *node);
-  topology::cluster get_best_cluster_from(std::vector<topology::cluster> cs);
+  topology::cluster get_best_cluster_from(const std::vector<topology::cluster> &cs);
   std::vector<topology::node> get_furthest_end_points(
-      std::vector<topology::cluster> clusters_of_endpoints);
+      const std::vector<topology::cluster> &clusters_of_endpoints);
   void assign_helices_to_clusters();
+  void assign_helix_to_cluster(topology::cluster &cluster, size_t icluster);
   void assign_helices_to_sequences();
   int gap_number(const topology::cell &c);
   topology::plane get_foil_plane();
@@ -124,30 +133,26 @@ class sultan {
   const std::vector<topology::cluster> &get_clusters() const { return clusters_; }
 
   //! get leftover_cluster
-  const topology::cluster &get_leftover_cluster() const { return *leftover_cluster_; }
+  const topology::cluster &get_leftover_cluster() const { return leftover_cluster_; }
 
   //! get assigned_cluster
-  const topology::cluster &get_assigned_cluster() const { return *assigned_cluster_; }
+  const topology::cluster &get_assigned_cluster() const { return assigned_cluster_; }
 
   //! get triplets
   const std::vector<topology::cell_triplet> &get_triplets() const { return triplets_; }
 
   //! set clusters
-  void set_clusters(std::vector<topology::cluster> clusters) {
-    clusters_.clear();
-    clusters_ = clusters;
-  }
+  void set_clusters(std::vector<topology::cluster> clusters) { clusters_ = std::move(clusters); }
 
   //! set leftover_cluster
-  void set_leftover_cluster(topology::cluster c) { *leftover_cluster_ = c; }
+  void set_leftover_cluster(topology::cluster c) { leftover_cluster_ = std::move(c); }
 
   //! set assigned_cluster
-  void set_assigned_cluster(topology::cluster c) { *assigned_cluster_ = c; }
+  void set_assigned_cluster(topology::cluster c) { assigned_cluster_ = std::move(c); }
 
   //! set triplets
   void set_triplets(std::vector<topology::cell_triplet> triplets) {
-    triplets_.clear();
-    triplets_ = triplets;
+    triplets_ = std::move(triplets);
   }
 
   //! get sequences
@@ -155,8 +160,7 @@ class sultan {
 
   //! set sequences
   void set_sequences(std::vector<topology::sequence> sequences) {
-    sequences_.clear();
-    sequences_ = sequences;
+    sequences_ = std::move(sequences);
   }
 
   // module number (SuperNemo will be modular)
@@ -192,6 +196,13 @@ class sultan {
     return;
   }
 
+  //! number of threads sequentiating the clusters of an event, 1 to run serially
+  //! The threads are started at initialization
+  void set_nthreads(size_t v) {
+    nthreads = v;
+    return;
+  }
+
   void set_print_event_display(bool v) {
     print_event_display = v;
     return;
@@ -273,6 +284,9 @@ class sultan {
     return;
   }
 
+  //! timers of the algorithm
+  Clock &get_clock() { return clock; }
+
   void set_cell_distance(double v) {
     cell_distance = v;
     return;
@@ -327,9 +341,15 @@ class sultan {
     return;
   }
 
-  int check_if_cell_is_near_calo(topology::cell c);
+  int check_if_cell_is_near_calo(const topology::cell &c);
 
   void reduce_clusters();
+  void reduce_cluster(const topology::cluster &cluster, size_t icluster);
+
+  // copies of this sultan with their own scratch state, to share the clusters with
+  void make_workers();
+  void prepare_workers();
+  void add_clocks_of_workers();
 
   void set_num_blocks(int nb) {
     if (nb > 0) {
@@ -361,6 +381,9 @@ class sultan {
  protected:
   Clock clock;
 
+  // time of the current sequentiation, to check it against max_time
+  clockable sequentiation_clock;
+
   mybhep::prlevel level;
 
   mybhep::messenger m;
@@ -393,6 +416,7 @@ class sultan {
   // Support numbers
   double execution_time;
   double max_time;
+  size_t nthreads;
   bool SuperNemoChannel; /** New initialization modeof the algorithm
                           *  for SuperNEMO and usage from Channel by
                           *  Falaise and Hereward.
@@ -433,23 +457,39 @@ class sultan {
   std::vector<topology::calorimeter_hit> calos_;
 
   // cluster of neighbouring cells under study:
-  topology::cluster *full_cluster_;
+  topology::cluster full_cluster_;
 
   // all the cell triplets under study
   std::vector<topology::cell_triplet> triplets_;
 
   // cluster of neighbouring cells under study: leftover hits
-  topology::cluster *leftover_cluster_;
+  topology::cluster leftover_cluster_;
 
   // cluster of neighbouring cells under study: assigned hits
-  topology::cluster *assigned_cluster_;
+  topology::cluster assigned_cluster_;
 
   int num_blocks;
   mybhep::dvector<double> planes_per_block;
 
   double run_time;
-  topology::experimental_legendre_vector *experimental_legendre_vector;
+  topology::experimental_legendre_vector experimental_legendre_vector;
   TFile *root_file_;
+
+  // copies of this sultan and the pool of threads they run on, made at
+  // initialization. A copy of a sultan makes workers of its own
+  struct parallel_workers {
+    std::vector<std::unique_ptr<sultan> > copies;
+    std::unique_ptr<task_pool> pool;
+
+    parallel_workers() {}
+    parallel_workers(const parallel_workers &) {}
+    parallel_workers &operator=(const parallel_workers &) {
+      pool.reset();
+      copies.clear();
+      return *this;
+    }
+  };
+  parallel_workers workers_;
 };
 
 }  // end of namespace SULTAN
@@ -0,0 +1,124 @@
+/* -*- mode: c++ -*- */
+#ifndef __sultan__task_pool_h
+#define __sultan__task_pool_h 1
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SULTAN {
+
+// Pool of nworkers workers running tasks, whose threads live as long as the pool
+//
+// Worker 0 runs on the calling thread, the others on threads of their own,
+// which wait for tasks between calls to run(). A pool is operated by a single
+// thread at a time.
+class task_pool {
+ public:
+  explicit task_pool(size_t nworkers) : nworkers_(std::max<size_t>(1, nworkers)) {
+    threads_.reserve(nworkers_ - 1);
+    for (size_t iworker = 1; iworker < nworkers_; ++iworker) {
+      threads_.emplace_back(&task_pool::wait_for_tasks, this, iworker);
+    }
+  }
+
+  ~task_pool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread &t : threads_) t.join();
+  }
+
+  task_pool(const task_pool &) = delete;
+  task_pool &operator=(const task_pool &) = delete;
+
+  size_t size() const { return nworkers_; }
+
+  // Run task(iworker, itask) for each itask in [0, ntasks)
+  //
+  // Each worker takes the next task in turn, so that tasks of uneven cost are
+  // balanced, and may use scratch state of its own, indexed by iworker. The
+  // first exception thrown by a task is rethrown once all the workers are done.
+  template <typename Task>
+  void run(size_t ntasks, Task task) {
+    const size_t nworkers = std::min(nworkers_, ntasks);
+    if (nworkers <= 1) {
+      for (size_t itask = 0; itask < ntasks; ++itask) task(0, itask);
+      return;
+    }
+
+    std::atomic<size_t> next_task(0);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    auto work = [&](size_t iworker) {
+      size_t itask;
+      while ((itask = next_task++) < ntasks) {
+        try {
+          task(iworker, itask);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(error_mutex);
+          if (!error) error = std::current_exception();
+          next_task = ntasks;
+        }
+      }
+    };
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      work_ = work;
+      active_ = nworkers;
+      busy_ = nworkers - 1;
+      ++generation_;
+    }
+    wake_.notify_all();
+    work(0);
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      done_.wait(lock, [this] { return busy_ == 0; });
+      work_ = nullptr;
+    }
+
+    if (error) std::rethrow_exception(error);
+  }
+
+ private:
+  void wait_for_tasks(size_t iworker) {
+    size_t generation = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      wake_.wait(lock, [&] { return stopping_ || generation_ != generation; });
+      if (stopping_) return;
+      generation = generation_;
+      // fewer tasks than workers: this one sits the call out
+      if (iworker >= active_) continue;
+      lock.unlock();
+      work_(iworker);
+      lock.lock();
+      if (--busy_ == 0) done_.notify_one();
+    }
+  }
+
+  const size_t nworkers_;
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  std::function<void(size_t)> work_;
+  size_t active_ = 0;
+  size_t busy_ = 0;
+  size_t generation_ = 0;
+  bool stopping_ = false;
+};
+
+}  // namespace SULTAN
+
+#endif  // __sultan__task_pool_h
@@ -0,0 +1,78 @@
+/* -*- mode: c++ -*- */
+#ifndef __sultan__timers_h
+#define __sultan__timers_h 1
+
+#include <cstddef>
+
+namespace SULTAN {
+
+// Timers of the SULTAN algorithms, each addressing one counter of a Clock.
+// Their names are listed in the same order in Clock.cpp
+enum class timer : size_t {
+  clusterizer_finalize,
+  clusterizer_prepare_event,
+  clusterizer_clusterize,
+  clusterizer_get_near_cells,
+  clusterizer_setup_clusters,
+  experimental_legendre_vector_add_helix_to_clusters,
+  experimental_legendre_vector_add_a_helix_to_clusters,
+  experimental_legendre_vector_merge_cluster_of_index,
+  experimental_legendre_vector_merge_the_cluster_of_index,
+  experimental_legendre_vector_fill_accumulator,
+  experimental_legendre_vector_max,
+  sultan_finalize,
+  sultan_sequentiate,
+  sultan_assign_helices_to_clusters,
+  sultan_assign_helices_to_sequences,
+  sultan_reduce_clusters,
+  sultan_sequentiate_after_cat,
+  sultan_assign_nodes_based_on_experimental_helix,
+  sultan_continous,
+  sultan_get_longest_piece,
+  sultan_form_triplets_from_cells,
+  sultan_form_triplets_from_cells_with_endpoints,
+  sultan_form_helices_from_triplets,
+  sultan_form_helices_from_triplets_print_event_display,
+  sultan_sequentiate_with_vector,
+  sultan_sequentiate_with_vector_helix_loop_clean,
+  sultan_sequentiate_with_vector_helix_loop_add_helix,
+  sultan_sequentiate_with_vector_helix_loop_max,
+  sultan_sequentiate_with_vector_helix_loop_assign,
+  sultan_sequentiate_with_vector_2,
+  sultan_sequentiate_with_vector_2_helix_loop_clean,
+  sultan_sequentiate_with_vector_2_helix_loop_add_helix_to_clusters,
+  sultan_sequentiate_with_vector_2_helix_loop_max,
+  sultan_sequentiate_with_vector_2_helix_loop_assign,
+  sultan_sequentiate_with_vector_3,
+  sultan_sequentiate_with_vector_3_helix_loop_clean,
+  sultan_sequentiate_with_vector_3_helix_loop_add_helix,
+  sultan_sequentiate_with_vector_3_helix_loop_max,
+  sultan_sequentiate_with_vector_3_helix_loop_assign,
+  sultan_sequentiate_with_vector_4,
+  sultan_sequentiate_with_vector_4_helix_loop_clean,
+  sultan_sequentiate_with_vector_4_helix_loop_add_helix_to_clusters,
+  sultan_sequentiate_with_vector_4_helix_loop_find_clusters,
+  sultan_sequentiate_with_vector_4_helix_loop_assign,
+  sultan_get_clusters_of_cells_to_be_used_as_end_points,
+  sultan_reduce_cluster_with_2_endpoints,
+  sultan_reduce_cluster_with_2_clusters_of_endpoints,
+  sultan_reduce_cluster_with_vector_of_clusters_of_endpoints,
+  sultan_reduce_cluster_based_on_endpoints,
+  sultan_make_scenarios,
+  sultan_get_helix_cluster_from,
+  sultan_add_cells_to_helix_cluster_from,
+  sultan_helix_is_near_cell,
+  sultan_get_line_cluster_from,
+  sultan_add_cells_to_line_cluster_from,
+  sultan_get_line_clusters_from,
+  sultan_get_helix_clusters_from,
+  sultan_get_clusters_from,
+  n_timers  // number of timers, keep last
+};
+
+//! name of timer t
+const char* timer_name(timer t);
+
+}  // namespace SULTAN
+
+#endif  // __sultan__timers_h
@@ -44,6 +44,12 @@ class tracked_data : public tracking_object {
   //! Default destructor
   virtual ~tracked_data(){};
 
+  //! copy and move constructors and assignments
+  tracked_data(const tracked_data &) = default;
+  tracked_data(tracked_data &&) = default;
+  tracked_data &operator=(const tracked_data &) = default;
+  tracked_data &operator=(tracked_data &&) = default;
+
   //! constructor
   tracked_data(const std::vector<cell>& cells, const std::vector<calorimeter_hit>& calos,
                const std::vector<cluster>& clusters, const std::vector<scenario>& scenarios,
@@ -19,6 +19,8 @@
 #include <geomtools/manager.h>
 
 // This project :
+#include <CAT/clock_profile.h>
+#include <falaise/snemo/datamodels/handle_pool.h>
 #include <falaise/snemo/datamodels/tracker_clustering_data.h>
 #include <falaise/snemo/geometry/calo_locator.h>
 #include <falaise/snemo/geometry/gg_locator.h>
@@ -134,6 +136,31 @@ void cat_driver::initialize(const datatools::properties& setup_) {
     }
   }
 
+  // Maximum processing time of the search for the best scenario of an event
+  if (setup_.has_key("CAT.max_scenario_time")) {
+    _CAT_setup_.MaxScenarioTime = setup_.fetch_real("CAT.max_scenario_time");
+    if (!setup_.has_explicit_unit("CAT.max_scenario_time")) {
+      _CAT_setup_.MaxScenarioTime *= CLHEP::ms;
+    }
+    DT_THROW_IF(_CAT_setup_.MaxScenarioTime < 0.0, std::logic_error,
+                "Invalid maximum scenario time(" << _CAT_setup_.MaxScenarioTime << ") !");
+  }
+
+  // Maximum number of candidate scenarios tried for an event
+  if (setup_.has_key("CAT.max_scenario_candidates")) {
+    _CAT_setup_.MaxScenarioCandidates = setup_.fetch_integer("CAT.max_scenario_candidates");
+    DT_THROW_IF(_CAT_setup_.MaxScenarioCandidates < 0, std::logic_error,
+                "Invalid maximum number of candidate scenarios("
+                    << _CAT_setup_.MaxScenarioCandidates << ") !");
+  }
+
+  // Number of threads sequentiating the clusters of an event
+  if (setup_.has_key("CAT.threads")) {
+    _CAT_setup_.nthreads = setup_.fetch_integer("CAT.threads");
+    DT_THROW_IF(_CAT_setup_.nthreads < 1, std::logic_error,
+                "Invalid number of threads(" << _CAT_setup_.nthreads << ") !");
+  }
+
   // Max radius of cells to be not treated as points in distance unit
   if (setup_.has_key("CAT.small_radius")) {
     _CAT_setup_.SmallRadius = setup_.fetch_real("CAT.small_radius");
@@ -238,6 +265,8 @@ void cat_driver::initialize(const datatools::properties& setup_) {
   CAT::sequentiator_configure(_CAT_sequentiator_, _CAT_setup_);
   _CAT_clusterizer_.initialize();
   _CAT_sequentiator_.initialize();
+  enable_clock_profile(_CAT_clusterizer_.get_clock());
+  enable_clock_profile(_CAT_sequentiator_.get_clock());
 
   _set_initialized(true);
 }
@@ -448,6 +477,8 @@ int cat_driver::_process_algo(const base_tracker_clusterizer::hit_collection_typ
 
   // Run the sequentiator algorithm :
   _CAT_sequentiator_.sequentiate(_CAT_output_.tracked_data);
+  record_clock_profile(_CAT_clusterizer_.get_clock(), CAT_ID);
+  record_clock_profile(_CAT_sequentiator_.get_clock(), CAT_ID);
 
   // Analyse the sequentiator output i.e. 'scenarios' made of 'sequences' of geiger cells:
   const std::vector<CAT::topology::scenario>& tss = _CAT_output_.tracked_data.get_scenarios();
@@ -457,10 +488,13 @@ int cat_driver::_process_algo(const base_tracker_clusterizer::hit_collection_typ
       ihs.second = 0;
     }
 
-    auto htcs = datatools::make_handle<sdm::TrackerClusteringSolution>();
+    auto htcs = snemo::datamodel::make_pooled_handle<sdm::TrackerClusteringSolution>();
     clustering_.push_back(htcs, true);
     clustering_.get_default().set_solution_id(clustering_.size() - 1);
     sdm::tracker_clustering_solution& clustering_solution = clustering_.get_default();
+    if (_CAT_output_.tracked_data.truncated()) {
+      clustering_solution.get_auxiliaries().update_flag(truncated_key());
+    }
 
     // Analyse the sequentiator output :
     const std::vector<CAT::topology::sequence>& the_sequences = iscenario.sequences();
@@ -796,6 +830,63 @@ void cat_driver::init_ocd(datatools::object_configuration_description& ocd_) {
             "                                  \n");
   }
 
+  {
+    // Description of the 'CAT.max_scenario_time' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("CAT.max_scenario_time")
+        .set_from("snemo::reconstruction::cat_driver")
+        .set_terse_description("Maximum processing time of the search for scenarios of an event")
+        .set_traits(datatools::TYPE_REAL)
+        .set_mandatory(false)
+        .set_long_description(
+            "Once it is reached, the best scenario found so far is kept and the  \n"
+            "clustering solution is flagged 'truncated'.                         \n"
+            "Default value: 0 ms, for no limit but 'CAT.max_time'                \n")
+        .add_example(
+            "Search for scenarios for 500 ms at most::  \n"
+            "                                           \n"
+            "  CAT.max_scenario_time : real = 500 ms    \n"
+            "                                           \n");
+  }
+
+  {
+    // Description of the 'CAT.max_scenario_candidates' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("CAT.max_scenario_candidates")
+        .set_from("snemo::reconstruction::cat_driver")
+        .set_terse_description("Maximum number of candidate scenarios tried for an event")
+        .set_traits(datatools::TYPE_INTEGER)
+        .set_mandatory(false)
+        .set_long_description(
+            "Once it is reached, the best scenario found so far is kept and the  \n"
+            "clustering solution is flagged 'truncated'.                         \n"
+            "Default value: 0, for no limit                                      \n")
+        .add_example(
+            "Try 100000 candidate scenarios at most::          \n"
+            "                                                  \n"
+            "  CAT.max_scenario_candidates : integer = 100000  \n"
+            "                                                  \n");
+  }
+
+  {
+    // Description of the 'CAT.threads' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("CAT.threads")
+        .set_from("snemo::reconstruction::cat_driver")
+        .set_terse_description("Number of threads sequentiating the clusters of an event")
+        .set_traits(datatools::TYPE_INTEGER)
+        .set_mandatory(false)
+        .set_long_description(
+            "Clusters are sequentiated in parallel on this number of threads. \n"
+            "The result does not depend on it.                                \n"
+            "Default value: 1                                                 \n")
+        .add_example(
+            "Sequentiate clusters on 4 threads::   \n"
+            "                                      \n"
+            "  CAT.threads : integer = 4           \n"
+            "                                      \n");
+  }
+
   {
     // Description of the 'CAT.small_radius' configuration property :
     datatools::configuration_property_description& cpd = ocd_.add_property_info();
@@ -20,6 +20,7 @@
 #include <falaise/snemo/datamodels/data_model.h>
 #include <falaise/snemo/datamodels/tracker_clustering_data.h>
 #include <falaise/snemo/processing/base_tracker_clusterizer.h>
+#include <falaise/snemo/processing/profiler.h>
 #include <falaise/snemo/services/services.h>
 #include "falaise/snemo/services/geometry.h"
 #include "falaise/snemo/services/service_handle.h"
@@ -130,6 +131,7 @@ void cat_tracker_clustering_module::initialize(const datatools::properties& conf
 
 // Processing :
 dpp::base_module::process_status cat_tracker_clustering_module::process(datatools::things& event) {
+  falaise::processing::scoped_profile profile{get_name()};
   DT_THROW_IF(!is_initialized(), std::logic_error,
               "Module '" << get_name() << "' is not initialized !");
   namespace snedm = snemo::datamodel;
@@ -137,7 +139,7 @@ dpp::base_module::process_status cat_tracker_clustering_module::process(datatool
   if (!event.has(CDTag_)) {
     DT_THROW_IF(true, std::logic_error, "Missing calibrated data to be processed !");
   }
-  const auto& calibratedData = event.get<snedm::calibrated_data>(CDTag_);
+  const auto& calibratedData = ::snedm::getFromEvent<snedm::calibrated_data>(CDTag_, event);
 
   // Get or create output data
   auto& clusteringData = ::snedm::getOrAddToEvent<snedm::tracker_clustering_data>(TCDTag_, event);
@@ -146,7 +148,7 @@ dpp::base_module::process_status cat_tracker_clustering_module::process(datatool
   // Main processing method :
   _process(calibratedData, clusteringData);
 
-  return dpp::base_module::PROCESS_SUCCESS;
+  return profile.result(dpp::base_module::PROCESS_SUCCESS);
 }
 
 void cat_tracker_clustering_module::_process(
@@ -0,0 +1,51 @@
+/** \file CAT/clock_profile.h
+ *
+ * Description:
+ *
+ *   Export of the timers of the CAT and SULTAN algorithms to the module
+ *   profiler of Falaise.
+ *
+ */
+
+#ifndef FALAISE_CAT_PLUGIN_SNEMO_RECONSTRUCTION_CLOCK_PROFILE_H
+#define FALAISE_CAT_PLUGIN_SNEMO_RECONSTRUCTION_CLOCK_PROFILE_H 1
+
+// Standard library:
+#include <string>
+
+// This project
+#include <falaise/snemo/processing/profiler.h>
+
+namespace snemo {
+
+namespace reconstruction {
+
+/// Operate the timers of a CAT or SULTAN clock if the module profiler is active
+template <typename Clock>
+void enable_clock_profile(Clock& clock_) {
+  if (falaise::processing::profiler::is_active()) {
+    clock_.set_enabled(true);
+  }
+}
+
+/// Record the time spent in each timer of a CAT or SULTAN clock since the previous call
+///
+/// Each timer which ran is recorded as one lap of a timer of the module profiler,
+/// named "<prefix_>/<timer name>", apart from the module calls. Timers only
+/// measure the wall time.
+template <typename Clock>
+void record_clock_profile(Clock& clock_, const std::string& prefix_) {
+  if (!falaise::processing::profiler::is_active()) {
+    return;
+  }
+  falaise::processing::profiler& prof = falaise::processing::profiler::instance();
+  clock_.for_each_lap([&](const char* name_, double time_) {
+    prof.record_timer(prefix_ + "/" + name_, time_ * 1.e6);  // ms to ns
+  });
+}
+
+}  // end of namespace reconstruction
+
+}  // end of namespace snemo
+
+#endif  // FALAISE_CAT_PLUGIN_SNEMO_RECONSTRUCTION_CLOCK_PROFILE_H
@@ -19,6 +19,8 @@
 #include <geomtools/manager.h>
 
 // This project :
+#include <CAT/clock_profile.h>
+#include <falaise/snemo/datamodels/handle_pool.h>
 #include <falaise/snemo/datamodels/tracker_clustering_data.h>
 #include <falaise/snemo/geometry/calo_locator.h>
 #include <falaise/snemo/geometry/gg_locator.h>
@@ -139,6 +141,13 @@ void sultan_driver::initialize(const datatools::properties& setup_) {
     }
   }
 
+  // Number of threads sequentiating the clusters of an event
+  if (setup_.has_key("SULTAN.threads")) {
+    _SULTAN_setup_.nthreads = setup_.fetch_integer("SULTAN.threads");
+    DT_THROW_IF(_SULTAN_setup_.nthreads < 1, std::logic_error,
+                "Invalid number of threads(" << _SULTAN_setup_.nthreads << ") !");
+  }
+
   // Make an event display?
   if (setup_.has_key("SULTAN.print_event_display")) {
     _SULTAN_setup_.print_event_display = setup_.fetch_boolean("SULTAN.print_event_display");
@@ -301,6 +310,8 @@ void sultan_driver::initialize(const datatools::properties& setup_) {
 
   _SULTAN_clusterizer_.initialize();
   _SULTAN_sultan_.initialize();
+  enable_clock_profile(_SULTAN_clusterizer_.get_clock());
+  enable_clock_profile(_SULTAN_sultan_.get_clock());
 
   _set_initialized(true);
 }
@@ -508,13 +519,15 @@ int sultan_driver::_process_algo(
   // Run the Sultan algorithm :
   _SULTAN_clusterizer_.clusterize(_SULTAN_output_.tracked_data);
   _SULTAN_sultan_.sequentiate(_SULTAN_output_.tracked_data);
+  record_clock_profile(_SULTAN_clusterizer_.get_clock(), SULTAN_ID);
+  record_clock_profile(_SULTAN_sultan_.get_clock(), SULTAN_ID);
 
   // Analyse the Sultan output: scenarios made of sequences
   const std::vector<st::scenario>& tss = _SULTAN_output_.tracked_data.get_scenarios();
 
   for (const auto& ts : tss) {
     // Add a new solution :
-    auto htcs = datatools::make_handle<sdm::TrackerClusteringSolution>();
+    auto htcs = snemo::datamodel::make_pooled_handle<sdm::TrackerClusteringSolution>();
     clustering_.push_back(htcs, true);
     clustering_.get_default().set_solution_id(clustering_.size() - 1);
     sdm::tracker_clustering_solution& clustering_solution = clustering_.get_default();
@@ -647,6 +660,25 @@ void sultan_driver::init_ocd(datatools::object_configuration_description& ocd_)
             "                                   \n");
   }
 
+  {
+    // Description of the 'SULTAN.threads' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("SULTAN.threads")
+        .set_from("snemo::reconstruction::sultan_driver")
+        .set_terse_description("Number of threads sequentiating the clusters of an event")
+        .set_traits(datatools::TYPE_INTEGER)
+        .set_mandatory(false)
+        .set_long_description(
+            "Clusters are sequentiated in parallel on this number of threads. \n"
+            "The result does not depend on it.                                \n"
+            "Default value: 1                                                 \n")
+        .add_example(
+            "Sequentiate clusters on 4 threads::   \n"
+            "                                      \n"
+            "  SULTAN.threads : integer = 4        \n"
+            "                                      \n");
+  }
+
   {
     // Description of the 'SULTAN.print_event_display' configuration property :
     datatools::configuration_property_description& cpd = ocd_.add_property_info();
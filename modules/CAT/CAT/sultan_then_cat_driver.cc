@@ -19,6 +19,8 @@
 #include <geomtools/manager.h>
 
 // This project :
+#include <CAT/clock_profile.h>
+#include <falaise/snemo/datamodels/handle_pool.h>
 #include <falaise/snemo/datamodels/tracker_clustering_data.h>
 #include <falaise/snemo/geometry/calo_locator.h>
 #include <falaise/snemo/geometry/gg_locator.h>
@@ -106,6 +108,24 @@ void sultan_then_cat_driver::initialize(const datatools::properties& setup_) {
   if (setup_.has_key("CAT.max_time")) {
     _CAT_setup_.MaxTime = setup_.fetch_real("CAT.max_time");
   }
+
+  // Maximum processing time of the search for the best scenario of an event
+  if (setup_.has_key("CAT.max_scenario_time")) {
+    _CAT_setup_.MaxScenarioTime = setup_.fetch_real("CAT.max_scenario_time");
+    if (!setup_.has_explicit_unit("CAT.max_scenario_time")) {
+      _CAT_setup_.MaxScenarioTime *= CLHEP::ms;
+    }
+    DT_THROW_IF(_CAT_setup_.MaxScenarioTime < 0.0, std::logic_error,
+                "Invalid maximum scenario time(" << _CAT_setup_.MaxScenarioTime << ") !");
+  }
+
+  // Maximum number of candidate scenarios tried for an event
+  if (setup_.has_key("CAT.max_scenario_candidates")) {
+    _CAT_setup_.MaxScenarioCandidates = setup_.fetch_integer("CAT.max_scenario_candidates");
+    DT_THROW_IF(_CAT_setup_.MaxScenarioCandidates < 0, std::logic_error,
+                "Invalid maximum number of candidate scenarios("
+                    << _CAT_setup_.MaxScenarioCandidates << ") !");
+  }
   if (setup_.has_key("SULTAN.clusterizer_level")) {
     _SULTAN_setup_.clusterizer_level = setup_.fetch_string("SULTAN.clusterizer_level");
   }
@@ -155,6 +175,13 @@ void sultan_then_cat_driver::initialize(const datatools::properties& setup_) {
     _SULTAN_setup_.max_time = setup_.fetch_real("SULTAN.max_time");
   }
 
+  // Number of threads sequentiating the clusters of an event
+  if (setup_.has_key("SULTAN.threads")) {
+    _SULTAN_setup_.nthreads = setup_.fetch_integer("SULTAN.threads");
+    DT_THROW_IF(_SULTAN_setup_.nthreads < 1, std::logic_error,
+                "Invalid number of threads(" << _SULTAN_setup_.nthreads << ") !");
+  }
+
   // make an event display?
   if (setup_.has_key("SULTAN.print_event_display")) {
     _SULTAN_setup_.print_event_display = setup_.fetch_boolean("SULTAN.print_event_display");
@@ -351,6 +378,11 @@ void sultan_then_cat_driver::initialize(const datatools::properties& setup_) {
   _SULTAN_clusterizer_.initialize();
   _SULTAN_sultan_.initialize();
 
+  enable_clock_profile(_CAT_clusterizer_.get_clock());
+  enable_clock_profile(_CAT_sequentiator_.get_clock());
+  enable_clock_profile(_SULTAN_clusterizer_.get_clock());
+  enable_clock_profile(_SULTAN_sultan_.get_clock());
+
   _set_initialized(true);
 }
 
@@ -884,6 +916,11 @@ int sultan_then_cat_driver::_process_algo(
   convert_cat_data_to_sultan_data();
   _SULTAN_sultan_.sequentiate_after_cat(_SULTAN_output_.tracked_data);
 
+  record_clock_profile(_CAT_clusterizer_.get_clock(), "CAT");
+  record_clock_profile(_CAT_sequentiator_.get_clock(), "CAT");
+  record_clock_profile(_SULTAN_clusterizer_.get_clock(), "SULTAN");
+  record_clock_profile(_SULTAN_sultan_.get_clock(), "SULTAN");
+
   // Analyse the Sultan output: scenarios made of sequences
   const std::vector<ct::scenario>& tss = _CAT_output_.tracked_data.get_scenarios();
   DT_LOG_DEBUG(get_logging_priority(), "Number of scenarios = " << tss.size());
@@ -897,10 +934,13 @@ int sultan_then_cat_driver::_process_algo(
 
   for (const auto& ts : tss) {
     // Add a new solution :
-    auto htcs = datatools::make_handle<sdm::TrackerClusteringSolution>();
+    auto htcs = snemo::datamodel::make_pooled_handle<sdm::TrackerClusteringSolution>();
     clustering_.push_back(htcs, true);
     clustering_.get_default().set_solution_id(clustering_.size() - 1);
     sdm::tracker_clustering_solution& clustering_solution = clustering_.get_default();
+    if (_CAT_output_.tracked_data.truncated()) {
+      clustering_solution.get_auxiliaries().update_flag(truncated_key());
+    }
     clustering_solution.get_auxiliaries().update_string("TRACKER", "CAT");
 
     // Analyse the sequentiator output :
@@ -1286,6 +1326,25 @@ void sultan_then_cat_driver::init_ocd(datatools::object_configuration_descriptio
             "                                   \n");
   }
 
+  {
+    // Description of the 'SULTAN.threads' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("SULTAN.threads")
+        .set_from("snemo::reconstruction::sultan_then_cat_driver")
+        .set_terse_description("Number of threads sequentiating the clusters of an event")
+        .set_traits(datatools::TYPE_INTEGER)
+        .set_mandatory(false)
+        .set_long_description(
+            "Clusters are sequentiated in parallel on this number of threads. \n"
+            "The result does not depend on it.                                \n"
+            "Default value: 1                                                 \n")
+        .add_example(
+            "Sequentiate clusters on 4 threads::   \n"
+            "                                      \n"
+            "  SULTAN.threads : integer = 4        \n"
+            "                                      \n");
+  }
+
   {
     // Description of the 'SULTAN.print_event_display' configuration property :
     datatools::configuration_property_description& cpd = ocd_.add_property_info();
@@ -1606,6 +1665,44 @@ void sultan_then_cat_driver::init_ocd(datatools::object_configuration_descriptio
             "                                  \n");
   }
 
+  {
+    // Description of the 'CAT.max_scenario_time' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("CAT.max_scenario_time")
+        .set_from("snemo::reconstruction::cat_driver")
+        .set_terse_description("Maximum processing time of the search for scenarios of an event")
+        .set_traits(datatools::TYPE_REAL)
+        .set_mandatory(false)
+        .set_long_description(
+            "Once it is reached, the best scenario found so far is kept and the  \n"
+            "clustering solution is flagged 'truncated'.                         \n"
+            "Default value: 0 ms, for no limit but 'CAT.max_time'                \n")
+        .add_example(
+            "Search for scenarios for 500 ms at most::  \n"
+            "                                           \n"
+            "  CAT.max_scenario_time : real = 500 ms    \n"
+            "                                           \n");
+  }
+
+  {
+    // Description of the 'CAT.max_scenario_candidates' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("CAT.max_scenario_candidates")
+        .set_from("snemo::reconstruction::cat_driver")
+        .set_terse_description("Maximum number of candidate scenarios tried for an event")
+        .set_traits(datatools::TYPE_INTEGER)
+        .set_mandatory(false)
+        .set_long_description(
+            "Once it is reached, the best scenario found so far is kept and the  \n"
+            "clustering solution is flagged 'truncated'.                         \n"
+            "Default value: 0, for no limit                                      \n")
+        .add_example(
+            "Try 100000 candidate scenarios at most::          \n"
+            "                                                  \n"
+            "  CAT.max_scenario_candidates : integer = 100000  \n"
+            "                                                  \n");
+  }
+
   {
     // Description of the 'CAT.small_radius' configuration property :
     datatools::configuration_property_description& cpd = ocd_.add_property_info();
@@ -89,11 +89,31 @@ int main(int argc_, char** argv_) {
     CAT.set_geometry_manager(Geo);
     CAT.initialize(CATconfig);
 
+    // The same driver, sequentiating the clusters on several threads:
+    datatools::properties CATthreadsconfig = CATconfig;
+    CATthreadsconfig.store_integer("CAT.threads", 4);
+    snemo::reconstruction::cat_driver CATthreads;
+    CATthreads.set_logging_priority(logging);
+    CATthreads.set_geometry_manager(Geo);
+    CATthreads.initialize(CATthreadsconfig);
+
+    // The same driver, trying a single candidate scenario per event:
+    datatools::properties CATbudgetconfig = CATconfig;
+    CATbudgetconfig.store_integer("CAT.max_scenario_candidates", 1);
+    snemo::reconstruction::cat_driver CATbudget;
+    CATbudget.set_logging_priority(logging);
+    CATbudget.set_geometry_manager(Geo);
+    CATbudget.initialize(CATbudgetconfig);
+
     // Event loop:
     for (int i = 0; i < 3; i++) {
       std::clog << "Processing event #" << i << "\n";
       snemo::reconstruction::cat_driver::hit_collection_type gghits;
       generate_gg_hits(*gg_locator, gghits);
+      // The serial run is the reference of the run on several threads, which
+      // annotates hits of its own with the trajectories it finds:
+      snemo::reconstruction::cat_driver::hit_collection_type threads_gghits;
+      copy_gg_hits(gghits, threads_gghits);
       snemo::reconstruction::cat_driver::calo_hit_collection_type calohits;
       snemo::datamodel::tracker_clustering_data clustering_data;
       int code = CAT.process(gghits, calohits, clustering_data);
@@ -101,11 +121,28 @@ int main(int argc_, char** argv_) {
         break;
       }
       clustering_data.tree_dump(std::clog, "Clustering data: ");
+      snemo::datamodel::tracker_clustering_data threads_clustering_data;
+      code = CATthreads.process(threads_gghits, calohits, threads_clustering_data);
+      DT_THROW_IF(code != 0 || !same_clustering(clustering_data, threads_clustering_data),
+                  std::logic_error, "Sequentiation on several threads changed the result!");
+      // Unless they are flagged as truncated, solutions within budget are the same:
+      snemo::datamodel::tracker_clustering_data budget_clustering_data;
+      code = CATbudget.process(gghits, calohits, budget_clustering_data);
+      DT_THROW_IF(code != 0, std::logic_error, "Search for scenarios within budget failed!");
+      bool truncated = false;
+      for (size_t isol = 0; isol < budget_clustering_data.size(); isol++) {
+        const datatools::properties& aux = budget_clustering_data.at(isol).get_auxiliaries();
+        truncated = truncated || aux.has_flag(snemo::reconstruction::cat_driver::truncated_key());
+      }
+      DT_THROW_IF(!truncated && !same_clustering(clustering_data, budget_clustering_data),
+                  std::logic_error, "Search for scenarios within budget changed the result!");
       if (draw) display_event(*gg_locator, gghits, clustering_data);
     }
 
     // Terminate the CAT driver:
     CAT.reset();
+    CATthreads.reset();
+    CATbudget.reset();
 
     std::clog << "The end.\n";
   } catch (std::exception& error) {
@@ -98,11 +98,23 @@ int main(int argc_, char** argv_) {
     SULTAN.set_geometry_manager(Geo);
     SULTAN.initialize(SULTANconfig);
 
+    // The same driver, sequentiating the clusters on several threads:
+    datatools::properties SULTANthreadsconfig = SULTANconfig;
+    SULTANthreadsconfig.store_integer("SULTAN.threads", 4);
+    snemo::reconstruction::sultan_driver SULTANthreads;
+    SULTANthreads.set_logging_priority(logging);
+    SULTANthreads.set_geometry_manager(Geo);
+    SULTANthreads.initialize(SULTANthreadsconfig);
+
     // Event loop:
     for (int i = 0; i < 3; i++) {
       std::clog << "Processing event #" << i << "\n";
       snemo::reconstruction::sultan_driver::hit_collection_type gghits;
       generate_gg_hits(*gg_locator, gghits);
+      // The serial run is the reference of the run on several threads, which
+      // annotates hits of its own with the trajectories it finds:
+      snemo::reconstruction::sultan_driver::hit_collection_type threads_gghits;
+      copy_gg_hits(gghits, threads_gghits);
       snemo::reconstruction::sultan_driver::calo_hit_collection_type calohits;
       snemo::datamodel::tracker_clustering_data clustering_data;
       int code = SULTAN.process(gghits, calohits, clustering_data);
@@ -110,11 +122,16 @@ int main(int argc_, char** argv_) {
         break;
       }
       clustering_data.tree_dump(std::clog, "Clustering data: ");
+      snemo::datamodel::tracker_clustering_data threads_clustering_data;
+      code = SULTANthreads.process(threads_gghits, calohits, threads_clustering_data);
+      DT_THROW_IF(code != 0 || !same_clustering(clustering_data, threads_clustering_data),
+                  std::logic_error, "Sequentiation on several threads changed the result!");
       if (draw) display_event(*gg_locator, gghits, clustering_data);
     }
 
     // Terminate the SULTAN driver:
     SULTAN.reset();
+    SULTANthreads.reset();
 
     std::clog << "The end.\n";
   } catch (std::exception& error) {
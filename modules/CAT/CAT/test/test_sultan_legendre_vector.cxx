@@ -0,0 +1,162 @@
+// Standard library:
+#include <cmath>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// This project:
+#include <sultan/experimental_legendre_vector.h>
+
+namespace {
+
+using SULTAN::topology::experimental_double;
+using SULTAN::topology::experimental_helix;
+using SULTAN::topology::experimental_legendre_vector;
+
+// A helix of centre (x0, y0) and errors ex0, ey0, built out of a few of 12 cells
+experimental_helix random_helix(double x0, double y0, double ex0, double ey0) {
+  experimental_helix h(experimental_double(x0, ex0), experimental_double(y0, ey0),
+                       experimental_double(100. * drand48(), 5.),
+                       experimental_double(1000. + 20. * drand48(), 10.),
+                       experimental_double(50. * drand48(), 5.));
+  for (size_t id = 0; id < 12; id++) {
+    if (drand48() < 0.3) h.add_id(id);
+  }
+  return h;
+}
+
+bool same_value(double a_, double b_) { return a_ == b_ || (std::isnan(a_) && std::isnan(b_)); }
+
+bool same_helix(const experimental_helix& a_, const experimental_helix& b_) {
+  return same_value(a_.x0().value(), b_.x0().value()) &&
+         same_value(a_.y0().value(), b_.y0().value()) &&
+         same_value(a_.z0().value(), b_.z0().value()) &&
+         same_value(a_.R().value(), b_.R().value()) &&
+         same_value(a_.H().value(), b_.H().value()) && a_.ids() == b_.ids();
+}
+
+// Check that the neighbours of each helix found through the accumulator are
+// those found by comparing the helix with all the others
+void check_neighbours(experimental_legendre_vector& elv_, const std::string& what_) {
+  const std::vector<experimental_helix> helices = elv_.helices();
+  std::vector<size_t> indices;
+  std::vector<experimental_helix> expected;
+  size_t nneighbours = 0;
+  for (size_t i = 0; i < helices.size(); i++) {
+    elv_.get_neighbour_indices(i, &indices);
+    elv_.get_neighbours(helices[i], &expected);
+    bool same = indices.size() == expected.size();
+    for (size_t k = 0; same && k < indices.size(); k++) {
+      same = indices[k] < helices.size() && same_helix(helices[indices[k]], expected[k]);
+    }
+    if (!same) {
+      std::ostringstream message;
+      message << what_ << ": helix " << i << " has " << indices.size()
+              << " neighbours in the accumulator instead of " << expected.size();
+      throw std::logic_error(message.str());
+    }
+    nneighbours += indices.size();
+  }
+  std::clog << what_ << ": " << helices.size() << " helices, " << nneighbours << " neighbours\n";
+}
+
+// Helices spread over a plane of side 2000, the errors of their centres in [emin_, emax_)
+void add_helices(experimental_legendre_vector& elv_, size_t n_, double emin_, double emax_) {
+  for (size_t i = 0; i < n_; i++) {
+    const double x0 = 2000. * drand48() - 1000.;
+    const double y0 = 2000. * drand48() - 1000.;
+    elv_.add_helix(random_helix(x0, y0, emin_ + (emax_ - emin_) * drand48(),
+                                emin_ + (emax_ - emin_) * drand48()));
+  }
+}
+
+}  // namespace
+
+int main(int /*argc_*/, char** /*argv_*/) {
+  int error_code = EXIT_SUCCESS;
+  try {
+    srand48(314159);
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+
+    for (double nsigmas : {1., 3.}) {
+      std::ostringstream tag;
+      tag << "nsigmas " << nsigmas;
+
+      // Errors small compared to the spread of the centres, so that the bins are used,
+      // with clumps of close helices to have many neighbours
+      experimental_legendre_vector elv;
+      elv.set_nsigmas(nsigmas);
+      add_helices(elv, 300, 5., 40.);
+      for (size_t i = 0; i < 100; i++) {
+        elv.add_helix(random_helix(200. + 30. * drand48(), -300. + 30. * drand48(), 10., 10.));
+      }
+      check_neighbours(elv, tag.str() + ", narrow errors");
+
+      // The accumulator is filled again once helices are added, some of them on bin edges
+      elv.add_helix(random_helix(0., 0., 10., 10.));
+      elv.add_helix(random_helix(-0., 1.e-300, 10., 10.));
+      add_helices(elv, 50, 5., 40.);
+      check_neighbours(elv, tag.str() + ", added helices");
+
+      // Zero errors: helices are only neighbours of helices at the same place
+      experimental_legendre_vector zero;
+      zero.set_nsigmas(nsigmas);
+      add_helices(zero, 100, 0., 0.);
+      for (size_t i = 0; i < 20; i++) zero.add_helix(random_helix(100., 100., 0., 0.));
+      check_neighbours(zero, tag.str() + ", zero errors");
+
+      // Some zero errors among finite ones
+      experimental_legendre_vector some_zero;
+      some_zero.set_nsigmas(nsigmas);
+      add_helices(some_zero, 200, 5., 40.);
+      for (size_t i = 0; i < 20; i++) some_zero.add_helix(random_helix(100., 100., 0., 0.));
+      for (size_t i = 0; i < 20; i++) some_zero.add_helix(random_helix(100., -50., 0., 30.));
+      check_neighbours(some_zero, tag.str() + ", some zero errors");
+
+      // Helices whose centre or its error is not finite are kept out of the bins
+      experimental_legendre_vector not_finite;
+      not_finite.set_nsigmas(nsigmas);
+      add_helices(not_finite, 200, 5., 40.);
+      not_finite.add_helix(random_helix(nan, 10., 10., 10.));
+      not_finite.add_helix(random_helix(10., inf, 10., 10.));
+      not_finite.add_helix(random_helix(-inf, -inf, 10., 10.));
+      not_finite.add_helix(random_helix(10., 10., nan, 10.));
+      not_finite.add_helix(random_helix(10., 10., 10., inf));
+      not_finite.add_helix(random_helix(1.e300, -1.e300, 10., 10.));
+      add_helices(not_finite, 50, 5., 40.);
+      check_neighbours(not_finite, tag.str() + ", non-finite centres and errors");
+
+      // Errors spread over many orders of magnitude: the reach of the helices of
+      // large errors covers more bins than there are helices, they are compared
+      // with all the others
+      experimental_legendre_vector broad;
+      broad.set_nsigmas(nsigmas);
+      add_helices(broad, 200, 1., 5.);
+      add_helices(broad, 5, 500., 5000.);
+      for (size_t i = 0; i < 50; i++) {
+        const double e = std::pow(10., 6. * drand48() - 2.);
+        broad.add_helix(random_helix(2000. * drand48() - 1000., 2000. * drand48() - 1000., e, e));
+      }
+      check_neighbours(broad, tag.str() + ", broad spread of errors");
+    }
+
+    // A single helix, and none
+    experimental_legendre_vector single;
+    single.add_helix(random_helix(1., 2., 3., 4.));
+    check_neighbours(single, "single helix");
+    experimental_legendre_vector none;
+    check_neighbours(none, "no helix");
+
+    std::clog << "The end.\n";
+  } catch (std::exception& error) {
+    std::cerr << "error: " << error.what() << std::endl;
+    error_code = EXIT_FAILURE;
+  }
+  return error_code;
+}
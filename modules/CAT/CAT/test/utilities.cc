@@ -1,6 +1,12 @@
 // Ourselves
 #include <utilities.h>
 
+// Standard library:
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
 // Third party:
 // - Bayeux/datatools:
 #include <datatools/clhep_units.h>
@@ -121,6 +127,14 @@ void generate_gg_hits(const snemo::geometry::gg_locator& ggloc_,
   return;
 }
 
+void copy_gg_hits(const snemo::datamodel::TrackerHitHdlCollection& gghits_,
+                  snemo::datamodel::TrackerHitHdlCollection& copies_) {
+  for (const snemo::datamodel::TrackerHitHdl& hgghit : gghits_) {
+    copies_.push_back(
+        snemo::datamodel::TrackerHitHdl(new snemo::datamodel::calibrated_tracker_hit(*hgghit)));
+  }
+}
+
 void display_event(const snemo::geometry::gg_locator& ggloc_,
                    const snemo::datamodel::TrackerHitHdlCollection& gghits_,
                    const snemo::datamodel::tracker_clustering_data& tcd_) {
@@ -217,3 +231,90 @@ void display_event(const snemo::geometry::gg_locator& ggloc_,
 
   return;
 }
+
+namespace {
+bool same_real(double a_, double b_) { return a_ == b_ || (std::isnan(a_) && std::isnan(b_)); }
+
+// Only the kinds of properties stored by the drivers are compared
+bool same_auxiliaries(const datatools::properties& a_, const datatools::properties& b_) {
+  if (a_.keys() != b_.keys()) {
+    return false;
+  }
+  for (const std::string& key : a_.keys()) {
+    if (a_.get(key).get_type() != b_.get(key).get_type()) {
+      return false;
+    }
+    if (a_.is_real(key)) {
+      std::vector<double> va;
+      std::vector<double> vb;
+      if (a_.is_vector(key)) {
+        a_.fetch(key, va);
+        b_.fetch(key, vb);
+      } else {
+        va.push_back(a_.fetch_real(key));
+        vb.push_back(b_.fetch_real(key));
+      }
+      if (va.size() != vb.size() || !std::equal(va.begin(), va.end(), vb.begin(), same_real)) {
+        return false;
+      }
+    } else if (a_.is_vector(key)) {
+      return false;
+    } else if (a_.is_boolean(key)) {
+      if (a_.fetch_boolean(key) != b_.fetch_boolean(key)) {
+        return false;
+      }
+    } else if (a_.is_integer(key)) {
+      if (a_.fetch_integer(key) != b_.fetch_integer(key)) {
+        return false;
+      }
+    } else if (a_.fetch_string(key) != b_.fetch_string(key)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool same_hits(const snemo::datamodel::TrackerHitHdlCollection& a_,
+               const snemo::datamodel::TrackerHitHdlCollection& b_) {
+  if (a_.size() != b_.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a_.size(); i++) {
+    if (a_[i]->get_hit_id() != b_[i]->get_hit_id()) {
+      return false;
+    }
+    if (!same_auxiliaries(a_[i]->get_auxiliaries(), b_[i]->get_auxiliaries())) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+bool same_clustering(const snemo::datamodel::tracker_clustering_data& a_,
+                     const snemo::datamodel::tracker_clustering_data& b_) {
+  if (a_.size() != b_.size()) {
+    return false;
+  }
+  for (size_t isol = 0; isol < a_.size(); isol++) {
+    const snemo::datamodel::tracker_clustering_solution& sa = a_.at(isol);
+    const snemo::datamodel::tracker_clustering_solution& sb = b_.at(isol);
+    if (sa.get_clusters().size() != sb.get_clusters().size()) {
+      return false;
+    }
+    for (size_t iclu = 0; iclu < sa.get_clusters().size(); iclu++) {
+      const snemo::datamodel::tracker_cluster& ca = *sa.get_clusters()[iclu];
+      const snemo::datamodel::tracker_cluster& cb = *sb.get_clusters()[iclu];
+      if (!same_hits(ca.hits(), cb.hits())) {
+        return false;
+      }
+      if (!same_auxiliaries(ca.get_auxiliaries(), cb.get_auxiliaries())) {
+        return false;
+      }
+    }
+    if (!same_hits(sa.get_unclustered_hits(), sb.get_unclustered_hits())) {
+      return false;
+    }
+  }
+  return true;
+}
@@ -9,8 +9,19 @@
 void generate_gg_hits(const snemo::geometry::gg_locator& ggloc_,
                       snemo::datamodel::TrackerHitHdlCollection& gghits_);
 
+//! Append to copies_ a copy of each hit of gghits_, which drivers may annotate apart
+void copy_gg_hits(const snemo::datamodel::TrackerHitHdlCollection& gghits_,
+                  snemo::datamodel::TrackerHitHdlCollection& copies_);
+
 void display_event(const snemo::geometry::gg_locator& ggloc_,
                    const snemo::datamodel::TrackerHitHdlCollection& gghits_,
                    const snemo::datamodel::tracker_clustering_data& tcd_);
 
+//! Return true if both clustering data hold the same solutions, made of the same hits
+//!
+//! The trajectories stored by the drivers as auxiliary properties of the clusters
+//! and of their hits, such as fitted helices, must be the same too.
+bool same_clustering(const snemo::datamodel::tracker_clustering_data& a_,
+                     const snemo::datamodel::tracker_clustering_data& b_);
+
 #endif  // FALAISE_CAT_PLUGIN_UTILITIES_H
@@ -29,6 +29,12 @@ if(NOT SULTAN_MINIMAL_BUILD)
   set(SULTAN_WITH_DEVEL_ROOT       1)
 endif()
 
+# - Timers of the algorithms, operated at runtime when the algorithms are
+#   verbose or flreconstruct profiles the modules. Build without them to
+#   remove their cost entirely.
+option(CAT_WITH_TIMERS "Build CAT and SULTAN with their timers" ON)
+set(SULTAN_WITH_TIMERS ${CAT_WITH_TIMERS})
+
 ############################################################################################
 # - mybhep
 set(_mybhep_HEADERS
@@ -170,7 +176,10 @@ set(_CATAlgorithm_HEADERS
   CAT/CellularAutomatonTracker/CATAlgorithm/experimental_double.h
   CAT/CellularAutomatonTracker/CATAlgorithm/i_predicate.h
   CAT/CellularAutomatonTracker/CATAlgorithm/scenario.h
+  CAT/CellularAutomatonTracker/CATAlgorithm/scenario_occupancy.h
   CAT/CellularAutomatonTracker/CATAlgorithm/Clock.h
+  CAT/CellularAutomatonTracker/CATAlgorithm/timers.h
+  CAT/CellularAutomatonTracker/CATAlgorithm/task_pool.h
   CAT/CellularAutomatonTracker/CATAlgorithm/clusterizer.h
   CAT/CellularAutomatonTracker/CATAlgorithm/cell_triplet.h
   CAT/CellularAutomatonTracker/CATAlgorithm/cluster.h
@@ -229,6 +238,7 @@ set(_CATAlgorithm_SOURCES
   CAT/CellularAutomatonTracker/CATAlgorithm/printable.cpp
   CAT/CellularAutomatonTracker/CATAlgorithm/plane.cpp
   CAT/CellularAutomatonTracker/CATAlgorithm/scenario.cpp
+  CAT/CellularAutomatonTracker/CATAlgorithm/scenario_occupancy.cpp
   CAT/CellularAutomatonTracker/CATAlgorithm/Clock.cpp
   CAT/CellularAutomatonTracker/CATAlgorithm/cell_base.cpp
   CAT/CellularAutomatonTracker/CATAlgorithm/broken_line.cpp
@@ -258,6 +268,8 @@ set(_sultan_HEADERS
   CAT/CellularAutomatonTracker/sultan/experimental_double.h
   CAT/CellularAutomatonTracker/sultan/scenario.h
   CAT/CellularAutomatonTracker/sultan/Clock.h
+  CAT/CellularAutomatonTracker/sultan/timers.h
+  CAT/CellularAutomatonTracker/sultan/task_pool.h
   CAT/CellularAutomatonTracker/sultan/clusterizer.h
   CAT/CellularAutomatonTracker/sultan/cell_triplet.h
   CAT/CellularAutomatonTracker/sultan/cluster.h
@@ -17,6 +17,7 @@
 #include <falaise/property_set.h>
 #include <falaise/quantity.h>
 
+#include <falaise/snemo/datamodels/handle_pool.h>
 #include <falaise/snemo/datamodels/helix_trajectory_pattern.h>
 #include <falaise/snemo/datamodels/line_trajectory_pattern.h>
 #include <falaise/snemo/datamodels/particle_track_data.h>
@@ -271,7 +272,7 @@ void alpha_finder_driver::_find_short_track_(
       // If hits come from unclustered hits then add a new particle
       // Create a new cluster with only one delayed geiger hits and associate it
       // to the particle track trajectory
-      auto a_cluster = datatools::make_handle<snedm::tracker_cluster>();
+      auto a_cluster = snemo::datamodel::make_pooled_handle<snedm::tracker_cluster>();
       a_cluster->make_delayed();
       auto &hits = a_cluster->hits();
       hits.push_back(*ihit);
@@ -316,7 +317,7 @@ void alpha_finder_driver::_build_alpha_particle_track_(
   namespace snedm = snemo::datamodel;
 
   // Add short alpha particle track
-  auto a_short_alpha = datatools::make_handle<snedm::particle_track>();
+  auto a_short_alpha = snemo::datamodel::make_pooled_handle<snedm::particle_track>();
   a_short_alpha->set_track_id(particle_track_data_.numberOfParticles());
   a_short_alpha->set_charge(snedm::particle_track::UNDEFINED);
 
@@ -333,7 +334,7 @@ void alpha_finder_driver::_build_alpha_particle_track_(
   }
 
   // Create new 'tracker_trajectory' handle:
-  auto a_trajectory = datatools::make_handle<snedm::tracker_trajectory>();
+  auto a_trajectory = snemo::datamodel::make_pooled_handle<snedm::tracker_trajectory>();
   // Set trajectory geom_id using the first geiger hit of the associated
   // cluster
   geoManager().get_id_mgr().make_id("tracker_submodule", a_trajectory->grab_geom_id());
@@ -367,7 +368,7 @@ void alpha_finder_driver::_build_alpha_particle_track_(
   snedm::particle_track::vertex_collection_type &vertices = a_short_alpha->get_vertices();
   {
     // Vertex on wire
-    auto spot = datatools::make_handle<geomtools::blur_spot>();
+    auto spot = snemo::datamodel::make_pooled_handle<geomtools::blur_spot>();
     spot->set_hit_id(vertices.size());
     spot->grab_auxiliaries().update(snedm::particle_track::vertex_type_key(),
                                     snedm::particle_track::vertex_on_wire_label());
@@ -417,7 +418,7 @@ void alpha_finder_driver::_build_alpha_particle_track_(
     } else {
       vertex_label = snedm::particle_track::vertex_on_wire_label();
     }
-    auto spot = datatools::make_handle<geomtools::blur_spot>();
+    auto spot = snemo::datamodel::make_pooled_handle<geomtools::blur_spot>();
     spot->set_hit_id(vertices.size());
     spot->grab_auxiliaries().update(snedm::particle_track::vertex_type_key(), vertex_label);
     spot->set_blur_dimension(geomtools::blur_spot::dimension_three);
@@ -18,9 +18,11 @@
 #include <falaise/property_set.h>
 #include <falaise/snemo/datamodels/calibrated_data.h>
 #include <falaise/snemo/datamodels/data_model.h>
+#include <falaise/snemo/datamodels/handle_pool.h>
 #include <falaise/snemo/datamodels/particle_track_data.h>
 #include <falaise/snemo/datamodels/tracker_clustering_data.h>
 #include <falaise/snemo/datamodels/tracker_trajectory_data.h>
+#include <falaise/snemo/processing/profiler.h>
 #include <falaise/snemo/services/services.h>
 
 // This plugin (ChargedParticleTracking):
@@ -122,13 +124,15 @@ charged_particle_tracking_module::~charged_particle_tracking_module() {
 // Processing :
 dpp::base_module::process_status charged_particle_tracking_module::process(
     datatools::things& event) {
+  falaise::processing::scoped_profile profile{get_name()};
   DT_THROW_IF(!is_initialized(), std::logic_error,
               "Module '" << get_name() << "' is not initialized !");
   namespace snedm = snemo::datamodel;
 
   // Get required input products
-  const auto& the_calibrated_data = event.get<snedm::calibrated_data>(CDTag_);
-  const auto& the_tracker_trajectory_data = event.get<snedm::tracker_trajectory_data>(TTDTag_);
+  const auto& the_calibrated_data = ::snedm::getFromEvent<snedm::calibrated_data>(CDTag_, event);
+  const auto& the_tracker_trajectory_data =
+      ::snedm::getFromEvent<snedm::tracker_trajectory_data>(TTDTag_, event);
 
   // Create or reset output bank
   auto& the_particle_track_data =
@@ -139,7 +143,7 @@ dpp::base_module::process_status charged_particle_tracking_module::process(
   this->_process(the_calibrated_data, the_tracker_trajectory_data, the_particle_track_data);
   this->_post_process(the_calibrated_data, the_particle_track_data);
 
-  return dpp::base_module::PROCESS_SUCCESS;
+  return profile.result(dpp::base_module::PROCESS_SUCCESS);
 }
 
 void charged_particle_tracking_module::_process(
@@ -171,7 +175,7 @@ void charged_particle_tracking_module::_process(
     }
 
     // Add a new particle_track
-    auto hPT = datatools::make_handle<snedm::particle_track>();
+    auto hPT = snemo::datamodel::make_pooled_handle<snedm::particle_track>();
     hPT->set_trajectory_handle(a_trajectory);
     hPT->set_track_id(particle_track_data_.numberOfParticles());
     particle_track_data_.insertParticle(hPT);
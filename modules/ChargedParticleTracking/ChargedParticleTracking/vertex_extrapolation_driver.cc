@@ -13,6 +13,7 @@
 #include <geomtools/manager.h>
 
 // This project (Falaise):
+#include <falaise/snemo/datamodels/handle_pool.h>
 #include <falaise/snemo/datamodels/helix_trajectory_pattern.h>
 #include <falaise/snemo/datamodels/line_trajectory_pattern.h>
 #include <falaise/snemo/datamodels/tracker_trajectory.h>
@@ -349,7 +350,7 @@ void vertex_extrapolation_driver::_measure_vertices_(
       // Is this an error or warning?
       DT_LOG_WARNING(logPriority_, "Closest vertex is on the opposite side!");
     }
-    auto spot = datatools::make_handle<geomtools::blur_spot>();
+    auto spot = snemo::datamodel::make_pooled_handle<geomtools::blur_spot>();
     spot->set_hit_id(vertices_.size());
     spot->grab_auxiliaries().update(snedm::particle_track::vertex_type_key(), flag);
     // Future: determine the GID of the scintillator block or source strip
@@ -20,6 +20,7 @@
 #include <falaise/property_set.h>
 #include <falaise/quantity.h>
 #include <falaise/snemo/datamodels/data_model.h>
+#include <falaise/snemo/datamodels/handle_pool.h>
 #include <falaise/snemo/datamodels/particle_track_data.h>
 #include <falaise/snemo/geometry/calo_locator.h>
 #include <falaise/snemo/geometry/gveto_locator.h>
@@ -112,7 +113,7 @@ int gamma_clustering_driver::_process_algo(
 
   // Set new particles within 'particle track data' container
   for (const auto& a_cluster : the_reconstructed_gammas) {
-    auto hPT = datatools::make_handle<snemo::datamodel::particle_track>();
+    auto hPT = snemo::datamodel::make_pooled_handle<snemo::datamodel::particle_track>();
     ptd_.insertParticle(hPT);
     hPT->set_track_id(ptd_.numberOfParticles());
     hPT->set_charge(snemo::datamodel::particle_track::NEUTRAL);
@@ -124,7 +125,7 @@ int gamma_clustering_driver::_process_algo(
       const geomtools::geom_id& a_gid = a_calo_hit.get_geom_id();
 
       // Build calorimeter vertices
-      auto hBS = datatools::make_handle<geomtools::blur_spot>();
+      auto hBS = snemo::datamodel::make_pooled_handle<geomtools::blur_spot>();
       hPT->get_vertices().push_back(hBS);
       hBS->set_hit_id(a_calo_hit.get_hit_id());
       hBS->set_geom_id(a_gid);
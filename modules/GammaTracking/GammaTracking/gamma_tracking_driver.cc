@@ -9,6 +9,7 @@
 
 // This project:
 #include <falaise/snemo/datamodels/base_trajectory_pattern.h>
+#include <falaise/snemo/datamodels/handle_pool.h>
 #include <falaise/snemo/datamodels/helix_trajectory_pattern.h>
 #include <falaise/snemo/datamodels/line_trajectory_pattern.h>
 #include <falaise/snemo/datamodels/particle_track.h>
@@ -116,7 +117,7 @@ int gamma_tracking_driver::_process_algo(
   gtAlgo_.get_reflects(gamma_tracks);
 
   for (const auto& a_list : gamma_tracks) {
-    auto hPT = datatools::make_handle<snemo::datamodel::particle_track>();
+    auto hPT = snemo::datamodel::make_pooled_handle<snemo::datamodel::particle_track>();
     hPT->set_track_id(ptd_.numberOfParticles());
     hPT->set_charge(snemo::datamodel::particle_track::NEUTRAL);
     ptd_.insertParticle(hPT);
@@ -137,7 +138,7 @@ int gamma_tracking_driver::_process_algo(
       hPT->get_associated_calorimeter_hits().push_back(*found);
 
       // Build vertex
-      auto hBS = datatools::make_handle<geomtools::blur_spot>();
+      auto hBS = snemo::datamodel::make_pooled_handle<geomtools::blur_spot>();
       hBS->set_hit_id(calo_id);
       hBS->set_geom_id((*found)->get_geom_id());
       hBS->set_blur_dimension(geomtools::blur_spot::dimension_three);
@@ -0,0 +1,46 @@
+/// \file falaise/TrackFit/fit_workspace_pool.cc
+
+// Ourselves:
+#include <TrackFit/fit_workspace_pool.h>
+
+// Standard library:
+#include <stdexcept>
+
+// Third party:
+// - Bayeux/datatools:
+#include <datatools/exception.h>
+
+namespace TrackFit {
+
+fit_workspace_pool::~fit_workspace_pool() { clear(); }
+
+fit_workspace &fit_workspace_pool::acquire(size_t npoints_, size_t npars_) {
+  fit_workspace &ws = _workspaces_[std::make_pair(npoints_, npars_)];
+  if (ws.solver == nullptr) {
+    ws.solver = gsl_multifit_fdfsolver_alloc(gsl_multifit_fdfsolver_lmder, npoints_, npars_);
+    DT_THROW_IF(ws.solver == nullptr, std::logic_error, "Cannot create solver !");
+    ws.covariance = gsl_matrix_alloc(npars_, npars_);
+    ws.jacobian = gsl_matrix_alloc(npoints_, npars_);
+  }
+  return ws;
+}
+
+size_t fit_workspace_pool::size() const { return _workspaces_.size(); }
+
+void fit_workspace_pool::clear() {
+  for (auto &entry : _workspaces_) {
+    fit_workspace &ws = entry.second;
+    if (ws.solver != nullptr) {
+      gsl_multifit_fdfsolver_free(ws.solver);
+    }
+    if (ws.covariance != nullptr) {
+      gsl_matrix_free(ws.covariance);
+    }
+    if (ws.jacobian != nullptr) {
+      gsl_matrix_free(ws.jacobian);
+    }
+  }
+  _workspaces_.clear();
+}
+
+}  // end of namespace TrackFit
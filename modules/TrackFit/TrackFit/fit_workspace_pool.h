@@ -0,0 +1,81 @@
+// -*- mode: c++ ; -*-
+/** \file falaise/TrackFit/fit_workspace_pool.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public  License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ * Description:
+ *   Pool of GSL workspaces shared by successive fits
+ *
+ * History:
+ *
+ */
+
+#ifndef FALAISE_TRACKFIT_FIT_WORKSPACE_POOL_H
+#define FALAISE_TRACKFIT_FIT_WORKSPACE_POOL_H 1
+
+// Standard library:
+#include <cstddef>
+#include <map>
+#include <utility>
+
+// Third party:
+// - Boost:
+#include <boost/utility.hpp>
+// - GSL:
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_multifit_nlin.h>
+
+namespace TrackFit {
+
+/// \brief GSL workspaces for a least-squares fit of npoints residuals with npars parameters
+struct fit_workspace {
+  gsl_multifit_fdfsolver *solver = nullptr;  /// Levenberg-Marquardt solver
+  gsl_matrix *covariance = nullptr;          /// npars x npars covariance matrix
+  gsl_matrix *jacobian = nullptr;            /// npoints x npars Jacobian matrix
+};
+
+/// \brief Pool of GSL workspaces, keyed by (npoints, npars)
+///
+/// Allocating the lmder solver and its matrices is a significant part of
+/// the cost of a fit on a small cluster. The workspaces handed out by the
+/// pool are allocated on first use and kept until the pool is cleared or
+/// destroyed, so that successive fits of clusters with the same number of
+/// hits do not allocate. A workspace is reset by gsl_multifit_fdfsolver_set
+/// and may only be used by one fit at a time.
+class fit_workspace_pool : boost::noncopyable {
+ public:
+  /// Default constructor
+  fit_workspace_pool() = default;
+
+  /// Destructor
+  ~fit_workspace_pool();
+
+  /// Return the workspace for npoints residuals and npars parameters
+  fit_workspace &acquire(size_t npoints_, size_t npars_);
+
+  /// Return the number of allocated workspaces
+  size_t size() const;
+
+  /// Free all workspaces
+  void clear();
+
+ private:
+  std::map<std::pair<size_t, size_t>, fit_workspace> _workspaces_;  /// Workspaces by shape
+};
+
+}  // end of namespace TrackFit
+
+#endif  // FALAISE_TRACKFIT_FIT_WORKSPACE_POOL_H
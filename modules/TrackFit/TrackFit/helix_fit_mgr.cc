@@ -4,6 +4,7 @@
 #include <TrackFit/helix_fit_mgr.h>
 
 // Standard library:
+#include <cmath>
 #include <limits>
 
 // Third party:
@@ -100,6 +101,7 @@ void helix_fit_data::reset() {
   using_first = false;
   using_last = false;
   using_drift_time = false;
+  numerical_jacobian = false;
 }
 
 helix_fit_data::helix_fit_data() { reset(); }
@@ -144,6 +146,7 @@ void helix_fit_solution::reset() {
   chi = std::numeric_limits<double>::infinity();
   ndof = 0;
   niter = 0;
+  auxiliaries.clear();
 }
 
 double helix_fit_solution::probability_p() const { return gsl_cdf_chisq_P(chi * chi, ndof); }
@@ -363,6 +366,7 @@ void helix_fit_mgr::_set_defaults_() {
   _fit_npoints_ = 0;
   _fit_mf_fdf_solver_ = nullptr;
   _fit_covar_ = nullptr;
+  _fit_jacobian_ = nullptr;
   _fit_iter_ = 0;
   _fit_max_iter_ = helix_fit_mgr::constants::default_fit_max_iter();
   _fit_eps_ = helix_fit_mgr::constants::default_fit_eps();
@@ -372,11 +376,12 @@ void helix_fit_mgr::_set_defaults_() {
   _calibration_ = nullptr;
   _t0_ = 0.0 * CLHEP::ns;
 
-  _solution_.ok = false;
+  _solution_.reset();
 
   _using_first_ = false;
   _using_last_ = false;
   _using_drift_time_ = false;
+  _numerical_jacobian_ = false;
 
   // Debug flags :
   _step_print_status_ = false;
@@ -397,8 +402,15 @@ void helix_fit_mgr::set_calibration(const i_drift_time_calibration &calibration_
   _calibration_ = &calibration_;
 }
 
+void helix_fit_mgr::set_workspace_pool(fit_workspace_pool &pool_) {
+  DT_THROW_IF(is_initialized(), std::logic_error,
+              "Object is now locked ! Operation is not allowed !");
+  _workspace_pool_ = &pool_;
+}
+
 // ctor:
 helix_fit_mgr::helix_fit_mgr() {
+  _workspace_pool_ = nullptr;
   _set_defaults_();
   set_initialized(false);
 }
@@ -425,7 +437,6 @@ void helix_fit_mgr::init(const datatools::properties &config_) {
 
   _fit_npoints_ = 2 * nhits;
   _fit_npars_ = helix_fit_params::HELIX_FIT_FIXED_START_TIME_NOPARS;
-  _fit_covar_ = gsl_matrix_alloc(_fit_npars_, _fit_npars_);
 
   if (config_.has_flag("step_print_status")) {
     _step_print_status_ = true;
@@ -449,9 +460,14 @@ void helix_fit_mgr::init(const datatools::properties &config_) {
   DT_THROW_IF(_using_drift_time_ && !has_calibration(), std::logic_error,
               "Missing drift time calibration !");
 
+  if (config_.has_flag("numerical_jacobian")) {
+    _numerical_jacobian_ = true;
+  }
+
   _fit_data_.using_first = _using_first_;
   _fit_data_.using_last = _using_last_;
   _fit_data_.using_drift_time = _using_drift_time_;
+  _fit_data_.numerical_jacobian = _numerical_jacobian_;
   _fit_data_.hits = _hits_;
   _fit_data_.calibration = _calibration_;
   _fit_data_.start_time = _t0_;
@@ -463,10 +479,11 @@ void helix_fit_mgr::init(const datatools::properties &config_) {
   _fit_mf_fdf_function_.n = _fit_npoints_;
   _fit_mf_fdf_function_.params = &_fit_data_;
 
-  const gsl_multifit_fdfsolver_type *T = gsl_multifit_fdfsolver_lmder;
-  _fit_mf_fdf_solver_ = gsl_multifit_fdfsolver_alloc(T, _fit_npoints_, _fit_npars_);
-  DT_THROW_IF(_fit_mf_fdf_solver_ == nullptr, std::logic_error, "Cannot create solver !");
-  const std::string fdsolver_name = gsl_multifit_fdfsolver_name(_fit_mf_fdf_solver_);
+  fit_workspace_pool &pool = _workspace_pool_ != nullptr ? *_workspace_pool_ : _own_workspaces_;
+  fit_workspace &workspace = pool.acquire(_fit_npoints_, _fit_npars_);
+  _fit_mf_fdf_solver_ = workspace.solver;
+  _fit_covar_ = workspace.covariance;
+  _fit_jacobian_ = workspace.jacobian;
 
   _fit_vview_ = gsl_vector_view_array(_fit_x_init_, _fit_npars_);
 
@@ -478,13 +495,7 @@ void helix_fit_mgr::init(const datatools::properties &config_) {
 void helix_fit_mgr::reset() {
   DT_THROW_IF(!is_initialized(), std::logic_error, "Not initialized !");
 
-  if (_fit_mf_fdf_solver_ != nullptr) {
-    const std::string fdsolver_name = gsl_multifit_fdfsolver_name(_fit_mf_fdf_solver_);
-    gsl_multifit_fdfsolver_free(_fit_mf_fdf_solver_);
-  }
-  if (_fit_covar_ != nullptr) {
-    gsl_matrix_free(_fit_covar_);
-  }
+  // GSL workspaces are kept by their pool for the next fit
   _fit_data_.reset();
   _set_defaults_();
   set_initialized(false);
@@ -496,6 +507,8 @@ bool helix_fit_mgr::is_using_first() const { return _using_first_; }
 
 bool helix_fit_mgr::is_using_drift_time() const { return _using_drift_time_; }
 
+bool helix_fit_mgr::is_using_numerical_jacobian() const { return _numerical_jacobian_; }
+
 void helix_fit_mgr::print_fit_status(std::ostream &out_) const {
   out_ << "TrackFit::helix_fit_mgr::print_fit_status:" << std::endl;
   out_ << "|-- "
@@ -613,10 +626,8 @@ void helix_fit_mgr::fit() {
 
   if (_fit_status_ <= GSL_SUCCESS && under_r_crit_limit) {
 #if GSL_MAJOR_VERSION > 1
-    gsl_matrix *J = gsl_matrix_alloc(_fit_npoints_, _fit_npars_);
-    gsl_multifit_fdfsolver_jac(_fit_mf_fdf_solver_, J);
-    gsl_multifit_covar(J, 0.0, _fit_covar_);
-    gsl_matrix_free(J);
+    gsl_multifit_fdfsolver_jac(_fit_mf_fdf_solver_, _fit_jacobian_);
+    gsl_multifit_covar(_fit_jacobian_, 0.0, _fit_covar_);
 #else
     gsl_multifit_covar(_fit_mf_fdf_solver_->J, 0.0, _fit_covar_);
 #endif
@@ -654,6 +665,58 @@ void helix_fit_mgr::fit() {
   }
 }
 
+namespace {
+/// Drift distance of a hit and its error, as used for the 'alpha' residuals
+void hit_drift_distance(const helix_fit_residual_function_param &param, double &drift_distance,
+                        double &sigma_drift_distance) {
+  datatools::logger::priority local_priority = datatools::logger::PRIO_ERROR;
+  const i_drift_time_calibration *dtc = param.dtc;
+  const double ti = param.ti;
+  const double start_time = param.start_time;
+
+  drift_distance = param.ri * CLHEP::mm;
+  sigma_drift_distance = param.dri * CLHEP::mm;
+
+  // 2012-11-15 XG: if a isolated cell is delayed
+  // i.e. 'drift_distance' is invalid then force the
+  // 'drift_distance' value to rmax and 'sigma_drift_distance' to be
+  // large enough : the cell weight is then pretty small
+  if (!datatools::is_valid(drift_distance)) {
+    drift_distance = param.rmaxi * CLHEP::mm;
+    sigma_drift_distance = param.rmaxi * CLHEP::mm;
+  }
+
+  // 2012/02/15 XG: maybe here we can check if the geiger hit is
+  // delayed and then redo the calibration for such hit using start
+  // time value
+  if (param.using_drift_time) {
+    const double drift_time = ti - start_time;
+    if (!dtc->drift_time_is_valid(drift_time)) {
+      DT_LOG_WARNING(local_priority, "Drift_time is out of physics range!");
+    }
+    dtc->drift_time_to_radius(drift_time, drift_distance, sigma_drift_distance);
+
+    if (!dtc->radius_is_valid(drift_distance)) {
+      DT_LOG_WARNING(local_priority, "Drift_distance is out of physics range!");
+    }
+  }
+}
+
+/// Copy the data of a hit to the residual parameters
+void set_hit(const gg_hit &hit, helix_fit_residual_function_param &param) {
+  param.last = hit.is_last();
+  param.first = hit.is_first();
+  param.xi = hit.get_x();
+  param.yi = hit.get_y();
+  param.zi = hit.get_z();
+  param.szi = hit.get_sigma_z();
+  param.ti = hit.get_t();
+  param.ri = hit.get_r();
+  param.dri = hit.get_sigma_r();
+  param.rmaxi = hit.get_rmax();
+}
+}  // namespace
+
 double helix_fit_mgr::residual_function(double x_, void *params_) {
   datatools::logger::priority local_priority = datatools::logger::PRIO_ERROR;
   const auto *param_ptr = static_cast<const helix_fit_residual_function_param *>(params_);
@@ -664,11 +727,8 @@ double helix_fit_mgr::residual_function(double x_, void *params_) {
   // calibration
   DT_THROW_IF(param.using_drift_time && param.dtc == nullptr, std::logic_error,
               "Drift time should be recomputed by some drift-time calibration algo !");
-  const i_drift_time_calibration *dtc = param.dtc;
   const bool using_first = param.using_first;
   const bool using_last = param.using_last;
-  const bool using_drift_time = param.using_drift_time;
-  const double start_time = param.start_time;
 
   // parameters from the helix:
   double x0 = param.x0;
@@ -703,35 +763,12 @@ double helix_fit_mgr::residual_function(double x_, void *params_) {
   const double yi = param.yi;
   const double zi = param.zi;
   const double sigma_zi = param.szi;
-  const double ti = param.ti;
   const double rmaxi = param.rmaxi;
 
-  double drift_distance = param.ri * CLHEP::mm;
-  double sigma_drift_distance = param.dri * CLHEP::mm;
+  double drift_distance;
+  double sigma_drift_distance;
+  hit_drift_distance(param, drift_distance, sigma_drift_distance);
 
-  // 2012-11-15 XG: if a isolated cell is delayed
-  // i.e. 'drift_distance' is invalid then force the
-  // 'drift_distance' value to rmax and 'sigma_drift_distance' to be
-  // large enough : the cell weight is then pretty small
-  if (!datatools::is_valid(drift_distance)) {
-    drift_distance = param.rmaxi * CLHEP::mm;
-    sigma_drift_distance = param.rmaxi * CLHEP::mm;
-  }
-
-  // 2012/02/15 XG: maybe here we can check if the geiger hit is
-  // delayed and then redo the calibration for such hit using start
-  // time value
-  if (using_drift_time) {
-    const double drift_time = ti - start_time;
-    if (!dtc->drift_time_is_valid(drift_time)) {
-      DT_LOG_WARNING(local_priority, "Drift_time is out of physics range!");
-    }
-    dtc->drift_time_to_radius(drift_time, drift_distance, sigma_drift_distance);
-
-    if (!dtc->radius_is_valid(drift_distance)) {
-      DT_LOG_WARNING(local_priority, "Drift_distance is out of physics range!");
-    }
-  }
   // else
   //   {
   //     drift_time           = 0.;
@@ -947,7 +984,127 @@ int helix_fit_mgr::residual_f(const gsl_vector *x_, void *params_, gsl_vector *f
   return GSL_SUCCESS;
 }
 
+double helix_fit_mgr::residual_gradient(const helix_fit_residual_function_param &param_,
+                                        double *gradient_) {
+  DT_THROW_IF(param_.using_drift_time && param_.dtc == nullptr, std::logic_error,
+              "Drift time should be recomputed by some drift-time calibration algo !");
+  for (size_t k = 0; k < helix_fit_params::HELIX_FIT_FIXED_START_TIME_NOPARS; k++) {
+    gradient_[k] = 0.0;
+  }
+
+  // the hit seen from the axis of the helix, at distance di along udi:
+  const double dxi = param_.xi - param_.x0;
+  const double dyi = param_.yi - param_.y0;
+  const double di = std::hypot(dxi, dyi);
+  const double udix = dxi / di;
+  const double udiy = dyi / di;
+
+  if (param_.residual_type == helix_fit_residual_function_param::RESIDUAL_ALPHA) {
+    double drift_distance;
+    double sigma_drift_distance;
+    hit_drift_distance(param_, drift_distance, sigma_drift_distance);
+
+    // alpha_i = |(r - di) -/+ drift distance| with the drift circle on the
+    // side of the hit facing the helix
+    const double oipi = param_.r - di;
+    const double oiti = (di > param_.r) ? -drift_distance : drift_distance;
+    if ((param_.using_last && param_.last && std::abs(oipi) < std::abs(oiti)) ||
+        (param_.using_first && param_.first && std::abs(oipi) <= std::abs(oiti))) {
+      return 0.0;
+    }
+    const double tipi = oipi - oiti;
+    const double sign = (tipi > 0.0) ? 1.0 : ((tipi < 0.0) ? -1.0 : 0.0);
+    gradient_[helix_fit_params::PARAM_INDEX_X0] = sign * udix / sigma_drift_distance;
+    gradient_[helix_fit_params::PARAM_INDEX_Y0] = sign * udiy / sigma_drift_distance;
+    gradient_[helix_fit_params::PARAM_INDEX_R] = sign / sigma_drift_distance;
+    return std::abs(tipi) / sigma_drift_distance;
+  }
+
+  DT_THROW_IF(param_.residual_type != helix_fit_residual_function_param::RESIDUAL_BETA,
+              std::logic_error, "Invalid residual type !");
+  const double sigma_zi = param_.szi;
+  const double step = param_.step;
+  const double eps_step = 1.e-8;
+  if (std::abs(step) <= eps_step) {
+    gradient_[helix_fit_params::PARAM_INDEX_Z0] = 1.0 / sigma_zi;
+    return (param_.z0 - param_.zi) / sigma_zi;
+  }
+
+  // beta_i = z0 + step * theta / (2 pi) - zi on the nearest turn, where
+  // theta is the polar angle of the hit shifted by a whole number of turns
+  const double theta_i = atan2(udiy, udix);
+  const double dkmax = (param_.zi - param_.z0 - 0.5 * step * theta_i / M_PI) / step;
+  const int kmax = (int)floor(dkmax);
+  double theta_minus = theta_i + kmax * 2 * M_PI;
+  double theta_plus = theta_minus + 2 * M_PI;
+  double zLminus = param_.z0 + step * theta_minus / (2 * M_PI);
+  double zLplus = param_.z0 + step * theta_plus / (2 * M_PI);
+  if (zLminus > zLplus) {
+    std::swap(zLminus, zLplus);
+    std::swap(theta_minus, theta_plus);
+  }
+  if (param_.zi < zLminus - 0.001 || param_.zi > zLplus + 0.001) {
+    for (size_t k = 0; k < helix_fit_params::HELIX_FIT_FIXED_START_TIME_NOPARS; k++) {
+      gradient_[k] = datatools::invalid_real();
+    }
+    return datatools::invalid_real();
+  }
+  double beta_i = zLplus - param_.zi;
+  double theta = theta_plus;
+  if (std::abs(zLminus - param_.zi) < std::abs(beta_i)) {
+    beta_i = zLminus - param_.zi;
+    theta = theta_minus;
+  }
+  // d(theta)/d(x0) = dyi / di^2, d(theta)/d(y0) = -dxi / di^2
+  const double dbeta_dtheta = step / (2 * M_PI);
+  gradient_[helix_fit_params::PARAM_INDEX_X0] = dbeta_dtheta * udiy / di / sigma_zi;
+  gradient_[helix_fit_params::PARAM_INDEX_Y0] = -dbeta_dtheta * udix / di / sigma_zi;
+  gradient_[helix_fit_params::PARAM_INDEX_Z0] = 1.0 / sigma_zi;
+  gradient_[helix_fit_params::PARAM_INDEX_STEP] = theta / (2 * M_PI) / sigma_zi;
+  return beta_i / sigma_zi;
+}
+
 int helix_fit_mgr::residual_df(const gsl_vector *x_, void *params_, gsl_matrix *J_) {
+  const auto *lf_data = static_cast<const helix_fit_data *>(params_);
+  if (lf_data->numerical_jacobian) {
+    return residual_df_numerical(x_, params_, J_);
+  }
+
+  // initialize the helix parameters:
+  helix_fit_residual_function_param param;
+  param.x0 = gsl_vector_get(x_, helix_fit_params::PARAM_INDEX_X0);
+  param.y0 = gsl_vector_get(x_, helix_fit_params::PARAM_INDEX_Y0);
+  param.z0 = gsl_vector_get(x_, helix_fit_params::PARAM_INDEX_Z0);
+  param.r = gsl_vector_get(x_, helix_fit_params::PARAM_INDEX_R);
+  param.step = gsl_vector_get(x_, helix_fit_params::PARAM_INDEX_STEP);
+  param.start_time = lf_data->start_time;
+  param.dtc = lf_data->calibration;
+  param.using_first = lf_data->using_first;
+  param.using_last = lf_data->using_last;
+  param.using_drift_time = lf_data->using_drift_time;
+
+  const auto *hits = static_cast<const gg_hits_col *>(lf_data->hits);
+  double gradient[helix_fit_params::HELIX_FIT_FIXED_START_TIME_NOPARS];
+  size_t i = 0;
+  for (auto it_hit = hits->begin(); it_hit != hits->end(); ++it_hit, ++i) {
+    set_hit(*it_hit, param);
+
+    param.residual_type = helix_fit_residual_function_param::RESIDUAL_ALPHA;
+    residual_gradient(param, gradient);
+    for (size_t k = 0; k < helix_fit_params::HELIX_FIT_FIXED_START_TIME_NOPARS; k++) {
+      gsl_matrix_set(J_, i, k, gradient[k]);
+    }
+
+    param.residual_type = helix_fit_residual_function_param::RESIDUAL_BETA;
+    residual_gradient(param, gradient);
+    for (size_t k = 0; k < helix_fit_params::HELIX_FIT_FIXED_START_TIME_NOPARS; k++) {
+      gsl_matrix_set(J_, i + hits->size(), k, gradient[k]);
+    }
+  }
+  return GSL_SUCCESS;
+}
+
+int helix_fit_mgr::residual_df_numerical(const gsl_vector *x_, void *params_, gsl_matrix *J_) {
   // initialize the helix parameters:
   helix_fit_residual_function_param param;
   param.x0 = gsl_vector_get(x_, helix_fit_params::PARAM_INDEX_X0);
@@ -43,6 +43,7 @@
 #include <gsl/gsl_multifit_nlin.h>
 
 // This project:
+#include <TrackFit/fit_workspace_pool.h>
 #include <TrackFit/gg_hit.h>
 
 namespace TrackFit {
@@ -117,6 +118,7 @@ struct helix_fit_data {
   bool using_first;         /// Use first flag (default = false)
   bool using_last;          /// Use last flag (default = false)
   bool using_drift_time;    /// Use drift time (default = false)
+  bool numerical_jacobian;  /// Differentiate residuals numerically (default = false)
   double start_time;        /// Reference time for all hits
   const gg_hits_col *hits;  /// Collection of Geiger hits
   const i_drift_time_calibration
@@ -217,6 +219,9 @@ class helix_fit_mgr : boost::noncopyable {
   /// Check if the fit uses the drift time
   bool is_using_drift_time() const;
 
+  /// Check if the fit differentiates residuals numerically rather than analytically
+  bool is_using_numerical_jacobian() const;
+
   /// Set the maximum number of iteration of the fit
   void set_fit_max_iter(size_t fit_max_iter_);
 
@@ -244,6 +249,13 @@ class helix_fit_mgr : boost::noncopyable {
   /// Check if a calibration object is available
   bool has_calibration() const;
 
+  /// Set the pool the GSL workspaces of the fit are taken from
+  ///
+  /// The pool must outlive the fit manager and is kept on reset(), so that
+  /// a single pool can serve successive fits. Without a pool, workspaces
+  /// are owned by the fit manager and kept until its destruction.
+  void set_workspace_pool(fit_workspace_pool &pool_);
+
   /// Default constructor
   helix_fit_mgr();
 
@@ -341,9 +353,20 @@ class helix_fit_mgr : boost::noncopyable {
   /// Compute residual (GSL interface)
   static int residual_f(const gsl_vector *x_, void *params_, gsl_vector *f_);
 
+  /// Compute residual and its derivatives with respect to the free parameters
+  ///
+  /// gradient_ must hold HELIX_FIT_FIXED_START_TIME_NOPARS values, ordered by
+  /// parameter index. Both are invalid if the hit cannot be matched to a turn
+  /// of the helix.
+  static double residual_gradient(const helix_fit_residual_function_param &param_,
+                                  double *gradient_);
+
   /// Compute residual difference (GSL interface)
   static int residual_df(const gsl_vector *x_, void *params_, gsl_matrix *J_);
 
+  /// Compute residual difference by numerical differentiation (GSL interface)
+  static int residual_df_numerical(const gsl_vector *x_, void *params_, gsl_matrix *J_);
+
   /// Compute residual and difference (GSL interface)
   static int residual_fdf(const gsl_vector *x_, void *params_, gsl_vector *f_, gsl_matrix *J_);
 
@@ -384,12 +407,13 @@ class helix_fit_mgr : boost::noncopyable {
   gsl_vector_view _fit_vview_;  /// GSL view for the internal vector of fit parameters
   double _fit_x_init_[helix_fit_params::HELIX_FIT_FIXED_START_TIME_NOPARS];  /// Parameters for the
                                                                              /// fitted helix
-  size_t _fit_iter_;          /// Current number of fit iterations
-  double _fit_eps_;           /// Fit tolerance
-  size_t _fit_max_iter_;      /// Maximum number of fit iterations
-  gsl_matrix *_fit_covar_;    /// Covariance matrix of the fit
-  int _fit_status_;           /// Current fit status
-  helix_fit_data _fit_data_;  /// Fit data for an helix
+  size_t _fit_iter_;           /// Current number of fit iterations
+  double _fit_eps_;            /// Fit tolerance
+  size_t _fit_max_iter_;       /// Maximum number of fit iterations
+  gsl_matrix *_fit_covar_;     /// Covariance matrix of the fit
+  gsl_matrix *_fit_jacobian_;  /// Jacobian matrix of the fit at the solution
+  int _fit_status_;            /// Current fit status
+  helix_fit_data _fit_data_;   /// Fit data for an helix
 
   bool _using_last_;       /// Flag to use the 'last' flag of hits
   bool _using_first_;      /// Flag to use the 'first' flag of hits
@@ -397,12 +421,16 @@ class helix_fit_mgr : boost::noncopyable {
                             * in place of the pre-calibrarion drift radius. This mode uses a
                             * on-the-fly time-to-radius calibration.
                             */
+  bool _numerical_jacobian_;  /// Flag to differentiate residuals numerically (validation only)
   const gg_hits_col *_hits_;                      /// Handle to the input collection of Geiger hits
   const i_drift_time_calibration *_calibration_;  /// Handle to the calibration object
   double _t0_;                                    /// Reference delay time (==0 set by user)
   bool _step_print_status_;       /// Flag to print the status of the fit at each step
   bool _step_draw_;               /// Flag to display the fit status at each step
   helix_fit_solution _solution_;  /// Embedded solution of the fit
+
+  fit_workspace_pool *_workspace_pool_;  /// Handle to the pool of GSL workspaces (not owned)
+  fit_workspace_pool _own_workspaces_;   /// GSL workspaces used without a pool
 };
 
 }  // end of namespace TrackFit
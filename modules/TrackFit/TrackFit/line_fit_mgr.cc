@@ -4,6 +4,7 @@
 #include <TrackFit/line_fit_mgr.h>
 
 // Standard library:
+#include <cmath>
 #include <limits>
 
 // Third party:
@@ -74,6 +75,7 @@ void line_fit_data::reset() {
   using_last = false;
   using_drift_time = false;
   fit_start_time = false;
+  numerical_jacobian = false;
 }
 
 line_fit_data::line_fit_data() { reset(); }
@@ -122,6 +124,7 @@ void line_fit_solution::reset() {
   chi = std::numeric_limits<double>::infinity();
   ndof = 0;
   niter = 0;
+  auxiliaries.clear();
 }
 
 double line_fit_solution::probability_p() const { return gsl_cdf_chisq_P(chi * chi, ndof); }
@@ -324,6 +327,7 @@ void line_fit_mgr::_set_defaults_() {
   _fit_npoints_ = 0;
   _fit_mf_fdf_solver_ = nullptr;
   _fit_covar_ = nullptr;
+  _fit_jacobian_ = nullptr;
   _fit_iter_ = 0;
   _fit_max_iter_ = line_fit_mgr::constants::default_fit_max_iter();
   _fit_eps_ = line_fit_mgr::constants::default_fit_eps();
@@ -333,11 +337,12 @@ void line_fit_mgr::_set_defaults_() {
   _calibration_ = nullptr;
   _t0_ = 0.0 * CLHEP::ns;
 
-  _solution_.ok = false;
+  _solution_.reset();
   _using_first_ = false;
   _using_last_ = false;
   _using_drift_time_ = false;
   _fit_start_time_ = false;
+  _numerical_jacobian_ = false;
 
   _step_print_status_ = false;
   _step_draw_ = false;
@@ -357,8 +362,15 @@ void line_fit_mgr::set_calibration(const i_drift_time_calibration &calibration_)
   _calibration_ = &calibration_;
 }
 
+void line_fit_mgr::set_workspace_pool(fit_workspace_pool &pool_) {
+  DT_THROW_IF(is_initialized(), std::logic_error,
+              "Object is now locked ! Operation is not allowed !");
+  _workspace_pool_ = &pool_;
+}
+
 // ctor:
 line_fit_mgr::line_fit_mgr(bool /* debug_ */) {
+  _workspace_pool_ = nullptr;
   _set_defaults_();
   _set_initialized(false);
 }
@@ -406,6 +418,10 @@ void line_fit_mgr::init(const datatools::properties &config_) {
     _using_drift_time_ = true;
   }
 
+  if (config_.has_flag("numerical_jacobian")) {
+    _numerical_jacobian_ = true;
+  }
+
   DT_THROW_IF(_using_drift_time_ && !has_calibration(), std::logic_error,
               "Missing drift time calibration !");
 
@@ -437,13 +453,13 @@ void line_fit_mgr::init(const datatools::properties &config_) {
     // Only use 4 parameters
     _fit_npars_--;
   }
-  _fit_covar_ = gsl_matrix_alloc(_fit_npars_, _fit_npars_);
 
   // init fit params
   _fit_data_.using_first = _using_first_;
   _fit_data_.using_last = _using_last_;
   _fit_data_.using_drift_time = _using_drift_time_;
   _fit_data_.fit_start_time = _fit_start_time_;
+  _fit_data_.numerical_jacobian = _numerical_jacobian_;
   _fit_data_.hits = _hits_;
   _fit_data_.calibration = _calibration_;
 
@@ -454,10 +470,11 @@ void line_fit_mgr::init(const datatools::properties &config_) {
   _fit_mf_fdf_function_.n = _fit_npoints_;
   _fit_mf_fdf_function_.params = &_fit_data_;
 
-  const gsl_multifit_fdfsolver_type *T = gsl_multifit_fdfsolver_lmder;
-  _fit_mf_fdf_solver_ = gsl_multifit_fdfsolver_alloc(T, _fit_npoints_, _fit_npars_);
-  DT_THROW_IF(_fit_mf_fdf_solver_ == nullptr, std::logic_error, "Cannot create solver !");
-  const std::string fdsolver_name = gsl_multifit_fdfsolver_name(_fit_mf_fdf_solver_);
+  fit_workspace_pool &pool = _workspace_pool_ != nullptr ? *_workspace_pool_ : _own_workspaces_;
+  fit_workspace &workspace = pool.acquire(_fit_npoints_, _fit_npars_);
+  _fit_mf_fdf_solver_ = workspace.solver;
+  _fit_covar_ = workspace.covariance;
+  _fit_jacobian_ = workspace.jacobian;
 
   _fit_vview_ = gsl_vector_view_array(_fit_x_init_, _fit_npars_);
 
@@ -469,13 +486,7 @@ void line_fit_mgr::init(const datatools::properties &config_) {
 void line_fit_mgr::reset() {
   DT_THROW_IF(!is_initialized(), std::logic_error, "Not initialized !");
 
-  if (_fit_mf_fdf_solver_ != nullptr) {
-    const std::string fdsolver_name = gsl_multifit_fdfsolver_name(_fit_mf_fdf_solver_);
-    gsl_multifit_fdfsolver_free(_fit_mf_fdf_solver_);
-  }
-  if (_fit_covar_ != nullptr) {
-    gsl_matrix_free(_fit_covar_);
-  }
+  // GSL workspaces are kept by their pool for the next fit
   _fit_data_.reset();
 
   _set_defaults_();
@@ -490,6 +501,8 @@ bool line_fit_mgr::is_using_drift_time() const { return _using_drift_time_; }
 
 bool line_fit_mgr::is_fitting_start_time() const { return _fit_start_time_; }
 
+bool line_fit_mgr::is_using_numerical_jacobian() const { return _numerical_jacobian_; }
+
 void line_fit_mgr::print_fit_status(std::ostream &out_) const {
   out_ << "trackfit::line_fit_mgr::print_fit_status:" << std::endl;
   out_ << "|-- "
@@ -583,10 +596,8 @@ void line_fit_mgr::fit() {
 
   if (_fit_status_ <= GSL_SUCCESS) {
 #if GSL_MAJOR_VERSION > 1
-    gsl_matrix *J = gsl_matrix_alloc(_fit_npoints_, _fit_npars_);
-    gsl_multifit_fdfsolver_jac(_fit_mf_fdf_solver_, J);
-    gsl_multifit_covar(J, 0.0, _fit_covar_);
-    gsl_matrix_free(J);
+    gsl_multifit_fdfsolver_jac(_fit_mf_fdf_solver_, _fit_jacobian_);
+    gsl_multifit_covar(_fit_jacobian_, 0.0, _fit_covar_);
 #else
     gsl_multifit_covar(_fit_mf_fdf_solver_->J, 0.0, _fit_covar_);
 #endif
@@ -705,6 +716,57 @@ void line_fit_mgr::compute_best_frame(const gg_hits_col &hits_, gg_hits_col &hit
   }
 }
 
+namespace {
+/// Drift distance of a hit and its error, as used for the 'alpha' residuals
+void hit_drift_distance(const line_fit_residual_function_param &param, double t0,
+                        double &drift_distance, double &sigma_drift_distance) {
+  datatools::logger::priority local_priority = datatools::logger::PRIO_ERROR;
+  const i_drift_time_calibration *dtc = param.dtc;
+  const double ti = param.ti;
+
+  drift_distance = param.ri * CLHEP::mm;
+  sigma_drift_distance = param.dri * CLHEP::mm;
+  // 2012-11-15 XG: if a isolated cell is delayed
+  // i.e. 'drift_distance' is invalid then force the
+  // 'drift_distance' value to rmax and 'sigma_drift_distance' to be
+  // large enough : the cell weight is then pretty small
+  if (!datatools::is_valid(drift_distance)) {
+    drift_distance = param.rmaxi * CLHEP::mm;
+    sigma_drift_distance = param.rmaxi * CLHEP::mm;
+  }
+
+  // 2012-02-15 XG: maybe here we can check if the geiger hit is
+  // delayed and then redo the calibration for such hit using start
+  // time value
+  if (param.using_drift_time) {
+    double drift_time = ti - t0;
+    if (!dtc->drift_time_is_valid(drift_time)) {
+      DT_LOG_WARNING(local_priority, "Drift_time is out of physics range!");
+      // 2012-11-02 XG: This is a bit harsh !
+      drift_time = 0.0 * CLHEP::ns;
+    }
+    dtc->drift_time_to_radius(drift_time, drift_distance, sigma_drift_distance);
+    if (!dtc->radius_is_valid(drift_distance)) {
+      DT_LOG_WARNING(local_priority, "Drift_distance is out of physics range!");
+    }
+  }
+}
+
+/// Copy the data of a hit to the residual parameters
+void set_hit(const gg_hit &hit, line_fit_residual_function_param &param) {
+  param.last = hit.is_last();
+  param.first = hit.is_first();
+  param.xi = hit.get_x();
+  param.yi = hit.get_y();
+  param.zi = hit.get_z();
+  param.szi = hit.get_sigma_z();
+  param.ti = hit.get_t();
+  param.ri = hit.get_r();
+  param.dri = hit.get_sigma_r();
+  param.rmaxi = hit.get_rmax();
+}
+}  // namespace
+
 double line_fit_mgr::residual_function(double x_, void *params_) {
   datatools::logger::priority local_priority = datatools::logger::PRIO_ERROR;
   const auto *param_ptr = static_cast<const line_fit_residual_function_param *>(params_);
@@ -715,10 +777,8 @@ double line_fit_mgr::residual_function(double x_, void *params_) {
   // calibration
   DT_THROW_IF(param.using_drift_time && param.dtc == nullptr, std::logic_error,
               "Drift time should be recomputed by some drift-time calibration algo !");
-  const i_drift_time_calibration *dtc = param.dtc;
   const bool using_first = param.using_first;
   const bool using_last = param.using_last;
-  const bool using_drift_time = param.using_drift_time;
   const bool fit_start_time = param.fit_start_time;
   DT_THROW_IF(!fit_start_time && param.mode == line_fit_params::PARAM_INDEX_T0, std::logic_error,
               "Looking for 't0' parameter while fitting start time is disabled !");
@@ -756,35 +816,12 @@ double line_fit_mgr::residual_function(double x_, void *params_) {
   const double yi = param.yi;
   const double zi = param.zi;
   const double sigma_zi = param.szi;
-  const double ti = param.ti;
   const double rmaxi = param.rmaxi;
 
-  double drift_distance = param.ri * CLHEP::mm;
-  double sigma_drift_distance = param.dri * CLHEP::mm;
-  // 2012-11-15 XG: if a isolated cell is delayed
-  // i.e. 'drift_distance' is invalid then force the
-  // 'drift_distance' value to rmax and 'sigma_drift_distance' to be
-  // large enough : the cell weight is then pretty small
-  if (!datatools::is_valid(drift_distance)) {
-    drift_distance = param.rmaxi * CLHEP::mm;
-    sigma_drift_distance = param.rmaxi * CLHEP::mm;
-  }
+  double drift_distance;
+  double sigma_drift_distance;
+  hit_drift_distance(param, t0, drift_distance, sigma_drift_distance);
 
-  // 2012-02-15 XG: maybe here we can check if the geiger hit is
-  // delayed and then redo the calibration for such hit using start
-  // time value
-  if (using_drift_time) {
-    double drift_time = ti - t0;
-    if (!dtc->drift_time_is_valid(drift_time)) {
-      DT_LOG_WARNING(local_priority, "Drift_time is out of physics range!");
-      // 2012-11-02 XG: This is a bit harsh !
-      drift_time = 0.0 * CLHEP::ns;
-    }
-    dtc->drift_time_to_radius(drift_time, drift_distance, sigma_drift_distance);
-    if (!dtc->radius_is_valid(drift_distance)) {
-      DT_LOG_WARNING(local_priority, "Drift_distance is out of physics range!");
-    }
-  }
   // else
   //   {
   //     drift_time           = 0.;
@@ -959,7 +996,111 @@ int line_fit_mgr::residual_f(const gsl_vector *x_, void *params_, gsl_vector *f_
   return GSL_SUCCESS;
 }
 
+double line_fit_mgr::residual_gradient(const line_fit_residual_function_param &param_,
+                                       double *gradient_) {
+  DT_THROW_IF(param_.using_drift_time && param_.dtc == nullptr, std::logic_error,
+              "Drift time should be recomputed by some drift-time calibration algo !");
+  for (size_t k = 0; k < line_fit_params::LINE_FIT_NOPARS; k++) {
+    gradient_[k] = 0.0;
+  }
+
+  // the hit seen from (0, y0), along (a) and across (d) the horizontal
+  // direction (cos(phi), sin(phi)) of the line:
+  const double cos_phi = std::cos(param_.phi);
+  const double sin_phi = std::sin(param_.phi);
+  const double uix = param_.xi;
+  const double uiy = param_.yi - param_.y0;
+  const double a = uix * cos_phi + uiy * sin_phi;
+  const double d = -uix * sin_phi + uiy * cos_phi;
+
+  if (param_.residual_type == line_fit_residual_function_param::RESIDUAL_ALPHA) {
+    double drift_distance;
+    double sigma_drift_distance;
+    hit_drift_distance(param_, param_.t0, drift_distance, sigma_drift_distance);
+
+    // alpha_i = ||d| - drift distance|, |d| being the distance of the line to the wire
+    const double oipi = std::abs(d);
+    if ((param_.using_last && param_.last && oipi <= std::abs(drift_distance)) ||
+        (param_.using_first && param_.first && oipi <= std::abs(drift_distance))) {
+      return 0.0;
+    }
+    const double tipi = oipi - drift_distance;
+    const double sign_tipi = (tipi > 0.0) ? 1.0 : ((tipi < 0.0) ? -1.0 : 0.0);
+    const double sign = (d < 0.0) ? -sign_tipi : sign_tipi;
+    gradient_[line_fit_params::PARAM_INDEX_Y0] = -sign * cos_phi / sigma_drift_distance;
+    gradient_[line_fit_params::PARAM_INDEX_PHI] = -sign * a / sigma_drift_distance;
+    return std::abs(tipi) / sigma_drift_distance;
+  }
+
+  DT_THROW_IF(param_.residual_type != line_fit_residual_function_param::RESIDUAL_BETA,
+              std::logic_error, "Invalid residual type !");
+  // beta_i = zi - z0 - a / tan(theta)
+  const double sigma_zi = param_.szi;
+  const double sin_theta = std::sin(param_.theta);
+  const double cot_theta = std::cos(param_.theta) / sin_theta;
+  gradient_[line_fit_params::PARAM_INDEX_Z0] = -1.0 / sigma_zi;
+  gradient_[line_fit_params::PARAM_INDEX_Y0] = sin_phi * cot_theta / sigma_zi;
+  gradient_[line_fit_params::PARAM_INDEX_PHI] = -d * cot_theta / sigma_zi;
+  gradient_[line_fit_params::PARAM_INDEX_THETA] = a / (sin_theta * sin_theta) / sigma_zi;
+  return (param_.zi - param_.z0 - a * cot_theta) / sigma_zi;
+}
+
 int line_fit_mgr::residual_df(const gsl_vector *x_, void *params_, gsl_matrix *J_) {
+  const auto *lf_data = static_cast<const line_fit_data *>(params_);
+  if (lf_data->numerical_jacobian) {
+    return residual_df_numerical(x_, params_, J_);
+  }
+
+  // initialize the line parameters:
+  line_fit_residual_function_param param;
+  param.z0 = gsl_vector_get(x_, line_fit_params::PARAM_INDEX_Z0);
+  param.y0 = gsl_vector_get(x_, line_fit_params::PARAM_INDEX_Y0);
+  param.phi = gsl_vector_get(x_, line_fit_params::PARAM_INDEX_PHI);
+  param.theta = gsl_vector_get(x_, line_fit_params::PARAM_INDEX_THETA);
+  param.dtc = lf_data->calibration;
+  param.using_first = lf_data->using_first;
+  param.using_last = lf_data->using_last;
+  param.using_drift_time = lf_data->using_drift_time;
+  param.fit_start_time = lf_data->fit_start_time;
+  if (param.fit_start_time) {
+    param.t0 = gsl_vector_get(x_, line_fit_params::PARAM_INDEX_T0);
+  }
+
+  // The start time only enters through the drift time calibration
+  gsl_function F;
+  double result, abserr;
+  F.function = &residual_function;
+  F.params = &param;
+  const double h_time = 0.5 * CLHEP::ns;
+
+  const auto *hits = static_cast<const gg_hits_col *>(lf_data->hits);
+  const size_t npars = J_->size2;
+  double gradient[line_fit_params::LINE_FIT_NOPARS];
+  size_t i = 0;
+  for (auto it_hit = hits->begin(); it_hit != hits->end(); ++it_hit, ++i) {
+    set_hit(*it_hit, param);
+
+    param.residual_type = line_fit_residual_function_param::RESIDUAL_ALPHA;
+    residual_gradient(param, gradient);
+    if (param.fit_start_time) {
+      param.mode = line_fit_params::PARAM_INDEX_T0;
+      gsl_deriv_central(&F, param.t0, h_time, &result, &abserr);
+      gradient[line_fit_params::PARAM_INDEX_T0] = result;
+    }
+    for (size_t k = 0; k < npars; k++) {
+      gsl_matrix_set(J_, i, k, gradient[k]);
+    }
+
+    param.residual_type = line_fit_residual_function_param::RESIDUAL_BETA;
+    residual_gradient(param, gradient);
+    for (size_t k = 0; k < npars; k++) {
+      gsl_matrix_set(J_, i + hits->size(), k, gradient[k]);
+    }
+  }
+  return GSL_SUCCESS;
+}
+
+int line_fit_mgr::residual_df_numerical(const gsl_vector *x_, void *params_, gsl_matrix *J_) {
   // initialize the line parameters:
   line_fit_residual_function_param param;
   param.z0 = gsl_vector_get(x_, line_fit_params::PARAM_INDEX_Z0);
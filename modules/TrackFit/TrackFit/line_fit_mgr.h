@@ -42,6 +42,7 @@
 #include <gsl/gsl_multifit_nlin.h>
 
 // This project:
+#include <TrackFit/fit_workspace_pool.h>
 #include <TrackFit/gg_hit.h>
 
 namespace geomtools {
@@ -103,6 +104,7 @@ struct line_fit_data {
   bool using_last;          /// Use last flag (default = false)
   bool using_drift_time;    /// Use drift time (default = false)
   bool fit_start_time;      /// Flag to also fit the reference time
+  bool numerical_jacobian;  /// Differentiate residuals numerically (default = false)
   const gg_hits_col *hits;  /// Collection of Geiger hits
   const i_drift_time_calibration
       *calibration;  /// Handle to the drift time to radius calibration object
@@ -202,6 +204,9 @@ class line_fit_mgr : boost::noncopyable {
   /// Check if the fit fits the reference time
   bool is_fitting_start_time() const;
 
+  /// Check if the fit differentiates residuals numerically rather than analytically
+  bool is_using_numerical_jacobian() const;
+
   /// Set the fit tolerance
   void set_fit_eps(double eps_);
 
@@ -226,6 +231,13 @@ class line_fit_mgr : boost::noncopyable {
   /// Check if a calibration object is available
   bool has_calibration() const;
 
+  /// Set the pool the GSL workspaces of the fit are taken from
+  ///
+  /// The pool must outlive the fit manager and is kept on reset(), so that
+  /// a single pool can serve successive fits. Without a pool, workspaces
+  /// are owned by the fit manager and kept until its destruction.
+  void set_workspace_pool(fit_workspace_pool &pool_);
+
   /// Default constructor
   line_fit_mgr(bool debug_ = false);
 
@@ -330,9 +342,20 @@ class line_fit_mgr : boost::noncopyable {
   /// Compute residual(GSL interface)
   static int residual_f(const gsl_vector *x_, void *params_, gsl_vector *f_);
 
+  /// Compute residual and its derivatives with respect to the geometrical parameters
+  ///
+  /// gradient_ must hold LINE_FIT_NOPARS values, ordered by parameter index.
+  /// The derivative with respect to the reference time is left to zero, as
+  /// the drift time calibration has no analytical derivative.
+  static double residual_gradient(const line_fit_residual_function_param &param_,
+                                  double *gradient_);
+
   /// Compute residual difference(GSL interface)
   static int residual_df(const gsl_vector *x_, void *params_, gsl_matrix *J_);
 
+  /// Compute residual difference by numerical differentiation(GSL interface)
+  static int residual_df_numerical(const gsl_vector *x_, void *params_, gsl_matrix *J_);
+
   /// Compute residual and difference(GSL interface)
   static int residual_fdf(const gsl_vector *x_, void *params_, gsl_vector *f_, gsl_matrix *J_);
 
@@ -377,6 +400,7 @@ class line_fit_mgr : boost::noncopyable {
   double _fit_eps_;                                       /// Fit tolerance
   size_t _fit_max_iter_;                                  /// Maximum number of fit iterations
   gsl_matrix *_fit_covar_;                                /// Covariance matrix of the fit
+  gsl_matrix *_fit_jacobian_;                             /// Jacobian matrix at the solution
   int _fit_status_;                                       /// Current fit status
   line_fit_data _fit_data_;                               /// Fit data for a line
 
@@ -387,12 +411,16 @@ class line_fit_mgr : boost::noncopyable {
                             * on-the-fly time-to-radius calibration.
                             */
   bool _fit_start_time_;   /// Flag to also consider the reference time as a free parameter
+  bool _numerical_jacobian_;  /// Flag to differentiate residuals numerically (validation only)
   const gg_hits_col *_hits_;                      /// Handle to the input collection of Geiger hits
   const i_drift_time_calibration *_calibration_;  /// Handle to the calibration object
   double _t0_;                                    /// Reference delay time (==0 set by user)
   bool _step_print_status_;      /// Flag to print the status of the fit at each step
   bool _step_draw_;              /// Flag to display the fit status at each step
   line_fit_solution _solution_;  /// Embedded solution of the fit
+
+  fit_workspace_pool *_workspace_pool_;  /// Handle to the pool of GSL workspaces (not owned)
+  fit_workspace_pool _own_workspaces_;   /// GSL workspaces used without a pool
 };
 
 }  // end of namespace TrackFit
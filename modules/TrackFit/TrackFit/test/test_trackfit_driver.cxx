@@ -2,6 +2,8 @@
 #include <cstdlib>
 #include <exception>
 #include <iostream>
+#include <map>
+#include <set>
 #include <string>
 
 // Third party:
@@ -91,6 +93,7 @@ int main(int argc_, char** argv_) {
     TF.initialize(TrackFitconfig);
 
     // Event loop:
+    size_t nmulti_guess_clusters = 0;
     for (int i = 0; i < 3; i++) {
       std::clog << "Processing event #" << i << "\n";
       snemo::datamodel::TrackerHitHdlCollection CTH;
@@ -113,8 +116,26 @@ int main(int argc_, char** argv_) {
         std::cerr << "TrackFit solution 0: " << std::endl;
         TTD.get_solutions()[j].get().tree_dump(std::clog, "TrackFit solution: ", indent);
       }
+      // Each converging guess of a cluster gives a trajectory of its own:
+      for (const auto& hsolution : TTD.get_solutions()) {
+        std::map<const snemo::datamodel::tracker_cluster*, std::set<std::string> > guesses;
+        for (const auto& htrajectory : hsolution->get_trajectories()) {
+          const std::string guess = htrajectory->get_pattern().get_pattern_id() + "/" +
+                                    htrajectory->get_auxiliaries().fetch_string("guess");
+          std::set<std::string>& cluster_guesses = guesses[&htrajectory->get_cluster()];
+          DT_THROW_IF(!cluster_guesses.insert(guess).second, std::logic_error,
+                      "Guess '" << guess << "' fitted twice!");
+        }
+        for (const auto& cluster_guesses : guesses) {
+          if (cluster_guesses.second.size() > 1) {
+            nmulti_guess_clusters++;
+          }
+        }
+      }
       if (draw) display_event(*gg_locator, CTH, TCD, TTD);
     }
+    DT_THROW_IF(nmulti_guess_clusters == 0, std::logic_error,
+                "No cluster was fitted from several guesses!");
 
     // Terminate the TrackFit driver:
     TF.reset();
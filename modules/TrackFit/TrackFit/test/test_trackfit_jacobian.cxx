@@ -0,0 +1,377 @@
+// test_trackfit_jacobian.cxx
+//
+// Check the analytic Jacobians of the helix and line fits against their finite
+// difference versions, on random tracks, and check that fits using one or the
+// other converge to the same parameters. The program fails on any disagreement.
+
+// Standard library:
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Third party:
+// - GSL:
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_vector.h>
+// - Bayeux/datatools:
+#include <datatools/clhep_units.h>
+#include <datatools/properties.h>
+// - Bayeux/mygsl:
+#include <mygsl/rng.h>
+// - Bayeux/geomtools:
+#include <geomtools/placement.h>
+
+// This project:
+#include <TrackFit/gg_hit.h>
+#include <TrackFit/helix_fit_mgr.h>
+#include <TrackFit/i_drift_time_calibration.h>
+#include <TrackFit/line_fit_mgr.h>
+
+namespace {
+
+typedef int (*residual_f_type)(const gsl_vector*, void*, gsl_vector*);
+typedef int (*residual_df_type)(const gsl_vector*, void*, gsl_matrix*);
+
+// Relative difference allowed between analytic and numerical derivatives
+const double kJacobianTolerance = 1.e-6;
+
+// Relative change of slope above which a residual is not smooth enough over
+// the finite difference interval for its numerical derivative to be compared
+const double kSmoothnessTolerance = 1.e-4;
+
+// Difference allowed between the parameters fitted in both modes, in units of
+// their fitted error
+const double kParameterTolerance = 0.05;
+
+const size_t kNumberOfEvents = 20;
+const size_t kNumberOfHits = 10;
+
+//! Return the number of elements of the analytic Jacobian at x_ which differ from the
+//! numerical one. Elements for which the residual has a kink within the finite difference
+//! step h_ of their parameter, from an absolute value or a change of helix turn, are skipped.
+int check_jacobian(const std::string& label_, residual_f_type f_, residual_df_type df_,
+                   residual_df_type df_numerical_, void* data_, size_t nresiduals_,
+                   const std::vector<double>& x_, const std::vector<double>& h_,
+                   size_t& checked_) {
+  const size_t npars = x_.size();
+  std::vector<double> x = x_;
+  gsl_vector_view xview = gsl_vector_view_array(x.data(), npars);
+  gsl_matrix* analytic = gsl_matrix_alloc(nresiduals_, npars);
+  gsl_matrix* numerical = gsl_matrix_alloc(nresiduals_, npars);
+  df_(&xview.vector, data_, analytic);
+  df_numerical_(&xview.vector, data_, numerical);
+
+  // Residuals at x + (j - 2) * h / 2 along one parameter
+  const size_t nsamples = 5;
+  std::vector<gsl_vector*> samples(nsamples);
+  for (auto& sample : samples) {
+    sample = gsl_vector_alloc(nresiduals_);
+  }
+
+  int failures = 0;
+  for (size_t k = 0; k < npars; k++) {
+    for (size_t j = 0; j < nsamples; j++) {
+      std::copy(x_.begin(), x_.end(), x.begin());
+      x[k] += (static_cast<double>(j) - 2.0) * 0.5 * h_[k];
+      f_(&xview.vector, data_, samples[j]);
+    }
+    for (size_t i = 0; i < nresiduals_; i++) {
+      // The third difference of the slopes vanishes for a residual quadratic in x[k]
+      double slope[nsamples - 1];
+      double max_slope = 0.0;
+      for (size_t j = 0; j + 1 < nsamples; j++) {
+        slope[j] =
+            (gsl_vector_get(samples[j + 1], i) - gsl_vector_get(samples[j], i)) / (0.5 * h_[k]);
+        max_slope = std::max(max_slope, std::abs(slope[j]));
+      }
+      const double roughness = std::abs(slope[0] - 3.0 * slope[1] + 3.0 * slope[2] - slope[3]);
+      if (roughness > kSmoothnessTolerance * (1.0 + max_slope)) {
+        continue;
+      }
+      checked_++;
+      const double a = gsl_matrix_get(analytic, i, k);
+      const double n = gsl_matrix_get(numerical, i, k);
+      if (std::abs(a - n) > kJacobianTolerance * (1.0 + std::abs(n))) {
+        std::cerr << "error: " << label_ << ": dF[" << i << "]/dx[" << k << "] = " << a
+                  << " (analytic) != " << n << " (numerical)" << std::endl;
+        failures++;
+      }
+    }
+  }
+
+  for (auto& sample : samples) {
+    gsl_vector_free(sample);
+  }
+  gsl_matrix_free(numerical);
+  gsl_matrix_free(analytic);
+  return failures;
+}
+
+//! Return 1 if a parameter fitted in both modes differs by more than the tolerance
+int check_parameter(const std::string& label_, const std::string& name_, double analytic_,
+                    double numerical_, double error_) {
+  if (std::abs(analytic_ - numerical_) <= kParameterTolerance * error_) {
+    return 0;
+  }
+  std::cerr << "error: " << label_ << ": fitted " << name_ << " = " << analytic_
+            << " (analytic) != " << numerical_ << " (numerical), error = " << error_
+            << std::endl;
+  return 1;
+}
+
+//! Add a hit at (xi_, yi_, zi_) with a drift radius smeared through the drift time
+void add_hit(mygsl::rng& random_, const TrackFit::default_drift_time_calibration& dtc_,
+             double xi_, double yi_, double zi_, double sigma_z_, double drift_radius_,
+             TrackFit::gg_hits_col& hits_) {
+  double drift_time, sigma_drift_time;
+  dtc_.radius_to_drift_time(drift_radius_, drift_time, sigma_drift_time);
+  drift_time = std::max(random_.gaussian(drift_time, 20.0 * CLHEP::ns), 20.0 * CLHEP::ns);
+  double drift_radius, sigma_drift_radius;
+  dtc_.drift_time_to_radius(drift_time, drift_radius, sigma_drift_radius);
+
+  TrackFit::gg_hit hit;
+  hit.set_id(hits_.size());
+  hit.set_x(xi_);
+  hit.set_y(yi_);
+  hit.set_z(zi_);
+  hit.set_sigma_z(sigma_z_);
+  hit.set_r(drift_radius);
+  hit.set_sigma_r(sigma_drift_radius);
+  hit.set_t(drift_time);
+  hit.set_rmax(dtc_.rmax);
+  hits_.push_back(hit);
+}
+
+void generate_helix_hits(mygsl::rng& random_, const TrackFit::default_drift_time_calibration& dtc_,
+                         TrackFit::gg_hits_col& hits_) {
+  hits_.clear();
+  const double r = random_.flat(50. * CLHEP::cm, 200. * CLHEP::cm);
+  const double step = random_.flat(50. * CLHEP::cm, 100. * CLHEP::cm);
+  const double x0 = random_.flat(-25. * CLHEP::cm, 25. * CLHEP::cm);
+  const double y0 = random_.flat(-25. * CLHEP::cm, 25. * CLHEP::cm);
+  const double z0 = random_.flat(-50. * CLHEP::cm, 50. * CLHEP::cm);
+  const double sigma_z = 2.5 * CLHEP::mm;
+  const double dtheta = 3. * dtc_.rmax / r;
+  double angle = random_.flat(-150. * CLHEP::degree, 150. * CLHEP::degree);
+  for (size_t i = 0; i < kNumberOfHits; i++) {
+    const double drift_radius = random_.flat(0.1 * CLHEP::mm, dtc_.rmax);
+    const double ri = r + (random_.uniform() < 0.5 ? -drift_radius : drift_radius);
+    const double zi = random_.gaussian(z0 + step * angle / (2. * M_PI), sigma_z);
+    add_hit(random_, dtc_, x0 + ri * std::cos(angle), y0 + ri * std::sin(angle), zi, sigma_z,
+            drift_radius, hits_);
+    angle += dtheta;
+  }
+}
+
+void generate_line_hits(mygsl::rng& random_, const TrackFit::default_drift_time_calibration& dtc_,
+                        TrackFit::gg_hits_col& hits_) {
+  hits_.clear();
+  const double theta = random_.flat(-30. * CLHEP::degree, 30. * CLHEP::degree);
+  const double sigma_z = 2.5 * CLHEP::cm;
+  for (size_t i = 0; i < kNumberOfHits; i++) {
+    const double x = random_.gaussian((i + 1) * 2. * dtc_.rmax / std::cos(theta), 0.1 * dtc_.rmax);
+    const double drift_radius = random_.flat(0.1 * CLHEP::mm, dtc_.rmax);
+    const double y = random_.uniform() < 0.5 ? -drift_radius : drift_radius;
+    const double zi = random_.gaussian(25.5 * CLHEP::cm + i * 3.2 * CLHEP::cm, sigma_z);
+    add_hit(random_, dtc_, x * std::cos(theta) - y * std::sin(theta),
+            x * std::sin(theta) + y * std::cos(theta), zi, sigma_z, drift_radius, hits_);
+  }
+  hits_.front().set_first(true);
+  hits_.back().set_last(true);
+}
+
+int check_helix(mygsl::rng& random_, const TrackFit::default_drift_time_calibration& dtc_,
+                size_t& checked_, size_t& fits_) {
+  using TrackFit::helix_fit_params;
+  TrackFit::gg_hits_col hits;
+  generate_helix_hits(random_, dtc_, hits);
+
+  TrackFit::helix_fit_data data;
+  data.using_drift_time = true;
+  data.hits = &hits;
+  data.calibration = &dtc_;
+  data.start_time = 0.0 * CLHEP::ns;
+
+  // Finite difference steps used by helix_fit_mgr::residual_df_numerical
+  std::vector<double> h(helix_fit_params::HELIX_FIT_FIXED_START_TIME_NOPARS, 0.25 * CLHEP::mm);
+  h[helix_fit_params::PARAM_INDEX_STEP] = 0.25 * CLHEP::mm / CLHEP::radian;
+
+  int failures = 0;
+  datatools::properties guess_config;
+  TrackFit::helix_fit_mgr::guess_utils GU;
+  GU.initialize(guess_config);
+  for (int iguess = 0; iguess < (int)TrackFit::helix_fit_mgr::guess_utils::NUMBER_OF_GUESS;
+       iguess++) {
+    TrackFit::helix_fit_params guess;
+    if (!GU.compute_guess(hits, iguess, guess, false)) {
+      continue;
+    }
+    std::vector<double> x(helix_fit_params::HELIX_FIT_FIXED_START_TIME_NOPARS);
+    x[helix_fit_params::PARAM_INDEX_X0] = guess.x0;
+    x[helix_fit_params::PARAM_INDEX_Y0] = guess.y0;
+    x[helix_fit_params::PARAM_INDEX_Z0] = guess.z0;
+    x[helix_fit_params::PARAM_INDEX_R] = guess.r;
+    x[helix_fit_params::PARAM_INDEX_STEP] = guess.step;
+    failures += check_jacobian("helix guess #" + std::to_string(iguess),
+                               &TrackFit::helix_fit_mgr::residual_f,
+                               &TrackFit::helix_fit_mgr::residual_df,
+                               &TrackFit::helix_fit_mgr::residual_df_numerical, &data,
+                               2 * hits.size(), x, h, checked_);
+
+    TrackFit::helix_fit_solution solutions[2];
+    for (int numerical = 0; numerical < 2; numerical++) {
+      datatools::properties config;
+      config.store_flag("using_drift_time");
+      if (numerical != 0) {
+        config.store_flag("numerical_jacobian");
+      }
+      TrackFit::helix_fit_mgr HFM;
+      HFM.set_hits(hits);
+      HFM.set_calibration(dtc_);
+      HFM.set_t0(0.0 * CLHEP::ns);
+      HFM.set_fit_eps(1.e-6);
+      HFM.set_guess(guess);
+      HFM.init(config);
+      HFM.fit();
+      solutions[numerical] = HFM.get_solution();
+      HFM.reset();
+    }
+    const TrackFit::helix_fit_solution& a = solutions[0];
+    const TrackFit::helix_fit_solution& n = solutions[1];
+    const std::string label = "helix fit from guess #" + std::to_string(iguess);
+    if (a.ok != n.ok) {
+      std::cerr << "error: " << label << ": converges in one mode only" << std::endl;
+      failures++;
+      continue;
+    }
+    if (!a.ok) {
+      continue;
+    }
+    fits_++;
+    failures += check_parameter(label, "x0", a.x0, n.x0, a.err_x0);
+    failures += check_parameter(label, "y0", a.y0, n.y0, a.err_y0);
+    failures += check_parameter(label, "z0", a.z0, n.z0, a.err_z0);
+    failures += check_parameter(label, "r", a.r, n.r, a.err_r);
+    failures += check_parameter(label, "step", a.step, n.step, a.err_step);
+  }
+  return failures;
+}
+
+int check_line(mygsl::rng& random_, const TrackFit::default_drift_time_calibration& dtc_,
+               size_t& checked_, size_t& fits_) {
+  using TrackFit::line_fit_params;
+  TrackFit::gg_hits_col hits;
+  generate_line_hits(random_, dtc_, hits);
+  // The fit works in the frame where the track is along the x axis
+  TrackFit::gg_hits_col hits_ref;
+  geomtools::placement working_ref;
+  TrackFit::line_fit_mgr::compute_best_frame(hits, hits_ref, working_ref);
+
+  TrackFit::line_fit_data data;
+  data.using_drift_time = true;
+  data.hits = &hits_ref;
+  data.calibration = &dtc_;
+
+  // Finite difference steps used by line_fit_mgr::residual_df_numerical, the
+  // start time not being fitted
+  std::vector<double> h(line_fit_params::LINE_FIT_NOPARS - 1, 0.25 * CLHEP::mm);
+  h[line_fit_params::PARAM_INDEX_PHI] = M_PI / 100 * CLHEP::radian;
+  h[line_fit_params::PARAM_INDEX_THETA] = M_PI / 100 * CLHEP::radian;
+
+  int failures = 0;
+  datatools::properties guess_config;
+  TrackFit::line_fit_mgr::guess_utils GU;
+  GU.initialize(guess_config);
+  for (int iguess = 0; iguess < (int)TrackFit::line_fit_mgr::guess_utils::NUMBER_OF_GUESS;
+       iguess++) {
+    TrackFit::line_fit_params guess;
+    if (!GU.compute_guess(hits_ref, iguess, guess)) {
+      continue;
+    }
+    std::vector<double> x(line_fit_params::LINE_FIT_NOPARS - 1);
+    x[line_fit_params::PARAM_INDEX_Z0] = guess.z0;
+    x[line_fit_params::PARAM_INDEX_Y0] = guess.y0;
+    x[line_fit_params::PARAM_INDEX_PHI] = guess.phi;
+    x[line_fit_params::PARAM_INDEX_THETA] = guess.theta;
+    failures += check_jacobian("line guess #" + std::to_string(iguess),
+                               &TrackFit::line_fit_mgr::residual_f,
+                               &TrackFit::line_fit_mgr::residual_df,
+                               &TrackFit::line_fit_mgr::residual_df_numerical, &data,
+                               2 * hits_ref.size(), x, h, checked_);
+
+    TrackFit::line_fit_solution solutions[2];
+    for (int numerical = 0; numerical < 2; numerical++) {
+      datatools::properties config;
+      config.store_flag("using_drift_time");
+      if (numerical != 0) {
+        config.store_flag("numerical_jacobian");
+      }
+      TrackFit::line_fit_mgr LFM;
+      LFM.set_hits(hits_ref);
+      LFM.set_calibration(dtc_);
+      LFM.set_t0(0.0 * CLHEP::ns);
+      LFM.set_fit_eps(1.e-6);
+      LFM.set_guess(guess);
+      LFM.init(config);
+      LFM.fit();
+      solutions[numerical] = LFM.get_solution();
+      LFM.reset();
+    }
+    const TrackFit::line_fit_solution& a = solutions[0];
+    const TrackFit::line_fit_solution& n = solutions[1];
+    const std::string label = "line fit from guess #" + std::to_string(iguess);
+    if (a.ok != n.ok) {
+      std::cerr << "error: " << label << ": converges in one mode only" << std::endl;
+      failures++;
+      continue;
+    }
+    if (!a.ok) {
+      continue;
+    }
+    fits_++;
+    failures += check_parameter(label, "y0", a.y0, n.y0, a.err_y0);
+    failures += check_parameter(label, "z0", a.z0, n.z0, a.err_z0);
+    failures += check_parameter(label, "phi", a.phi, n.phi, a.err_phi);
+    failures += check_parameter(label, "theta", a.theta, n.theta, a.err_theta);
+  }
+  return failures;
+}
+
+}  // namespace
+
+int main(int /*argc_*/, char** /*argv_*/) {
+  int error_code = EXIT_SUCCESS;
+  try {
+    std::clog << "Test program for the Jacobians of the TrackFit helix and line fits!"
+              << std::endl;
+
+    // A fixed seed keeps the test reproducible
+    mygsl::rng random("mt19937", 314159);
+    TrackFit::default_drift_time_calibration dtc;
+
+    int failures = 0;
+    size_t checked = 0;
+    size_t fits = 0;
+    for (size_t ievent = 0; ievent < kNumberOfEvents; ievent++) {
+      failures += check_helix(random, dtc, checked, fits);
+      failures += check_line(random, dtc, checked, fits);
+    }
+    std::clog << "Compared " << checked << " Jacobian elements and " << fits
+              << " pairs of fits: " << failures << " disagreement(s)" << std::endl;
+    if (failures != 0 || checked == 0 || fits == 0) {
+      error_code = EXIT_FAILURE;
+    }
+  } catch (std::exception& x) {
+    std::cerr << "error: " << x.what() << std::endl;
+    error_code = EXIT_FAILURE;
+  } catch (...) {
+    std::cerr << "error: "
+              << "unexpected error!" << std::endl;
+    error_code = EXIT_FAILURE;
+  }
+  return (error_code);
+}
@@ -52,6 +52,7 @@ int main(int argc_, char** argv_) {
     bool no_z = false;
     bool stop1 = false;
     bool do_fit = true;
+    bool numerical_jacobian = false;
 
     int iarg = 1;
 
@@ -65,6 +66,8 @@ int main(int argc_, char** argv_) {
           draw = true;
         } else if ((option == "-T") || (option == "--no-drift-time")) {
           use_drift_time = false;
+        } else if ((option == "-J") || (option == "--numerical-jacobian")) {
+          numerical_jacobian = true;
         } else if (option == "-z") {
           no_z = true;
         } else if (option == "-b") {
@@ -198,6 +201,9 @@ int main(int argc_, char** argv_) {
       if (!use_drift_time) {
         config.store_flag("ignore_drift_time");
       }
+      if (numerical_jacobian) {
+        config.store_flag("numerical_jacobian");
+      }
 
       for (int iguess = 0; iguess < max_guess; iguess++) {
         if (only_guess >= 0) {
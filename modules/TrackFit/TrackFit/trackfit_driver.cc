@@ -10,6 +10,7 @@
 // This project:
 #include <falaise/property_set.h>
 
+#include <falaise/snemo/datamodels/handle_pool.h>
 #include <falaise/snemo/datamodels/helix_trajectory_pattern.h>
 #include <falaise/snemo/datamodels/line_trajectory_pattern.h>
 #include <falaise/snemo/datamodels/tracker_clustering_data.h>
@@ -154,6 +155,7 @@ void trackfit_driver::reset() {
 
   _helix_guess_driver_.reset();
   _line_guess_driver_.reset();
+  _fit_workspaces_.clear();
 
   _line_guess_dict_.clear();
   _helix_guess_dict_.clear();
@@ -247,7 +249,7 @@ int trackfit_driver::_process_algo(const snemo::datamodel::tracker_clustering_da
   for (const datatools::handle<snemo::datamodel::tracker_clustering_solution>& a_cluster_solution :
        cluster_solutions) {
     auto a_trajectory_solution =
-        datatools::make_handle<snemo::datamodel::tracker_trajectory_solution>();
+        snemo::datamodel::make_pooled_handle<snemo::datamodel::tracker_trajectory_solution>();
     trajectory_.add_solution(a_trajectory_solution);
     a_trajectory_solution->set_solution_id(a_cluster_solution->get_solution_id());
     a_trajectory_solution->set_clustering_solution(a_cluster_solution);
@@ -305,7 +307,8 @@ int trackfit_driver::_process_algo(const snemo::datamodel::tracker_clustering_da
         helix_fit_succeed = true;
 
         // Create new 'tracker_trajectory' handle:
-        auto h_trajectory = datatools::make_handle<snemo::datamodel::tracker_trajectory>();
+        auto h_trajectory =
+            snemo::datamodel::make_pooled_handle<snemo::datamodel::tracker_trajectory>();
         a_trajectory_solution->grab_trajectories().push_back(h_trajectory);
 
         // 2012/05/11 XG : this work if all cells are clusterized on
@@ -355,7 +358,8 @@ int trackfit_driver::_process_algo(const snemo::datamodel::tracker_clustering_da
         line_fit_succeed = true;
 
         // Create new 'tracker_trajectory' handle:
-        auto h_trajectory = datatools::make_handle<snemo::datamodel::tracker_trajectory>();
+        auto h_trajectory =
+            snemo::datamodel::make_pooled_handle<snemo::datamodel::tracker_trajectory>();
         a_trajectory_solution->grab_trajectories().push_back(h_trajectory);
 
         // Set trajectory geom_id using the first geiger
@@ -481,8 +485,10 @@ void trackfit_driver::_compute_line_guesses_(const TrackFit::gg_hits_col& gg_hit
 void trackfit_driver::_compute_helix_fit_solutions_(
     const TrackFit::gg_hits_col& gg_hits_, const helix_guess_dict_type& guesses_,
     std::list<TrackFit::helix_fit_solution>& solutions_) {
+  // One fit manager and its GSL workspaces serve all of the guesses
+  TrackFit::helix_fit_mgr hfm;
+  hfm.set_workspace_pool(_fit_workspaces_);
   for (const auto& iguess : guesses_) {
-    TrackFit::helix_fit_mgr hfm;
     hfm.set_logging_priority(get_logging_priority());
     hfm.set_hits(gg_hits_);
     if (_dtc_.get() != nullptr) {
@@ -509,8 +515,10 @@ void trackfit_driver::_compute_helix_fit_solutions_(
 void trackfit_driver::_compute_line_fit_solutions_(
     const TrackFit::gg_hits_col& gg_hits_, const line_guess_dict_type& guesses_,
     std::list<TrackFit::line_fit_solution>& solutions_) {
+  // One fit manager and its GSL workspaces serve all of the guesses
+  TrackFit::line_fit_mgr lfm;
+  lfm.set_workspace_pool(_fit_workspaces_);
   for (const auto& iguess : guesses_) {
-    TrackFit::line_fit_mgr lfm;
     lfm.set_logging_priority(get_logging_priority());
     if (_dtc_.get() != nullptr) {
       lfm.set_calibration(*_dtc_);
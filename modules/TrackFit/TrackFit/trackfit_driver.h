@@ -45,6 +45,7 @@
 #include <falaise/snemo/processing/base_tracker_fitter.h>
 
 // This project:
+#include <TrackFit/fit_workspace_pool.h>
 #include <TrackFit/gg_hit.h>
 #include <TrackFit/helix_fit_mgr.h>
 #include <TrackFit/i_drift_time_calibration.h>
@@ -191,6 +192,7 @@ class trackfit_driver : public ::snemo::processing::base_tracker_fitter {
   uint32_t _trackfit_flag_;                    /// Special flags for trackfit algorithm
   std::string _drift_time_calibration_label_;  /// Drift time calibration driver label
   boost::scoped_ptr<TrackFit::i_drift_time_calibration> _dtc_;  /// Drift time calibration driver
+  TrackFit::fit_workspace_pool _fit_workspaces_;  /// GSL workspaces shared by all fits
 
   // Specific to line fit:
   bool _use_line_fit_;                                      /// Flag to use 'line' fit
@@ -19,6 +19,7 @@
 #include <falaise/snemo/datamodels/data_model.h>
 #include <falaise/snemo/datamodels/tracker_clustering_data.h>
 #include <falaise/snemo/datamodels/tracker_trajectory_data.h>
+#include <falaise/snemo/processing/profiler.h>
 #include <falaise/snemo/services/services.h>
 #include "falaise/snemo/services/geometry.h"
 #include "falaise/snemo/services/service_handle.h"
@@ -112,6 +113,7 @@ void trackfit_tracker_fitting_module::reset() {
 // Processing :
 dpp::base_module::process_status trackfit_tracker_fitting_module::process(
     datatools::things& event) {
+  falaise::processing::scoped_profile profile{get_name()};
   DT_THROW_IF(!is_initialized(), std::logic_error,
               "Module '" << get_name() << "' is not initialized !");
   namespace snedm = snemo::datamodel;
@@ -120,7 +122,7 @@ dpp::base_module::process_status trackfit_tracker_fitting_module::process(
   if (!event.has(TCDTag_)) {
     DT_THROW_IF(true, std::logic_error, "Missing tracker clustering data to be processed !");
   }
-  const auto& inputClusters = event.get<snedm::tracker_clustering_data>(TCDTag_);
+  const auto& inputClusters = ::snedm::getFromEvent<snedm::tracker_clustering_data>(TCDTag_, event);
 
   // Check tracker trajectory data
   auto& outputTrajectories = ::snedm::getOrAddToEvent<snedm::tracker_trajectory_data>(TTDTag_, event);
@@ -133,7 +135,7 @@ dpp::base_module::process_status trackfit_tracker_fitting_module::process(
   // Main processing method :
   _process(inputClusters, outputTrajectories);
 
-  return dpp::base_module::PROCESS_SUCCESS;
+  return profile.result(dpp::base_module::PROCESS_SUCCESS);
 }
 
 void trackfit_tracker_fitting_module::_process(
@@ -20,6 +20,8 @@
 #include "bayeux/mctools/utils.h"
 
 // This Project
+#include "falaise/snemo/datamodels/event.h"
+
 // Macro which automatically implements the interface needed
 // to enable the module to be loaded at runtime
 // The first argument is the typename
@@ -323,7 +325,8 @@ dpp::base_module::process_status Things2Root::process(datatools::things& workIte
 
   // Access the workItem
   if (workItem.has("SD")) {
-    const mctools::simulated_data& SD = workItem.get<mctools::simulated_data>("SD");
+    const mctools::simulated_data& SD =
+        snedm::getFromEvent<mctools::simulated_data>("SD", workItem);
 
     truevertex_.x_ = SD.get_vertex().x();
     truevertex_.y_ = SD.get_vertex().y();
@@ -544,7 +547,7 @@ dpp::base_module::process_status Things2Root::process(datatools::things& workIte
     unsigned int gveto_geom_type = 1252;
 
     const snemo::datamodel::calibrated_data& CD =
-        workItem.get<snemo::datamodel::calibrated_data>("CD");
+        snedm::getFromEvent<snemo::datamodel::calibrated_data>("CD", workItem);
     //      std::clog << "In process: found CD data bank " << std::endl;
     tracker_.nohits_ = CD.tracker_hits().size();
     BOOST_FOREACH (const snemo::datamodel::TrackerHitHdl& gg_handle, CD.tracker_hits()) {
@@ -645,7 +648,8 @@ dpp::base_module::process_status Things2Root::process(datatools::things& workIte
   }
   // look for event header
   if (workItem.has("EH")) {
-    const snemo::datamodel::event_header& EH = workItem.get<snemo::datamodel::event_header>("EH");
+    const snemo::datamodel::event_header& EH =
+        snedm::getFromEvent<snemo::datamodel::event_header>("EH", workItem);
     //      std::clog << "In process: found EH event header " << std::endl;
     header_.runnumber_ = EH.get_id().get_run_number();
     header_.eventnumber_ = EH.get_id().get_event_number();
@@ -0,0 +1,85 @@
+//! \file    flconvertbfieldmapmain.cc
+//! \brief   Convert a text magnetic field map to the binary, memory mappable format
+//
+// This file is part of Falaise.
+//
+// Falaise is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Falaise is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Falaise.  If not, see <http://www.gnu.org/licenses/>.
+
+// Standard Library:
+#include <exception>
+#include <iostream>
+#include <string>
+
+// Third Party:
+// - Boost:
+#include "boost/program_options.hpp"
+
+// This Project:
+#include "falaise/exitcodes.h"
+#include "falaise/falaise.h"
+#include "falaise/snemo/geometry/magnetic_field_map.h"
+
+namespace {
+falaise::exit_code do_convert(int argc, char* argv[]) {
+  namespace bpo = boost::program_options;
+  std::string input;
+  std::string output;
+
+  bpo::options_description options("Options");
+  // clang-format off
+  options.add_options()
+    ("help,h", "print this help message")
+    ("input,i", bpo::value<std::string>(&input)->required()->value_name("file"),
+     "text map file (csv_map_0 format) to convert")
+    ("output,o", bpo::value<std::string>(&output)->required()->value_name("file"),
+     "binary map file to create");
+  // clang-format on
+
+  try {
+    bpo::variables_map vm;
+    bpo::store(bpo::parse_command_line(argc, argv, options), vm);
+    if (vm.count("help") != 0u) {
+      std::cout << "Usage:\n"
+                << "  flconvertbfieldmap [options]\n"
+                << "Convert a magnetic field map to the binary format read by the\n"
+                << "\"import_binary_map\" mode of snemo::geometry::mapped_magnetic_field\n\n"
+                << options << "\n";
+      return falaise::EXIT_OK;
+    }
+    bpo::notify(vm);
+  } catch (const bpo::error& e) {
+    std::cerr << "flconvertbfieldmap: " << e.what() << "\n";
+    return falaise::EXIT_USAGE;
+  }
+
+  try {
+    snemo::geometry::field_map_layout layout;
+    std::vector<int32_t> components = snemo::geometry::read_csv_field_map(input, layout);
+    snemo::geometry::write_binary_field_map(output, layout, components);
+    // Check the result can be read back, once for all its readers
+    snemo::geometry::binary_field_map check{output, true};
+  } catch (const std::exception& e) {
+    std::cerr << "flconvertbfieldmap: " << e.what() << "\n";
+    return falaise::EXIT_UNAVAILABLE;
+  }
+  return falaise::EXIT_OK;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  falaise::initialize();
+  falaise::exit_code ret = do_convert(argc, argv);
+  falaise::terminate();
+  return ret;
+}
@@ -0,0 +1,145 @@
+// Ourselves
+#include "FLReconstructAllocationProbe.h"
+
+// Standard Library
+#include <cstdlib>
+#include <new>
+
+namespace {
+thread_local std::size_t allocationCount = 0;
+thread_local std::size_t allocatedBytes = 0;
+
+//! Allocate with allocate(size) and count, following the standard operator new failure protocol
+template <typename Allocate>
+void* counted_allocate(std::size_t size, bool throwOnFailure, Allocate allocate) {
+  ++allocationCount;
+  allocatedBytes += size;
+  if (size == 0) {
+    size = 1;
+  }
+  while (true) {
+    void* p = allocate(size);
+    if (p != nullptr) {
+      return p;
+    }
+    std::new_handler handler = std::get_new_handler();
+    if (handler == nullptr) {
+      if (throwOnFailure) {
+        throw std::bad_alloc{};
+      }
+      return nullptr;
+    }
+    handler();
+  }
+}
+
+void* counted_allocate(std::size_t size, bool throwOnFailure) {
+  return counted_allocate(size, throwOnFailure, [](std::size_t n) { return std::malloc(n); });
+}
+
+#if defined(__cpp_aligned_new)
+void* counted_allocate(std::size_t size, std::align_val_t alignment, bool throwOnFailure) {
+  std::size_t align = static_cast<std::size_t>(alignment);
+  if (align < sizeof(void*)) {
+    align = sizeof(void*);
+  }
+  return counted_allocate(size, throwOnFailure, [align](std::size_t n) {
+    void* p = nullptr;
+    return ::posix_memalign(&p, align, n) == 0 ? p : nullptr;
+  });
+}
+#endif
+}  // namespace
+
+namespace FLReconstruct {
+
+void current_thread_allocations(std::size_t& count, std::size_t& bytes) {
+  count = allocationCount;
+  bytes = allocatedBytes;
+}
+
+}  // namespace FLReconstruct
+
+// Replacement of the global allocation functions
+void* operator new(std::size_t size) { return counted_allocate(size, true); }
+
+void* operator new[](std::size_t size) { return counted_allocate(size, true); }
+
+void* operator new(std::size_t size, const std::nothrow_t& /*unused*/) noexcept {
+  try {
+    return counted_allocate(size, false);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& /*unused*/) noexcept {
+  try {
+    return counted_allocate(size, false);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete[](void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t /*unused*/) noexcept { std::free(p); }
+
+void operator delete[](void* p, std::size_t /*unused*/) noexcept { std::free(p); }
+
+void operator delete(void* p, const std::nothrow_t& /*unused*/) noexcept { std::free(p); }
+
+void operator delete[](void* p, const std::nothrow_t& /*unused*/) noexcept { std::free(p); }
+
+#if defined(__cpp_aligned_new)
+// Over-aligned types, allocated with posix_memalign which memory is released by free
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return counted_allocate(size, alignment, true);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return counted_allocate(size, alignment, true);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment,
+                   const std::nothrow_t& /*unused*/) noexcept {
+  try {
+    return counted_allocate(size, alignment, false);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment,
+                     const std::nothrow_t& /*unused*/) noexcept {
+  try {
+    return counted_allocate(size, alignment, false);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void operator delete(void* p, std::align_val_t /*unused*/) noexcept { std::free(p); }
+
+void operator delete[](void* p, std::align_val_t /*unused*/) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t /*unused*/, std::align_val_t /*unused*/) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p, std::size_t /*unused*/, std::align_val_t /*unused*/) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t /*unused*/,
+                     const std::nothrow_t& /*unused*/) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p, std::align_val_t /*unused*/,
+                       const std::nothrow_t& /*unused*/) noexcept {
+  std::free(p);
+}
+#endif
@@ -0,0 +1,33 @@
+// FLReconstructAllocationProbe.h - Heap allocation counting for FLReconstruct profiling
+//
+// Distributed under the OSI-approved BSD 3-Clause License (the "License");
+// see accompanying file License.txt for details.
+//
+// This software is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the License for more information.
+
+#ifndef FLRECONSTRUCTALLOCATIONPROBE_H
+#define FLRECONSTRUCTALLOCATIONPROBE_H
+
+// Standard Library:
+#include <cstddef>
+
+namespace FLReconstruct {
+
+//! Return the cumulative number of heap allocations and allocated bytes of the calling thread
+//!
+//! Counts are maintained by the replacement global operator new of the
+//! flreconstruct application, which is only built with the CMake option
+//! FALAISE_WITH_ALLOCATION_PROBE.
+void current_thread_allocations(std::size_t& count, std::size_t& bytes);
+
+}  // namespace FLReconstruct
+
+#endif  // FLRECONSTRUCTALLOCATIONPROBE_H
+
+// Local Variables: --
+// mode: c++ --
+// c-file-style: "gnu" --
+// tab-width: 2 --
+// End: --
@@ -35,13 +35,19 @@ FLReconstructCommandLine FLReconstructCommandLine::makeDefault() {
   FLReconstructCommandLine frArgs;
   frArgs.logLevel = datatools::logger::PRIO_FATAL;
   frArgs.moduloEvents = 0;
+  frArgs.numberOfThreads = 1;
   frArgs.userProfile = "normal";
   frArgs.pipelineScript = "";
   frArgs.inputMetadataFile = "";
   frArgs.outputMetadataFile = "";  // "flreconstruct.mdata" ?
   frArgs.embeddedMetadata = true;
-  frArgs.inputFile = "";
+  frArgs.inputFiles.clear();
+  frArgs.inputRange = RecordRange{};
   frArgs.outputFile = "";
+  frArgs.outputIndex = false;
+  frArgs.packedBanks.clear();
+  frArgs.compactHits = false;
+  frArgs.profileReport = "";
   return frArgs;
 }
 
@@ -154,6 +160,8 @@ FLDialogState do_cldialog(int argc, char* argv[], FLReconstructCommandLine& clAr
 
   // Bind command line parser to exposed parameters
   std::string verbosityLabel;
+  std::string rangeLabel;
+  std::string shardLabel;
   // Application specific options:
   // clang-format off
   bpo::options_description optDesc("Options");
@@ -173,6 +181,9 @@ FLDialogState do_cldialog(int argc, char* argv[], FLReconstructCommandLine& clAr
     ("modulo,P", bpo::value<uint32_t>(&clArgs.moduloEvents)->default_value(0)->value_name("period"),
       "progress modulo on number of events")
 
+    ("threads,t", bpo::value<uint32_t>(&clArgs.numberOfThreads)->default_value(1)->value_name("n"),
+      "number of pipelines processing events in parallel")
+
     ("user-profile,u", bpo::value<std::string>(&clArgs.userProfile)->value_name("name")->default_value("normal"),
       R"(set the user profile ("expert", "normal", "production"))")
 
@@ -189,11 +200,40 @@ FLDialogState do_cldialog(int argc, char* argv[], FLReconstructCommandLine& clAr
     ("pipeline,p", bpo::value<std::string>(&clArgs.pipelineScript)->value_name("file"),
       "pipeline script")
 
-    ("input-file,i", bpo::value<std::string>(&clArgs.inputFile)->required()->value_name("file"),
-      "file from which to read input data (simulation, real)")
+    ("input-file,i", bpo::value<std::vector<std::string>>(&clArgs.inputFiles)->required()->value_name("file"),
+      "file from which to read input data (simulation, real)\n"
+      "May be repeated, and may contain wildcards, to read\n"
+      "several files in sequence")
+
+    ("skip", bpo::value<uint64_t>(&clArgs.inputRange.first)->value_name("n"),
+      "skip the first n input records")
+
+    ("range", bpo::value<std::string>(&rangeLabel)->value_name("a:b"),
+      "process input records a (included) to b (excluded)\n"
+      "Either bound may be omitted")
+
+    ("shard", bpo::value<std::string>(&shardLabel)->value_name("i/n"),
+      "process the i-th of n equal slices of the input records\n"
+      "(after --skip or --range), i counting from 0")
 
     ("output-file,o", bpo::value<std::string>(&clArgs.outputFile)->value_name("file"),
       "file in which to store reconstruction results")
+
+    ("output-index", bpo::bool_switch(&clArgs.outputIndex),
+      "write an index of the records of the output file\n"
+      "next to it, in <file>.idx")
+
+    ("pack-banks", bpo::value<std::vector<std::string>>(&clArgs.packedBanks)->multitoken()->value_name("label"),
+      "write the output banks with these labels in packed\n"
+      "form, decoded only by the modules which read them\n"
+      "Example: --pack-banks SD")
+
+    ("compact-hits", bpo::bool_switch(&clArgs.compactHits),
+      "write the calibrated hits in a compact form, with\n"
+      "their real quantities in single precision")
+
+    ("profile", bpo::value<std::string>(&clArgs.profileReport)->value_name("file"),
+      "profile the processing modules and store the report in JSON format in file")
     ;
   // clang-format on
 
@@ -249,6 +289,27 @@ FLDialogState do_cldialog(int argc, char* argv[], FLReconstructCommandLine& clAr
     }
   }
 
+  if (vMap.count("range") != 0u) {
+    if (vMap.count("skip") != 0u) {
+      do_error(std::cerr, "Options --skip and --range cannot be used together!");
+      return DIALOG_ERROR;
+    }
+    if (!parse_record_range(rangeLabel, clArgs.inputRange)) {
+      do_error(std::cerr, "Invalid record range '" + rangeLabel + "'!");
+      return DIALOG_ERROR;
+    }
+  }
+
+  if (vMap.count("shard") != 0u && !parse_record_shard(shardLabel, clArgs.inputRange)) {
+    do_error(std::cerr, "Invalid shard '" + shardLabel + "'!");
+    return DIALOG_ERROR;
+  }
+
+  if (clArgs.numberOfThreads == 0) {
+    do_error(std::cerr, "Number of threads must be at least 1!");
+    return DIALOG_ERROR;
+  }
+
   if (falaise::validUserLevels().count(clArgs.userProfile) == 0u) {
     do_error(std::cerr, "Invalid user profile '" + clArgs.userProfile + "'!");
     return DIALOG_ERROR;
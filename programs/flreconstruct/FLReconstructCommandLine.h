@@ -16,8 +16,10 @@
 #define FLRECONSTRUCTCOMMANDLINE_H
 
 // Standard Library:
+#include <cstdint>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 // Third Party
 // - Boost
@@ -28,6 +30,7 @@
 
 // This project
 #include "FLReconstructErrors.h"
+#include "FLReconstructRecordReader.h"
 
 namespace FLReconstruct {
 
@@ -38,13 +41,19 @@ namespace FLReconstruct {
 struct FLReconstructCommandLine {
   datatools::logger::priority logLevel;  //!< Verbosity level
   uint32_t moduloEvents;                 //!< Event modulo
+  uint32_t numberOfThreads;              //!< Number of event-parallel pipelines
   std::string userProfile;               //!< User profile
   std::string pipelineScript;            //!< Path of the processing pipeline configuration script
   std::string inputMetadataFile;         //!< Path for loading metadata
-  std::string inputFile;                 //!< Path for the input module
+  std::vector<std::string> inputFiles;   //!< Paths or wildcard patterns of the input files
+  RecordRange inputRange;                //!< Input records to process
   std::string outputMetadataFile;        //!< Path for saving metadata
   bool embeddedMetadata;                 //!< Flag to embed metadata in the output data file
   std::string outputFile;                //!< Path for the output module
+  bool outputIndex;                      //!< Flag to write a record index of the output file
+  std::vector<std::string> packedBanks;  //!< Labels of the banks written in packed form
+  bool compactHits;                      //!< Flag to write calibrated hits in compact form
+  std::string profileReport;             //!< Path for the per-module profile report
 
   //! Build a default arguments set:
   static FLReconstructCommandLine makeDefault();
@@ -0,0 +1,164 @@
+// FLReconstructEventQueues.h - Thread safe queues for the FLReconstruct event loop
+//
+// Distributed under the OSI-approved BSD 3-Clause License (the "License");
+// see accompanying file License.txt for details.
+//
+// This software is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the License for more information.
+
+#ifndef FLRECONSTRUCTEVENTQUEUES_H
+#define FLRECONSTRUCTEVENTQUEUES_H
+
+// Standard Library:
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace FLReconstruct {
+
+//! \brief Bounded, blocking FIFO shared between producer and consumer threads
+//!
+//! push() blocks while the queue is full, pop() blocks while it is empty.
+//! Once closed, push() is a no-op returning false and pop() drains the
+//! remaining items before returning false.
+template <typename T>
+class BoundedQueue {
+ public:
+  explicit BoundedQueue(std::size_t capacity) : capacity_{capacity > 0 ? capacity : 1} {}
+
+  BoundedQueue(const BoundedQueue&) = delete;
+  BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+  //! Append an item, waiting for free space. Return false if the queue was closed
+  bool push(T&& item) {
+    std::unique_lock<std::mutex> lock{mutex_};
+    notFull_.wait(lock, [this] { return closed_ || items_.size() < capacity_; });
+    if (closed_) {
+      return false;
+    }
+    items_.push_back(std::move(item));
+    notEmpty_.notify_one();
+    return true;
+  }
+
+  //! Extract the oldest item, waiting for one. Return false once closed and drained
+  bool pop(T& item) {
+    std::unique_lock<std::mutex> lock{mutex_};
+    notEmpty_.wait(lock, [this] { return closed_ || !items_.empty(); });
+    if (items_.empty()) {
+      return false;
+    }
+    item = std::move(items_.front());
+    items_.pop_front();
+    notFull_.notify_one();
+    return true;
+  }
+
+  //! Refuse further items and wake up all waiting threads
+  void close() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    closed_ = true;
+    notEmpty_.notify_all();
+    notFull_.notify_all();
+  }
+
+ private:
+  std::size_t capacity_;
+  bool closed_ = false;
+  std::deque<T> items_;
+  std::mutex mutex_;
+  std::condition_variable notEmpty_;
+  std::condition_variable notFull_;
+};
+
+//! \brief Reorder buffer restoring input order of items processed out of order
+//!
+//! Each item is identified by its sequence number in the input stream.
+//! The producer reserve()s a sequence number before handing the item to
+//! a worker, which blocks while the item would fall outside the window of
+//! capacity items following the next one to be released. This bounds the
+//! memory held by items completed ahead of a slow one. Workers insert()
+//! completed items in any order and the consumer pop()s them strictly in
+//! sequence order.
+template <typename T>
+class ReorderBuffer {
+ public:
+  explicit ReorderBuffer(std::size_t capacity) : capacity_{capacity > 0 ? capacity : 1} {}
+
+  ReorderBuffer(const ReorderBuffer&) = delete;
+  ReorderBuffer& operator=(const ReorderBuffer&) = delete;
+
+  //! Wait until sequence number seq fits in the window. Return false if cancelled
+  bool reserve(std::size_t seq) {
+    std::unique_lock<std::mutex> lock{mutex_};
+    windowFree_.wait(lock, [this, seq] { return cancelled_ || seq < next_ + capacity_; });
+    return !cancelled_;
+  }
+
+  //! Store the item with sequence number seq
+  void insert(std::size_t seq, T&& item) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    items_.emplace(seq, std::move(item));
+    if (seq == next_) {
+      ready_.notify_all();
+    }
+  }
+
+  //! Declare that no item with sequence number end or above will be inserted
+  void finish(std::size_t end) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    end_ = end;
+    finished_ = true;
+    ready_.notify_all();
+  }
+
+  //! Wake up all waiting threads and make further calls fail
+  void cancel() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    cancelled_ = true;
+    ready_.notify_all();
+    windowFree_.notify_all();
+  }
+
+  //! Extract the next item in sequence. Return false when finished or cancelled
+  bool pop(T& item) {
+    std::unique_lock<std::mutex> lock{mutex_};
+    ready_.wait(lock, [this] {
+      return cancelled_ || (finished_ && next_ >= end_) || items_.count(next_) != 0;
+    });
+    auto found = items_.find(next_);
+    if (cancelled_ || found == items_.end()) {
+      return false;
+    }
+    item = std::move(found->second);
+    items_.erase(found);
+    ++next_;
+    windowFree_.notify_all();
+    return true;
+  }
+
+ private:
+  std::size_t capacity_;
+  std::size_t next_ = 0;
+  std::size_t end_ = 0;
+  bool finished_ = false;
+  bool cancelled_ = false;
+  std::map<std::size_t, T> items_;
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::condition_variable windowFree_;
+};
+
+}  // namespace FLReconstruct
+
+#endif  // FLRECONSTRUCTEVENTQUEUES_H
+
+// Local Variables: --
+// mode: c++ --
+// c-file-style: "gnu" --
+// tab-width: 2 --
+// End: --
@@ -0,0 +1,180 @@
+// Ourselves
+#include "FLReconstructEventStreams.h"
+
+// Standard Library
+#include <exception>
+#include <iostream>
+#include <utility>
+
+// Third Party
+// - Falaise
+#include "falaise/snemo/datamodels/packed_bank.h"
+
+namespace {
+//! Print the message of an exception caught on any thread
+void report(const std::exception_ptr& error) {
+  if (!error) {
+    return;
+  }
+  try {
+    std::rethrow_exception(error);
+  } catch (std::exception& e) {
+    std::cerr << "flreconstruct : " << e.what() << std::endl;
+  } catch (...) {
+    std::cerr << "flreconstruct : unknown exception" << std::endl;
+  }
+}
+}  // namespace
+
+namespace FLReconstruct {
+
+EventSource::EventSource(RecordReader& input, std::size_t readAheadDepth) : input_(input) {
+  if (readAheadDepth == 0) {
+    return;
+  }
+  buffer_.reset(new BoundedQueue<std::unique_ptr<datatools::things>>{readAheadDepth});
+  reader_ = std::thread{[this]() {
+    try {
+      std::unique_ptr<datatools::things> record;
+      while (read(record) == RECORD_OK) {
+        if (!buffer_->push(std::move(record))) {
+          break;
+        }
+      }
+    } catch (...) {
+      readError_ = std::current_exception();
+      readFailed_ = true;
+    }
+    // Wakes the consumer, which then finds out about a failure
+    buffer_->close();
+  }};
+}
+
+EventSource::~EventSource() { stop(); }
+
+EventSource::status EventSource::next(std::unique_ptr<datatools::things>& record) {
+  status result = RECORD_OK;
+  if (!buffer_) {
+    result = read(record);
+  } else if (!buffer_->pop(record)) {
+    // Errors are only reported once all records read before them are consumed
+    result = readFailed_ ? READ_ERROR : END_OF_INPUT;
+  }
+  if (result == READ_ERROR) {
+    report(readError_);
+    readError_ = nullptr;
+  }
+  return result;
+}
+
+void EventSource::stop() {
+  if (buffer_) {
+    buffer_->close();
+  }
+  if (reader_.joinable()) {
+    reader_.join();
+  }
+}
+
+EventSource::status EventSource::read(std::unique_ptr<datatools::things>& record) {
+  // Input files are opened on the way, possibly on the reader thread
+  try {
+    if (input_.is_terminated()) {
+      return END_OF_INPUT;
+    }
+    if (input_.read(record)) {
+      return RECORD_OK;
+    }
+  } catch (...) {
+    readError_ = std::current_exception();
+  }
+  readFailed_ = true;
+  return READ_ERROR;
+}
+
+EventSink::EventSink(dpp::base_module* output, std::size_t writeBehindDepth,
+                     snemo::datamodel::record_index* index,
+                     std::vector<std::string> packedBanks)
+    : output_(output), index_(index), packedBanks_(std::move(packedBanks)) {
+  if (output_ == nullptr || writeBehindDepth == 0) {
+    return;
+  }
+  buffer_.reset(new BoundedQueue<std::unique_ptr<datatools::things>>{writeBehindDepth});
+  writer_ = std::thread{[this]() {
+    try {
+      std::unique_ptr<datatools::things> record;
+      while (buffer_->pop(record)) {
+        if (!process(record)) {
+          writeFailed_ = true;
+          break;
+        }
+        // Release the record on this thread rather than on the producer's. Its
+        // pooled blocks still go back to the thread which allocated them
+        record.reset();
+      }
+    } catch (...) {
+      writeError_ = std::current_exception();
+      writeFailed_ = true;
+    }
+    // Wakes a producer waiting for room, which then finds out about a failure
+    if (writeFailed_) {
+      buffer_->close();
+    }
+  }};
+}
+
+EventSink::~EventSink() { close(); }
+
+bool EventSink::write(std::unique_ptr<datatools::things> record) {
+  if (output_ == nullptr) {
+    return true;
+  }
+  if (!buffer_) {
+    if (!process(record)) {
+      writeFailed_ = true;
+    }
+    return check();
+  }
+  return buffer_->push(std::move(record)) && check();
+}
+
+bool EventSink::close() {
+  if (buffer_) {
+    buffer_->close();
+  }
+  if (writer_.joinable()) {
+    writer_.join();
+  }
+  return check();
+}
+
+bool EventSink::check() {
+  if (!writeFailed_) {
+    return true;
+  }
+  if (!errorReported_) {
+    report(writeError_);
+    errorReported_ = true;
+  }
+  return false;
+}
+
+bool EventSink::process(const std::unique_ptr<datatools::things>& record) {
+  // A failed write ends the run, and the index is then discarded
+  try {
+    if (index_ != nullptr) {
+      index_->add(*record);
+    }
+    for (const std::string& label : packedBanks_) {
+      if (record->has(label)) {
+        snemo::datamodel::pack_bank(*record, label);
+      }
+    }
+    return output_->process(*record) == dpp::base_module::PROCESS_OK;
+  } catch (...) {
+    writeError_ = std::current_exception();
+    return false;
+  }
+}
+
+}  // namespace FLReconstruct
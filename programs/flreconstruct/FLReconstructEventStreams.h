@@ -0,0 +1,122 @@
+// FLReconstructEventStreams.h - Asynchronous input/output stages of the FLReconstruct event loop
+//
+// Distributed under the OSI-approved BSD 3-Clause License (the "License");
+// see accompanying file License.txt for details.
+//
+// This software is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the License for more information.
+
+#ifndef FLRECONSTRUCTEVENTSTREAMS_H
+#define FLRECONSTRUCTEVENTSTREAMS_H
+
+// Standard Library:
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Third Party
+// - Bayeux
+#include "bayeux/datatools/things.h"
+#include "bayeux/dpp/base_module.h"
+// - Falaise
+#include "falaise/snemo/datamodels/record_index.h"
+
+// This project
+#include "FLReconstructEventQueues.h"
+#include "FLReconstructRecordReader.h"
+
+namespace FLReconstruct {
+
+//! \brief Source of event records read from the input files
+//!
+//! With a non-zero read-ahead depth, records are deserialized on a
+//! background thread and up to depth records are buffered ahead of the
+//! consumer. With a zero depth, records are read on the calling thread.
+//! A read error, whatever thread it occurs on, is reported by next().
+class EventSource {
+ public:
+  //! Outcome of a request for the next record
+  enum status { RECORD_OK, END_OF_INPUT, READ_ERROR };
+
+  EventSource(RecordReader& input, std::size_t readAheadDepth);
+  ~EventSource();
+
+  EventSource(const EventSource&) = delete;
+  EventSource& operator=(const EventSource&) = delete;
+
+  //! Fetch the next record, in input order
+  status next(std::unique_ptr<datatools::things>& record);
+
+  //! Stop reading ahead. Further calls to next() report the end of input
+  void stop();
+
+ private:
+  //! Read one record on the calling thread
+  status read(std::unique_ptr<datatools::things>& record);
+
+  RecordReader& input_;
+  std::unique_ptr<BoundedQueue<std::unique_ptr<datatools::things>>> buffer_;
+  //! Exception which made reading fail, set before readFailed_
+  std::exception_ptr readError_;
+  std::atomic<bool> readFailed_{false};
+  std::thread reader_;
+};
+
+//! \brief Sink of event records written through an output module
+//!
+//! With a non-zero write-behind depth, records are serialized on a
+//! background thread, in the order they were submitted, and up to depth
+//! records wait for it. With a zero depth, records are written on the
+//! calling thread. A null output module discards all records. If an index
+//! is given, each record written is appended to it. The banks labelled in
+//! packedBanks are packed before being written, so that readers only decode
+//! them when they use them. A write error, whatever thread it occurs on,
+//! is reported by write() or close().
+class EventSink {
+ public:
+  EventSink(dpp::base_module* output, std::size_t writeBehindDepth,
+            snemo::datamodel::record_index* index = nullptr,
+            std::vector<std::string> packedBanks = {});
+  ~EventSink();
+
+  EventSink(const EventSink&) = delete;
+  EventSink& operator=(const EventSink&) = delete;
+
+  //! Submit a record for writing. Return false if a write has failed
+  bool write(std::unique_ptr<datatools::things> record);
+
+  //! Flush the pending records. Return false if a write has failed
+  bool close();
+
+ private:
+  //! Write one record on the calling thread
+  bool process(const std::unique_ptr<datatools::things>& record);
+
+  //! Return true if no write has failed, reporting the first failure
+  bool check();
+
+  dpp::base_module* output_;
+  snemo::datamodel::record_index* index_;
+  std::vector<std::string> packedBanks_;
+  std::unique_ptr<BoundedQueue<std::unique_ptr<datatools::things>>> buffer_;
+  //! Exception which made writing fail, set before writeFailed_
+  std::exception_ptr writeError_;
+  std::atomic<bool> writeFailed_{false};
+  bool errorReported_{false};
+  std::thread writer_;
+};
+
+}  // namespace FLReconstruct
+
+#endif  // FLRECONSTRUCTEVENTSTREAMS_H
+
+// Local Variables: --
+// mode: c++ --
+// c-file-style: "gnu" --
+// tab-width: 2 --
+// End: --
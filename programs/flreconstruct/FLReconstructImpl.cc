@@ -60,12 +60,18 @@ void do_configure(int argc, char* argv[], FLReconstructParams& flRecParameters)
   // Import parameters from the command line:
   flRecParameters.logLevel = clArgs.logLevel;
   flRecParameters.moduloEvents = clArgs.moduloEvents;
+  flRecParameters.numberOfThreads = clArgs.numberOfThreads;
   flRecParameters.userProfile = clArgs.userProfile;
   flRecParameters.inputMetadataFile = clArgs.inputMetadataFile;
-  flRecParameters.inputFile = clArgs.inputFile;
+  flRecParameters.inputFiles = expand_input_files(clArgs.inputFiles);
+  flRecParameters.inputRange = clArgs.inputRange;
   flRecParameters.outputMetadataFile = clArgs.outputMetadataFile;
   flRecParameters.embeddedMetadata = clArgs.embeddedMetadata;
   flRecParameters.outputFile = clArgs.outputFile;
+  flRecParameters.outputIndex = clArgs.outputIndex;
+  flRecParameters.packedBanks = clArgs.packedBanks;
+  flRecParameters.compactHits = clArgs.compactHits;
+  flRecParameters.profileReport = clArgs.profileReport;
 
   if (flRecParameters.userProfile.empty()) {
     // Force a default user profile:
@@ -104,6 +110,18 @@ void do_configure(int argc, char* argv[], FLReconstructParams& flRecParameters)
     flRecParameters.moduloEvents =
         basicSystem.get<int>("moduloEvents", flRecParameters.moduloEvents);
 
+    // Depth of the input read-ahead and output write-behind queues:
+    const int readAheadDepth =
+        basicSystem.get<int>("readAheadDepth", flRecParameters.readAheadDepth);
+    DT_THROW_IF(readAheadDepth < 0, FLConfigUserError,
+                "Invalid negative read-ahead depth '" << readAheadDepth << "'!");
+    flRecParameters.readAheadDepth = readAheadDepth;
+    const int writeBehindDepth =
+        basicSystem.get<int>("writeBehindDepth", flRecParameters.writeBehindDepth);
+    DT_THROW_IF(writeBehindDepth < 0, FLConfigUserError,
+                "Invalid negative write-behind depth '" << writeBehindDepth << "'!");
+    flRecParameters.writeBehindDepth = writeBehindDepth;
+
     // Printing rate for events:
     flRecParameters.userProfile =
         basicSystem.get<std::string>("userprofile", flRecParameters.userProfile);
@@ -285,9 +303,9 @@ void do_postprocess_input_metadata(FLReconstructParams& flRecParameters) {
     // Fetch the metadata from the companion input metadata file, if any:
     mc.set_input_metadata_file(flRecParameters.inputMetadataFile);
     flRecParameters.inputMetadata = mc.get_metadata_from_metadata_file();
-  } else if (!flRecParameters.inputFile.empty()) {
-    // Fetch the metadata from the input data file:
-    mc.set_input_data_file(flRecParameters.inputFile);
+  } else if (!flRecParameters.inputFiles.empty()) {
+    // Fetch the metadata from the first input data file:
+    mc.set_input_data_file(flRecParameters.inputFiles.front());
     flRecParameters.inputMetadata = mc.get_metadata_from_data_file();
   } else {
     // No metadata is available. Do nothing.
@@ -579,6 +597,18 @@ falaise::exit_code do_metadata(const FLReconstructParams& flRecParameters,
                                  "Number of reconstructed events");
     }
 
+    if (!flRecParameters.inputRange.is_complete()) {
+      const RecordRange& range = flRecParameters.inputRange;
+      std::string rangeLabel = std::to_string(range.first) + ":";
+      if (range.last != RecordRange::kUnbounded) {
+        rangeLabel += std::to_string(range.last);
+      }
+      system_props.store_string("inputRange", rangeLabel, "Range of the input records");
+      system_props.store_string(
+          "inputShard", std::to_string(range.shardIndex) + "/" + std::to_string(range.shardCount),
+          "Shard of the range of input records");
+    }
+
     if (!flRecParameters.experimentalSetupUrn.empty()) {
       system_props.store_string("experimentalSetupUrn", flRecParameters.experimentalSetupUrn,
                                 "Experimental setup URN");
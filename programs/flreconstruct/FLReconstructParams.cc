@@ -16,8 +16,11 @@ FLReconstructParams FLReconstructParams::makeDefault() {
   // Application specific parameters:
   params.logLevel = datatools::logger::PRIO_ERROR;
   params.userProfile = "normal";
-  params.numberOfEvents = 0;  // 0 == no limit on event loop
-  params.moduloEvents = 0;    // 0 == no print
+  params.numberOfEvents = 0;    // 0 == no limit on event loop
+  params.moduloEvents = 0;      // 0 == no print
+  params.numberOfThreads = 1;   // 1 == serial event loop
+  params.readAheadDepth = 0;    // 0 == synchronous input
+  params.writeBehindDepth = 0;  // 0 == synchronous output
 
   // Experimental setup:
   params.experimentalSetupUrn = "";  // "urn:snemo:demonstrator:setup:1.0";
@@ -39,10 +42,15 @@ FLReconstructParams FLReconstructParams::makeDefault() {
 
   // I/O:
   params.inputMetadataFile = "";
-  params.inputFile = "";
+  params.inputFiles.clear();
+  params.inputRange = RecordRange{};
   params.outputMetadataFile = "";
   params.embeddedMetadata = true;
   params.outputFile = "";
+  params.outputIndex = false;
+  params.packedBanks.clear();
+  params.compactHits = false;
+  params.profileReport = "";
   params.inputMetadata.reset();
   params.inputMetadata.set_key_label("name");
   params.inputMetadata.set_meta_label("type");
@@ -78,6 +86,9 @@ void FLReconstructParams::print(std::ostream& out_) const {
   out_ << tag << "userProfile                = " << userProfile << std::endl;
   out_ << tag << "numberOfEvents               = " << numberOfEvents << std::endl;
   out_ << tag << "moduloEvents                 = " << moduloEvents << std::endl;
+  out_ << tag << "numberOfThreads              = " << numberOfThreads << std::endl;
+  out_ << tag << "readAheadDepth               = " << readAheadDepth << std::endl;
+  out_ << tag << "writeBehindDepth             = " << writeBehindDepth << std::endl;
   out_ << tag << "experimentalSetupUrn         = " << experimentalSetupUrn << std::endl;
   out_ << tag << "reconstructionPipelineUrn    = " << reconstructionPipelineUrn << std::endl;
   out_ << tag << "reconstructionPipelineConfig = " << reconstructionPipelineConfig << std::endl;
@@ -89,11 +100,30 @@ void FLReconstructParams::print(std::ostream& out_) const {
   out_ << tag << "servicesSubsystemConfigUrn   = " << servicesSubsystemConfigUrn << std::endl;
   out_ << tag << "servicesSubsystemConfig      = " << servicesSubsystemConfig << std::endl;
   out_ << tag << "inputMetadataFile            = " << inputMetadataFile << std::endl;
-  out_ << tag << "inputFile                    = " << inputFile << std::endl;
+  out_ << tag << "inputFiles                   = ";
+  for (const std::string& inputFile : inputFiles) {
+    out_ << inputFile << ' ';
+  }
+  out_ << std::endl;
+  out_ << tag << "inputRange                   = [" << inputRange.first << ", ";
+  if (inputRange.last == RecordRange::kUnbounded) {
+    out_ << "end";
+  } else {
+    out_ << inputRange.last;
+  }
+  out_ << "), shard " << inputRange.shardIndex << '/' << inputRange.shardCount << std::endl;
   out_ << tag << "outputMetadataFile           = " << outputMetadataFile << std::endl;
   out_ << tag << "embeddedMetadata             = " << std::boolalpha << embeddedMetadata
        << std::endl;
-  out_ << last_tag << "outputFile                   = " << outputFile << std::endl;
+  out_ << tag << "outputFile                   = " << outputFile << std::endl;
+  out_ << tag << "outputIndex                  = " << std::boolalpha << outputIndex << std::endl;
+  out_ << tag << "packedBanks                  = ";
+  for (const std::string& packedBank : packedBanks) {
+    out_ << packedBank << ' ';
+  }
+  out_ << std::endl;
+  out_ << tag << "compactHits                  = " << std::boolalpha << compactHits << std::endl;
+  out_ << last_tag << "profileReport                = " << profileReport << std::endl;
 }
 
 }  // namespace FLReconstruct
@@ -17,6 +17,7 @@
 
 // Standard Library:
 #include <string>
+#include <vector>
 
 // Third Party
 // - Bayeux
@@ -24,6 +25,9 @@
 #include "bayeux/datatools/logger.h"
 #include "bayeux/datatools/multi_properties.h"
 
+// This project
+#include "FLReconstructRecordReader.h"
+
 namespace FLReconstruct {
 
 //! Collect all needed configuration parameters in one data structure
@@ -33,6 +37,9 @@ struct FLReconstructParams {
   std::string userProfile;               //!< User profile
   unsigned int numberOfEvents;           //!< Number of events to be processed in the pipeline
   unsigned int moduloEvents;             //!< Number of events progress modulo
+  unsigned int numberOfThreads;          //!< Number of event-parallel pipelines
+  unsigned int readAheadDepth;           //!< Number of input records decoded ahead (0: none)
+  unsigned int writeBehindDepth;         //!< Number of output records queued for writing (0: none)
 
   // Required experimental setup and versioning:
   std::string experimentalSetupUrn;  //!< The URN of the experimental setup
@@ -48,11 +55,16 @@ struct FLReconstructParams {
   std::string servicesSubsystemConfig;     //!< The main configuration file for the service manager
 
   // Reconstruction control:
-  std::string inputMetadataFile;   //!< Input metadata file
-  std::string inputFile;           //!< Input data file for the input module
-  std::string outputMetadataFile;  //!< Output metadata file
-  bool embeddedMetadata;           //!< Flag to embed metadata in the output data file
-  std::string outputFile;          //!< Output data file for the output module
+  std::string inputMetadataFile;         //!< Input metadata file
+  std::vector<std::string> inputFiles;   //!< Input data files, read in sequence
+  RecordRange inputRange;                //!< Input records to process
+  std::string outputMetadataFile;        //!< Output metadata file
+  bool embeddedMetadata;                 //!< Flag to embed metadata in the output data file
+  std::string outputFile;                //!< Output data file for the output module
+  bool outputIndex;                      //!< Flag to write a record index of the output file
+  std::vector<std::string> packedBanks;  //!< Labels of the banks written in packed form
+  bool compactHits;                      //!< Flag to write calibrated hits in compact form
+  std::string profileReport;             //!< Output file for the per-module profile report (JSON)
 
   // // Description of the data to be processed by the FLReconstruct script:
   // std::string dataType;              //!< The type of data ("Real", "MC")
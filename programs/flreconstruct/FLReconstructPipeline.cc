@@ -2,8 +2,13 @@
 #include "FLReconstructPipeline.h"
 
 // Standard Library
+#include <atomic>
 #include <exception>
+#include <fstream>
 #include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
 
 // Third Party
 // - Boost
@@ -23,12 +28,266 @@
 #include "bayeux/geomtools/manager.h"
 
 // This Project:
+#include "FLReconstructErrors.h"
+#include "FLReconstructEventQueues.h"
+#include "FLReconstructEventStreams.h"
 #include "FLReconstructImpl.h"
+#if defined(FLRECONSTRUCT_WITH_ALLOCATION_PROBE)
+#include "FLReconstructAllocationProbe.h"
+#endif
 #include "falaise/resource.h"
+#include "falaise/snemo/datamodels/hit_encoding.h"
+#include "falaise/snemo/datamodels/record_index.h"
+#include "falaise/snemo/processing/profiler.h"
 #include "falaise/snemo/services/services.h"
 
 namespace FLReconstruct {
 
+namespace {
+
+//! Load the processing modules requested by the user in the module manager
+void load_pipeline_modules(const FLReconstructParams& flRecParameters,
+                           dpp::module_manager& moduleManager) {
+  if (!flRecParameters.modulesConfig.empty()) {
+    moduleManager.load_modules(flRecParameters.modulesConfig);
+  } else {
+    // Hand configure a dumb dump module
+    datatools::properties dumbConfig;
+    dumbConfig.store("title", "flreconstruct::default");
+    dumbConfig.store("output", "cout");
+    moduleManager.load_module(flRecParameters.reconstructionPipelineModule, "dpp::dump_module",
+                              dumbConfig);
+  }
+}
+
+//! Check that the loaded modules can be copied to the workers of the event-parallel mode
+//!
+//! Each worker owns a copy of every module. The copies of an output module would
+//! each write the records of their worker, and the copies of a module drawing
+//! random numbers would all draw the same sequence, so that the output would
+//! depend on the number of workers. Such modules must reseed their generator
+//! for each event from its identifier (random.event_seeding). The output module
+//! of flreconstruct itself, named recOutputName, is fed by the calling thread only.
+void check_event_parallel_modules(const dpp::module_manager& moduleManager,
+                                  const std::string& recOutputName) {
+  for (const auto& entry : moduleManager.get_modules()) {
+    const std::string& moduleName = entry.first;
+    const std::string& moduleId = entry.second.get_module_id();
+    const datatools::properties& moduleConfig = entry.second.get_module_config();
+    if (moduleName == recOutputName) {
+      continue;
+    }
+    DT_THROW_IF(moduleId == "dpp::output_module" || moduleId == "Things2Root", FLConfigUserError,
+                "Output module '" << moduleName
+                                  << "' cannot be run by several threads, use the -o option!");
+    const bool drawsRandomNumbers = moduleId == "snemo::processing::mock_calorimeter_s2c_module" ||
+                                    moduleId == "snemo::processing::mock_tracker_s2c_module" ||
+                                    moduleConfig.has_key("random.seed");
+    const bool seedsEvents = moduleConfig.has_key("random.event_seeding") &&
+                             moduleConfig.fetch_boolean("random.event_seeding");
+    DT_THROW_IF(drawsRandomNumbers && !seedsEvents, FLConfigUserError,
+                "Module '" << moduleName << "' draws random numbers and cannot be run by several "
+                           << "threads unless 'random.event_seeding' is set!");
+  }
+}
+
+//! Run the event loop on the calling thread
+falaise::exit_code do_serial_event_loop(const FLReconstructParams& flRecParameters,
+                                        EventSource& recSource, dpp::base_module* pipeline,
+                                        EventSink& recSink) {
+  falaise::exit_code code = falaise::EXIT_OK;
+  std::unique_ptr<datatools::things> workItem;
+  std::size_t eventCounter = 0;
+  while (true) {
+    // Prepare and read work
+    EventSource::status readStatus = recSource.next(workItem);
+    if (readStatus == EventSource::END_OF_INPUT) {
+      break;
+    }
+    if (readStatus == EventSource::READ_ERROR) {
+      DT_LOG_FATAL(flRecParameters.logLevel, "Failed to read data record from input source");
+      code = falaise::EXIT_UNAVAILABLE;
+      break;
+    }
+
+    // Check pre-conditions on event model (requiredInputBanks) ?
+
+    // Feed through pipeline
+    dpp::base_module::process_status pStatus = pipeline->process(*workItem);
+    DT_THROW_IF(pStatus == dpp::base_module::PROCESS_INVALID, std::logic_error,
+                "Bug!!! Module '" << pipeline->get_name()
+                                  << "' did not return a valid processing status!");
+
+    // FATAL, ERROR and ERROR_STOP status triggers the abortion of the processing loop.
+    // This is a very conservative approach, but it is compatible with the default behaviour of
+    // the bxdpp_processing executable.
+    if (pStatus == dpp::base_module::PROCESS_FATAL) {
+      code = falaise::EXIT_UNAVAILABLE;
+      break;
+    }
+    if (pStatus == dpp::base_module::PROCESS_ERROR) {
+      code = falaise::EXIT_UNAVAILABLE;
+      break;
+    }
+    if (pStatus == dpp::base_module::PROCESS_ERROR_STOP) {
+      code = falaise::EXIT_UNAVAILABLE;
+      break;
+    }
+
+    // STOP means the current event should not be processed anymore nor saved
+    // but the loop can continue with other items
+    if (pStatus == dpp::base_module::PROCESS_STOP) {
+      continue;
+    }
+
+    // Check post-conditions on event model (expectedOutputBanks) ?
+
+    // Write item
+    if (!recSink.write(std::move(workItem))) {
+      DT_LOG_FATAL(flRecParameters.logLevel, "Failed to write data record to output sink");
+      code = falaise::EXIT_UNAVAILABLE;
+      break;
+    }
+    if (flRecParameters.moduloEvents > 0) {
+      if (eventCounter % flRecParameters.moduloEvents == 0) {
+        DT_LOG_NOTICE(datatools::logger::PRIO_NOTICE, "Event #" << eventCounter);
+      }
+    }
+    eventCounter++;
+    if (flRecParameters.numberOfEvents > 0 && eventCounter > flRecParameters.numberOfEvents) {
+      break;
+    }
+  }
+  return code;
+}
+
+//! Event record travelling from a worker pipeline to the output stage
+struct ProcessedEvent {
+  std::unique_ptr<datatools::things> record;
+  dpp::base_module::process_status status = dpp::base_module::PROCESS_INVALID;
+};
+
+//! Run the event loop with one worker thread per pipeline instance
+//!
+//! A dispatcher thread feeds the records from the input source to the workers,
+//! and the calling thread submits the processed records to the output sink in
+//! input order so that the output is identical to the one of the serial loop.
+falaise::exit_code do_parallel_event_loop(const FLReconstructParams& flRecParameters,
+                                          EventSource& recSource,
+                                          const std::vector<dpp::base_module*>& pipelines,
+                                          EventSink& recSink) {
+  using InputEvent = std::pair<std::size_t, std::unique_ptr<datatools::things>>;
+  BoundedQueue<InputEvent> inputQueue{2 * pipelines.size()};
+  ReorderBuffer<ProcessedEvent> outputBuffer{4 * pipelines.size()};
+  std::atomic<bool> readFailed{false};
+
+  std::thread dispatcher{[&]() {
+    std::size_t sequence = 0;
+    try {
+      while (outputBuffer.reserve(sequence)) {
+        std::unique_ptr<datatools::things> record;
+        EventSource::status readStatus = recSource.next(record);
+        if (readStatus != EventSource::RECORD_OK) {
+          readFailed = (readStatus == EventSource::READ_ERROR);
+          break;
+        }
+        if (!inputQueue.push(std::make_pair(sequence, std::move(record)))) {
+          break;
+        }
+        ++sequence;
+      }
+    } catch (...) {
+      readFailed = true;
+    }
+    inputQueue.close();
+    outputBuffer.finish(sequence);
+  }};
+
+  std::vector<std::thread> workers;
+  for (dpp::base_module* pipeline : pipelines) {
+    workers.emplace_back([&, pipeline]() {
+      InputEvent job;
+      while (inputQueue.pop(job)) {
+        ProcessedEvent result;
+        result.record = std::move(job.second);
+        try {
+          result.status = pipeline->process(*result.record);
+        } catch (std::exception& e) {
+          DT_LOG_FATAL(flRecParameters.logLevel,
+                       "Module '" << pipeline->get_name() << "' threw exception: " << e.what());
+          result.status = dpp::base_module::PROCESS_FATAL;
+        } catch (...) {
+          DT_LOG_FATAL(flRecParameters.logLevel,
+                       "Module '" << pipeline->get_name() << "' threw unknown exception");
+          result.status = dpp::base_module::PROCESS_FATAL;
+        }
+        outputBuffer.insert(job.first, std::move(result));
+      }
+    });
+  }
+
+  falaise::exit_code code = falaise::EXIT_OK;
+  bool drained = true;
+  std::size_t eventCounter = 0;
+  ProcessedEvent item;
+  while (outputBuffer.pop(item)) {
+    dpp::base_module::process_status pStatus = item.status;
+    if (pStatus == dpp::base_module::PROCESS_INVALID) {
+      DT_LOG_FATAL(flRecParameters.logLevel,
+                   "Bug!!! Pipeline module did not return a valid processing status!");
+      code = falaise::EXIT_UNAVAILABLE;
+      drained = false;
+      break;
+    }
+
+    // Same abortion policy as the serial loop
+    if (pStatus == dpp::base_module::PROCESS_FATAL || pStatus == dpp::base_module::PROCESS_ERROR ||
+        pStatus == dpp::base_module::PROCESS_ERROR_STOP) {
+      code = falaise::EXIT_UNAVAILABLE;
+      drained = false;
+      break;
+    }
+
+    if (pStatus == dpp::base_module::PROCESS_STOP) {
+      continue;
+    }
+
+    if (!recSink.write(std::move(item.record))) {
+      DT_LOG_FATAL(flRecParameters.logLevel, "Failed to write data record to output sink");
+      code = falaise::EXIT_UNAVAILABLE;
+      drained = false;
+      break;
+    }
+    if (flRecParameters.moduloEvents > 0) {
+      if (eventCounter % flRecParameters.moduloEvents == 0) {
+        DT_LOG_NOTICE(datatools::logger::PRIO_NOTICE, "Event #" << eventCounter);
+      }
+    }
+    eventCounter++;
+    if (flRecParameters.numberOfEvents > 0 && eventCounter > flRecParameters.numberOfEvents) {
+      drained = false;
+      break;
+    }
+  }
+
+  // Release the dispatcher and the workers, whatever the reason to stop
+  inputQueue.close();
+  outputBuffer.cancel();
+  dispatcher.join();
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+
+  // A read failure only matters if the serial loop would have reached it
+  if (drained && readFailed) {
+    DT_LOG_FATAL(flRecParameters.logLevel, "Failed to read data record from input source");
+    code = falaise::EXIT_UNAVAILABLE;
+  }
+  return code;
+}
+
+}  // namespace
+
 //! Configure and run the pipeline
 falaise::exit_code do_pipeline(const FLReconstructParams& flRecParameters) {
   DT_LOG_TRACE_ENTERING(flRecParameters.logLevel);
@@ -55,6 +314,15 @@ falaise::exit_code do_pipeline(const FLReconstructParams& flRecParameters) {
     return falaise::EXIT_UNAVAILABLE;
   }
 
+  // Profiling support:
+  falaise::processing::profiler& moduleProfiler = falaise::processing::profiler::instance();
+  if (!flRecParameters.profileReport.empty()) {
+#if defined(FLRECONSTRUCT_WITH_ALLOCATION_PROBE)
+    moduleProfiler.set_allocation_probe(&current_thread_allocations);
+#endif
+    moduleProfiler.set_enabled(true);
+  }
+
   // - Run:
   falaise::exit_code code = falaise::EXIT_OK;
   try {
@@ -99,19 +367,11 @@ falaise::exit_code do_pipeline(const FLReconstructParams& flRecParameters) {
     DT_LOG_DEBUG(flRecParameters.logLevel, "Service manager is now plugged in the module manager.");
 
     // Configure the modules themselves
-    if (!flRecParameters.modulesConfig.empty()) {
-      moduleManager->load_modules(flRecParameters.modulesConfig);
-    } else {
-      // Hand configure a dumb dump module
-      datatools::properties dumbConfig;
-      dumbConfig.store("title", "flreconstruct::default");
-      dumbConfig.store("output", "cout");
-      moduleManager->load_module(flRecParameters.reconstructionPipelineModule, "dpp::dump_module",
-                                 dumbConfig);
-    }
+    load_pipeline_modules(flRecParameters, *moduleManager);
 
     datatools::library_loader altLibLoader;
     // Load a Things2Root module in the manager before initialization
+    const std::string t2rOutputName{"t2rRecOutput"};
     if (!flRecParameters.outputFile.empty()) {
       DT_LOG_DEBUG(flRecParameters.logLevel, "Configuring the output module...");
       if (boost::algorithm::ends_with(flRecParameters.outputFile, ".root")) {
@@ -120,24 +380,17 @@ falaise::exit_code do_pipeline(const FLReconstructParams& flRecParameters) {
         DT_LOG_DEBUG(flRecParameters.logLevel, "using ROOT format for output");
         datatools::properties t2rConfig;
         t2rConfig.store("output_file", flRecParameters.outputFile);
-        moduleManager->load_module("t2rRecOutput", "Things2Root", t2rConfig);
+        moduleManager->load_module(t2rOutputName, "Things2Root", t2rConfig);
       }
     }
 
     // Plain initialization:
     moduleManager->initialize_simple();
 
-    // Input module...
-    std::unique_ptr<dpp::input_module> recInput(new dpp::input_module);
-    DT_LOG_DEBUG(flRecParameters.logLevel, "Configuring the input module...");
-    recInput->set_logging_priority(flRecParameters.logLevel);
-    recInput->set_single_input_file(flRecParameters.inputFile);
-    recInput->initialize_simple();
-
-    DT_LOG_DEBUG(flRecParameters.logLevel,
-                 "Number of entries  = " << recInput->get_source().get_number_of_entries());
-    DT_LOG_DEBUG(flRecParameters.logLevel,
-                 "Number of metadata = " << recInput->get_source().get_number_of_metadata());
+    // Input records...
+    DT_LOG_DEBUG(flRecParameters.logLevel, "Configuring the input files...");
+    RecordReader recInput{flRecParameters.inputFiles, flRecParameters.inputRange,
+                          flRecParameters.logLevel};
 
     // Output metadata management:
     DT_LOG_DEBUG(flRecParameters.logLevel, "Building output metadata...");
@@ -157,12 +410,29 @@ falaise::exit_code do_pipeline(const FLReconstructParams& flRecParameters) {
       return falaise::EXIT_UNAVAILABLE;
     }
 
+    // Event-parallel mode: each extra worker owns an independent copy of the
+    // pipeline modules. Only the first manager holds the output module.
+    if (flRecParameters.numberOfThreads > 1) {
+      check_event_parallel_modules(*moduleManager, t2rOutputName);
+    }
+    std::vector<std::unique_ptr<dpp::module_manager>> workerManagers;
+    std::vector<dpp::base_module*> pipelines{pipeline};
+    for (unsigned int i = 1; i < flRecParameters.numberOfThreads; i++) {
+      DT_LOG_DEBUG(flRecParameters.logLevel, "Configuring the module manager of worker #" << i);
+      std::unique_ptr<dpp::module_manager> workerManager(new dpp::module_manager);
+      workerManager->set_service_manager(recServices);
+      load_pipeline_modules(flRecParameters, *workerManager);
+      workerManager->initialize_simple();
+      pipelines.push_back(&(workerManager->grab(flRecParameters.reconstructionPipelineModule)));
+      workerManagers.push_back(std::move(workerManager));
+    }
+
     // Output module... only if added in the module manager
     dpp::base_module* recOutputHandle = nullptr;
     std::unique_ptr<dpp::output_module> flRecOutput;
-    if (moduleManager->has("t2rRecOutput")) {
+    if (moduleManager->has(t2rOutputName)) {
       // We instantiate and fetch the t2r module from the manager
-      recOutputHandle = &moduleManager->grab("t2rRecOutput");
+      recOutputHandle = &moduleManager->grab(t2rOutputName);
     } else if (!flRecParameters.outputFile.empty()) {
       // We try to setup an output module
       flRecOutput.reset(new dpp::output_module);
@@ -179,83 +449,72 @@ falaise::exit_code do_pipeline(const FLReconstructParams& flRecParameters) {
       recOutputHandle = flRecOutput.get();
     }
 
+    // Index of the output records, for brio and Boost archive output files
+    std::unique_ptr<snemo::datamodel::record_index> outputIndex;
+    if (flRecParameters.outputIndex) {
+      if (flRecOutput) {
+        outputIndex.reset(new snemo::datamodel::record_index);
+      } else {
+        DT_LOG_WARNING(flRecParameters.logLevel, "No record index is written for this output");
+      }
+    }
+
     if (!flRecParameters.outputMetadataFile.empty()) {
       std::string fMetadata = flRecParameters.outputMetadataFile;
       datatools::fetch_path_with_env(fMetadata);
       flRecMetadata.write(fMetadata);
     }
 
+    snemo::datamodel::set_compact_hit_encoding(flRecParameters.compactHits);
+
     // - Now the actual event loop
     DT_LOG_DEBUG(flRecParameters.logLevel, "begin event loop");
-    datatools::things workItem;
-    std::size_t eventCounter = 0;
-    while (true) {
-      // Prepare and read work
-      workItem.clear();
-      if (recInput->is_terminated()) {
-        break;
-      }
-      if (recInput->process(workItem) != dpp::base_module::PROCESS_OK) {
-        DT_LOG_FATAL(flRecParameters.logLevel, "Failed to read data record from input source");
-        code = falaise::EXIT_UNAVAILABLE;
-        break;
-      }
-
-      // Check pre-conditions on event model (requiredInputBanks) ?
-
-      // Feed through pipeline
-      dpp::base_module::process_status pStatus = pipeline->process(workItem);
-      DT_THROW_IF(pStatus == dpp::base_module::PROCESS_INVALID, std::logic_error,
-                  "Bug!!! Module '" << pipeline->get_name()
-                                    << "' did not return a valid processing status!");
-
-      // FATAL, ERROR and ERROR_STOP status triggers the abortion of the processing loop.
-      // This is a very conservative approach, but it is compatible with the default behaviour of
-      // the bxdpp_processing executable.
-      if (pStatus == dpp::base_module::PROCESS_FATAL) {
-        code = falaise::EXIT_UNAVAILABLE;
-        break;
-      }
-      if (pStatus == dpp::base_module::PROCESS_ERROR) {
-        code = falaise::EXIT_UNAVAILABLE;
-        break;
+    {
+      EventSource recSource{recInput, flRecParameters.readAheadDepth};
+      EventSink recSink{recOutputHandle, flRecParameters.writeBehindDepth, outputIndex.get(),
+                        flRecParameters.packedBanks};
+      if (pipelines.size() > 1) {
+        DT_LOG_NOTICE(flRecParameters.logLevel,
+                      "Running " << pipelines.size() << " event-parallel pipelines");
+        code = do_parallel_event_loop(flRecParameters, recSource, pipelines, recSink);
+      } else {
+        code = do_serial_event_loop(flRecParameters, recSource, pipeline, recSink);
       }
-      if (pStatus == dpp::base_module::PROCESS_ERROR_STOP) {
+      recSource.stop();
+      // Flush records still waiting to be written
+      if (!recSink.close() && code == falaise::EXIT_OK) {
+        DT_LOG_FATAL(flRecParameters.logLevel, "Failed to write data record to output sink");
         code = falaise::EXIT_UNAVAILABLE;
-        break;
-      }
-
-      // STOP means the current event should not be processed anymore nor saved
-      // but the loop can continue with other items
-      if (pStatus == dpp::base_module::PROCESS_STOP) {
-        continue;
       }
+    }
+    DT_LOG_DEBUG(flRecParameters.logLevel, "event loop completed");
 
-      // Check post-conditions on event model (expectedOutputBanks) ?
+    if (outputIndex && code == falaise::EXIT_OK) {
+      // The index records the size of the complete output file
+      flRecOutput->reset();
+      outputIndex->write(flRecParameters.outputFile);
+    }
 
-      // Write item
-      if (recOutputHandle != nullptr) {
-        pStatus = recOutputHandle->process(workItem);
-        if (pStatus != dpp::base_module::PROCESS_OK) {
-          DT_LOG_FATAL(flRecParameters.logLevel, "Failed to write data record to output sink");
-          code = falaise::EXIT_UNAVAILABLE;
-          break;
-        }
-      }
-      if (flRecParameters.moduloEvents > 0) {
-        if (eventCounter % flRecParameters.moduloEvents == 0) {
-          DT_LOG_NOTICE(datatools::logger::PRIO_NOTICE, "Event #" << eventCounter);
-        }
-      }
-      eventCounter++;
-      if (flRecParameters.numberOfEvents > 0 && eventCounter > flRecParameters.numberOfEvents) {
-        break;
+    if (!flRecParameters.profileReport.empty()) {
+      moduleProfiler.set_enabled(false);
+      std::string fProfile = flRecParameters.profileReport;
+      datatools::fetch_path_with_env(fProfile);
+      std::ofstream profileStream(fProfile);
+      moduleProfiler.write_json(profileStream);
+      if (!profileStream) {
+        DT_LOG_ERROR(flRecParameters.logLevel,
+                     "Failed to write module profile report to '" << fProfile << "'");
       }
     }
-    DT_LOG_DEBUG(flRecParameters.logLevel, "event loop completed");
 
     // - MUST delete the module manager BEFORE the library loader clears
     // in case the manager is holding resources created from a shared lib
+    for (auto& workerManager : workerManagers) {
+      if (workerManager->is_initialized()) {
+        workerManager->reset();
+      }
+    }
+    workerManagers.clear();
     if (moduleManager != nullptr) {
       if (moduleManager->is_initialized()) {
         moduleManager->reset();
@@ -267,6 +526,9 @@ falaise::exit_code do_pipeline(const FLReconstructParams& flRecParameters) {
     recServices.reset();
     DT_LOG_DEBUG(flRecParameters.logLevel, "Reconstruction services are stopped");
 
+  } catch (FLConfigUserError& e) {
+    std::cerr << "User configuration error: " << e.what() << std::endl;
+    code = falaise::EXIT_USAGE;
   } catch (std::exception& e) {
     std::cerr << "flreconstruct : Setup/run of simulation threw exception" << std::endl;
     std::cerr << e.what() << std::endl;
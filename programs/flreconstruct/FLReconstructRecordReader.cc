@@ -0,0 +1,244 @@
+// Ourselves
+#include "FLReconstructRecordReader.h"
+
+// Standard Library
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+
+// POSIX
+#include <glob.h>
+
+// Third Party
+// - Boost
+#include <boost/lexical_cast.hpp>
+// - Bayeux
+#include "bayeux/datatools/exception.h"
+#include "bayeux/datatools/utils.h"
+#include "bayeux/dpp/base_module.h"
+#include "bayeux/dpp/i_data_source.h"
+// - Falaise
+#include "falaise/snemo/datamodels/record_index.h"
+
+namespace FLReconstruct {
+
+namespace {
+//! Parse an unsigned integer, all characters of text being digits
+bool parse_index(const std::string& text, uint64_t& value) {
+  if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos) {
+    return false;
+  }
+  try {
+    value = boost::lexical_cast<uint64_t>(text);
+  } catch (boost::bad_lexical_cast&) {
+    return false;
+  }
+  return true;
+}
+
+//! Return the number of records in an opened input module, or -1 if unknown
+//! Sources which do not know it, like Boost archives, may have a record index
+int64_t number_of_records(const dpp::input_module& input, const std::string& file) {
+  int64_t records = input.get_source().get_number_of_entries();
+  if (records < 0) {
+    snemo::datamodel::record_index index;
+    if (index.read(file)) {
+      records = static_cast<int64_t>(index.size());
+    }
+  }
+  return records;
+}
+}  // namespace
+
+constexpr uint64_t RecordRange::kUnbounded;
+
+std::pair<uint64_t, uint64_t> RecordRange::resolve(uint64_t total) const {
+  const uint64_t begin = std::min(first, total);
+  const uint64_t end = std::max(begin, std::min(last, total));
+  // The first (size % shardCount) shards hold one more record than the others
+  const uint64_t size = end - begin;
+  const uint64_t quotient = size / shardCount;
+  const uint64_t remainder = size % shardCount;
+  const uint64_t shardBegin =
+      begin + shardIndex * quotient + std::min<uint64_t>(shardIndex, remainder);
+  const uint64_t shardSize = quotient + (shardIndex < remainder ? 1 : 0);
+  return std::make_pair(shardBegin, shardBegin + shardSize);
+}
+
+bool parse_record_range(const std::string& text, RecordRange& range) {
+  const std::size_t colon = text.find(':');
+  if (colon == std::string::npos) {
+    return false;
+  }
+  const std::string firstText = text.substr(0, colon);
+  const std::string lastText = text.substr(colon + 1);
+  uint64_t first = 0;
+  uint64_t last = RecordRange::kUnbounded;
+  if (!firstText.empty() && !parse_index(firstText, first)) {
+    return false;
+  }
+  if (!lastText.empty() && !parse_index(lastText, last)) {
+    return false;
+  }
+  if (last < first) {
+    return false;
+  }
+  range.first = first;
+  range.last = last;
+  return true;
+}
+
+bool parse_record_shard(const std::string& text, RecordRange& range) {
+  const std::size_t slash = text.find('/');
+  if (slash == std::string::npos) {
+    return false;
+  }
+  uint64_t index = 0;
+  uint64_t count = 0;
+  if (!parse_index(text.substr(0, slash), index) || !parse_index(text.substr(slash + 1), count)) {
+    return false;
+  }
+  if (count == 0 || index >= count || count > std::numeric_limits<uint32_t>::max()) {
+    return false;
+  }
+  range.shardIndex = static_cast<uint32_t>(index);
+  range.shardCount = static_cast<uint32_t>(count);
+  return true;
+}
+
+std::vector<std::string> expand_input_files(const std::vector<std::string>& patterns) {
+  std::vector<std::string> files;
+  for (const std::string& pattern : patterns) {
+    if (pattern.find_first_of("*?[") == std::string::npos) {
+      files.push_back(pattern);
+      continue;
+    }
+    std::string path = pattern;
+    datatools::fetch_path_with_env(path);
+    glob_t matches;
+    if (::glob(path.c_str(), 0, nullptr, &matches) == 0) {
+      // Matches are sorted, so that numbered files are read in order
+      for (std::size_t i = 0; i < matches.gl_pathc; ++i) {
+        files.emplace_back(matches.gl_pathv[i]);
+      }
+    } else {
+      files.push_back(pattern);
+    }
+    ::globfree(&matches);
+  }
+  return files;
+}
+
+RecordReader::RecordReader(std::vector<std::string> files, const RecordRange& range,
+                           datatools::logger::priority logLevel)
+    : files_(std::move(files)), logLevel_(logLevel) {
+  DT_THROW_IF(files_.empty(), std::logic_error, "No input file!");
+  uint64_t total = RecordRange::kUnbounded;
+  if (range.is_sharded()) {
+    // Shards are located from the total number of records, read from the file headers
+    total = 0;
+    for (const std::string& file : files_) {
+      dpp::input_module input;
+      input.set_logging_priority(logLevel_);
+      input.set_single_input_file(file);
+      input.initialize_simple();
+      const int64_t records = number_of_records(input, file);
+      input.reset();
+      DT_THROW_IF(records < 0, std::logic_error,
+                  "Cannot shard input file '" << file << "' with an unknown number of records!");
+      total += records;
+    }
+  }
+  std::tie(first_, last_) = range.resolve(total);
+  DT_LOG_DEBUG(logLevel_, "Reading input records [" << first_ << ", " << last_ << ")");
+}
+
+RecordReader::~RecordReader() { close_file(); }
+
+bool RecordReader::is_terminated() {
+  while (position_ < last_) {
+    if (pending_) {
+      return false;
+    }
+    if (input_ && position_ < fileEnd_ && !input_->is_terminated()) {
+      return false;
+    }
+    if (!open_next_file()) {
+      return true;
+    }
+  }
+  return true;
+}
+
+bool RecordReader::read(std::unique_ptr<datatools::things>& record) {
+  if (pending_) {
+    record = std::move(pending_);
+  } else {
+    record.reset(new datatools::things);
+    if (input_->process(*record) != dpp::base_module::PROCESS_OK) {
+      return false;
+    }
+  }
+  ++position_;
+  return true;
+}
+
+bool RecordReader::open_next_file() {
+  close_file();
+  if (nextFile_ == files_.size()) {
+    return false;
+  }
+  const std::string& file = files_[nextFile_++];
+  input_.reset(new dpp::input_module);
+  input_->set_logging_priority(logLevel_);
+  input_->set_single_input_file(file);
+  input_->initialize_simple();
+
+  const int64_t records = number_of_records(*input_, file);
+  DT_LOG_DEBUG(logLevel_, "Input file '" << file << "' holds " << records << " records");
+  const bool countKnown = records >= 0;
+  fileEnd_ = countKnown ? position_ + records : RecordRange::kUnbounded;
+  if (position_ >= first_) {
+    return true;
+  }
+
+  // Skip whole files from their number of records only
+  if (fileEnd_ <= first_) {
+    position_ = fileEnd_;
+    close_file();
+    return true;
+  }
+
+  // Load the first record of the range by index. The source then reads on
+  // sequentially from there
+  const uint64_t entry = first_ - position_;
+  dpp::i_data_source& source = input_->grab_source();
+  if (countKnown && source.is_random() && source.can_load_record(static_cast<int64_t>(entry))) {
+    pending_.reset(new datatools::things);
+    DT_THROW_IF(!source.load_record(*pending_, static_cast<int64_t>(entry)), std::runtime_error,
+                "Cannot load record #" << entry << " of input file '" << file << "'!");
+    position_ = first_;
+    return true;
+  }
+
+  // Otherwise read and discard the records before the range
+  datatools::things discarded;
+  while (position_ < first_ && !input_->is_terminated()) {
+    discarded.clear();
+    DT_THROW_IF(input_->process(discarded) != dpp::base_module::PROCESS_OK, std::runtime_error,
+                "Cannot read input file '" << file << "'!");
+    ++position_;
+  }
+  return true;
+}
+
+void RecordReader::close_file() {
+  pending_.reset();
+  if (input_ && input_->is_initialized()) {
+    input_->reset();
+  }
+  input_.reset();
+  fileEnd_ = RecordRange::kUnbounded;
+}
+
+}  // namespace FLReconstruct
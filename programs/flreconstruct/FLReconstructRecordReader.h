@@ -0,0 +1,121 @@
+// FLReconstructRecordReader.h - Selection of the input records read by FLReconstruct
+//
+// Distributed under the OSI-approved BSD 3-Clause License (the "License");
+// see accompanying file License.txt for details.
+//
+// This software is distributed WITHOUT ANY WARRANTY; without even the
+// implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the License for more information.
+
+#ifndef FLRECONSTRUCTRECORDREADER_H
+#define FLRECONSTRUCTRECORDREADER_H
+
+// Standard Library:
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Third Party
+// - Bayeux
+#include "bayeux/datatools/logger.h"
+#include "bayeux/datatools/things.h"
+#include "bayeux/dpp/input_module.h"
+
+namespace FLReconstruct {
+
+//! \brief Slice of the records of the concatenated input files
+//!
+//! Records are numbered from 0 across all input files, in file order. The
+//! range [first, last) is selected first, then split into shardCount
+//! contiguous shards of (nearly) equal size, of which shard shardIndex is
+//! read.
+struct RecordRange {
+  static constexpr uint64_t kUnbounded = std::numeric_limits<uint64_t>::max();
+
+  uint64_t first = 0;          //!< Index of the first selected record
+  uint64_t last = kUnbounded;  //!< Index past the last selected record
+  uint32_t shardIndex = 0;     //!< Index of the shard to read
+  uint32_t shardCount = 1;     //!< Number of shards the range is split into
+
+  //! Return true if all records are selected
+  bool is_complete() const { return first == 0 && last == kUnbounded && shardCount == 1; }
+
+  //! Return true if the number of input records is needed to locate the slice
+  bool is_sharded() const { return shardCount > 1; }
+
+  //! Return the [first, last) indices of the records to read among total records
+  std::pair<uint64_t, uint64_t> resolve(uint64_t total) const;
+};
+
+//! Parse a "a:b" range of record indices into range, either bound being optional
+//! Return false if the text is malformed
+bool parse_record_range(const std::string& text, RecordRange& range);
+
+//! Parse a "i/n" shard specification into range
+//! Return false if the text is malformed or i is not less than n
+bool parse_record_shard(const std::string& text, RecordRange& range);
+
+//! Return the input files named by patterns, in order, expanding shell wildcards
+//! Patterns matching no file are kept as is, so that opening them reports the error
+std::vector<std::string> expand_input_files(const std::vector<std::string>& patterns);
+
+//! \brief Reader of a range of records over a list of input files
+//!
+//! Each input file is read through its own input module, opened when the
+//! previous one is exhausted. Files entirely before the range are skipped
+//! from their number of records only. Within a file, the first record of
+//! the range is loaded directly by index if the data source supports random
+//! access (brio files), otherwise the preceding records are read and
+//! discarded.
+class RecordReader {
+ public:
+  RecordReader(std::vector<std::string> files, const RecordRange& range,
+               datatools::logger::priority logLevel);
+  ~RecordReader();
+
+  RecordReader(const RecordReader&) = delete;
+  RecordReader& operator=(const RecordReader&) = delete;
+
+  //! Return true once all records of the range have been read
+  bool is_terminated();
+
+  //! Read the next record into a new container. Return false on a read error
+  bool read(std::unique_ptr<datatools::things>& record);
+
+  //! Return the index of the first record of the range
+  uint64_t first() const { return first_; }
+
+  //! Return the index past the last record of the range
+  uint64_t last() const { return last_; }
+
+ private:
+  //! Open the next input file and move to the first record of the range in it
+  //! Return false if there is no more file, throw if a file cannot be read
+  bool open_next_file();
+
+  //! Close the current input file
+  void close_file();
+
+  std::vector<std::string> files_;              //!< Input files, in reading order
+  datatools::logger::priority logLevel_;        //!< Logging priority threshold
+  uint64_t first_ = 0;                          //!< Index of the first record of the range
+  uint64_t last_ = RecordRange::kUnbounded;     //!< Index past the last record of the range
+  std::size_t nextFile_ = 0;                    //!< Index of the next file to open
+  std::unique_ptr<dpp::input_module> input_;    //!< Input module of the current file
+  uint64_t position_ = 0;                       //!< Index of the next record
+  uint64_t fileEnd_ = RecordRange::kUnbounded;  //!< Index past the last record of the file
+  std::unique_ptr<datatools::things> pending_;  //!< Record loaded by index, not yet read
+};
+
+}  // namespace FLReconstruct
+
+#endif  // FLRECONSTRUCTRECORDREADER_H
+
+// Local Variables: --
+// mode: c++ --
+// c-file-style: "gnu" --
+// tab-width: 2 --
+// End: --
@@ -0,0 +1,92 @@
+// compareRecords - check that two data files hold the same event records
+//
+// Usage: compareRecords <file> <file>
+//
+// Records are read in turn from both files and compared through their portable
+// binary serialization, so that a difference in any bank is found. The first
+// different record is reported and the program exits with a non-zero code.
+
+// Standard Library
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// Third Party
+// - Bayeux
+#include "bayeux/datatools/eos/portable_oarchive.hpp"
+#include "bayeux/datatools/things.h"
+#include "bayeux/dpp/input_module.h"
+
+// This Project
+#include "falaise/falaise.h"
+
+namespace {
+//! Serialize the next record of an input into bytes, return false at the end of the input
+bool next_record(dpp::input_module& input, std::string& bytes) {
+  if (input.is_terminated()) {
+    return false;
+  }
+  datatools::things record;
+  if (input.process(record) != dpp::base_module::PROCESS_OK) {
+    return false;
+  }
+  std::ostringstream out(std::ios::out | std::ios::binary);
+  {
+    eos::portable_oarchive archive(out);
+    const datatools::things& constRecord = record;
+    archive << constRecord;
+  }
+  bytes = out.str();
+  return true;
+}
+
+int compare_records(const std::string& firstFile, const std::string& secondFile) {
+  dpp::input_module first;
+  first.set_single_input_file(firstFile);
+  first.initialize_simple();
+  dpp::input_module second;
+  second.set_single_input_file(secondFile);
+  second.initialize_simple();
+
+  std::string firstBytes;
+  std::string secondBytes;
+  uint64_t record = 0;
+  while (true) {
+    const bool hasFirst = next_record(first, firstBytes);
+    const bool hasSecond = next_record(second, secondBytes);
+    if (!hasFirst && !hasSecond) {
+      break;
+    }
+    if (hasFirst != hasSecond) {
+      const std::string& shorterFile = hasFirst ? secondFile : firstFile;
+      std::cerr << "compareRecords: '" << shorterFile << "' ends at record #" << record << std::endl;
+      return 1;
+    }
+    if (firstBytes != secondBytes) {
+      std::cerr << "compareRecords: record #" << record << " differs" << std::endl;
+      return 1;
+    }
+    ++record;
+  }
+  std::cout << "compareRecords: " << record << " identical records" << std::endl;
+  return 0;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  if (argc != 3) {
+    std::cerr << "usage: compareRecords <file> <file>" << std::endl;
+    return 2;
+  }
+  falaise::initialize(argc, argv);
+  int code = 1;
+  try {
+    code = compare_records(argv[1], argv[2]);
+  } catch (std::exception& e) {
+    std::cerr << "compareRecords: " << e.what() << std::endl;
+  }
+  falaise::terminate();
+  return code;
+}
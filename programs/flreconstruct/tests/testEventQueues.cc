@@ -0,0 +1,105 @@
+//! \file testEventQueues.cc
+//! \brief Tests for the queues of the flreconstruct event loop
+//
+// This file is part of Falaise.
+//
+// Falaise is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Falaise is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Falaise.  If not, see <http://www.gnu.org/licenses/>.
+
+// Standard Library
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Third Party
+#include "catch.hpp"
+
+// This Project
+#include "FLReconstructEventQueues.h"
+
+TEST_CASE("Bounded queue is FIFO and drains after close", "") {
+  FLReconstruct::BoundedQueue<std::unique_ptr<int>> q{4};
+  for (int i = 0; i < 4; ++i) {
+    REQUIRE(q.push(std::unique_ptr<int>{new int{i}}));
+  }
+  q.close();
+  REQUIRE_FALSE(q.push(std::unique_ptr<int>{new int{4}}));
+
+  std::unique_ptr<int> item;
+  for (int i = 0; i < 4; ++i) {
+    REQUIRE(q.pop(item));
+    REQUIRE(*item == i);
+  }
+  REQUIRE_FALSE(q.pop(item));
+}
+
+TEST_CASE("Reorder buffer restores input order", "") {
+  const std::size_t nItems = 1000;
+  const std::size_t nWorkers = 4;
+  FLReconstruct::BoundedQueue<std::size_t> work{2 * nWorkers};
+  FLReconstruct::ReorderBuffer<std::size_t> order{4 * nWorkers};
+
+  std::thread producer{[&]() {
+    for (std::size_t i = 0; i < nItems; ++i) {
+      if (!order.reserve(i) || !work.push(std::size_t{i})) {
+        break;
+      }
+    }
+    work.close();
+    order.finish(nItems);
+  }};
+
+  std::vector<std::thread> workers;
+  for (std::size_t w = 0; w < nWorkers; ++w) {
+    workers.emplace_back([&]() {
+      std::size_t seq = 0;
+      while (work.pop(seq)) {
+        // Spread completion times so items arrive out of order
+        std::this_thread::sleep_for(std::chrono::microseconds((seq * 7919) % 50));
+        order.insert(seq, std::size_t{seq});
+      }
+    });
+  }
+
+  std::vector<std::size_t> results;
+  std::size_t item = 0;
+  while (order.pop(item)) {
+    results.push_back(item);
+  }
+
+  producer.join();
+  for (auto& w : workers) {
+    w.join();
+  }
+
+  REQUIRE(results.size() == nItems);
+  for (std::size_t i = 0; i < nItems; ++i) {
+    REQUIRE(results[i] == i);
+  }
+}
+
+TEST_CASE("Reorder buffer cancellation releases producer", "") {
+  FLReconstruct::ReorderBuffer<int> order{2};
+  REQUIRE(order.reserve(0));
+  REQUIRE(order.reserve(1));
+
+  bool reserved = true;
+  std::thread producer{[&]() { reserved = order.reserve(2); }};
+  order.cancel();
+  producer.join();
+  REQUIRE_FALSE(reserved);
+
+  int item = 0;
+  REQUIRE_FALSE(order.pop(item));
+}
@@ -0,0 +1,99 @@
+//! \file testRecordRange.cc
+//! \brief Tests for the selection of the input records of flreconstruct
+//
+// This file is part of Falaise.
+//
+// Falaise is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// Falaise is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Falaise.  If not, see <http://www.gnu.org/licenses/>.
+
+// Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+// Third Party
+#include "catch.hpp"
+
+// This Project
+#include "FLReconstructRecordReader.h"
+
+using FLReconstruct::RecordRange;
+
+TEST_CASE("Record ranges are parsed with optional bounds", "") {
+  RecordRange range;
+  REQUIRE(FLReconstruct::parse_record_range("10:20", range));
+  REQUIRE(range.first == 10);
+  REQUIRE(range.last == 20);
+
+  REQUIRE(FLReconstruct::parse_record_range(":5", range));
+  REQUIRE(range.first == 0);
+  REQUIRE(range.last == 5);
+
+  REQUIRE(FLReconstruct::parse_record_range("7:", range));
+  REQUIRE(range.first == 7);
+  REQUIRE(range.last == RecordRange::kUnbounded);
+
+  for (const char* bad : {"", "12", "a:b", "-1:3", "5:4", "1:2:3", " 1:2"}) {
+    REQUIRE_FALSE(FLReconstruct::parse_record_range(bad, range));
+  }
+}
+
+TEST_CASE("Shards are parsed with an index less than their count", "") {
+  RecordRange range;
+  REQUIRE(FLReconstruct::parse_record_shard("3/8", range));
+  REQUIRE(range.shardIndex == 3);
+  REQUIRE(range.shardCount == 8);
+
+  for (const char* bad : {"", "3", "8/8", "1/0", "/2", "1/", "-1/2"}) {
+    REQUIRE_FALSE(FLReconstruct::parse_record_shard(bad, range));
+  }
+}
+
+TEST_CASE("Ranges are clamped to the number of records", "") {
+  RecordRange range;
+  REQUIRE(range.is_complete());
+  REQUIRE(range.resolve(100) == std::make_pair(uint64_t{0}, uint64_t{100}));
+
+  range.first = 40;
+  range.last = 1000;
+  REQUIRE(range.resolve(100) == std::make_pair(uint64_t{40}, uint64_t{100}));
+  REQUIRE(range.resolve(10) == std::make_pair(uint64_t{10}, uint64_t{10}));
+
+  // Without sharding, the number of records need not be known
+  REQUIRE(range.resolve(RecordRange::kUnbounded) ==
+          std::make_pair(uint64_t{40}, uint64_t{1000}));
+}
+
+TEST_CASE("Shards partition the range in order", "") {
+  for (uint64_t total : {0, 1, 7, 10, 101}) {
+    for (uint32_t count : {1, 2, 3, 16}) {
+      RecordRange range;
+      range.first = 2;
+      range.shardCount = count;
+      uint64_t expectedFirst = std::min<uint64_t>(2, total);
+      uint64_t smallest = RecordRange::kUnbounded;
+      uint64_t largest = 0;
+      for (uint32_t i = 0; i < count; ++i) {
+        range.shardIndex = i;
+        const auto shard = range.resolve(total);
+        REQUIRE(shard.first == expectedFirst);
+        REQUIRE(shard.second >= shard.first);
+        smallest = std::min(smallest, shard.second - shard.first);
+        largest = std::max(largest, shard.second - shard.first);
+        expectedFirst = shard.second;
+      }
+      REQUIRE(expectedFirst == total);
+      REQUIRE(largest - smallest <= 1);
+    }
+  }
+}
@@ -43,6 +43,8 @@ FLSimulateArgs FLSimulateArgs::makeDefault() {
   params.logLevel = datatools::logger::PRIO_ERROR;
   params.userProfile = "normal";
   params.numberOfEvents = 1;
+  params.numberOfJobs = 0;      // 0 == single process, no event blocks
+  params.eventsPerBlock = 1000;
   params.doSimulation = true;
   params.doDigitization = false;
   // Identification of the experimental setup:
@@ -84,6 +86,7 @@ FLSimulateArgs FLSimulateArgs::makeDefault() {
   params.outputMetadataFile = "";
   params.embeddedMetadata = true;
   params.outputFile = "";
+  params.outputIndex = false;
 
   return params;
 }
@@ -108,7 +111,9 @@ void do_configure(int argc, char* argv[], FLSimulateArgs& flSimParameters) {
   flSimParameters.outputMetadataFile = args.outputMetadataFile;
   flSimParameters.embeddedMetadata = args.embeddedMetadata;
   flSimParameters.outputFile = args.outputFile;
+  flSimParameters.outputIndex = args.outputIndex;
   flSimParameters.mountPoints = args.mountPoints;
+  flSimParameters.numberOfJobs = args.numberOfJobs;
 
   if (static_cast<unsigned int>(!flSimParameters.mountPoints.empty()) != 0u) {
     // Apply mount points as soon as possible, because manually set file path below
@@ -171,6 +176,14 @@ void do_configure(int argc, char* argv[], FLSimulateArgs& flSimParameters) {
       flSimParameters.numberOfEvents =
           baseSystem.get<int>("numberOfEvents", flSimParameters.numberOfEvents);
 
+      // Number of events simulated by each job in multi-job mode, checked before
+      // it is stored as unsigned:
+      const int eventsPerBlock =
+          baseSystem.get<int>("eventsPerBlock", static_cast<int>(flSimParameters.eventsPerBlock));
+      DT_THROW_IF(eventsPerBlock < 1, FLConfigUserError,
+                  "Number of events per block must be positive!");
+      flSimParameters.eventsPerBlock = static_cast<unsigned int>(eventsPerBlock);
+
       // Printing rate for events:
       flSimParameters.simulationManagerParams.number_of_events_modulo = baseSystem.get<int>(
           "moduloEvents", flSimParameters.simulationManagerParams.number_of_events_modulo);
@@ -355,6 +368,17 @@ void do_postprocess(FLSimulateArgs& flSimParameters) {
   datatools::kernel& dtk = datatools::kernel::instance();
   const datatools::urn_query_service& dtkUrnQuery = dtk.get_urn_query();
 
+  if (flSimParameters.numberOfJobs > 0) {
+    // Seeds of each block are derived from the master seeds, which must be known up front
+    DT_THROW_IF(!flSimParameters.simulationManagerParams.input_prng_seeds_file.empty(),
+                FLConfigUserError,
+                "Multi-job simulation derives its seeds from the inline PRNG seeds, "
+                    << "it cannot use a seed file!");
+    DT_THROW_IF(!flSimParameters.simulationManagerParams.input_prng_states_file.empty() ||
+                    !flSimParameters.simulationManagerParams.output_prng_states_file.empty(),
+                FLConfigUserError, "Multi-job simulation cannot load or save PRNG states!");
+  }
+
   if (flSimParameters.simulationManagerParams.input_prng_seeds_file.empty()) {
     if (!flSimParameters.saveRngSeeding &&
         flSimParameters.simulationManagerParams.output_prng_seeds_file.empty()) {
@@ -568,6 +592,8 @@ void FLSimulateArgs::print(std::ostream& out_) const {
        << std::endl;
   out_ << tag << "userProfile                = " << userProfile << std::endl;
   out_ << tag << "numberOfEvents             = " << numberOfEvents << std::endl;
+  out_ << tag << "numberOfJobs               = " << numberOfJobs << std::endl;
+  out_ << tag << "eventsPerBlock             = " << eventsPerBlock << std::endl;
   out_ << tag << "doSimulation               = " << std::boolalpha << doSimulation << std::endl;
   out_ << tag << "doDigitization             = " << std::boolalpha << doDigitization << std::endl;
   out_ << tag << "experimentalSetupUrn       = " << experimentalSetupUrn << std::endl;
@@ -588,7 +614,9 @@ void FLSimulateArgs::print(std::ostream& out_) const {
   out_ << tag << "servicesSubsystemConfig    = " << servicesSubsystemConfig << std::endl;
   out_ << tag << "outputMetadataFile         = " << outputMetadataFile << std::endl;
   out_ << tag << "embeddedMetadata           = " << std::boolalpha << embeddedMetadata << std::endl;
-  out_ << last_tag << "outputFile                 = " << outputFile << std::endl;
+  out_ << tag << "outputFile                 = " << outputFile << std::endl;
+  out_ << last_tag << "outputIndex                = " << std::boolalpha << outputIndex
+       << std::endl;
 }
 
 }  // namespace FLSimulate
@@ -33,6 +33,8 @@ struct FLSimulateArgs {
   std::string userProfile;               //!< User profile
   std::vector<std::string> mountPoints;  //!< Directory mount directives
   unsigned int numberOfEvents;           //!< Number of events to be processed in the pipeline
+  unsigned int numberOfJobs;             //!< Number of worker processes (0: simulate in-process)
+  unsigned int eventsPerBlock;           //!< Number of events simulated from each set of seeds
 
   bool doSimulation;                 //!< Simulation flag
   bool doDigitization;               //!< Digitization flag
@@ -64,6 +66,7 @@ struct FLSimulateArgs {
   bool saveRngSeeding;             //!< Flag to save PRNG seeds in metadata
   std::string rngSeeding;          //!< PRNG seed initialization
   std::string outputFile;          //!< Output data file for the output module
+  bool outputIndex;                //!< Flag to write a record index of the output file
 
   //! Construct and return the default configuration object
   // Equally, could be supplied in a .application file, though note
@@ -27,7 +27,9 @@ FLSimulateCommandLine FLSimulateCommandLine::makeDefault() {
   flClarg.outputMetadataFile = "";
   flClarg.embeddedMetadata = true;
   flClarg.outputFile = "";
+  flClarg.outputIndex = false;
   flClarg.userProfile = "normal";
+  flClarg.numberOfJobs = 0;
   return flClarg;
 }
 
@@ -75,6 +77,7 @@ void do_help_scripting(std::ostream& os) {
      << std::endl
      << "[name=\"flsimulate\" type=\"flsimulate::section\"]\n"
      << "numberOfEvents : integer = 1                     # Number of events to simulate\n"
+     << "eventsPerBlock : integer = 1000                  # Number of events per block with -j\n"
      << std::endl
      << "[name=\"flsimulate.simulation\" type=\"flsimulate::section\"]\n"
      << "simulationSetupUrn : string = \"" << default_simulation_setup() << "\" \n"
@@ -160,6 +163,16 @@ void do_cldialog(int argc, char* argv[], FLSimulateCommandLine& clArgs) {
       "Examples:\n"
       "  -o \"example.brio\" \n"
       "  -o \"${WORKER_DIR}/data/run_1.xml\"")
+
+    ("output-index", bpo::bool_switch(&clArgs.outputIndex),
+      "write an index of the records of the output file\n"
+      "next to it, in <file>.idx")
+
+    ("jobs,j", bpo::value<uint32_t>(&clArgs.numberOfJobs)->default_value(0)->value_name("n"),
+      "simulate blocks of events in n worker processes\n"
+      "The output is the same for any n > 0. With 0, events\n"
+      "are simulated in a single block by this process,\n"
+      "from other random numbers than with n > 0")
     ;
   // clang-format on
 
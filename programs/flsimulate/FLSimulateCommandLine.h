@@ -16,6 +16,7 @@
 #define FLSIMULATECOMMANDLINE_H
 
 // Standard Library:
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -37,6 +38,8 @@ struct FLSimulateCommandLine {
   std::string outputMetadataFile;        //!< Path for saving metadata
   bool embeddedMetadata;                 //!< Flag to embed metadata in the output data file
   std::string outputFile;                //!< Path for the output module
+  bool outputIndex;                      //!< Flag to write a record index of the output file
+  uint32_t numberOfJobs;                 //!< Number of worker processes
   static FLSimulateCommandLine makeDefault();
 };
 
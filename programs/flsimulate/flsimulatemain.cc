@@ -37,7 +37,22 @@
 // along with Falaise.  If not, see <http://www.gnu.org/licenses/>.
 
 // Standard Library
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <random>
+#include <set>
+#include <sstream>
 #include <string>
+#include <vector>
+
+// POSIX
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 // Third Party
 // - Boost
@@ -55,6 +70,7 @@
 #include "bayeux/datatools/urn_db_service.h"
 #include "bayeux/datatools/urn_query_service.h"
 #include "bayeux/datatools/urn_to_path_resolver_service.h"
+#include "bayeux/dpp/input_module.h"
 #include "bayeux/dpp/output_module.h"
 #include "bayeux/geomtools/manager.h"
 #include "bayeux/mctools/g4/manager_parameters.h"
@@ -69,6 +85,8 @@
 #include "falaise/resource.h"
 #include "falaise/snemo/datamodels/data_model.h"
 #include "falaise/snemo/datamodels/event_header.h"
+#include "falaise/snemo/datamodels/record_index.h"
+#include "falaise/snemo/processing/event_seed.h"
 #include "falaise/snemo/services/services.h"
 #include "falaise/version.h"
 
@@ -85,6 +103,40 @@ falaise::exit_code do_flsimulate(int argc, char *argv[]);
 falaise::exit_code do_metadata(const FLSimulateArgs & /*flSimParameters*/,
                                datatools::multi_properties & /*flSimMetadata*/);
 
+//! Configure and initialize a simulation module using the geometry service
+void setup_simulation_module(mctools::g4::simulation_module &flSimModule,
+                             const mctools::g4::manager_parameters &params,
+                             datatools::service_manager &services);
+
+//! Simulate one event and write it to the output module, indexing it if index is not null
+falaise::exit_code simulate_event(unsigned int eventNumber,
+                                  mctools::g4::simulation_module &flSimModule,
+                                  dpp::base_module &output, datatools::things &workItem,
+                                  snemo::datamodel::record_index *index = nullptr);
+
+//! Replace automatic PRNG seeds by explicit ones, from which the seeds of blocks are derived
+void resolve_master_seeds(mctools::g4::manager_parameters &params);
+
+//! Return the simulation parameters of a block of events, with seeds derived from the master ones
+mctools::g4::manager_parameters block_parameters(const mctools::g4::manager_parameters &params,
+                                                 unsigned int block);
+
+//! Simulate the events of one block into its own file
+falaise::exit_code simulate_block(const FLSimulateArgs &flSimParameters,
+                                  datatools::service_manager &services, unsigned int block,
+                                  const std::string &blockFile);
+
+//! Simulate the blocks of events in at most numberOfJobs concurrent worker processes
+falaise::exit_code run_workers(const FLSimulateArgs &flSimParameters,
+                               datatools::service_manager &services,
+                               const std::vector<std::string> &blockFiles);
+
+//! Copy the events of the block files to the output module, in event order, indexing them if
+//! index is not null
+falaise::exit_code merge_blocks(const std::vector<std::string> &blockFiles,
+                                dpp::base_module &output,
+                                snemo::datamodel::record_index *index = nullptr);
+
 }  // end of namespace FLSimulate
 
 //----------------------------------------------------------------------
@@ -133,6 +185,11 @@ falaise::exit_code do_metadata(const FLSimulateArgs &flSimParameters,
   system_props.store_integer("numberOfEvents", flSimParameters.numberOfEvents,
                              "Number of simulated events");
 
+  if (flSimParameters.numberOfJobs > 0) {
+    system_props.store_integer("eventsPerBlock", flSimParameters.eventsPerBlock,
+                               "Number of events simulated from each set of seeds");
+  }
+
   system_props.store_boolean("doSimulation", flSimParameters.doSimulation, "Activate simulation");
 
   system_props.store_boolean("doDigitization", flSimParameters.doDigitization,
@@ -295,22 +352,31 @@ falaise::exit_code do_flsimulate(int argc, char *argv[]) {
     services.initialize(services_config);
 
     // Simulation module:
-    mctools::g4::simulation_module flSimModule;
-    flSimModule.set_name("G4SimulationModule");
-    std::string sd_label = snedm::labels::simulated_data();
-    std::string geo_label = snemo::service_info::geometryServiceName();
-    flSimModule.set_sd_label(sd_label);
-    flSimModule.set_geo_label(geo_label);
-    flSimModule.set_geant4_parameters(flSimParameters.simulationManagerParams);
-    flSimModule.initialize_simple_with_service(services);
-    if (flSimModule.is_initialized()) {
-      // Fetch effective seeds' value after simulation module initialization
-      // because the embedded PRNG seed manager makes the final choice of
-      // initial seeds.
+    // In multi-job mode, each worker process initializes its own module for each block of
+    // events, with seeds derived from the master seeds.
+    const bool multiJob = flSimParameters.numberOfJobs > 0;
+    std::unique_ptr<mctools::g4::simulation_module> flSimModule;
+    if (multiJob) {
+      mctools::g4::manager_parameters &params = flSimParameters.simulationManagerParams;
+      resolve_master_seeds(params);
       std::ostringstream rngSeedingOut;
-      rngSeedingOut << flSimModule.get_seed_manager();
+      rngSeedingOut << "{EG=" << params.eg_seed << "; VG=" << params.vg_seed
+                    << "; SHPF=" << params.shpf_seed << "; MGR=" << params.mgr_seed
+                    << "} per block of " << flSimParameters.eventsPerBlock << " events";
       flSimParameters.rngSeeding = rngSeedingOut.str();
       DT_LOG_DEBUG(flSimParameters.logLevel, "PRNG seeding = " << flSimParameters.rngSeeding);
+    } else {
+      flSimModule.reset(new mctools::g4::simulation_module);
+      setup_simulation_module(*flSimModule, flSimParameters.simulationManagerParams, services);
+      if (flSimModule->is_initialized()) {
+        // Fetch effective seeds' value after simulation module initialization
+        // because the embedded PRNG seed manager makes the final choice of
+        // initial seeds.
+        std::ostringstream rngSeedingOut;
+        rngSeedingOut << flSimModule->get_seed_manager();
+        flSimParameters.rngSeeding = rngSeedingOut.str();
+        DT_LOG_DEBUG(flSimParameters.logLevel, "PRNG seeding = " << flSimParameters.rngSeeding);
+      }
     }
 
     // Digitization module:
@@ -332,6 +398,31 @@ falaise::exit_code do_flsimulate(int argc, char *argv[]) {
       flSimMetadata.write(fMetadata);
     }
 
+    // Blocks are simulated into scratch files next to the output file, with the
+    // same extension so that they are written in the same format. Workers are
+    // started before the output file is opened, so they do not share it.
+    boost::filesystem::path blockDir;
+    std::vector<std::string> blockFiles;
+    if (multiJob) {
+      std::string outputPath = flSimParameters.outputFile;
+      datatools::fetch_path_with_env(outputPath);
+      const boost::filesystem::path output{outputPath};
+      const std::string outputName = output.filename().string();
+      const std::string extension =
+          outputName.substr(std::min(outputName.find('.'), outputName.size()));
+      blockDir = output.parent_path() / (outputName + ".blocks");
+      boost::filesystem::create_directories(blockDir);
+      const unsigned int numberOfBlocks =
+          (flSimParameters.numberOfEvents + flSimParameters.eventsPerBlock - 1) /
+          flSimParameters.eventsPerBlock;
+      for (unsigned int block = 0; block < numberOfBlocks; ++block) {
+        std::ostringstream blockName;
+        blockName << "block-" << std::setw(6) << std::setfill('0') << block << extension;
+        blockFiles.push_back((blockDir / blockName.str()).string());
+      }
+      code = run_workers(flSimParameters, services, blockFiles);
+    }
+
     // Simulation output module:
     dpp::output_module simOutput;
     simOutput.set_name("FLSimulateOutput");
@@ -344,38 +435,36 @@ falaise::exit_code do_flsimulate(int argc, char *argv[]) {
     }
     simOutput.initialize_simple();
 
-    // Manual Event loop....
-    datatools::things workItem;
-    dpp::base_module::process_status status;
-
-    for (unsigned int i(0); i < flSimParameters.numberOfEvents; ++i) {
-      workItem.clear();
+    // Record index, written next to the output file once it is closed:
+    std::unique_ptr<snemo::datamodel::record_index> outputIndex;
+    if (flSimParameters.outputIndex) {
+      outputIndex.reset(new snemo::datamodel::record_index);
+    }
 
-      // Add the event header bank
-      auto &eventHeader = workItem.add<snemo::datamodel::event_header>(
-          snedm::labels::event_header(), "Event Header Bank");
-      eventHeader.set_generation(snemo::datamodel::event_header::GENERATION_SIMULATED);
-      datatools::event_id eventID{datatools::event_id::ANY_RUN_NUMBER, static_cast<int>(i)};
-      eventHeader.set_id(eventID);
-
-      status = flSimModule.process(workItem);
-      if (status != dpp::base_module::PROCESS_OK) {
-        std::cerr << "flsimulate : Simulation module failed" << std::endl;
-        code = falaise::EXIT_UNAVAILABLE;
+    if (multiJob) {
+      if (code == falaise::EXIT_OK) {
+        code = merge_blocks(blockFiles, simOutput, outputIndex.get());
       }
+      boost::filesystem::remove_all(blockDir);
+    } else {
+      // Manual Event loop....
+      datatools::things workItem;
 
-      status = simOutput.process(workItem);
-      if (status != dpp::base_module::PROCESS_OK) {
-        std::cerr << "flsimulate : Output module failed" << std::endl;
-        code = falaise::EXIT_UNAVAILABLE;
-      }
+      for (unsigned int i(0); i < flSimParameters.numberOfEvents; ++i) {
+        code = simulate_event(i, *flSimModule, simOutput, workItem, outputIndex.get());
 
-      // Here we will process optional ASB+Digitization+terminal output modules
+        // Here we will process optional ASB+Digitization+terminal output modules
 
-      if (code != falaise::EXIT_OK) {
-        break;
+        if (code != falaise::EXIT_OK) {
+          break;
+        }
       }
     }
+
+    if (outputIndex && code == falaise::EXIT_OK) {
+      simOutput.reset();
+      outputIndex->write(flSimParameters.outputFile);
+    }
   } catch (std::exception &e) {
     std::cerr << "flsimulate : Setup/run of simulation threw exception" << std::endl;
     std::cerr << e.what() << std::endl;
@@ -390,4 +479,197 @@ falaise::exit_code do_flsimulate(int argc, char *argv[]) {
   return code;
 }
 
+//----------------------------------------------------------------------
+void setup_simulation_module(mctools::g4::simulation_module &flSimModule,
+                             const mctools::g4::manager_parameters &params,
+                             datatools::service_manager &services) {
+  flSimModule.set_name("G4SimulationModule");
+  std::string sd_label = snedm::labels::simulated_data();
+  std::string geo_label = snemo::service_info::geometryServiceName();
+  flSimModule.set_sd_label(sd_label);
+  flSimModule.set_geo_label(geo_label);
+  flSimModule.set_geant4_parameters(params);
+  flSimModule.initialize_simple_with_service(services);
+}
+
+//----------------------------------------------------------------------
+falaise::exit_code simulate_event(unsigned int eventNumber,
+                                  mctools::g4::simulation_module &flSimModule,
+                                  dpp::base_module &output, datatools::things &workItem,
+                                  snemo::datamodel::record_index *index) {
+  falaise::exit_code code = falaise::EXIT_OK;
+  workItem.clear();
+
+  // Add the event header bank
+  auto &eventHeader = workItem.add<snemo::datamodel::event_header>(snedm::labels::event_header(),
+                                                                   "Event Header Bank");
+  eventHeader.set_generation(snemo::datamodel::event_header::GENERATION_SIMULATED);
+  datatools::event_id eventID{datatools::event_id::ANY_RUN_NUMBER, static_cast<int>(eventNumber)};
+  eventHeader.set_id(eventID);
+
+  dpp::base_module::process_status status = flSimModule.process(workItem);
+  if (status != dpp::base_module::PROCESS_OK) {
+    std::cerr << "flsimulate : Simulation module failed" << std::endl;
+    code = falaise::EXIT_UNAVAILABLE;
+  }
+
+  status = output.process(workItem);
+  if (status != dpp::base_module::PROCESS_OK) {
+    std::cerr << "flsimulate : Output module failed" << std::endl;
+    code = falaise::EXIT_UNAVAILABLE;
+  } else if (index != nullptr) {
+    index->add(workItem);
+  }
+  return code;
+}
+
+//----------------------------------------------------------------------
+void resolve_master_seeds(mctools::g4::manager_parameters &params) {
+  std::random_device entropy;
+  for (int *seed : {&params.eg_seed, &params.vg_seed, &params.shpf_seed, &params.mgr_seed}) {
+    if (*seed <= 0) {
+      *seed = 1 + static_cast<int>(entropy() % 0x7FFFFFFE);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+mctools::g4::manager_parameters block_parameters(const mctools::g4::manager_parameters &params,
+                                                 unsigned int block) {
+  // Seeds are kept positive, as null or negative ones request automatic seeding
+  auto blockSeed = [block](int masterSeed, const std::string &stream) {
+    return 1 + snemo::processing::event_seed(masterSeed, 0, static_cast<int32_t>(block), stream) %
+                   0x7FFFFFFE;
+  };
+  mctools::g4::manager_parameters blockParams = params;
+  blockParams.eg_seed = blockSeed(params.eg_seed, "EG");
+  blockParams.vg_seed = blockSeed(params.vg_seed, "VG");
+  blockParams.shpf_seed = blockSeed(params.shpf_seed, "SHPF");
+  blockParams.mgr_seed = blockSeed(params.mgr_seed, "MGR");
+  blockParams.output_prng_seeds_file = "";
+  return blockParams;
+}
+
+//----------------------------------------------------------------------
+falaise::exit_code simulate_block(const FLSimulateArgs &flSimParameters,
+                                  datatools::service_manager &services, unsigned int block,
+                                  const std::string &blockFile) {
+  falaise::exit_code code = falaise::EXIT_OK;
+  try {
+    mctools::g4::simulation_module flSimModule;
+    setup_simulation_module(flSimModule,
+                            block_parameters(flSimParameters.simulationManagerParams, block),
+                            services);
+
+    dpp::output_module blockOutput;
+    blockOutput.set_name("FLSimulateBlockOutput");
+    blockOutput.set_single_output_file(blockFile);
+    blockOutput.initialize_simple();
+
+    const unsigned int firstEvent = block * flSimParameters.eventsPerBlock;
+    const unsigned int lastEvent =
+        std::min(firstEvent + flSimParameters.eventsPerBlock, flSimParameters.numberOfEvents);
+    datatools::things workItem;
+    for (unsigned int i = firstEvent; i < lastEvent && code == falaise::EXIT_OK; ++i) {
+      code = simulate_event(i, flSimModule, blockOutput, workItem);
+    }
+    blockOutput.reset();
+  } catch (std::exception &e) {
+    std::cerr << "flsimulate : Simulation of block " << block << " threw exception" << std::endl;
+    std::cerr << e.what() << std::endl;
+    code = falaise::EXIT_UNAVAILABLE;
+  }
+  return code;
+}
+
+//----------------------------------------------------------------------
+falaise::exit_code run_workers(const FLSimulateArgs &flSimParameters,
+                               datatools::service_manager &services,
+                               const std::vector<std::string> &blockFiles) {
+  std::set<pid_t> workers;
+  bool failed = false;
+  auto waitForWorker = [&workers, &failed]() {
+    int status = 0;
+    const pid_t pid = ::waitpid(-1, &status, 0);
+    if (pid < 0) {
+      workers.clear();
+      failed = true;
+      return;
+    }
+    workers.erase(pid);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != falaise::EXIT_OK) {
+      failed = true;
+    }
+  };
+
+  // Anything left in the stream buffers would be written again by each worker
+  std::cout.flush();
+  std::fflush(nullptr);
+
+  for (unsigned int block = 0; block < blockFiles.size() && !failed; ++block) {
+    while (workers.size() >= flSimParameters.numberOfJobs) {
+      waitForWorker();
+    }
+    if (failed) {
+      break;
+    }
+    const pid_t pid = ::fork();
+    if (pid < 0) {
+      std::cerr << "flsimulate : Cannot start worker process: " << std::strerror(errno)
+                << std::endl;
+      failed = true;
+      break;
+    }
+    if (pid == 0) {
+      // Worker: the geometry and other services are shared with the parent
+      // until written to. Leave without running the parent's exit handlers.
+      const falaise::exit_code code =
+          simulate_block(flSimParameters, services, block, blockFiles[block]);
+      std::cout.flush();
+      std::fflush(nullptr);
+      ::_exit(code);
+    }
+    workers.insert(pid);
+  }
+
+  while (!workers.empty()) {
+    waitForWorker();
+  }
+
+  if (failed) {
+    std::cerr << "flsimulate : Simulation of a block of events failed" << std::endl;
+    return falaise::EXIT_UNAVAILABLE;
+  }
+  return falaise::EXIT_OK;
+}
+
+//----------------------------------------------------------------------
+falaise::exit_code merge_blocks(const std::vector<std::string> &blockFiles,
+                                dpp::base_module &output,
+                                snemo::datamodel::record_index *index) {
+  datatools::things workItem;
+  for (const std::string &blockFile : blockFiles) {
+    dpp::input_module blockInput;
+    blockInput.set_name("FLSimulateBlockInput");
+    blockInput.set_single_input_file(blockFile);
+    blockInput.initialize_simple();
+    while (!blockInput.is_terminated()) {
+      workItem.clear();
+      if (blockInput.process(workItem) != dpp::base_module::PROCESS_OK) {
+        std::cerr << "flsimulate : Cannot read back block file '" << blockFile << "'" << std::endl;
+        return falaise::EXIT_UNAVAILABLE;
+      }
+      if (output.process(workItem) != dpp::base_module::PROCESS_OK) {
+        std::cerr << "flsimulate : Output module failed" << std::endl;
+        return falaise::EXIT_UNAVAILABLE;
+      }
+      if (index != nullptr) {
+        index->add(workItem);
+      }
+    }
+    blockInput.reset();
+  }
+  return falaise::EXIT_OK;
+}
+
 }  // end of namespace FLSimulate
@@ -46,6 +46,7 @@ bool boost_access::is_sequential() const { return _sequential_; }
 
 // ctor:
 boost_access::boost_access() {
+  _sequential_ = false;
   _number_of_entries_ = 0;
   _current_file_number_ = 0;
   _reader_ = nullptr;
@@ -31,6 +31,8 @@
 #include <bayeux/brio/reader.h>
 // - Bayeux/dpp
 #include <bayeux/dpp/brio_common.h>
+// - Falaise:
+#include <falaise/snemo/datamodels/record_index.h>
 
 // This project:
 #include <EventBrowser/io/data_model.h>
@@ -66,6 +68,10 @@ bool brio_access::open(const std::vector<std::string>& filenames_) {
   }
 
   for (const auto& a_file : filenames_) {
+    // Files with a record index are not opened to count their entries
+    if (_build_list_from_index_(a_file)) {
+      continue;
+    }
     DT_LOG_DEBUG(view::options_manager::get_instance().get_logging_priority(),
                  "Opening file " << a_file << "...");
     _reader_->open(a_file);
@@ -80,6 +86,24 @@ bool brio_access::open(const std::vector<std::string>& filenames_) {
 
   // open the first one
   _reader_->open(_file_list_.at(_current_file_number_ = 0));
+  return _mode_.empty() ? is_readable() : true;
+}
+
+bool brio_access::_build_list_from_index_(const std::string& filename_) {
+  snemo::datamodel::record_index index;
+  if (!index.read(filename_)) {
+    DT_LOG_DEBUG(view::options_manager::get_instance().get_logging_priority(),
+                 "File '" << filename_ << "' has no valid record index");
+    return false;
+  }
+  for (size_t i = 0; i < index.size(); ++i) {
+    _entry_list_[_number_of_entries_ + i] = std::make_pair(_current_file_number_, i);
+  }
+  _number_of_entries_ += index.size();
+  _current_file_number_++;
+
+  DT_LOG_INFORMATION(view::options_manager::get_instance().get_logging_priority(),
+                     "Total number of record from index = " << _number_of_entries_);
   return true;
 }
 
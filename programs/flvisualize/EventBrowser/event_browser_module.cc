@@ -20,7 +20,8 @@
 #include <geomtools/geometry_service.h>
 #include <geomtools/manager.h>
 
-// SuperNEMO services
+// SuperNEMO data model and services
+#include <falaise/snemo/datamodels/packed_bank.h>
 #include <falaise/snemo/services/services.h>
 
 namespace snemo {
@@ -196,6 +197,7 @@ dpp::base_module::process_status event_browser_module::_show_event(
 
   DT_LOG_TRACE(get_logging_priority(), "Pass the event record object "
                                            << "to the event server...");
+  snemo::datamodel::unpack_banks(event_record_);
   _event_browser_->grab_event_server().set_external_event(event_record_);
 
   {
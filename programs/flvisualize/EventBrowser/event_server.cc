@@ -32,6 +32,9 @@
 // Bayeux/datatools
 #include <datatools/multi_properties.h>
 
+// Falaise:
+#include <falaise/snemo/datamodels/packed_bank.h>
+
 namespace snemo {
 
 namespace visualization {
@@ -140,6 +143,8 @@ bool event_server::next_event() {
 bool event_server::read_event(const unsigned int event_number_) {
   DT_THROW_IF(!is_initialized(), std::logic_error, "Not initialized !");
   if (_data_access_->retrieve_event(grab_event(), event_number_)) {
+    // Renderers access banks directly, so packed banks are all decoded here
+    snemo::datamodel::unpack_banks(grab_event());
     _current_event_number_ = event_number_;
     return true;
   }
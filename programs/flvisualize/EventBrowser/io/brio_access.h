@@ -51,6 +51,9 @@ namespace visualization {
 namespace io {
 
 /// \brief A data access class to read BRIO file
+///
+/// The entries of files with a record index are counted from the index,
+/// without opening the files.
 class brio_access : public i_data_access {
  public:
   /// Default constructor
@@ -103,6 +106,9 @@ class brio_access : public i_data_access {
   virtual bool retrieve_event(event_record& event_, const size_t event_number_);
 
  private:
+  /// Add the entries of a file from its record index, if it has a valid one
+  bool _build_list_from_index_(const std::string& filename_);
+
   size_t _number_of_entries_;          //!< Total number of entries
   unsigned int _current_file_number_;  //!< Current file index
 
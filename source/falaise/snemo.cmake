@@ -9,10 +9,14 @@ list(APPEND FalaiseLibrary_HEADERS
   snemo/datamodels/event.h
   snemo/datamodels/event_header.h
   snemo/datamodels/gg_track_utils.h
+  snemo/datamodels/handle_pool.h
+  snemo/datamodels/hit_encoding.h
   snemo/datamodels/helix_trajectory_pattern.h
   snemo/datamodels/line_trajectory_pattern.h
   snemo/datamodels/particle_track.h
   snemo/datamodels/particle_track_data.h
+  snemo/datamodels/packed_bank.h
+  snemo/datamodels/record_index.h
   snemo/datamodels/polyline_trajectory_pattern.h
   snemo/datamodels/timestamp.h
   snemo/datamodels/tracker_cluster.h
@@ -26,9 +30,11 @@ list(APPEND FalaiseLibrary_HEADERS
   snemo/datamodels/boost_io/calibrated_calorimeter_hit.ipp
   snemo/datamodels/boost_io/calibrated_data.ipp
   snemo/datamodels/boost_io/calibrated_tracker_hit.ipp
+  snemo/datamodels/boost_io/compact_base_hit.ipp
   snemo/datamodels/boost_io/event_header.ipp
   snemo/datamodels/boost_io/helix_trajectory_pattern.ipp
   snemo/datamodels/boost_io/line_trajectory_pattern.ipp
+  snemo/datamodels/boost_io/packed_bank.ipp
   snemo/datamodels/boost_io/particle_track.ipp
   snemo/datamodels/boost_io/particle_track_data.ipp
   snemo/datamodels/boost_io/polyline_trajectory_pattern.ipp
@@ -48,6 +54,7 @@ list(APPEND FalaiseLibrary_HEADERS
   snemo/geometry/gveto_locator.h
   snemo/geometry/locator_helpers.h
   snemo/geometry/locator_plugin.h
+  snemo/geometry/magnetic_field_map.h
   snemo/geometry/mapped_magnetic_field.h
 
   snemo/simulation/cosmic_muon_generator.h
@@ -59,6 +66,8 @@ list(APPEND FalaiseLibrary_HEADERS
   snemo/processing/base_tracker_clusterizer.h
   snemo/processing/base_tracker_fitter.h
   snemo/processing/module.h
+  snemo/processing/profiler.h
+  snemo/processing/event_seed.h
   snemo/processing/base_gamma_builder.h
   snemo/processing/detail/GeigerTimePartitioner.h
 
@@ -91,6 +100,10 @@ list(APPEND FalaiseLibrary_SOURCES
   snemo/datamodels/particle_track.cc
   snemo/datamodels/particle_track_data.cc
   snemo/datamodels/data_model.cc
+  snemo/datamodels/packed_bank.cc
+  snemo/datamodels/record_index.cc
+  snemo/datamodels/handle_pool.cc
+  snemo/datamodels/hit_encoding.cc
   snemo/datamodels/boost_io/the_serializable.cc
   snemo/datamodels/gg_track_utils.cc
 
@@ -100,6 +113,7 @@ list(APPEND FalaiseLibrary_SOURCES
   snemo/geometry/gveto_locator.cc
   snemo/geometry/locator_plugin.cc
   snemo/geometry/utils.cc
+  snemo/geometry/magnetic_field_map.cc
   snemo/geometry/mapped_magnetic_field.cc
   snemo/geometry/private/categories.h
 
@@ -114,8 +128,9 @@ list(APPEND FalaiseLibrary_SOURCES
   snemo/processing/base_tracker_clusterizer.cc
   snemo/processing/base_tracker_fitter.cc
   snemo/processing/base_gamma_builder.cc
-  snemo/processing/detail/mock_raw_tracker_hit.h
-  snemo/processing/detail/mock_raw_tracker_hit.cc
+  snemo/processing/profiler.cc
+  snemo/processing/event_seed.cc
+  snemo/processing/detail/mock_tracker_digits.h
   snemo/processing/detail/GeigerTimePartitioner.cc
   snemo/processing/detail/testing/gg_hit.h
   snemo/processing/detail/testing/gg_hit.cc
@@ -138,7 +153,15 @@ list(APPEND FalaiseLibrary_SOURCES
 list(APPEND FalaiseLibrary_TESTS_CATCH
   snemo/test/test_snemo_datamodel_event.cxx
   snemo/test/test_snemo_datamodel_timestamp.cxx
+  snemo/test/test_snemo_datamodel_record_index.cxx
+  snemo/test/test_snemo_datamodel_packed_bank.cxx
+  snemo/test/test_snemo_datamodel_compact_hits.cxx
+  snemo/test/test_snemo_datamodel_handle_pool.cxx
   snemo/test/test_snemo_geometry_gveto_locator_2.cxx
+  snemo/test/test_snemo_geometry_magnetic_field_map.cxx
+  snemo/test/test_snemo_processing_event_seed.cxx
+  snemo/test/test_snemo_processing_geiger_regime.cxx
+  snemo/test/test_snemo_processing_profiler.cxx
   snemo/test/test_module.cxx
   snemo/test/test_service.cxx
   snemo/test/test_event_record.cxx
@@ -15,13 +15,32 @@
 // - Bayeux/geomtools
 #include <geomtools/base_hit.ipp>
 
+// This project
+#include <falaise/snemo/datamodels/boost_io/compact_base_hit.ipp>
+#include <falaise/snemo/datamodels/hit_encoding.h>
+
 namespace snemo {
 
 namespace datamodel {
 
 /// Serialization method
 template <class Archive>
-void calibrated_calorimeter_hit::serialize(Archive& ar, const unsigned int /* version */) {
+void calibrated_calorimeter_hit::serialize(Archive& ar, const unsigned int version) {
+  // From version 1 : full or compact encoding, as chosen when writing
+  bool compact = false;
+  if (version >= 1) {
+    compact = is_compact_hit_encoding();
+    ar& boost::serialization::make_nvp("compact", compact);
+  }
+  if (compact) {
+    detail::serialize_compact_base_hit(ar, *this);
+    detail::serialize_compact_real(ar, "energy", energy_);
+    detail::serialize_compact_real(ar, "sigma_energy", sigma_energy_);
+    detail::serialize_compact_real(ar, "time", time_);
+    detail::serialize_compact_real(ar, "sigma_time", sigma_time_);
+    return;
+  }
+
   ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(base_hit);
   ar& boost::serialization::make_nvp("energy", energy_);
   ar& boost::serialization::make_nvp("sigma_energy", sigma_energy_);
@@ -13,16 +13,48 @@
 #include <boost/serialization/map.hpp>
 #include <boost/serialization/nvp.hpp>
 // - Bayeux/datatools:
+#include <datatools/exception.h>
 #include <datatools/utils.h>
 // - Bayeux/geomtools:
 #include <geomtools/base_hit.ipp>
 
+// This project:
+#include <falaise/snemo/datamodels/boost_io/compact_base_hit.ipp>
+#include <falaise/snemo/datamodels/hit_encoding.h>
+
 namespace snemo {
 
 namespace datamodel {
 
 template <class Archive>
 void calibrated_tracker_hit::serialize(Archive& ar_, const unsigned int version_) {
+  // From version 2 : full or compact encoding, as chosen when writing
+  bool compact = false;
+  if (version_ >= 2) {
+    compact = is_compact_hit_encoding();
+    ar_& boost::serialization::make_nvp("compact", compact);
+  }
+  if (compact) {
+    detail::serialize_compact_base_hit(ar_, *this);
+    uint8_t traits = static_cast<uint8_t>(traits_);
+    DT_THROW_IF(traits != traits_, std::logic_error, "Traits do not fit in 8 bits!");
+    ar_& boost::serialization::make_nvp("traits", traits);
+    traits_ = traits;
+    detail::serialize_compact_real(ar_, "r", r_);
+    detail::serialize_compact_real(ar_, "sigma_r", sigma_r_);
+    detail::serialize_compact_real(ar_, "z", z_);
+    detail::serialize_compact_real(ar_, "sigma_z", sigma_z_);
+    if (has_xy()) {
+      detail::serialize_compact_real(ar_, "x", x_);
+      detail::serialize_compact_real(ar_, "y", y_);
+    }
+    if (is_delayed()) {
+      detail::serialize_compact_real(ar_, "delayed_time", delayed_time_);
+      detail::serialize_compact_real(ar_, "delayed_time_error", delayed_time_error_);
+    }
+    return;
+  }
+
   ar_& BOOST_SERIALIZATION_BASE_OBJECT_NVP(base_hit);
   if (version_ == 0 && Archive::is_loading::value) {
     traits_ = 0x0;
@@ -39,9 +71,10 @@ void calibrated_tracker_hit::serialize(Archive& ar_, const unsigned int version_
     }
     datatools::invalidate(delayed_time_);
     datatools::invalidate(delayed_time_error_);
+    return;
   }
 
-  // From version 1 :
+  // From version 1, full encoding :
   ar_& boost::serialization::make_nvp("traits", traits_);
   ar_& boost::serialization::make_nvp("r", r_);
   ar_& boost::serialization::make_nvp("sigma_r", sigma_r_);
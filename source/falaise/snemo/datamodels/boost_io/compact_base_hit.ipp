@@ -0,0 +1,138 @@
+// -*- mode: c++ ; -*-
+/// \file falaise/snemo/datamodels/boost_io/compact_base_hit.ipp
+/// \brief Compact encoding of the hits of the calibrated data
+
+#ifndef FALAISE_SNEMO_DATAMODELS_COMPACT_BASE_HIT_IPP
+#define FALAISE_SNEMO_DATAMODELS_COMPACT_BASE_HIT_IPP 1
+
+// Standard library:
+#include <cstdint>
+
+// Third party:
+// - Boost:
+#include <boost/serialization/nvp.hpp>
+// - Bayeux/datatools:
+#include <datatools/properties.ipp>
+// - Bayeux/geomtools:
+#include <geomtools/base_hit.h>
+
+namespace snemo {
+
+namespace datamodel {
+
+namespace detail {
+
+/// \brief Flags of the fields of a compact hit
+///
+/// Hits are written field by field, without the class header and the
+/// storage mask of geomtools::base_hit, and only with the fields they have.
+/// The encoding is only used when chosen by set_compact_hit_encoding().
+enum compact_hit_layout : uint8_t {
+  COMPACT_HIT_ID = 0x1,           ///< The hit ID is stored
+  COMPACT_GEOM_ID = 0x2,          ///< The geometry ID is stored
+  COMPACT_SHORT_ADDRESSES = 0x4,  ///< Geometry ID addresses are stored on 16 bits
+  COMPACT_AUXILIARIES = 0x8       ///< The non-empty auxiliary properties are stored
+};
+
+/// Short forms of the special geometry ID addresses
+const uint16_t kCompactInvalidAddress = 0xFFFF;
+const uint16_t kCompactAnyAddress = 0xFFFE;
+
+/// Return true if address can be stored on 16 bits
+inline bool is_short_address(uint32_t address) {
+  return address < kCompactAnyAddress || address == geomtools::geom_id::INVALID_ADDRESS ||
+         address == geomtools::geom_id::ANY_ADDRESS;
+}
+
+/// Store or load a real quantity as a 32 bits float
+/// Floats have a relative precision of 6e-8, that is better than 1 ps on times up to
+/// 10 us and 1 um on lengths up to 10 m. Invalid (NaN) values are preserved.
+template <class Archive>
+void serialize_compact_real(Archive& ar, const char* name, double& value) {
+  float compact = static_cast<float>(value);
+  ar& boost::serialization::make_nvp(name, compact);
+  if (Archive::is_loading::value) {
+    value = compact;
+  }
+}
+
+/// Store or load the hit ID, geometry ID and auxiliary properties of a hit
+template <class Archive>
+void serialize_compact_base_hit(Archive& ar, geomtools::base_hit& hit) {
+  uint8_t layout = 0;
+  if (Archive::is_saving::value) {
+    if (hit.has_hit_id()) {
+      layout |= COMPACT_HIT_ID;
+    }
+    if (hit.has_geom_id()) {
+      layout |= COMPACT_GEOM_ID;
+      const geomtools::geom_id& gid = hit.get_geom_id();
+      bool shortAddresses = true;
+      for (uint32_t i = 0; i < gid.get_depth(); ++i) {
+        shortAddresses = shortAddresses && is_short_address(gid.get(i));
+      }
+      if (shortAddresses) {
+        layout |= COMPACT_SHORT_ADDRESSES;
+      }
+    }
+    if (hit.has_auxiliaries() && !hit.get_auxiliaries().empty()) {
+      layout |= COMPACT_AUXILIARIES;
+    }
+  }
+  ar& boost::serialization::make_nvp("layout", layout);
+
+  if ((layout & COMPACT_HIT_ID) != 0) {
+    int32_t hitId = hit.get_hit_id();
+    ar& boost::serialization::make_nvp("id", hitId);
+    if (Archive::is_loading::value) {
+      hit.set_hit_id(hitId);
+    }
+  }
+
+  if ((layout & COMPACT_GEOM_ID) != 0) {
+    geomtools::geom_id& gid = hit.grab_geom_id();
+    uint32_t type = gid.get_type();
+    uint8_t depth = static_cast<uint8_t>(gid.get_depth());
+    ar& boost::serialization::make_nvp("type", type);
+    ar& boost::serialization::make_nvp("depth", depth);
+    if (Archive::is_loading::value) {
+      gid.set_type(type);
+      gid.set_depth(depth);
+    }
+    for (uint32_t i = 0; i < depth; ++i) {
+      uint32_t address = gid.get(i);
+      if ((layout & COMPACT_SHORT_ADDRESSES) != 0) {
+        uint16_t shortAddress = static_cast<uint16_t>(address);
+        if (address == geomtools::geom_id::INVALID_ADDRESS) {
+          shortAddress = kCompactInvalidAddress;
+        } else if (address == geomtools::geom_id::ANY_ADDRESS) {
+          shortAddress = kCompactAnyAddress;
+        }
+        ar& boost::serialization::make_nvp("address", shortAddress);
+        address = shortAddress;
+        if (shortAddress == kCompactInvalidAddress) {
+          address = geomtools::geom_id::INVALID_ADDRESS;
+        } else if (shortAddress == kCompactAnyAddress) {
+          address = geomtools::geom_id::ANY_ADDRESS;
+        }
+      } else {
+        ar& boost::serialization::make_nvp("address", address);
+      }
+      if (Archive::is_loading::value) {
+        gid.set(i, address);
+      }
+    }
+  }
+
+  if ((layout & COMPACT_AUXILIARIES) != 0) {
+    ar& boost::serialization::make_nvp("auxiliaries", hit.grab_auxiliaries());
+  }
+}
+
+}  // end of namespace detail
+
+}  // end of namespace datamodel
+
+}  // end of namespace snemo
+
+#endif  // FALAISE_SNEMO_DATAMODELS_COMPACT_BASE_HIT_IPP
@@ -0,0 +1,32 @@
+// -*- mode: c++ ; -*-
+/// \file falaise/snemo/datamodels/packed_bank.ipp
+
+#ifndef FALAISE_SNEMO_DATAMODEL_PACKED_BANK_IPP
+#define FALAISE_SNEMO_DATAMODEL_PACKED_BANK_IPP 1
+
+// Ourselves:
+#include <falaise/snemo/datamodels/packed_bank.h>
+
+// Third party:
+// - Boost:
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/string.hpp>
+// - Bayeux/datatools:
+#include <datatools/i_serializable.ipp>
+
+namespace snemo {
+
+namespace datamodel {
+
+template <class Archive>
+void packed_bank::serialize(Archive& ar_, const unsigned int /*version_*/) {
+  ar_& DATATOOLS_SERIALIZATION_I_SERIALIZABLE_BASE_OBJECT_NVP;
+  ar_& boost::serialization::make_nvp("bank_serial_tag", bankSerialTag_);
+  ar_& boost::serialization::make_nvp("bytes", bytes_);
+}
+
+}  // end of namespace datamodel
+
+}  // end of namespace snemo
+
+#endif  // FALAISE_SNEMO_DATAMODEL_PACKED_BANK_IPP
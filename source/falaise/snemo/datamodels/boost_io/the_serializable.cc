@@ -116,3 +116,11 @@ DATATOOLS_SERIALIZATION_CLASS_SERIALIZE_INSTANTIATE_ALL(snemo::datamodel::partic
 #include <falaise/snemo/datamodels/boost_io/particle_track_data.ipp>
 DATATOOLS_SERIALIZATION_CLASS_SERIALIZE_INSTANTIATE_ALL(snemo::datamodel::particle_track_data)
 BOOST_CLASS_EXPORT_IMPLEMENT(snemo::datamodel::particle_track_data)
+
+/*********************************
+ * snemo::datamodel::packed_bank *
+ *********************************/
+
+#include <falaise/snemo/datamodels/boost_io/packed_bank.ipp>
+DATATOOLS_SERIALIZATION_CLASS_SERIALIZE_INSTANTIATE_ALL(snemo::datamodel::packed_bank)
+BOOST_CLASS_EXPORT_IMPLEMENT(snemo::datamodel::packed_bank)
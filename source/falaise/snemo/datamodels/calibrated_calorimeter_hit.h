@@ -101,4 +101,8 @@ using CalorimeterHitHdlCollection = std::vector<CalorimeterHitHdl>;
 
 }  // end of namespace snemo
 
+// Class version:
+#include <boost/serialization/version.hpp>
+BOOST_CLASS_VERSION(snemo::datamodel::calibrated_calorimeter_hit, 1)
+
 #endif  // FALAISE_SNEMO_DATAMODELS_CALIBRATED_CALORIMETER_HIT_H
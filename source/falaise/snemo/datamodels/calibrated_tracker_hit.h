@@ -235,7 +235,7 @@ using TrackerHitHdlCollection = std::vector<TrackerHitHdl>;
 
 // Class version:
 #include <boost/serialization/version.hpp>
-BOOST_CLASS_VERSION(snemo::datamodel::calibrated_tracker_hit, 1)
+BOOST_CLASS_VERSION(snemo::datamodel::calibrated_tracker_hit, 2)
 
 #endif  // FALAISE_SNEMO_DATAMODELS_CALIBRATED_TRACKER_HIT_H
 /*
@@ -6,6 +6,8 @@
 
 #include <bayeux/datatools/things.h>
 
+#include <falaise/snemo/datamodels/packed_bank.h>
+
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -54,7 +56,8 @@ class existing_product_key : public std::logic_error {
  * ```
  *
  * It additionally checks at compile time that the supplied type (`SomeDataType` here)
- * meets the requirements to be stored in the event.
+ * meets the requirements to be stored in the event, and decodes the value if it was
+ * read in packed form (see snemo::datamodel::packed_bank).
  *
  * \tparam T type of value to be retrieved or added
  * \param[in] key key for value to find
@@ -67,11 +70,38 @@ T& getOrAddToEvent(std::string const& key, event_record& event) {
   static_assert(std::is_base_of<datatools::i_serializable, T>::value,
                 "snedm::event_record can only store types derived from datatools::i_serializable");
   if (event.has(key)) {
+    snemo::datamodel::unpack_bank(event, key);
     return event.grab<T>(key);
   }
   return event.add<T>(key);
 }
 
+//! Get const reference to instance of T at supplied key in input event_record
+/*!
+ * Equivalent to the `get` member function of event_record, except that a value
+ * read in packed form (see snemo::datamodel::packed_bank) is decoded on this first
+ * access. Modules reading input banks should use it, so that banks they do not
+ * use are never decoded:
+ *
+ * ```cpp
+ * const auto& cd = getFromEvent<snedm::calibrated_data>(cdTag, event);
+ * ```
+ *
+ * \tparam T type of value to be retrieved
+ * \param[in] key key for value to find
+ * \param[in] event event_record to search in
+ * \returns const reference to value held at key
+ * \throws std::logic_error if key is not present
+ * \throws datatools::bad_things_cast if value at key is not of type T
+ */
+template <typename T>
+const T& getFromEvent(std::string const& key, event_record& event) {
+  static_assert(std::is_base_of<datatools::i_serializable, T>::value,
+                "snedm::event_record can only store types derived from datatools::i_serializable");
+  snemo::datamodel::unpack_bank(event, key);
+  return event.get<T>(key);
+}
+
 //! Add instance of T at supplied key in event_record unless key exists
 /*!
  * A simple convenience wrapper around a typical use case in Falaise modules:
@@ -0,0 +1,240 @@
+// falaise/snemo/datamodels/handle_pool.cc
+
+// Ourselves:
+#include <falaise/snemo/datamodels/handle_pool.h>
+
+// Standard library:
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace {
+// Blocks are multiples of the maximal fundamental alignment
+const std::size_t kGranularity = alignof(std::max_align_t);
+const std::size_t kSizeClasses =
+    (snemo::datamodel::handle_pool::kMaxBlockSize + kGranularity - 1) / kGranularity;
+
+std::size_t size_class(std::size_t size) { return (size + kGranularity - 1) / kGranularity - 1; }
+
+class thread_pool;
+
+// Each pooled block starts with the pool of the thread which allocated it,
+// padded so that the object which follows is suitably aligned
+union block_header {
+  thread_pool* owner;
+  std::max_align_t padding;
+};
+
+void* object_of(block_header* header) { return header + 1; }
+
+block_header* header_of(void* object) { return static_cast<block_header*>(object) - 1; }
+
+block_header* new_block(std::size_t sizeClass, thread_pool* owner) {
+  const std::size_t size = sizeof(block_header) + (sizeClass + 1) * kGranularity;
+  auto* header = static_cast<block_header*>(::operator new(size));
+  header->owner = owner;
+  return header;
+}
+
+// Set once the pool of the thread is given up, as objects freed later during
+// the exit of the thread, e.g. by static objects, must not use it
+thread_local bool freeListsDestroyed = false;
+
+//! \brief Free blocks allocated by one thread
+//!
+//! Blocks freed by the owning thread go to its free lists. Blocks freed by other
+//! threads, like the flreconstruct writer, are pushed to lock-free remote lists,
+//! which the owning thread takes back when its own lists are empty. Each free
+//! block stores the next one in place of its header.
+class thread_pool {
+ public:
+  void* pop(std::size_t sizeClass) {
+    list& l = lists_[sizeClass];
+    if (l.head == nullptr) {
+      collect_remote(sizeClass);
+      if (l.head == nullptr) {
+        return nullptr;
+      }
+    }
+    auto* header = static_cast<block_header*>(l.head);
+    l.head = *static_cast<void**>(l.head);
+    --l.count;
+    header->owner = this;
+    return object_of(header);
+  }
+
+  bool push(std::size_t sizeClass, block_header* header) {
+    list& l = lists_[sizeClass];
+    if (l.count == snemo::datamodel::handle_pool::kMaxFreeBlocks) {
+      return false;
+    }
+    *reinterpret_cast<void**>(header) = l.head;
+    l.head = header;
+    ++l.count;
+    return true;
+  }
+
+  //! Return a block freed by another thread than the owning one
+  void push_remote(std::size_t sizeClass, block_header* header) noexcept {
+    // Counted first, so that the count never goes below the number of listed blocks
+    remoteCount_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic<void*>& head = remote_[sizeClass];
+    void* next = head.load(std::memory_order_relaxed);
+    do {
+      *reinterpret_cast<void**>(header) = next;
+    } while (!head.compare_exchange_weak(next, header, std::memory_order_release,
+                                         std::memory_order_relaxed));
+  }
+
+  std::size_t size() const {
+    std::size_t total = remoteCount_.load(std::memory_order_relaxed);
+    for (const list& l : lists_) {
+      total += l.count;
+    }
+    return total;
+  }
+
+  void release() {
+    for (std::size_t i = 0; i < lists_.size(); ++i) {
+      collect_remote(i);
+      while (void* object = pop(i)) {
+        ::operator delete(header_of(object));
+      }
+    }
+  }
+
+ private:
+  // Move the blocks freed by other threads to the free lists, up to their bound
+  void collect_remote(std::size_t sizeClass) {
+    void* block = remote_[sizeClass].exchange(nullptr, std::memory_order_acquire);
+    std::size_t collected = 0;
+    while (block != nullptr) {
+      void* next = *static_cast<void**>(block);
+      if (!push(sizeClass, static_cast<block_header*>(block))) {
+        ::operator delete(block);
+      }
+      block = next;
+      ++collected;
+    }
+    remoteCount_.fetch_sub(collected, std::memory_order_relaxed);
+  }
+
+  struct list {
+    void* head = nullptr;
+    std::size_t count = 0;
+  };
+  std::array<list, kSizeClasses> lists_;
+  std::array<std::atomic<void*>, kSizeClasses> remote_{};
+  std::atomic<std::size_t> remoteCount_{0};
+};
+
+//! Pools of the threads which have exited, for reuse by new threads
+//!
+//! Pools are never deleted, as blocks they own may still be freed by other
+//! threads. Their number is bounded by the number of concurrent threads.
+struct idle_pools {
+  std::mutex mutex;
+  std::vector<thread_pool*> pools;
+};
+
+idle_pools& the_idle_pools() {
+  // Never destroyed, as threads may exit during static destruction
+  static auto* idle = new idle_pools;
+  return *idle;
+}
+
+//! Pool of the calling thread, given up when the thread exits
+class thread_pool_owner {
+ public:
+  thread_pool_owner() {
+    idle_pools& idle = the_idle_pools();
+    std::lock_guard<std::mutex> lock{idle.mutex};
+    if (idle.pools.empty()) {
+      pool_ = new thread_pool;
+    } else {
+      pool_ = idle.pools.back();
+      idle.pools.pop_back();
+    }
+  }
+
+  ~thread_pool_owner() {
+    pool_->release();
+    freeListsDestroyed = true;
+    idle_pools& idle = the_idle_pools();
+    std::lock_guard<std::mutex> lock{idle.mutex};
+    idle.pools.push_back(pool_);
+  }
+
+  thread_pool* get() const { return pool_; }
+
+ private:
+  thread_pool* pool_ = nullptr;
+};
+
+thread_pool& this_thread_pool() {
+  static thread_local thread_pool_owner owner;
+  return *owner.get();
+}
+}  // namespace
+
+namespace snemo {
+
+namespace datamodel {
+
+const std::size_t handle_pool::kMaxBlockSize;
+const std::size_t handle_pool::kMaxFreeBlocks;
+
+void* handle_pool::allocate(std::size_t size) {
+  if (size == 0 || size > kMaxBlockSize) {
+    return ::operator new(size);
+  }
+  const std::size_t sizeClass = size_class(size);
+  if (freeListsDestroyed) {
+    return object_of(new_block(sizeClass, nullptr));
+  }
+  thread_pool& pool = this_thread_pool();
+  if (void* object = pool.pop(sizeClass)) {
+    return object;
+  }
+  return object_of(new_block(sizeClass, &pool));
+}
+
+void handle_pool::deallocate(void* block, std::size_t size) noexcept {
+  if (block == nullptr) {
+    return;
+  }
+  if (size == 0 || size > kMaxBlockSize) {
+    ::operator delete(block);
+    return;
+  }
+  // Blocks go back to the pool of their allocating thread, so that threads which
+  // only free records do not keep the blocks the other threads need
+  block_header* header = header_of(block);
+  thread_pool* owner = header->owner;
+  const std::size_t sizeClass = size_class(size);
+  if (owner == nullptr) {
+    ::operator delete(header);
+  } else if (!freeListsDestroyed && owner == &this_thread_pool()) {
+    if (!owner->push(sizeClass, header)) {
+      ::operator delete(header);
+    }
+  } else {
+    owner->push_remote(sizeClass, header);
+  }
+}
+
+std::size_t handle_pool::free_blocks() {
+  return freeListsDestroyed ? 0 : this_thread_pool().size();
+}
+
+void handle_pool::release() {
+  if (!freeListsDestroyed) {
+    this_thread_pool().release();
+  }
+}
+
+}  // end of namespace datamodel
+
+}  // end of namespace snemo
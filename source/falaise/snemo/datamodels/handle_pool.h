@@ -0,0 +1,98 @@
+//! \file falaise/snemo/datamodels/handle_pool.h
+//! \brief Pooled allocation of the objects of the event data model
+#ifndef FALAISE_SNEMO_DATAMODELS_HANDLE_POOL_H
+#define FALAISE_SNEMO_DATAMODELS_HANDLE_POOL_H 1
+
+// Standard library:
+#include <cstddef>
+#include <utility>
+
+// Third party:
+// - Boost:
+#include <boost/make_shared.hpp>
+// - Bayeux/datatools:
+#include <datatools/handle.h>
+
+namespace snemo {
+
+namespace datamodel {
+
+//! \brief Per-thread pool of the memory blocks of small data model objects
+//!
+//! Each event allocates and frees many small objects held by handles (hits,
+//! clusters, trajectories, tracks, blur spots...). Freed blocks are kept in
+//! the free lists of the thread which allocated them, one per size class, and
+//! are reused by its next event instead of going back to the heap. Blocks
+//! freed by other threads, like the flreconstruct writer which releases the
+//! records, are handed back to the allocating thread without locking. The
+//! number of blocks kept per size class is bounded. Blocks larger than
+//! kMaxBlockSize are taken from the heap directly.
+class handle_pool {
+ public:
+  //! Size of the largest pooled block, in bytes
+  static const std::size_t kMaxBlockSize = 512;
+
+  //! Maximum number of free blocks reused per size class and thread
+  static const std::size_t kMaxFreeBlocks = 4096;
+
+  //! Return a block of at least size bytes, suitably aligned for any object
+  static void* allocate(std::size_t size);
+
+  //! Release a block returned by allocate(size)
+  static void deallocate(void* block, std::size_t size) noexcept;
+
+  //! Return the number of free blocks allocated by the calling thread
+  static std::size_t free_blocks();
+
+  //! Return the free blocks of the calling thread to the heap
+  static void release();
+};
+
+//! \brief Allocator drawing memory from the handle_pool
+template <typename T>
+struct pool_allocator {
+  using value_type = T;
+
+  template <typename U>
+  struct rebind {
+    using other = pool_allocator<U>;
+  };
+
+  pool_allocator() = default;
+
+  template <typename U>
+  pool_allocator(const pool_allocator<U>& /*other*/) {}
+
+  T* allocate(std::size_t n) { return static_cast<T*>(handle_pool::allocate(n * sizeof(T))); }
+
+  void deallocate(T* p, std::size_t n) noexcept { handle_pool::deallocate(p, n * sizeof(T)); }
+};
+
+template <typename T, typename U>
+bool operator==(const pool_allocator<T>& /*lhs*/, const pool_allocator<U>& /*rhs*/) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const pool_allocator<T>& /*lhs*/, const pool_allocator<U>& /*rhs*/) {
+  return false;
+}
+
+//! Return a handle on a new T constructed from args, with the object and its
+//! reference count allocated together in the handle_pool
+//!
+//! A drop-in replacement for datatools::make_handle for per-event objects:
+//! ```cpp
+//! auto hit = snemo::datamodel::make_pooled_handle<calibrated_tracker_hit>();
+//! ```
+template <typename T, typename... Args>
+datatools::handle<T> make_pooled_handle(Args&&... args) {
+  return datatools::handle<T>(
+      boost::allocate_shared<T>(pool_allocator<T>(), std::forward<Args>(args)...));
+}
+
+}  // end of namespace datamodel
+
+}  // end of namespace snemo
+
+#endif  // FALAISE_SNEMO_DATAMODELS_HANDLE_POOL_H
@@ -0,0 +1,24 @@
+// falaise/snemo/datamodels/hit_encoding.cc
+
+// Ourselves:
+#include <falaise/snemo/datamodels/hit_encoding.h>
+
+// Standard library:
+#include <atomic>
+
+namespace {
+// Read by the threads writing records, e.g. the flreconstruct writer
+std::atomic<bool> compactHitEncoding{false};
+}  // namespace
+
+namespace snemo {
+
+namespace datamodel {
+
+void set_compact_hit_encoding(bool compact) { compactHitEncoding = compact; }
+
+bool is_compact_hit_encoding() { return compactHitEncoding; }
+
+}  // end of namespace datamodel
+
+}  // end of namespace snemo
@@ -0,0 +1,26 @@
+//! \file falaise/snemo/datamodels/hit_encoding.h
+//! \brief Choice of the encoding of the calibrated hits written to archives
+#ifndef FALAISE_SNEMO_DATAMODELS_HIT_ENCODING_H
+#define FALAISE_SNEMO_DATAMODELS_HIT_ENCODING_H 1
+
+namespace snemo {
+
+namespace datamodel {
+
+//! Write the calibrated tracker and calorimeter hits in their compact encoding
+//!
+//! Hits are written at full precision by default. The compact encoding drops
+//! the class header of geomtools::base_hit and stores real quantities as 32 bits
+//! floats, so that hits read back are only equal to 6e-8 relative precision.
+//! The choice applies to all archives written afterwards by the process. Hits
+//! are read back from files written in either encoding.
+void set_compact_hit_encoding(bool compact);
+
+//! Return true if calibrated hits are written in their compact encoding
+bool is_compact_hit_encoding();
+
+}  // end of namespace datamodel
+
+}  // end of namespace snemo
+
+#endif  // FALAISE_SNEMO_DATAMODELS_HIT_ENCODING_H
@@ -0,0 +1,136 @@
+/// \file falaise/snemo/datamodels/packed_bank.cc
+
+// Ourselves:
+#include <falaise/snemo/datamodels/packed_bank.h>
+
+// Standard library:
+#include <sstream>
+#include <utility>
+#include <vector>
+
+// Third party:
+// - Bayeux/datatools:
+#include <datatools/eos/portable_iarchive.hpp>
+#include <datatools/eos/portable_oarchive.hpp>
+#include <datatools/exception.h>
+// - Bayeux/mctools:
+#include <mctools/simulated_data.h>
+
+// This project:
+#include <falaise/snemo/datamodels/calibrated_data.h>
+#include <falaise/snemo/datamodels/event_header.h>
+#include <falaise/snemo/datamodels/particle_track_data.h>
+#include <falaise/snemo/datamodels/tracker_clustering_data.h>
+#include <falaise/snemo/datamodels/tracker_trajectory_data.h>
+
+namespace {
+//! Packing and unpacking functions of a type of bank
+struct bank_codec {
+  const std::string* serialTag;
+  bool (*holds)(const datatools::things&, const std::string&);
+  std::string (*pack)(const datatools::things&, const std::string&);
+  void (*unpack)(const std::string&, datatools::things&, const std::string&,
+                 const std::string&);
+};
+
+template <typename T>
+bank_codec make_codec() {
+  bank_codec codec;
+  codec.serialTag = &T::SERIAL_TAG;
+  codec.holds = [](const datatools::things& record, const std::string& label) {
+    return record.is_a<T>(label);
+  };
+  codec.pack = [](const datatools::things& record, const std::string& label) {
+    std::ostringstream out(std::ios::out | std::ios::binary);
+    {
+      eos::portable_oarchive archive(out);
+      archive << record.get<T>(label);
+    }
+    return out.str();
+  };
+  codec.unpack = [](const std::string& bytes, datatools::things& record, const std::string& label,
+                    const std::string& description) {
+    T& bank = record.add<T>(label, description);
+    std::istringstream in(bytes, std::ios::in | std::ios::binary);
+    eos::portable_iarchive archive(in);
+    archive >> bank;
+  };
+  return codec;
+}
+
+const std::vector<bank_codec>& codecs() {
+  namespace sdm = snemo::datamodel;
+  static const std::vector<bank_codec> table{make_codec<sdm::event_header>(),
+                                             make_codec<mctools::simulated_data>(),
+                                             make_codec<sdm::calibrated_data>(),
+                                             make_codec<sdm::tracker_clustering_data>(),
+                                             make_codec<sdm::tracker_trajectory_data>(),
+                                             make_codec<sdm::particle_track_data>()};
+  return table;
+}
+}  // namespace
+
+namespace snemo {
+
+namespace datamodel {
+
+// Serial tag for datatools::i_serializable interface :
+DATATOOLS_SERIALIZATION_SERIAL_TAG_IMPLEMENTATION(packed_bank, "snemo::datamodel::packed_bank")
+
+void packed_bank::assign(const std::string& bankSerialTag, std::string bytes) {
+  bankSerialTag_ = bankSerialTag;
+  bytes_ = std::move(bytes);
+}
+
+bool is_packed_bank(const datatools::things& record, const std::string& label) {
+  return record.has(label) && record.is_a<packed_bank>(label);
+}
+
+void pack_bank(datatools::things& record, const std::string& label) {
+  if (is_packed_bank(record, label)) {
+    return;
+  }
+  for (const bank_codec& codec : codecs()) {
+    if (codec.holds(record, label)) {
+      std::string bytes = codec.pack(record, label);
+      const std::string description = record.get_entry_description(label);
+      record.remove(label);
+      record.add<packed_bank>(label, description).assign(*codec.serialTag, std::move(bytes));
+      return;
+    }
+  }
+  DT_THROW(std::logic_error, "Bank '" << label << "' of type '"
+                                      << record.get_entry_serial_tag(label)
+                                      << "' cannot be packed!");
+}
+
+void unpack_bank(datatools::things& record, const std::string& label) {
+  if (!is_packed_bank(record, label)) {
+    return;
+  }
+  const std::string serialTag = record.get<packed_bank>(label).get_bank_serial_tag();
+  for (const bank_codec& codec : codecs()) {
+    if (*codec.serialTag == serialTag) {
+      // The archive must outlive the packed bank, which is removed first
+      const std::string bytes = record.get<packed_bank>(label).get_bytes();
+      const std::string description = record.get_entry_description(label);
+      record.remove(label);
+      codec.unpack(bytes, record, label, description);
+      return;
+    }
+  }
+  DT_THROW(std::logic_error,
+           "Packed bank '" << label << "' holds unknown type '" << serialTag << "'!");
+}
+
+void unpack_banks(datatools::things& record) {
+  std::vector<std::string> labels;
+  record.get_names(labels);
+  for (const std::string& label : labels) {
+    unpack_bank(record, label);
+  }
+}
+
+}  // end of namespace datamodel
+
+}  // end of namespace snemo
@@ -0,0 +1,72 @@
+/// \file falaise/snemo/datamodels/packed_bank.h
+/// \brief Bank of an event record kept in its serialized form
+#ifndef FALAISE_SNEMO_DATAMODELS_PACKED_BANK_H
+#define FALAISE_SNEMO_DATAMODELS_PACKED_BANK_H 1
+
+// Standard library:
+#include <cstddef>
+#include <string>
+
+// Third party:
+// - Boost:
+#include <boost/serialization/access.hpp>
+// - Bayeux/datatools :
+#include <bayeux/datatools/i_serializable.h>
+#include <bayeux/datatools/things.h>
+
+namespace snemo {
+
+namespace datamodel {
+
+/// \brief A bank of an event record, stored as the bytes of its own archive
+///
+/// A packed bank replaces a standard bank in an event record, under the same
+/// label. Reading a record then only copies the bytes of the bank, which is
+/// decoded when it is first accessed through unpack_bank() (as done by the
+/// snedm::getFromEvent and snedm::getOrAddToEvent accessors). A bank which is
+/// never accessed is written back as is, without being decoded.
+class packed_bank : public datatools::i_serializable {
+ public:
+  /// Return the serial tag of the bank held
+  const std::string& get_bank_serial_tag() const { return bankSerialTag_; }
+
+  /// Return the archive of the bank held
+  const std::string& get_bytes() const { return bytes_; }
+
+  /// Return the size in bytes of the archive of the bank held
+  std::size_t size() const { return bytes_.size(); }
+
+  /// Set the bank held from its serial tag and archive
+  void assign(const std::string& bankSerialTag, std::string bytes);
+
+ private:
+  std::string bankSerialTag_{};  //!< Serial tag of the bank held
+  std::string bytes_{};          //!< Portable binary archive of the bank held
+
+  DATATOOLS_SERIALIZATION_DECLARATION()
+};
+
+/// Return true if the bank at label in record is packed
+bool is_packed_bank(const datatools::things& record, const std::string& label);
+
+/// Replace the bank at label in record by its packed form
+/// Packed banks are left as is. Only the standard banks (event header,
+/// simulated, calibrated, tracker clustering, tracker trajectory and
+/// particle track data) can be packed; std::logic_error is thrown otherwise.
+void pack_bank(datatools::things& record, const std::string& label);
+
+/// Replace the packed bank at label in record by the bank it holds
+/// Banks which are not packed are left as is.
+void unpack_bank(datatools::things& record, const std::string& label);
+
+/// Unpack all packed banks of record
+void unpack_banks(datatools::things& record);
+
+}  // end of namespace datamodel
+
+}  // end of namespace snemo
+
+#include <boost/serialization/export.hpp>
+BOOST_CLASS_EXPORT_KEY2(snemo::datamodel::packed_bank, "snemo::datamodel::packed_bank")
+
+#endif  // FALAISE_SNEMO_DATAMODELS_PACKED_BANK_H
@@ -0,0 +1,192 @@
+// falaise/snemo/datamodels/record_index.cc
+
+// Ourselves:
+#include <falaise/snemo/datamodels/record_index.h>
+
+// Standard library:
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+// Third party:
+// - Boost:
+#include <boost/filesystem.hpp>
+// - Bayeux/datatools:
+#include <datatools/exception.h>
+#include <datatools/utils.h>
+
+// This project:
+#include <falaise/snemo/datamodels/data_model.h>
+#include <falaise/snemo/datamodels/event_header.h>
+#include <falaise/snemo/datamodels/packed_bank.h>
+
+namespace {
+//! Header of a record index file, followed by the entries
+struct index_header {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  uint64_t dataFileSize;
+  uint64_t count;
+};
+static_assert(std::is_standard_layout<index_header>::value && sizeof(index_header) == 32,
+              "record index header must have a fixed layout");
+static_assert(std::is_standard_layout<snemo::datamodel::record_index_entry>::value &&
+                  sizeof(snemo::datamodel::record_index_entry) == 24,
+              "record index entries must have a fixed layout");
+
+const char kMagic[8] = {'S', 'N', 'R', 'I', 'N', 'D', 'E', 'X'};
+
+// Written as is, so reads back differently on a machine of the other endianness
+const uint32_t kByteOrderMark = 0x01020304;
+
+std::string resolved_path(const std::string& path) {
+  std::string resolved = path;
+  datatools::fetch_path_with_env(resolved);
+  return resolved;
+}
+}  // namespace
+
+namespace snemo {
+
+namespace datamodel {
+
+uint32_t record_bank_flags(const datatools::things& record) {
+  uint32_t flags = 0;
+  std::size_t standardBanks = 0;
+  auto flag = [&](const std::string& label, uint32_t bit) {
+    if (record.has(label)) {
+      flags |= bit;
+      ++standardBanks;
+    }
+  };
+  flag(snedm::labels::event_header(), BANK_EH);
+  flag(snedm::labels::simulated_data(), BANK_SD);
+  flag(snedm::labels::calibrated_data(), BANK_CD);
+  flag(snedm::labels::tracker_clustering_data(), BANK_TCD);
+  flag(snedm::labels::tracker_trajectory_data(), BANK_TTD);
+  flag(snedm::labels::particle_track_data(), BANK_PTD);
+  if (record.size() > standardBanks) {
+    flags |= BANK_OTHER;
+  }
+  return flags;
+}
+
+std::string record_index::sidecar_path(const std::string& dataFile) { return dataFile + ".idx"; }
+
+void record_index::add(const datatools::things& record) {
+  record_index_entry entry;
+  entry.entry = entries_.size();
+  entry.banks = record_bank_flags(record);
+  const std::string& ehLabel = snedm::labels::event_header();
+  if ((entry.banks & BANK_EH) != 0u) {
+    const datatools::things* holder = &record;
+    // A packed header is decoded in a scratch record, the record itself is left as is
+    datatools::things unpacked;
+    if (is_packed_bank(record, ehLabel)) {
+      const packed_bank& packed = record.get<packed_bank>(ehLabel);
+      unpacked.add<packed_bank>(ehLabel).assign(packed.get_bank_serial_tag(), packed.get_bytes());
+      unpack_bank(unpacked, ehLabel);
+      holder = &unpacked;
+    }
+    if (holder->is_a<event_header>(ehLabel)) {
+      const datatools::event_id& id = holder->get<event_header>(ehLabel).get_id();
+      entry.run = id.get_run_number();
+      entry.event = id.get_event_number();
+    }
+  }
+  entries_.push_back(entry);
+  add_position(entry, entries_.size() - 1);
+}
+
+void record_index::add_position(const record_index_entry& entry, std::size_t position) {
+  positions_.emplace(std::make_pair(entry.run, entry.event), position);
+}
+
+void record_index::clear() {
+  entries_.clear();
+  positions_.clear();
+}
+
+std::size_t record_index::find(int32_t run, int32_t event) const {
+  const auto found = positions_.find(std::make_pair(run, event));
+  return found != positions_.end() ? found->second : npos;
+}
+
+std::vector<std::size_t> record_index::select(uint32_t requiredBanks) const {
+  std::vector<std::size_t> selected;
+  for (std::size_t i = 0; i < entries_.size(); ++i) {
+    if ((entries_[i].banks & requiredBanks) == requiredBanks) {
+      selected.push_back(i);
+    }
+  }
+  return selected;
+}
+
+void record_index::write(const std::string& dataFile) const {
+  const std::string dataPath = resolved_path(dataFile);
+  boost::system::error_code ec;
+  const uintmax_t dataSize = boost::filesystem::file_size(dataPath, ec);
+  DT_THROW_IF(ec, std::runtime_error, "Cannot stat data file '" << dataPath << "'!");
+
+  index_header header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kFormatVersion;
+  header.byteOrderMark = kByteOrderMark;
+  header.dataFileSize = dataSize;
+  header.count = entries_.size();
+
+  const std::string indexPath = sidecar_path(dataPath);
+  std::ofstream fout(indexPath.c_str(), std::ios::binary | std::ios::trunc);
+  DT_THROW_IF(!fout, std::runtime_error, "Cannot open file '" << indexPath << "'!");
+  fout.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  fout.write(reinterpret_cast<const char*>(entries_.data()),
+             entries_.size() * sizeof(record_index_entry));
+  fout.close();
+  DT_THROW_IF(!fout, std::runtime_error, "Cannot write file '" << indexPath << "'!");
+}
+
+bool record_index::read(const std::string& dataFile) {
+  clear();
+  const std::string dataPath = resolved_path(dataFile);
+  std::ifstream fin(sidecar_path(dataPath).c_str(), std::ios::binary);
+  if (!fin) {
+    return false;
+  }
+
+  index_header header;
+  if (!fin.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+    return false;
+  }
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+      header.byteOrderMark != kByteOrderMark || header.version != kFormatVersion) {
+    return false;
+  }
+
+  // An index written for a previous version of the data file is ignored
+  boost::system::error_code ec;
+  const uintmax_t dataSize = boost::filesystem::file_size(dataPath, ec);
+  if (ec || dataSize != header.dataFileSize) {
+    return false;
+  }
+  const uintmax_t indexSize = boost::filesystem::file_size(sidecar_path(dataPath), ec);
+  if (ec || (indexSize - sizeof(header)) / sizeof(record_index_entry) != header.count) {
+    return false;
+  }
+
+  std::vector<record_index_entry> entries(header.count);
+  if (!fin.read(reinterpret_cast<char*>(entries.data()),
+                entries.size() * sizeof(record_index_entry))) {
+    return false;
+  }
+  entries_.swap(entries);
+  for (std::size_t i = 0; i < entries_.size(); ++i) {
+    add_position(entries_[i], i);
+  }
+  return true;
+}
+
+}  // end of namespace datamodel
+
+}  // end of namespace snemo
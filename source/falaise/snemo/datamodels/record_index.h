@@ -0,0 +1,103 @@
+//! \file falaise/snemo/datamodels/record_index.h
+//! \brief Index of the event records of a data file, stored in a sidecar file
+#ifndef FALAISE_SNEMO_DATAMODEL_RECORD_INDEX_H
+#define FALAISE_SNEMO_DATAMODEL_RECORD_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <bayeux/datatools/things.h>
+
+namespace snemo {
+
+namespace datamodel {
+
+//! \brief Flags of the standard banks present in an event record
+enum record_bank_flag : uint32_t {
+  BANK_EH = 0x1,           //!< Event header
+  BANK_SD = 0x2,           //!< Simulated data
+  BANK_CD = 0x4,           //!< Calibrated data
+  BANK_TCD = 0x8,          //!< Tracker clustering data
+  BANK_TTD = 0x10,         //!< Tracker trajectory data
+  BANK_PTD = 0x20,         //!< Particle track data
+  BANK_OTHER = 0x80000000  //!< Any non-standard bank
+};
+
+//! Return the flags of the banks present in record
+uint32_t record_bank_flags(const datatools::things& record);
+
+//! \brief Location and contents summary of one event record
+struct record_index_entry {
+  int32_t run = -1;       //!< Run number, -1 if the record has no event header
+  int32_t event = -1;     //!< Event number, -1 if the record has no event header
+  uint64_t entry = 0;     //!< Position of the record among the event records of the file
+  uint32_t banks = 0;     //!< Flags of the banks present in the record
+  uint32_t reserved = 0;  //!< Padding to a fixed layout, always 0
+};
+
+//! \brief Index of the event records of a data file
+//!
+//! The index is written next to the data file, in "<file>.idx", once the
+//! data file is closed. It records the size of the data file so that an
+//! index which does not match its data file any more is ignored. It gives
+//! the number of records of a file without opening it, the entry of a given
+//! event, and lets readers select records from the banks they contain
+//! without deserializing them.
+//!
+//! Records are addressed by their entry, which brio readers load directly.
+//! Boost archives cannot be positioned, so their index only serves to count
+//! and select records: they must still be read sequentially up to an entry.
+class record_index {
+ public:
+  //! Version of the file format written by write()
+  static const uint32_t kFormatVersion = 1;
+
+  //! Value returned by find() for an event which is not indexed
+  static const std::size_t npos = static_cast<std::size_t>(-1);
+
+  //! Return the path of the index of dataFile
+  static std::string sidecar_path(const std::string& dataFile);
+
+  //! Append the record written at the next entry of the data file
+  void add(const datatools::things& record);
+
+  //! Remove all entries
+  void clear();
+
+  //! Return the number of indexed records
+  std::size_t size() const { return entries_.size(); }
+
+  //! Return the entries, in file order
+  const std::vector<record_index_entry>& entries() const { return entries_; }
+
+  //! Return the position of the first record of event (run, event), or npos
+  std::size_t find(int32_t run, int32_t event) const;
+
+  //! Return the positions of the records holding all banks flagged in requiredBanks
+  std::vector<std::size_t> select(uint32_t requiredBanks) const;
+
+  //! Write the index of dataFile, which must be closed, to its sidecar file
+  //! Throws std::runtime_error if the index cannot be written
+  void write(const std::string& dataFile) const;
+
+  //! Load the index of dataFile from its sidecar file
+  //! Return false if there is no index, or if it is invalid or does not match dataFile
+  bool read(const std::string& dataFile);
+
+ private:
+  //! Record the position of entry in the lookup by event ID, unless it is already there
+  void add_position(const record_index_entry& entry, std::size_t position);
+
+  std::vector<record_index_entry> entries_;  //!< Indexed records, in file order
+  std::map<std::pair<int32_t, int32_t>, std::size_t> positions_;  //!< Position of each event ID
+};
+
+}  // end of namespace datamodel
+
+}  // end of namespace snemo
+
+#endif  // FALAISE_SNEMO_DATAMODEL_RECORD_INDEX_H
@@ -6,6 +6,9 @@
 // Ourselves:
 #include <falaise/snemo/datamodels/tracker_clustering_solution.h>
 
+// This project:
+#include <falaise/snemo/datamodels/handle_pool.h>
+
 namespace snemo {
 
 namespace datamodel {
@@ -236,7 +239,7 @@ int tracker_clustering_solution::copy_one_solution_in_one(
     // Pickup cluster from the solution:
     const auto &a_cluster_hdl = src_clusters.at(icluster_source);
     // Create a new cluster from the old::
-    auto hcl = datatools::make_handle<tracker_cluster>(*a_cluster_hdl);
+    auto hcl = make_pooled_handle<tracker_cluster>(*a_cluster_hdl);
     // But give it an unique Id:
     hcl->set_cluster_id(max_cluster_id + icluster_source + 1);
     tgt_clusters.push_back(hcl);
@@ -291,7 +294,7 @@ int tracker_clustering_solution::merge_two_solutions_in_ones(
       // Pickup a cluster from the solution:
       const tracker_cluster &a_cluster = rsol.get_clusters().at(icluster_source).get();
       // Create a new cluster:
-      auto hcl = datatools::make_handle<tracker_cluster>();
+      auto hcl = make_pooled_handle<tracker_cluster>();
       tracker_cluster &cl = hcl.grab();
       // Copy the original cluster into the new one:
       cl = a_cluster;
@@ -0,0 +1,291 @@
+// falaise/snemo/geometry/magnetic_field_map.cc
+
+// Ourselves:
+#include <falaise/snemo/geometry/magnetic_field_map.h>
+
+// Standard library:
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+// POSIX:
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Third party:
+// - Boost:
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+// - Bayeux/datatools:
+#include <datatools/clhep_units.h>
+#include <datatools/exception.h>
+#include <datatools/units.h>
+#include <datatools/utils.h>
+
+namespace {
+// http://stackoverflow.com/questions/6089231/getting-std-ifstream-to-handle-lf-cr-and-crlf
+std::istream& safe_getline(std::istream& in_, std::string& out_) {
+  out_.clear();
+  // The characters in the stream are read one-by-one using a std::streambuf.
+  // That is faster than reading them one-by-one using the std::istream.
+  // Code that uses streambuf this way must be guarded by a sentry object.
+  // The sentry object performs various tasks,
+  // such as thread synchronization and updating the stream state.
+  std::istream::sentry se(in_, true);
+  std::streambuf* sb = in_.rdbuf();
+  for (;;) {
+    int c = sb->sbumpc();
+    switch (c) {
+      case '\n':
+        return in_;
+      case '\r':
+        if (sb->sgetc() == '\n') {
+          sb->sbumpc();
+        }
+        return in_;
+      case EOF:
+        // Also handle the case when the last line has no line ending
+        if (out_.empty()) {
+          in_.setstate(std::ios::eofbit);
+        }
+        return in_;
+      default:
+        out_ += (char)c;
+    }
+  }
+}
+
+//! Header of a binary field map file
+//!
+//! Lengths and field unit are stored in CLHEP internal units. Components
+//! start at dataOffset bytes from the start of the file.
+struct binary_header {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  uint32_t nx;
+  uint32_t ny;
+  uint32_t nz;
+  uint32_t reserved;
+  double origin[3];
+  double step[3];
+  double fieldUnit;
+  uint64_t dataOffset;
+  uint64_t dataCount;
+  uint64_t checksum;
+};
+static_assert(std::is_standard_layout<binary_header>::value && sizeof(binary_header) == 112,
+              "binary field map header must have a fixed layout");
+
+const char kMagic[8] = {'S', 'N', 'B', 'F', 'M', 'A', 'P', '\0'};
+
+// Written as is, so reads back differently on a machine of the other endianness
+const uint32_t kByteOrderMark = 0x01020304;
+
+// Components start on a cache line boundary
+const uint64_t kDataOffset = 128;
+
+// 64 bits FNV-1a hash of the component bytes
+uint64_t checksum(const int32_t* data, std::size_t count) {
+  uint64_t hash = 14695981039346656037ULL;
+  const auto* bytes = reinterpret_cast<const unsigned char*>(data);
+  for (std::size_t i = 0; i < count * sizeof(int32_t); ++i) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+// Return true if count == 3 * nx * ny * nz, without computing the product which may overflow
+bool matches_grid_size(uint64_t count, uint64_t nx, uint64_t ny, uint64_t nz) {
+  if (nx == 0 || ny == 0 || nz == 0) {
+    return count == 0;
+  }
+  if (count % 3 != 0 || (count / 3) % nx != 0 || (count / 3 / nx) % ny != 0) {
+    return false;
+  }
+  return count / 3 / nx / ny == nz;
+}
+
+// Return a description of what is wrong with the mapped file, or an empty string
+// Components are only read to verify their checksum if verifyChecksum is set
+std::string check_binary_map(const void* address, std::size_t length, bool verifyChecksum) {
+  const auto* header = static_cast<const binary_header*>(address);
+  if (std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0) {
+    return "not a binary field map";
+  }
+  if (header->byteOrderMark != kByteOrderMark) {
+    return "written on a machine with a different byte order";
+  }
+  if (header->version != snemo::geometry::binary_field_map::kFormatVersion) {
+    return "unsupported format version " + std::to_string(header->version);
+  }
+  if (!matches_grid_size(header->dataCount, header->nx, header->ny, header->nz)) {
+    return "number of components does not match the grid size";
+  }
+  if (header->dataOffset < sizeof(binary_header) || header->dataOffset % alignof(int32_t) != 0) {
+    return "invalid offset of the components";
+  }
+  // Compare counts rather than byte sizes, which may overflow
+  if (header->dataOffset > length ||
+      header->dataCount > (length - header->dataOffset) / sizeof(int32_t)) {
+    return "truncated file";
+  }
+  if (verifyChecksum) {
+    const auto* data =
+        reinterpret_cast<const int32_t*>(static_cast<const char*>(address) + header->dataOffset);
+    if (checksum(data, header->dataCount) != header->checksum) {
+      return "checksum mismatch";
+    }
+  }
+  return {};
+}
+}  // namespace
+
+namespace snemo {
+
+namespace geometry {
+
+std::vector<int32_t> read_csv_field_map(const std::string& path, field_map_layout& layout) {
+  const double length_unit = CLHEP::meter;
+  const double mag_field_unit = datatools::units::milli() * CLHEP::gauss;
+
+  std::string mfn = path;
+  datatools::fetch_path_with_env(mfn);
+  std::ifstream fin(mfn.c_str());
+  DT_THROW_IF(!fin, std::runtime_error, "Cannot open file '" << mfn << "'!");
+
+  {
+    // Read header line:
+    std::string header_line;
+    safe_getline(fin, header_line);
+    DT_THROW_IF(!fin, std::runtime_error, "Cannot read map file header!");
+
+    std::vector<std::string> htokens;
+    boost::split(htokens, header_line, boost::is_any_of(","));
+    DT_THROW_IF(htokens.size() != 9, std::logic_error, "Invalid header line format!");
+    layout.nx = boost::lexical_cast<unsigned int>(htokens[0]);
+    layout.ny = boost::lexical_cast<unsigned int>(htokens[1]);
+    layout.nz = boost::lexical_cast<unsigned int>(htokens[2]);
+
+    double x0 = boost::lexical_cast<double>(htokens[3]);
+    double y0 = boost::lexical_cast<double>(htokens[4]);
+    double z0 = boost::lexical_cast<double>(htokens[5]);
+    layout.origin.set(x0 * length_unit, y0 * length_unit, z0 * length_unit);
+    layout.step.set(boost::lexical_cast<double>(htokens[6]) * length_unit,
+                    boost::lexical_cast<double>(htokens[7]) * length_unit,
+                    boost::lexical_cast<double>(htokens[8]) * length_unit);
+    layout.fieldUnit = mag_field_unit;
+  }
+
+  // Read map, one line per (axis, z, y) triplet:
+  std::vector<int32_t> components(layout.size());
+  for (size_t ax = 0; ax < 3; ax++) {
+    for (size_t iz = 0; iz < layout.nz; iz++) {
+      for (size_t iy = 0; iy < layout.ny; iy++) {
+        std::string bmap_line;
+        safe_getline(fin, bmap_line);
+        std::vector<std::string> btokens;
+        boost::split(btokens, bmap_line, boost::is_any_of(","));
+        DT_THROW_IF(btokens.size() != layout.nx + 3, std::logic_error, "Invalid B-line format!");
+        auto axi = boost::lexical_cast<unsigned int>(btokens[0]);
+        auto iyi = boost::lexical_cast<unsigned int>(btokens[1]);
+        auto izi = boost::lexical_cast<unsigned int>(btokens[2]);
+        DT_THROW_IF(axi != ax || iyi != iy || izi != iz, std::logic_error,
+                    "Invalid B map line format!");
+        for (size_t ix = 0; ix < layout.nx; ix++) {
+          components[layout.index(ix, iy, iz) + ax] = boost::lexical_cast<int>(btokens[ix + 3]);
+        }
+      }
+    }
+  }
+  return components;
+}
+
+void write_binary_field_map(const std::string& path, const field_map_layout& layout,
+                            const std::vector<int32_t>& components) {
+  DT_THROW_IF(components.size() != layout.size(), std::logic_error,
+              "Number of components does not match the grid size!");
+
+  binary_header header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = binary_field_map::kFormatVersion;
+  header.byteOrderMark = kByteOrderMark;
+  header.nx = layout.nx;
+  header.ny = layout.ny;
+  header.nz = layout.nz;
+  for (int i = 0; i < 3; ++i) {
+    header.origin[i] = layout.origin[i];
+    header.step[i] = layout.step[i];
+  }
+  header.fieldUnit = layout.fieldUnit;
+  header.dataOffset = kDataOffset;
+  header.dataCount = components.size();
+  header.checksum = checksum(components.data(), components.size());
+
+  std::string mfn = path;
+  datatools::fetch_path_with_env(mfn);
+  std::ofstream fout(mfn.c_str(), std::ios::binary | std::ios::trunc);
+  DT_THROW_IF(!fout, std::runtime_error, "Cannot open file '" << mfn << "'!");
+  const char padding[kDataOffset - sizeof(binary_header)] = {};
+  fout.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  fout.write(padding, sizeof(padding));
+  fout.write(reinterpret_cast<const char*>(components.data()),
+             components.size() * sizeof(int32_t));
+  fout.close();
+  DT_THROW_IF(!fout, std::runtime_error, "Cannot write file '" << mfn << "'!");
+}
+
+binary_field_map::binary_field_map(const std::string& path, bool verifyChecksum) {
+  std::string mfn = path;
+  datatools::fetch_path_with_env(mfn);
+
+  int fd = ::open(mfn.c_str(), O_RDONLY);
+  DT_THROW_IF(fd < 0, std::runtime_error,
+              "Cannot open file '" << mfn << "': " << std::strerror(errno));
+  struct stat info;
+  const bool sizeOk =
+      ::fstat(fd, &info) == 0 && info.st_size >= static_cast<off_t>(sizeof(binary_header));
+  void* address = MAP_FAILED;
+  int mapError = 0;
+  if (sizeOk) {
+    length_ = info.st_size;
+    address = ::mmap(nullptr, length_, PROT_READ, MAP_SHARED, fd, 0);
+    mapError = errno;
+  }
+  // The mapping stays valid once the descriptor is closed
+  ::close(fd);
+  DT_THROW_IF(!sizeOk, std::runtime_error, "File '" << mfn << "' is not a binary field map!");
+  DT_THROW_IF(address == MAP_FAILED, std::runtime_error,
+              "Cannot map file '" << mfn << "' into memory: " << std::strerror(mapError));
+
+  std::string error = check_binary_map(address, length_, verifyChecksum);
+  if (!error.empty()) {
+    ::munmap(address, length_);
+    DT_THROW(std::runtime_error, "Invalid binary field map '" << mfn << "': " << error << "!");
+  }
+  address_ = address;
+
+  const auto* header = static_cast<const binary_header*>(address_);
+  layout_.nx = header->nx;
+  layout_.ny = header->ny;
+  layout_.nz = header->nz;
+  layout_.origin.set(header->origin[0], header->origin[1], header->origin[2]);
+  layout_.step.set(header->step[0], header->step[1], header->step[2]);
+  layout_.fieldUnit = header->fieldUnit;
+  data_ = reinterpret_cast<const int32_t*>(static_cast<const char*>(address_) + header->dataOffset);
+}
+
+binary_field_map::~binary_field_map() {
+  if (address_ != nullptr) {
+    ::munmap(address_, length_);
+  }
+}
+
+}  // end of namespace geometry
+
+}  // end of namespace snemo
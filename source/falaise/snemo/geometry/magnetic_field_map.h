@@ -0,0 +1,91 @@
+//! \file falaise/snemo/geometry/magnetic_field_map.h
+//! \brief Storage and file formats of sampled magnetic field maps
+#ifndef FALAISE_SNEMO_GEOMETRY_MAGNETIC_FIELD_MAP_H
+#define FALAISE_SNEMO_GEOMETRY_MAGNETIC_FIELD_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <bayeux/geomtools/utils.h>
+
+namespace snemo {
+
+namespace geometry {
+
+//! \brief Regular grid on which a magnetic field map is sampled
+//!
+//! Field components are integers in units of fieldUnit, interleaved per grid
+//! node so that the three components of a node are contiguous. Node (ix, iy, iz)
+//! sits at origin + (ix * step.x(), iy * step.y(), iz * step.z()) in the frame
+//! of the map.
+struct field_map_layout {
+  uint32_t nx = 0;                                               //!< Number of nodes along X
+  uint32_t ny = 0;                                               //!< Number of nodes along Y
+  uint32_t nz = 0;                                               //!< Number of nodes along Z
+  geomtools::vector_3d origin = geomtools::invalid_vector_3d();  //!< Position of node (0,0,0)
+  geomtools::vector_3d step = geomtools::invalid_vector_3d();    //!< Distance between nodes
+  double fieldUnit = 0.0;                                        //!< Unit of stored components
+
+  //! Return the number of stored components
+  std::size_t size() const { return std::size_t{3} * nx * ny * nz; }
+
+  //! Return the index of the X component of node (ix, iy, iz)
+  std::size_t index(uint32_t ix, uint32_t iy, uint32_t iz) const {
+    return std::size_t{3} * ((std::size_t{iz} * ny + iy) * nx + ix);
+  }
+};
+
+//! Read a map from a "csv_map_0" text file into layout and return its components
+//!
+//! The path may use the "@falaise:" resource prefix and environment variables.
+//! Throws std::runtime_error if the file cannot be read, std::logic_error if
+//! its contents are malformed.
+std::vector<int32_t> read_csv_field_map(const std::string& path, field_map_layout& layout);
+
+//! Write a map to a binary file readable by binary_field_map
+void write_binary_field_map(const std::string& path, const field_map_layout& layout,
+                            const std::vector<int32_t>& components);
+
+//! \brief Read-only view of a binary field map file mapped into memory
+//!
+//! The file starts with a fixed size header recording a format version,
+//! the byte order and grid layout, and a checksum of the components which
+//! follow it. As the file is mapped read-only and shared, concurrent jobs on
+//! one node share a single physical copy of the map through the page cache.
+//! The checksum is only verified on request, as flconvertbfieldmap does once
+//! the file is written, so that mapping a file does not read all of it.
+class binary_field_map {
+ public:
+  //! Version of the file format written by write_binary_field_map
+  static const uint32_t kFormatVersion = 1;
+
+  //! Map the file at path, throwing std::runtime_error if it is not a valid map
+  //! If verifyChecksum is set, the components are read to check the checksum of the file
+  explicit binary_field_map(const std::string& path, bool verifyChecksum = false);
+
+  //! Unmap the file
+  ~binary_field_map();
+
+  binary_field_map(const binary_field_map&) = delete;
+  binary_field_map& operator=(const binary_field_map&) = delete;
+
+  //! Return the grid layout
+  const field_map_layout& layout() const { return layout_; }
+
+  //! Return the field components
+  const int32_t* data() const { return data_; }
+
+ private:
+  void* address_ = nullptr;        //!< Start of the mapping
+  std::size_t length_ = 0;         //!< Length of the mapping
+  field_map_layout layout_;        //!< Grid layout read from the header
+  const int32_t* data_ = nullptr;  //!< Components, pointing into the mapping
+};
+
+}  // end of namespace geometry
+
+}  // end of namespace snemo
+
+#endif  // FALAISE_SNEMO_GEOMETRY_MAGNETIC_FIELD_MAP_H
@@ -24,229 +24,149 @@
 #include <falaise/snemo/geometry/mapped_magnetic_field.h>
 
 // Standard library:
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
 #include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 
 // Third party:
-// - Boost:
-#if defined(__GNUC__)
-#define BOOST_SYSTEM_NO_DEPRECATED 1
-#endif
-#include <boost/filesystem.hpp>
-#if defined(__GNUC__)
-#undef BOOST_SYSTEM_NO_DEPRECATED
-#endif
-#include <boost/algorithm/string.hpp>
-#include <boost/lexical_cast.hpp>
 // - Bayeux/datatools:
 #include <datatools/clhep_units.h>
 #include <datatools/properties.h>
 #include <datatools/service_manager.h>
-#include <datatools/units.h>
 #include <datatools/utils.h>
 // - Bayeux/geomtools:
 #include <geomtools/utils.h>
 
 #include <falaise/property_set.h>
+#include <falaise/snemo/geometry/magnetic_field_map.h>
 
 namespace {
-// http://stackoverflow.com/questions/6089231/getting-std-ifstream-to-handle-lf-cr-and-crlf
-std::istream& safe_getline(std::istream& in_, std::string& out_) {
-  out_.clear();
-  // The characters in the stream are read one-by-one using a std::streambuf.
-  // That is faster than reading them one-by-one using the std::istream.
-  // Code that uses streambuf this way must be guarded by a sentry object.
-  // The sentry object performs various tasks,
-  // such as thread synchronization and updating the stream state.
-  std::istream::sentry se(in_, true);
-  std::streambuf* sb = in_.rdbuf();
-  for (;;) {
-    int c = sb->sbumpc();
-    switch (c) {
-      case '\n':
-        return in_;
-      case '\r':
-        if (sb->sgetc() == '\n') {
-          sb->sbumpc();
-        }
-        return in_;
-      case EOF:
-        // Also handle the case when the last line has no line ending
-        if (out_.empty()) {
-          in_.setstate(std::ios::eofbit);
-        }
-        return in_;
-      default:
-        out_ += (char)c;
-    }
-  }
-}
+// Runtime selection of the AVX2 kernel needs the GCC/Clang x86 builtins
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define FALAISE_MAPPED_FIELD_AVX2 1
+#endif
 
-/// \brief Private working data for MM_IMPORT_CSV_MAP_0 mode
-struct csv_map_0_t {
- public:
-  csv_map_0_t() = default;
-  csv_map_0_t(std::string mapfile) : map_filename{std::move(mapfile)} { load(map_filename); }
-  void load(const std::string& mapfile);
-  void reset();
-  int interpolate(const geomtools::vector_3d& position, geomtools::vector_3d& magnetic_field) const;
-  int compute(const geomtools::vector_3d& position, geomtools::vector_3d& magnetic_field) const;
-
- public:
-  // Configuration:
-  std::string map_filename;
-  double length_unit = CLHEP::meter;
-  double mag_field_unit = datatools::units::milli() * CLHEP::gauss;
-  // Header:
-  unsigned int nx = 0;
-  unsigned int ny = 0;
-  unsigned int nz = 0;
-  geomtools::vector_3d origin = geomtools::invalid_vector_3d();
-  double dx = datatools::invalid_real();
-  double dy = datatools::invalid_real();
-  double dz = datatools::invalid_real();
-  // Mapped B-field:
-  using vd = std::vector<int>;
-  using vvd = std::vector<vd>;
-  using vvvd = std::vector<vvd>;
-  using vvvvd = std::vector<vvvd>;
-  vvvvd bmap;
+/// \brief Grid cell containing a point and the trilinear weights of its 8 corners
+struct trilinear_cell {
+  const int32_t* n000;  //!< Components of the lower corner node
+  std::size_t dx;       //!< Offset to the next node along X
+  std::size_t dy;       //!< Offset to the next node along Y
+  std::size_t dz;       //!< Offset to the next node along Z
+  double w[8];          //!< Weights of the corners, X index varying fastest
 };
 
-void csv_map_0_t::reset() {
-  bmap.clear();
-  nx = 0;
-  ny = 0;
-  nz = 0;
-  origin = geomtools::invalid_vector_3d();
-  dx = datatools::invalid_real();
-  dy = datatools::invalid_real();
-  dz = datatools::invalid_real();
-}
-
-void csv_map_0_t::load(const std::string& mapfile) {
-  std::string mfn = mapfile;
-  datatools::fetch_path_with_env(mfn);
-  DT_THROW_IF(!boost::filesystem::exists(mfn), std::runtime_error,
-              "File '" << mfn << "' does not exist!");
-  std::ifstream fin(mfn.c_str());
-  DT_THROW_IF(!fin, std::runtime_error, "Cannot open file '" << map_filename << "'!");
-
-  map_filename = mapfile;
-  this->reset();
-  {
-    // Read header line:
-    std::string header_line;
-    safe_getline(fin, header_line);
-    DT_THROW_IF(!fin, std::runtime_error, "Cannot read map file header!");
-
-    std::vector<std::string> htokens;
-    boost::split(htokens, header_line, boost::is_any_of(","));
-    DT_THROW_IF(htokens.size() != 9, std::logic_error, "Invalid header line format!");
-    nx = boost::lexical_cast<unsigned int>(htokens[0]);
-    ny = boost::lexical_cast<unsigned int>(htokens[1]);
-    nz = boost::lexical_cast<unsigned int>(htokens[2]);
-
-    double x0(0.0), y0(0.0), z0(0.0);
-    x0 = boost::lexical_cast<double>(htokens[3]);
-    y0 = boost::lexical_cast<double>(htokens[4]);
-    z0 = boost::lexical_cast<double>(htokens[5]);
-    origin.set(x0 * length_unit, y0 * length_unit, z0 * length_unit);
-    dx = boost::lexical_cast<double>(htokens[6]) * length_unit;
-    dy = boost::lexical_cast<double>(htokens[7]) * length_unit;
-    dz = boost::lexical_cast<double>(htokens[8]) * length_unit;
-  }
-
-  {
-    // Read map:
-    csv_map_0_t::vvvvd& bb = bmap;
-    bb.reserve(3);
-    for (size_t ax = 0; ax < 3; ax++) {
-      {
-        csv_map_0_t::vvvd dummy;
-        bb.push_back(dummy);
-      }
-      csv_map_0_t::vvvd& bxyz = bb.back();
-      bxyz.reserve(nz);
-      for (size_t iz = 0; iz < nz; iz++) {
-        {
-          csv_map_0_t::vvd dummy;
-          bxyz.push_back(dummy);
-        }
-        csv_map_0_t::vvd& bxy = bxyz.back();
-        bxy.reserve(ny);
-        for (size_t iy = 0; iy < ny; iy++) {
-          std::string bmap_line;
-          safe_getline(fin, bmap_line);
-          std::vector<std::string> btokens;
-          boost::split(btokens, bmap_line, boost::is_any_of(","));
-          DT_THROW_IF(btokens.size() != nx + 3, std::logic_error, "Invalid B-line format!");
-          auto axi = boost::lexical_cast<unsigned int>(btokens[0]);
-          auto iyi = boost::lexical_cast<unsigned int>(btokens[1]);
-          auto izi = boost::lexical_cast<unsigned int>(btokens[2]);
-          DT_THROW_IF(axi != ax || iyi != iy || izi != iz, std::logic_error,
-                      "Invalid B map line format!");
-          {
-            csv_map_0_t::vd dummy;
-            bxy.push_back(dummy);
-          }
-          csv_map_0_t::vd& xdata = bxy.back();
-          xdata.reserve(btokens.size() - 3);
-          for (size_t ix = 3; ix < btokens.size(); ix++) {
-            xdata.push_back(boost::lexical_cast<int>(btokens[ix]));
-          }
-        }
-      }
-    }
-  }
-}
-
-int csv_map_0_t::interpolate(const geomtools::vector_3d& position_,
-                             geomtools::vector_3d& magnetic_field) const {
-  double xu = (position_.x() - origin.x()) / dx;
-  double yu = (position_.y() - origin.y()) / dy;
-  double zu = (position_.z() - origin.z()) / dz;
+/// \brief Locate the cell containing a point of the mapped octant
+bool locate(const snemo::geometry::field_map_layout& layout, const int32_t* bmap, double x,
+            double y, double z, trilinear_cell& cell) {
+  double xu = (x - layout.origin.x()) / layout.step.x();
+  double yu = (y - layout.origin.y()) / layout.step.y();
+  double zu = (z - layout.origin.z()) / layout.step.z();
   int ixl = (int)xu;
   int iyl = (int)yu;
   int izl = (int)zu;
+  if (ixl < 0 || ixl >= (int)(layout.nx - 1) || iyl < 0 || iyl >= (int)(layout.ny - 1) ||
+      izl < 0 || izl >= (int)(layout.nz - 1)) {
+    return false;
+  }
   double fx = xu - ixl;
   double fy = yu - iyl;
   double fz = zu - izl;
   double gx = 1.0 - fx;
   double gy = 1.0 - fy;
   double gz = 1.0 - fz;
-  const vvvvd& bb = bmap;
-  if (ixl >= 0 && ixl < (int)(nx - 1) && iyl >= 0 && iyl < (int)(ny - 1) && izl >= 0 &&
-      izl < (int)(nz - 1)) {
-    for (int ax = 0; ax < 3; ax++) {
-      const vvvd& b3d = bb[ax];
-      int b000 = b3d[izl][iyl][ixl];
-      int b100 = b3d[izl][iyl][ixl + 1];
-      int b010 = b3d[izl][iyl + 1][ixl];
-      int b001 = b3d[izl + 1][iyl][ixl];
-      int b110 = b3d[izl][iyl + 1][ixl + 1];
-      int b011 = b3d[izl + 1][iyl + 1][ixl];
-      int b101 = b3d[izl + 1][iyl][ixl + 1];
-      int b111 = b3d[izl + 1][iyl + 1][ixl + 1];
-      double bf00 = gx * b000 + fx * b100;
-      double bf10 = gx * b010 + fx * b110;
-      double bff0 = gy * bf00 + fy * bf10;
-      double bf01 = gx * b001 + fx * b101;
-      double bf11 = gx * b011 + fx * b111;
-      double bff1 = gy * bf01 + fy * bf11;
-      double bfff = gz * bff0 + fz * bff1;
-      magnetic_field[ax] = bfff;
-    }
-  } else {
-    geomtools::invalidate(magnetic_field);
-    return snemo::geometry::mapped_magnetic_field::STATUS_ERROR;
+  cell.n000 = bmap + layout.index(ixl, iyl, izl);
+  cell.dx = 3;
+  cell.dy = std::size_t{3} * layout.nx;
+  cell.dz = cell.dy * layout.ny;
+  cell.w[0] = gx * gy * gz;
+  cell.w[1] = fx * gy * gz;
+  cell.w[2] = gx * fy * gz;
+  cell.w[3] = fx * fy * gz;
+  cell.w[4] = gx * gy * fz;
+  cell.w[5] = fx * gy * fz;
+  cell.w[6] = gx * fy * fz;
+  cell.w[7] = fx * fy * fz;
+  return true;
+}
+
+/// \brief Weighted sum of the corner fields, one component at a time
+void blend_scalar(const trilinear_cell& cell, double b[3]) {
+  const int32_t* n000 = cell.n000;
+  const int32_t* n010 = n000 + cell.dy;
+  const int32_t* n001 = n000 + cell.dz;
+  const int32_t* n011 = n001 + cell.dy;
+  for (int ax = 0; ax < 3; ax++) {
+    b[ax] = cell.w[0] * n000[ax] + cell.w[1] * n000[cell.dx + ax] + cell.w[2] * n010[ax] +
+            cell.w[3] * n010[cell.dx + ax] + cell.w[4] * n001[ax] +
+            cell.w[5] * n001[cell.dx + ax] + cell.w[6] * n011[ax] + cell.w[7] * n011[cell.dx + ax];
   }
+}
 
-  return snemo::geometry::mapped_magnetic_field::STATUS_SUCCESS;
+#ifdef FALAISE_MAPPED_FIELD_AVX2
+/// \brief The 3 components of a node in the lower lanes of a vector
+///
+/// The masked load never touches the fourth int, so reading the last node of
+/// the map stays in bounds.
+__attribute__((target("avx2,fma"))) inline __m256d load_node(const int32_t* node) {
+  return _mm256_cvtepi32_pd(_mm_maskload_epi32(node, _mm_setr_epi32(-1, -1, -1, 0)));
+}
+
+/// \brief Weighted sum of the corner fields, all components at once
+__attribute__((target("avx2,fma"))) void blend_avx2(const trilinear_cell& cell, double b[3]) {
+  const int32_t* n000 = cell.n000;
+  const int32_t* n010 = n000 + cell.dy;
+  const int32_t* n001 = n000 + cell.dz;
+  const int32_t* n011 = n001 + cell.dy;
+  __m256d sum = _mm256_mul_pd(_mm256_set1_pd(cell.w[0]), load_node(n000));
+  sum = _mm256_fmadd_pd(_mm256_set1_pd(cell.w[1]), load_node(n000 + cell.dx), sum);
+  sum = _mm256_fmadd_pd(_mm256_set1_pd(cell.w[2]), load_node(n010), sum);
+  sum = _mm256_fmadd_pd(_mm256_set1_pd(cell.w[3]), load_node(n010 + cell.dx), sum);
+  sum = _mm256_fmadd_pd(_mm256_set1_pd(cell.w[4]), load_node(n001), sum);
+  sum = _mm256_fmadd_pd(_mm256_set1_pd(cell.w[5]), load_node(n001 + cell.dx), sum);
+  sum = _mm256_fmadd_pd(_mm256_set1_pd(cell.w[6]), load_node(n011), sum);
+  sum = _mm256_fmadd_pd(_mm256_set1_pd(cell.w[7]), load_node(n011 + cell.dx), sum);
+  double lanes[4];
+  _mm256_storeu_pd(lanes, sum);
+  b[0] = lanes[0];
+  b[1] = lanes[1];
+  b[2] = lanes[2];
+}
+#endif
+
+using blend_function = void (*)(const trilinear_cell&, double*);
+
+using kernel_t = snemo::geometry::mapped_magnetic_field::kernel_t;
+
+/// \brief Return true if the running CPU supports the AVX2 kernel
+bool cpu_supports_avx2() {
+#ifdef FALAISE_MAPPED_FIELD_AVX2
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+  return false;
+#endif
+}
+
+const bool has_avx2 = cpu_supports_avx2();
+
+/// \brief Blending function of a kernel, the fastest supported one for AUTOMATIC
+blend_function select_blend(kernel_t kernel) {
+#ifdef FALAISE_MAPPED_FIELD_AVX2
+  if (kernel == kernel_t::AVX2 || (kernel == kernel_t::AUTOMATIC && has_avx2)) {
+    return blend_avx2;
+  }
+#endif
+  return blend_scalar;
 }
 
-int csv_map_0_t::compute(const ::geomtools::vector_3d& position,
-                         ::geomtools::vector_3d& magnetic_field) const {
-  geomtools::invalidate(magnetic_field);
+/// \brief Field at a position in the demonstrator, unfolded from the mapped octant
+int compute(const snemo::geometry::field_map_layout& layout, const int32_t* bmap,
+            blend_function blend, const ::geomtools::vector_3d& position,
+            ::geomtools::vector_3d& magnetic_field) {
   // the coordinate system has its origin in the centre of the source foil.
   // X is in the horizontal direction within the foil.
   // Y is in the vertical direction within the foil.
@@ -254,41 +174,20 @@ int csv_map_0_t::compute(const ::geomtools::vector_3d& position,
   double x = position.y();
   double y = position.z();
   double z = position.x();
-  int mx[3];
-  mx[0] = 1;
-  mx[1] = 1;
-  mx[2] = 1;
-  if (x < 0.0) {
-    mx[0] *= -1;
-  }
-  int my[3];
-  my[0] = 1;
-  my[1] = 1;
-  my[2] = 1;
-  if (y < 0.0) {
-    my[0] *= -1;
-    my[2] *= -1;
-  }
-  int mz[3];
-  mz[0] = 1;
-  mz[1] = 1;
-  mz[2] = 1;
-  if (z < 0.0) {
-    mz[2] *= -1;
-  }
-  geomtools::vector_3d bb;
-  geomtools::vector_3d pos_ppp(std::abs(x), std::abs(y), std::abs(z));
-  int status = interpolate(pos_ppp, bb);
-  if (status == snemo::geometry::mapped_magnetic_field::STATUS_SUCCESS) {
-    double b[3];
-    for (int ax = 0; ax < 3; ax++) {
-      b[ax] = bb[ax] * mx[ax] * my[ax] * mz[ax];
-    }
-    magnetic_field[0] = b[2] * mag_field_unit;
-    magnetic_field[1] = b[0] * mag_field_unit;
-    magnetic_field[2] = b[1] * mag_field_unit;
+  trilinear_cell cell;
+  if (!locate(layout, bmap, std::abs(x), std::abs(y), std::abs(z), cell)) {
+    geomtools::invalidate(magnetic_field);
+    return snemo::geometry::mapped_magnetic_field::STATUS_ERROR;
   }
-  return status;
+  double b[3];
+  blend(cell, b);
+  // Symmetries of the field under reflection of each axis of the map frame
+  double sx = (x < 0.0) ? -1.0 : 1.0;
+  double sy = (y < 0.0) ? -1.0 : 1.0;
+  double sz = (z < 0.0) ? -1.0 : 1.0;
+  magnetic_field.set(b[2] * sy * sz * layout.fieldUnit, b[0] * sx * sy * layout.fieldUnit,
+                     b[1] * layout.fieldUnit);
+  return snemo::geometry::mapped_magnetic_field::STATUS_SUCCESS;
 }
 
 }  // namespace
@@ -299,9 +198,34 @@ namespace geometry {
 
 /// \brief Private working data
 struct mapped_magnetic_field::MapImpl {
-  MapImpl(const std::string& mapfile) : map{mapfile} {};
+  MapImpl(map_mode_t mode, const std::string& mapfile) {
+    if (mode == map_mode_t::IMPORT_BINARY_MAP) {
+      binary.reset(new binary_field_map{mapfile});
+      layout = binary->layout();
+      data = binary->data();
+    } else {
+      // Copy to storage starting on a cache line, as the binary map does
+      std::vector<int32_t> csv = read_csv_field_map(mapfile, layout);
+      void* storage = nullptr;
+      DT_THROW_IF(::posix_memalign(&storage, kCacheLineSize, csv.size() * sizeof(int32_t)) != 0,
+                  std::runtime_error, "Cannot allocate storage for map '" << mapfile << "'!");
+      components.reset(static_cast<int32_t*>(storage));
+      std::copy(csv.begin(), csv.end(), components.get());
+      data = components.get();
+    }
+  }
   ~MapImpl() = default;
-  csv_map_0_t map;
+
+  struct free_deleter {
+    void operator()(int32_t* p) const { std::free(p); }
+  };
+
+  static const std::size_t kCacheLineSize = 64;
+
+  field_map_layout layout;                             //!< Sampling grid
+  const int32_t* data = nullptr;                       //!< Field components on the grid
+  std::unique_ptr<int32_t[], free_deleter> components;  //!< Storage for maps imported from text
+  std::unique_ptr<binary_field_map> binary;            //!< Storage for memory mapped binary maps
 };
 
 // Registration instantiation macro :
@@ -321,6 +245,7 @@ void mapped_magnetic_field::_set_defaults() {
   mapMode_ = map_mode_t::INVALID;
   zeroFieldOutsideMap_ = true;
   invertFieldAlongZ_ = false;
+  kernel_ = kernel_t::AUTOMATIC;
 }
 
 void mapped_magnetic_field::reset() {
@@ -344,17 +269,20 @@ void mapped_magnetic_field::initialize(const datatools::properties& config_,
 
   falaise::property_set ps{config_};
 
-  auto modeStr = ps.get<std::string>("mapping_mode", "import_csv_map_0");
-  if (modeStr == "import_csv_map_0") {
-    mapMode_ = map_mode_t::IMPORT_CSV_MAP_0;
-  } else {
-    DT_THROW(std::logic_error, "Invalid mapping mode '" << modeStr << "'!");
+  // Configuration overrides any mode set through setMapMode
+  if (ps.has_key("mapping_mode") || mapMode_ == map_mode_t::INVALID) {
+    auto modeStr = ps.get<std::string>("mapping_mode", "import_csv_map_0");
+    if (modeStr == "import_csv_map_0") {
+      mapMode_ = map_mode_t::IMPORT_CSV_MAP_0;
+    } else if (modeStr == "import_binary_map") {
+      mapMode_ = map_mode_t::IMPORT_BINARY_MAP;
+    } else {
+      DT_THROW(std::logic_error, "Invalid mapping mode '" << modeStr << "'!");
+    }
   }
 
   mapFile_ = ps.get<falaise::path>("map_file", mapFile_);
-  // if (mapMode_ == map_mode_t::IMPORT_CSV_MAP_0) { // Useless as this is the only mode
-  fieldMap_.reset(new MapImpl{mapFile_});
-  //}
+  fieldMap_.reset(new MapImpl{mapMode_, mapFile_});
 
   zeroFieldOutsideMap_ = ps.get<bool>("zero_field_outside_map", zeroFieldOutsideMap_);
   invertFieldAlongZ_ = ps.get<bool>("z_inverted", invertFieldAlongZ_);
@@ -376,6 +304,16 @@ void mapped_magnetic_field::setZeroFieldOutsideMap(bool flag) { zeroFieldOutside
 
 void mapped_magnetic_field::setInvertedZ(bool flag) { invertFieldAlongZ_ = flag; }
 
+bool mapped_magnetic_field::isKernelSupported(kernel_t kernel) {
+  return kernel != kernel_t::AVX2 || has_avx2;
+}
+
+void mapped_magnetic_field::setKernel(kernel_t kernel) {
+  DT_THROW_IF(!isKernelSupported(kernel), std::logic_error,
+              "Interpolation kernel is not supported by this CPU!");
+  kernel_ = kernel;
+}
+
 int mapped_magnetic_field::compute_electric_field(const geomtools::vector_3d& /* position_ */,
                                                   double /* time_ */,
                                                   geomtools::vector_3d& efield) const {
@@ -387,8 +325,9 @@ int mapped_magnetic_field::compute_magnetic_field(const ::geomtools::vector_3d&
                                                   double /* time_ */,
                                                   ::geomtools::vector_3d& magnetic_field) const {
   int status = STATUS_ERROR;
-  if (mapMode_ == map_mode_t::IMPORT_CSV_MAP_0) {
-    status = fieldMap_->map.compute(position_, magnetic_field);
+  if (fieldMap_) {
+    status = compute(fieldMap_->layout, fieldMap_->data, select_blend(kernel_), position_,
+                     magnetic_field);
     if (invertFieldAlongZ_) {
       double Bz = -magnetic_field.z();
       magnetic_field.setZ(Bz);
@@ -403,6 +342,35 @@ int mapped_magnetic_field::compute_magnetic_field(const ::geomtools::vector_3d&
   return status;
 }
 
+int mapped_magnetic_field::compute_magnetic_field(
+    const std::vector<geomtools::vector_3d>& positions, double /* time_ */,
+    std::vector<geomtools::vector_3d>& magnetic_fields) const {
+  magnetic_fields.resize(positions.size());
+  if (!fieldMap_) {
+    for (auto& field : magnetic_fields) {
+      geomtools::invalidate(field);
+    }
+    return STATUS_ERROR;
+  }
+  const field_map_layout& layout = fieldMap_->layout;
+  const int32_t* bmap = fieldMap_->data;
+  const blend_function blend = select_blend(kernel_);
+  int status = STATUS_SUCCESS;
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    geomtools::vector_3d& field = magnetic_fields[i];
+    if (compute(layout, bmap, blend, positions[i], field) == STATUS_SUCCESS) {
+      if (invertFieldAlongZ_) {
+        field.setZ(-field.z());
+      }
+    } else if (zeroFieldOutsideMap_) {
+      field.set(0., 0., 0.);
+    } else {
+      status = STATUS_ERROR;
+    }
+  }
+  return status;
+}
+
 void mapped_magnetic_field::tree_dump(std::ostream& out, const std::string& title,
                                       const std::string& indent, bool inherit) const {
   this->base_electromagnetic_field::tree_dump(out, title, indent, true);
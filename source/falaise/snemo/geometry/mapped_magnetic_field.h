@@ -35,6 +35,7 @@
 // Standard library:
 #include <memory>
 #include <string>
+#include <vector>
 
 // Third party:
 // - Bayeux/emfield:
@@ -49,8 +50,16 @@ class mapped_magnetic_field : public ::emfield::base_electromagnetic_field {
  public:
   /// \brief Mapping mode
   enum class map_mode_t {
-    INVALID = -1,         ///< Invalid mapping mode
-    IMPORT_CSV_MAP_0 = 0  ///< Build from imported CSV file
+    INVALID = -1,          ///< Invalid mapping mode
+    IMPORT_CSV_MAP_0 = 0,  ///< Build from imported CSV file
+    IMPORT_BINARY_MAP = 1  ///< Memory map a binary file made by flconvertbfieldmap
+  };
+
+  /// \brief Trilinear interpolation kernel
+  enum class kernel_t {
+    AUTOMATIC = 0,  ///< Fastest kernel supported by the running CPU
+    SCALAR = 1,     ///< Portable kernel, one component at a time
+    AVX2 = 2        ///< x86 AVX2/FMA kernel, all components at once
   };
 
   /// Default constructor
@@ -74,6 +83,15 @@ class mapped_magnetic_field : public ::emfield::base_electromagnetic_field {
   virtual int compute_magnetic_field(const geomtools::vector_3d &position, double time,
                                      geomtools::vector_3d &magnetic_field) const;
 
+  /// Compute magnetic field at a batch of positions
+  ///
+  /// Fields are those computed one position at a time, without the cost of a
+  /// virtual call per position. Returns STATUS_ERROR if any position is
+  /// outside of the map while the field is not forced to zero there, the
+  /// fields at these positions being invalid.
+  int compute_magnetic_field(const std::vector<geomtools::vector_3d> &positions, double time,
+                             std::vector<geomtools::vector_3d> &magnetic_fields) const;
+
   /// Smart print
   virtual void tree_dump(std::ostream &out = std::clog, const std::string &title = "",
                          const std::string &indent = "", bool inherit = false) const;
@@ -90,6 +108,15 @@ class mapped_magnetic_field : public ::emfield::base_electromagnetic_field {
   /// Set the Z component inversion flag
   void setInvertedZ(bool);
 
+  /// Return true if the running CPU supports an interpolation kernel
+  static bool isKernelSupported(kernel_t);
+
+  /// Set the interpolation kernel, AUTOMATIC by default
+  ///
+  /// Kernels give the same fields up to rounding. Throws std::logic_error if
+  /// the running CPU does not support the kernel.
+  void setKernel(kernel_t);
+
  protected:
   /// Set default attributes values
   void _set_defaults();
@@ -99,6 +126,7 @@ class mapped_magnetic_field : public ::emfield::base_electromagnetic_field {
   std::string mapFile_;       //!< Map filename
   bool zeroFieldOutsideMap_;  //!< Force zero field outside the interpolated map
   bool invertFieldAlongZ_;    //!< Invert the Z component of the field
+  kernel_t kernel_;           //!< Interpolation kernel
 
   struct MapImpl;
   std::unique_ptr<MapImpl> fieldMap_;  //!< PIMPL-ized working data
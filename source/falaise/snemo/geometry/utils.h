@@ -32,8 +32,13 @@
 #ifndef FALAISE_SNEMO_GEOMETRY_UTILS_H
 #define FALAISE_SNEMO_GEOMETRY_UTILS_H 1
 
+// Standard library:
+#include <cstddef>
+#include <string>
+
 // Third party:
 // - Bayeux/geomtools:
+#include <geomtools/geom_id.h>
 #include <geomtools/visibility.h>
 
 namespace snemo {
@@ -84,6 +89,17 @@ struct grid_mask_t {
   };
 };
 
+/// \brief Hash of a geometry ID over its type and address, for unordered containers
+struct geom_id_hash {
+  std::size_t operator()(const geomtools::geom_id& gid) const {
+    std::size_t h = gid.get_type();
+    for (size_t i = 0; i < gid.get_depth(); i++) {
+      h = h * 1000003u ^ gid.get(i);
+    }
+    return h;
+  }
+};
+
 /// \brief Some geometry utility
 class utils {
  public:
@@ -15,6 +15,7 @@
 #include <falaise/property_set.h>
 #include <falaise/quantity.h>
 
+#include <falaise/snemo/datamodels/handle_pool.h>
 #include <falaise/snemo/datamodels/particle_track_data.h>
 #include <falaise/snemo/geometry/calo_locator.h>
 #include <falaise/snemo/geometry/gveto_locator.h>
@@ -323,7 +324,7 @@ int base_gamma_builder::_post_process(const base_gamma_builder::hit_collection_t
           const double int_prob = gsl_cdf_chisq_Q(chi2_int, 1) * 100. * CLHEP::perCent;
           const double int_prob_limit = minFoilVertexProbability_;
           if (int_prob > int_prob_limit) {
-            auto hBSv = datatools::make_handle<geomtools::blur_spot>();
+            auto hBSv = snemo::datamodel::make_pooled_handle<geomtools::blur_spot>();
             a_gamma->get_vertices().insert(a_gamma->get_vertices().begin(), hBSv);
             hBSv->set_hit_id(0);
             hBSv->set_blur_dimension(geomtools::blur_spot::dimension_three);
@@ -375,7 +376,7 @@ int base_gamma_builder::_post_process(const base_gamma_builder::hit_collection_t
             // snemo::datamodel::CalorimeterHitHdlCollection & hits =
             // a_gamma.grab_associated_calorimeter_hits(); hits.insert(hits.begin(),
             // the_calorimeters.front());
-            auto hBSv = datatools::make_handle<geomtools::blur_spot>();
+            auto hBSv = snemo::datamodel::make_pooled_handle<geomtools::blur_spot>();
             a_gamma->get_vertices().insert(a_gamma->get_vertices().begin(), hBSv);
             hBSv->set_hit_id(a_calo_hit->get_hit_id());
             hBSv->set_geom_id(a_calo_hit->get_geom_id());
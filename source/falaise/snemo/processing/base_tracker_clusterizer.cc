@@ -18,6 +18,7 @@
 // This project:
 #include <falaise/property_set.h>
 #include <falaise/quantity.h>
+#include <falaise/snemo/datamodels/handle_pool.h>
 #include <falaise/snemo/datamodels/tracker_clustering_data.h>
 #include <falaise/snemo/geometry/gg_locator.h>
 #include <falaise/snemo/geometry/locator_helpers.h>
@@ -49,6 +50,15 @@ const std::string &clusterizer_id_key() {
 }
 // ----- ABOVE TO BE MOVED -----
 
+// Carry the truncation flag of a solution over to the solution it is copied into
+void copy_truncated_flag(const snemo::datamodel::tracker_clustering_solution &source_,
+                         snemo::datamodel::tracker_clustering_solution &target_) {
+  const std::string &key = snemo::processing::base_tracker_clusterizer::truncated_key();
+  if (source_.get_auxiliaries().has_flag(key)) {
+    target_.get_auxiliaries().update_flag(key);
+  }
+}
+
 }  // namespace
 
 namespace snemo {
@@ -64,6 +74,12 @@ base_tracker_clusterizer::base_tracker_clusterizer(const std::string &name) {
 
 base_tracker_clusterizer::~base_tracker_clusterizer() = default;
 
+// static
+const std::string &base_tracker_clusterizer::truncated_key() {
+  static const std::string _key("truncated");
+  return _key;
+}
+
 void base_tracker_clusterizer::_set_defaults() {
   _logging_priority = datatools::logger::PRIO_WARNING;
   geoManager_ = nullptr;
@@ -295,11 +311,12 @@ int base_tracker_clusterizer::process(
       clustering_.solutions().reserve(prompt_cd.size());
 
       for (size_t isol = 0; isol < prompt_cd.size(); isol++) {
-        auto h_tc_sol = datatools::make_handle<snedm::tracker_clustering_solution>();
+        auto h_tc_sol = snemo::datamodel::make_pooled_handle<snedm::tracker_clustering_solution>();
         h_tc_sol->set_solution_id(isol);
         h_tc_sol->get_auxiliaries().store_flag(prompt_key());
         const snedm::tracker_clustering_solution &prompt_sol = prompt_cd.at(isol);
         snedm::tracker_clustering_solution::copy_one_solution_in_one(prompt_sol, *h_tc_sol);
+        copy_truncated_flag(prompt_sol, *h_tc_sol);
         h_tc_sol->get_auxiliaries().store_string(clusterizer_id_key(), get_id());
 
         clustering_.push_back(h_tc_sol);
@@ -316,7 +333,7 @@ int base_tracker_clusterizer::process(
       // Build all combinaisons of solutions from solutions found from both sides
       // of the source:
       for (size_t isol = 0; isol < nb_sols; ++isol) {
-        auto h_tc_sol = datatools::make_handle<snedm::tracker_clustering_solution>();
+        auto h_tc_sol = snemo::datamodel::make_pooled_handle<snedm::tracker_clustering_solution>();
         h_tc_sol->set_solution_id(isol);
         h_tc_sol->get_auxiliaries().store_flag(prompt_key());
         int isol0 = isol % nb_prompt_sol0;
@@ -325,6 +342,8 @@ int base_tracker_clusterizer::process(
         const snedm::tracker_clustering_solution &prompt_sol1 = prompt_cd1.at(isol1);
         snedm::tracker_clustering_solution::merge_two_solutions_in_ones(prompt_sol0, prompt_sol1,
                                                                         *h_tc_sol);
+        copy_truncated_flag(prompt_sol0, *h_tc_sol);
+        copy_truncated_flag(prompt_sol1, *h_tc_sol);
 
         h_tc_sol->get_auxiliaries().store_string(clusterizer_id_key(), get_id());
         clustering_.push_back(h_tc_sol);
@@ -360,12 +379,13 @@ int base_tracker_clusterizer::process(
         // Extract the solution from the clustering result:
         const snedm::tracker_clustering_solution &delayed_sol = delayed_cd.at(idelayed_sol);
         // Create a new clustering solution
-        auto h_tc_sol = datatools::make_handle<snedm::tracker_clustering_solution>();
+        auto h_tc_sol = snemo::datamodel::make_pooled_handle<snedm::tracker_clustering_solution>();
         // Give it an unique solution id:
         h_tc_sol->set_solution_id(clustering_.size() + idelayed_sol);
         // Record the delayed time-cluster unique Idd solution:
         h_tc_sol->get_auxiliaries().store_integer(delayed_id_key(), idelayed_clustering);
         snedm::tracker_clustering_solution::copy_one_solution_in_one(delayed_sol, *h_tc_sol);
+        copy_truncated_flag(delayed_sol, *h_tc_sol);
 
         h_tc_sol->get_auxiliaries().store_string(clusterizer_id_key(), get_id());
        // Flag it as a delayed clustering solution:
@@ -400,6 +420,7 @@ int base_tracker_clusterizer::process(
 
         aux_prompt.unset_flag(prompt_key());
         snedm::tracker_clustering_solution::copy_one_solution_in_one(sol_delayed, sol_prompt);
+        copy_truncated_flag(sol_delayed, sol_prompt);
       }
     }
     // Delete all delayed solutions (use erase(remove_if)?)
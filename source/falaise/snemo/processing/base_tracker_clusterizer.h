@@ -120,6 +120,10 @@ class base_tracker_clusterizer {
   /// Reset the clusterizer
   virtual void reset() = 0;
 
+  /// Return the auxiliary flag of the clustering solutions of an event whose
+  /// search was stopped by a time or work budget of the algorithm
+  static const std::string &truncated_key();
+
   /// OCD support
   static void ocd_support(datatools::object_configuration_description &,
                           const std::string &prefix_ = "");
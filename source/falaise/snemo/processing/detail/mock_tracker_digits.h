@@ -0,0 +1,132 @@
+// -*- mode: c++ ; -*-
+/// \file falaise/snemo/processing/detail/mock_tracker_digits.h
+/* Description:
+ *
+ *   Working buffers of the mock tracker digitization and calibration
+ *
+ * History:
+ *  - replaces the list of 'mock_raw_tracker_hit' objects built for each event
+ */
+
+#ifndef FALAISE_SNEMO_PROCESSING_DETAIL_MOCK_TRACKER_DIGITS_H
+#define FALAISE_SNEMO_PROCESSING_DETAIL_MOCK_TRACKER_DIGITS_H 1
+
+// Standard library:
+#include <cstddef>
+#include <vector>
+
+// Third party:
+// - Bayeux/datatools:
+#include <bayeux/datatools/utils.h>
+// - Bayeux/geomtools:
+#include <bayeux/geomtools/base_hit.h>
+#include <bayeux/geomtools/geom_id.h>
+// - Bayeux/mctools:
+#include <bayeux/mctools/utils.h>
+
+namespace geomtools {
+class geom_info;
+}
+
+namespace snreco {
+
+namespace detail {
+
+/// \brief Quantities of the Geiger step hits of an event, one column per quantity
+///
+/// Filled before any random number is drawn, so that the digitization loop
+/// only has to smear and merge the hits.
+struct mock_tracker_steps {
+  std::vector<const geomtools::geom_info*> cellInfos;  //!< Geometry information of the hit cell
+  std::vector<double> driftDistances;                  //!< True drift distance
+  std::vector<double> longitudinalPositions;           //!< Anode impact along the cell axis
+  std::vector<double> ionizationTimes;                 //!< Time of the ion/electron pair creation
+  std::vector<double> anodeEfficiencies;               //!< Anode efficiency at the drift distance
+
+  size_t size() const { return cellInfos.size(); }
+
+  /// Resize all columns, keeping their capacity
+  void resize(size_t n) {
+    cellInfos.resize(n);
+    driftDistances.resize(n);
+    longitudinalPositions.resize(n);
+    ionizationTimes.resize(n);
+    anodeEfficiencies.resize(n);
+  }
+};
+
+/// \brief Digitized then calibrated Geiger cells of an event, one column per quantity
+///
+/// Rows are cells in order of their first step hit. Only the earliest anode
+/// signal of a cell is kept, with its cathode times and MC truth hit and track IDs.
+/// Missing times and calibrated quantities which could not be computed are
+/// invalid.
+struct mock_tracker_digits {
+  // Digitization:
+  std::vector<geomtools::geom_id> cellIDs;             //!< Geometry ID of the cell
+  std::vector<const geomtools::geom_info*> cellInfos;  //!< Geometry information of the cell
+  std::vector<double> anodeTimes;                      //!< Anode time
+  std::vector<double> bottomCathodeTimes;              //!< Bottom cathode time
+  std::vector<double> topCathodeTimes;                 //!< Top cathode time
+  std::vector<int> mcHitIDs;                           //!< MC truth hit ID
+  std::vector<int> mcTrackIDs;                         //!< MC truth track ID
+  std::vector<int> mcParentTrackIDs;                   //!< MC truth parent track ID
+
+  // Calibration:
+  std::vector<double> radii;       //!< Drift radius
+  std::vector<double> sigmaRadii;  //!< Error on the drift radius
+  std::vector<double> zs;          //!< Longitudinal position
+  std::vector<double> sigmaZs;     //!< Error on the longitudinal position
+  std::vector<double> xs;          //!< X position of the cell in the module frame
+  std::vector<double> ys;          //!< Y position of the cell in the module frame
+
+  size_t size() const { return cellIDs.size(); }
+
+  /// Remove all rows, keeping the capacity of the columns
+  void clear() {
+    cellIDs.clear();
+    cellInfos.clear();
+    anodeTimes.clear();
+    bottomCathodeTimes.clear();
+    topCathodeTimes.clear();
+    mcHitIDs.clear();
+    mcTrackIDs.clear();
+    mcParentTrackIDs.clear();
+    radii.clear();
+    sigmaRadii.clear();
+    zs.clear();
+    sigmaZs.clear();
+    xs.clear();
+    ys.clear();
+  }
+
+  /// Append a row for a cell without any signal and return its index
+  size_t addCell(const geomtools::geom_id& gid, const geomtools::geom_info* info) {
+    cellIDs.push_back(gid);
+    cellInfos.push_back(info);
+    anodeTimes.push_back(datatools::invalid_real_double());
+    bottomCathodeTimes.push_back(datatools::invalid_real_double());
+    topCathodeTimes.push_back(datatools::invalid_real_double());
+    mcHitIDs.push_back(geomtools::base_hit::INVALID_HIT_ID);
+    mcTrackIDs.push_back(mctools::track_utils::INVALID_TRACK_ID);
+    mcParentTrackIDs.push_back(mctools::track_utils::INVALID_TRACK_ID);
+    return cellIDs.size() - 1;
+  }
+
+  /// Size the calibration columns to the number of cells, all values invalid
+  void resetCalibration() {
+    const size_t n = size();
+    radii.assign(n, datatools::invalid_real_double());
+    sigmaRadii.assign(n, datatools::invalid_real_double());
+    zs.assign(n, datatools::invalid_real_double());
+    sigmaZs.assign(n, datatools::invalid_real_double());
+    xs.assign(n, datatools::invalid_real_double());
+    ys.assign(n, datatools::invalid_real_double());
+  }
+};
+
+}  // end of namespace detail
+
+}  // end of namespace snreco
+
+#endif  // FALAISE_SNEMO_PROCESSING_DETAIL_MOCK_TRACKER_DIGITS_H
@@ -182,17 +182,11 @@ dpp::base_module::process_status event_header_utils_module::process(
 void event_header_utils_module::_process_add_header(datatools::things& data_record_) {
   DT_THROW_IF(_add_header_bank_label_.empty(), std::logic_error,
               "Missing bank label to be enriched !");
-  snemo::datamodel::event_header* ptr_event_header = nullptr;
-  if (data_record_.has(_add_header_bank_label_)) {
-    DT_THROW_IF(!_add_header_update_, std::logic_error,
-                "Event record already has a header '" << _add_header_bank_label_ << "' !");
-    ptr_event_header =
-        &(data_record_.grab<snemo::datamodel::event_header>(_add_header_bank_label_));
-  } else {
-    ptr_event_header = &(data_record_.add<snemo::datamodel::event_header>(_add_header_bank_label_));
-  }
-
-  snemo::datamodel::event_header& the_event_header = *ptr_event_header;
+  DT_THROW_IF(data_record_.has(_add_header_bank_label_) && !_add_header_update_, std::logic_error,
+              "Event record already has a header '" << _add_header_bank_label_ << "' !");
+  // An existing header may have been read in packed form
+  auto& the_event_header =
+      snedm::getOrAddToEvent<snemo::datamodel::event_header>(_add_header_bank_label_, data_record_);
   // the_event_header.clear();
   the_event_header.get_id().set_run_number(_ah_current_run_number_);
   the_event_header.get_id().set_event_number(_ah_current_event_number_);
@@ -219,7 +213,8 @@ void event_header_utils_module::_process_add_header(datatools::things& data_reco
       const std::string sd_label = snedm::labels::simulated_data();
       DT_THROW_IF(!data_record_.has(sd_label), std::logic_error,
                   "Event record has no '" << sd_label << "' bank!");
-      const auto& the_simulated_data = data_record_.get<mctools::simulated_data>(sd_label);
+      const auto& the_simulated_data =
+          snedm::getFromEvent<mctools::simulated_data>(sd_label, data_record_);
 
       if (_add_header_use_genbb_weight_) {
         const double weight = the_simulated_data.get_primary_event().get_genbb_weight();
@@ -0,0 +1,64 @@
+// falaise/snemo/processing/event_seed.cc
+
+// Ourselves:
+#include <falaise/snemo/processing/event_seed.h>
+
+namespace {
+// Constants of the Philox4x32 round function and key schedule
+const uint32_t kPhiloxM0 = 0xD2511F53;
+const uint32_t kPhiloxM1 = 0xCD9E8D57;
+const uint32_t kPhiloxW0 = 0x9E3779B9;
+const uint32_t kPhiloxW1 = 0xBB67AE85;
+const int kPhiloxRounds = 10;
+
+// Product of two 32 bits words, split into its high and low words
+void mulhilo(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo) {
+  const uint64_t product = uint64_t{a} * b;
+  hi = static_cast<uint32_t>(product >> 32);
+  lo = static_cast<uint32_t>(product);
+}
+
+// 32 bits FNV-1a hash of the stream name
+uint32_t stream_hash(const std::string& stream) {
+  uint32_t hash = 2166136261U;
+  for (const char c : stream) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 16777619U;
+  }
+  return hash;
+}
+}  // namespace
+
+namespace snemo {
+
+namespace processing {
+
+std::array<uint32_t, 4> philox4x32(const std::array<uint32_t, 4>& counter,
+                                   const std::array<uint32_t, 2>& key) {
+  std::array<uint32_t, 4> x = counter;
+  std::array<uint32_t, 2> k = key;
+  for (int round = 0; round < kPhiloxRounds; ++round) {
+    uint32_t hi0 = 0;
+    uint32_t lo0 = 0;
+    uint32_t hi1 = 0;
+    uint32_t lo1 = 0;
+    mulhilo(kPhiloxM0, x[0], hi0, lo0);
+    mulhilo(kPhiloxM1, x[2], hi1, lo1);
+    x = {{hi1 ^ x[1] ^ k[0], lo1, hi0 ^ x[3] ^ k[1], lo0}};
+    k[0] += kPhiloxW0;
+    k[1] += kPhiloxW1;
+  }
+  return x;
+}
+
+int32_t event_seed(int32_t baseSeed, int32_t runNumber, int32_t eventNumber,
+                   const std::string& stream) {
+  const std::array<uint32_t, 4> counter{
+      {static_cast<uint32_t>(eventNumber), static_cast<uint32_t>(runNumber), 0, 0}};
+  const std::array<uint32_t, 2> key{{static_cast<uint32_t>(baseSeed), stream_hash(stream)}};
+  return static_cast<int32_t>(philox4x32(counter, key)[0] & 0x7FFFFFFF);
+}
+
+}  // end of namespace processing
+
+}  // end of namespace snemo
@@ -0,0 +1,38 @@
+//! \file falaise/snemo/processing/event_seed.h
+//! \brief Seeds of per-event random number streams
+#ifndef FALAISE_SNEMO_PROCESSING_EVENT_SEED_H
+#define FALAISE_SNEMO_PROCESSING_EVENT_SEED_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace snemo {
+
+namespace processing {
+
+//! Apply the Philox4x32-10 counter-based generator to a counter with a key
+/*!
+ * Philox (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC11)
+ * maps each (counter, key) pair to four independent, uniformly distributed
+ * 32 bits words without any state.
+ */
+std::array<uint32_t, 4> philox4x32(const std::array<uint32_t, 4>& counter,
+                                   const std::array<uint32_t, 2>& key);
+
+//! Return the seed of the random stream for one event
+/*!
+ * The seed only depends on the base seed of the generator, on the run and
+ * event numbers and on the name of the stream, usually the label of the
+ * module which draws from it. An event can thus be processed alone, in any
+ * order or in any thread, and still draw the same random numbers. Seeds lie
+ * in [0, 2^31) so that they are accepted by any mygsl::rng.
+ */
+int32_t event_seed(int32_t baseSeed, int32_t runNumber, int32_t eventNumber,
+                   const std::string& stream);
+
+}  // end of namespace processing
+
+}  // end of namespace snemo
+
+#endif  // FALAISE_SNEMO_PROCESSING_EVENT_SEED_H
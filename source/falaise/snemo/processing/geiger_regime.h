@@ -20,8 +20,10 @@
 #define FALAISE_SNEMO_PROCESSING_GEIGER_REGIME_H 1
 
 // Standard library:
+#include <functional>
 #include <iostream>
 #include <string>
+#include <vector>
 
 // Third party:
 // - Bayeux/datatools
@@ -106,6 +108,9 @@ class geiger_regime : public datatools::i_tree_dumpable {
   void calibrateRadiusFromTime(double drift_time_, double& drift_radius_,
                                double& sigma_drift_radius_) const;
 
+  /// Check if drift times and radii are interpolated from precomputed lookup tables
+  bool usesLookupTables() const;
+
   /// Smart print
   virtual void tree_dump(std::ostream& out = std::clog, const std::string& title = "",
                          const std::string& indent = "", bool inherit = false) const;
@@ -114,6 +119,23 @@ class geiger_regime : public datatools::i_tree_dumpable {
   /// Compute the drift radius from the drift time
   double base_t_2_r(double time_, int mode_ = 0) const;
 
+  /// \brief Pair of functions sampled on a uniform grid, interpolated linearly
+  struct uniform_table {
+    /// Sample f at nbins + 1 nodes spanning [xmin, xmax]
+    void build(double xmin, double xmax, size_t nbins,
+               const std::function<void(double, double&, double&)>& f);
+
+    /// Interpolate both functions at x, clamped to the sampled range
+    void evaluate(double x, double& y0, double& y1) const;
+
+    double xmin{0.0};              //!< First node
+    double inverseStep{0.0};       //!< Inverse of the distance between nodes
+    std::vector<double> values{};  //!< Values of both functions, interleaved per node
+  };
+
+  /// Cache values derived from the parameters and build the lookup tables if requested
+  void computeDerivedQuantities();
+
   double cellRadius_;                         //!< Fiducial drift radius of a cell
   double cellDiagonal_;                       //!< Radius of circle containing corners of cell
   double cellLength_;                         //!< Fiducial drift length of a cell
@@ -131,6 +153,15 @@ class geiger_regime : public datatools::i_tree_dumpable {
   mygsl::tabulated_function timeFromRadius_;  //!< drift radius->time function
   double timeToDriftCellRadius_;              //!< Drift time equivalent to cell radius
   double tCut_;  //!< Cut on drift time (related, maybe identical, to threshold for delayed hits)
+  double rCut_;                               //!< Drift radius for a drift time tCut_
+  double tAtRCut_;                            //!< Drift time tabulated at rCut_
+  double sigmaRAtCellRadius_;                 //!< Radial resolution at the cell radius
+  double tInf_;                               //!< Lower bound of drift times beyond cellRadius_
+  bool useLookupTables_;                      //!< Flag to interpolate from lookup tables
+  size_t lookupTableBins_;                    //!< Number of bins of each lookup table
+  uniform_table radiusToTimeTable_;           //!< r -> (t, t at r - sigma_r) up to rCut_
+  uniform_table earlyTimeToRadiusTable_;      //!< t -> (r, sigma_r) up to timeToDriftCellRadius_
+  uniform_table lateTimeToRadiusTable_;       //!< t -> (r, sigma_r) above timeToDriftCellRadius_
 };
 
 }  // end of namespace processing
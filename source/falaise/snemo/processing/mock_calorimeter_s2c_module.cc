@@ -8,6 +8,7 @@
 // Standard library:
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 
 // Third party:
 // - Bayeux/datatools:
@@ -22,6 +23,10 @@
 
 // This project :
 #include <falaise/snemo/datamodels/data_model.h>
+#include <falaise/snemo/datamodels/event_header.h>
+#include <falaise/snemo/datamodels/handle_pool.h>
+#include <falaise/snemo/processing/event_seed.h>
+#include <falaise/snemo/processing/profiler.h>
 #include <falaise/snemo/services/services.h>
 
 namespace snemo {
@@ -48,6 +53,9 @@ void mock_calorimeter_s2c_module::initialize(const datatools::properties& ps,
   int random_seed = fps.get<int>("random.seed", 12345);
   std::string random_id = fps.get<std::string>("random.id", "mt19937");
   RNG_.init(random_id, random_seed);
+  baseSeed_ = random_seed;
+  eventSeeding_ = fps.get<bool>("random.event_seeding", false);
+  ehInputTag = fps.get<std::string>("EH_label", snedm::labels::event_header());
 
   // Configure models for each calorimeter type
   caloTypes = fps.get<std::vector<std::string>>("hit_categories", {"calo", "xcalo", "gveto"});
@@ -74,15 +82,26 @@ void mock_calorimeter_s2c_module::reset() { this->base_module::_set_initialized(
 
 // Processing :
 dpp::base_module::process_status mock_calorimeter_s2c_module::process(datatools::things& event) {
+  falaise::processing::scoped_profile profile{get_name()};
   DT_THROW_IF(!is_initialized(), std::logic_error,
               "Module '" << get_name() << "' is not initialized !");
 
+  if (eventSeeding_) {
+    DT_THROW_IF(!event.has(ehInputTag), std::logic_error,
+                "Module '" << get_name() << "' cannot seed its PRNG without the '" << ehInputTag
+                           << "' bank !");
+    const auto& eventID =
+        snedm::getFromEvent<snemo::datamodel::event_header>(ehInputTag, event).get_id();
+    RNG_.set_seed(event_seed(baseSeed_, eventID.get_run_number(), eventID.get_event_number(),
+                             get_name()));
+  }
+
   // Check Input simulated data exists, or fail
   if (!event.has(sdInputTag)) {
     throw std::logic_error("Missing simulated data to be processed !");
     return dpp::base_module::PROCESS_ERROR;
   }
-  auto& simulatedData = event.get<mctools::simulated_data>(sdInputTag);
+  auto& simulatedData = snedm::getFromEvent<mctools::simulated_data>(sdInputTag, event);
 
   // check if some 'calibrated_data' are available in the data model:
   // Calibrated Data is a single object with each hit collection
@@ -97,7 +116,7 @@ dpp::base_module::process_status mock_calorimeter_s2c_module::process(datatools:
   // Main processing method :
   process_impl(simulatedData, calibratedData.calorimeter_hits());
 
-  return dpp::base_module::PROCESS_SUCCESS;
+  return profile.result(dpp::base_module::PROCESS_SUCCESS);
 }
 
 // Here collect the 'calorimeter' raw hits from the simulation data source
@@ -106,6 +125,8 @@ void mock_calorimeter_s2c_module::digitizeHits(
     const mctools::simulated_data& simdata,
     snemo::datamodel::CalorimeterHitHdlCollection& calohits) {
   uint32_t calibrated_calorimeter_hit_id = 0;
+  hitModels.clear();
+  hitsByGeomID.clear();
 
   // Loop over all 'calorimeter hit' categories:
   for (const auto& calo : caloModels) {
@@ -132,15 +153,12 @@ void mock_calorimeter_s2c_module::digitizeHits(
 
       // Extract the corresponding geom ID:
       auto& geomID = a_calo_mc_hit->get_geom_id();
-      using CCHitHdl = snemo::datamodel::CalorimeterHitHdlCollection::value_type;
+      auto found = hitsByGeomID.find(geomID);
 
-      auto found = std::find_if(calohits.rbegin(), calohits.rend(), [&geomID](CCHitHdl const& x) {
-        return x->get_geom_id() == geomID;
-      });
-
-      if (found == calohits.rend()) {
+      if (found == hitsByGeomID.end()) {
         // Then it's a new hit
-        auto newHit = datatools::make_handle<snemo::datamodel::calibrated_calorimeter_hit>();
+        auto newHit =
+            snemo::datamodel::make_pooled_handle<snemo::datamodel::calibrated_calorimeter_hit>();
         // auto& newHit = newHandle.grab();
 
         newHit->set_hit_id(calibrated_calorimeter_hit_id++);
@@ -150,7 +168,7 @@ void mock_calorimeter_s2c_module::digitizeHits(
         newHit->set_time(step_hit_time_start);
         newHit->set_energy(energyDeposit);
 
-        // Add a properties to ease the final calibration
+        // Record the category of the hit, calibration uses the model directly
         newHit->grab_auxiliaries().store("category", theCaloID);
 
         // 2012-09-17 FM : support reference to the MC true hit ID
@@ -160,11 +178,13 @@ void mock_calorimeter_s2c_module::digitizeHits(
         }
 
         // Append it to the collection :
+        hitsByGeomID.emplace(geomID, calohits.size());
         calohits.push_back(newHit);
+        hitModels.push_back(&theCaloModel);
       } else {
         // This geom_id is already used by some previous calorimeter hit:
         // we update this hit !
-        auto& existingHit = *found;
+        auto& existingHit = calohits[found->second];
 
         // Grab auxiliaries :
         datatools::properties& cc_prop = existingHit->grab_auxiliaries();
@@ -205,11 +225,10 @@ void mock_calorimeter_s2c_module::digitizeHits(
 // Calibrate calorimeter hits from digitization informations:
 void mock_calorimeter_s2c_module::calibrateHits(
     snemo::datamodel::CalorimeterHitHdlCollection& calohits) {
-  for (auto& theCaloHit : calohits) {
-    // Setting category in order to get the correct energy resolution:
-    // first recover the calorimeter category
-    const std::string& category_name = theCaloHit->get_auxiliaries().fetch_string("category");
-    const CalorimeterModel& the_calo_regime = caloModels.at(category_name);
+  for (size_t i = 0; i < calohits.size(); ++i) {
+    auto& theCaloHit = calohits[i];
+    // Use the model of the hit category to get the correct energy resolution:
+    const CalorimeterModel& the_calo_regime = *hitModels[i];
 
     // Compute a random 'experimental' energy taking into account
     // the expected energy resolution of the calorimeter hit:
@@ -233,34 +252,35 @@ void mock_calorimeter_s2c_module::calibrateHits(
 void mock_calorimeter_s2c_module::triggerHits(
     snemo::datamodel::CalorimeterHitHdlCollection& calohits) {
   bool high_threshold = false;
-  for (auto& theCaloHit : calohits) {
-    // Setting category in order to get the correct trigger parameters:
-    // first recover the calorimeter category
-    const std::string& category_name = theCaloHit->get_auxiliaries().fetch_string("category");
-    const CalorimeterModel& the_calo_regime = caloModels.at(category_name);
-    const double energy = theCaloHit->get_energy();
-    if (the_calo_regime.aboveHighThreshold(energy)) {
+  for (size_t i = 0; i < calohits.size(); ++i) {
+    // Use the model of the hit category to get the correct trigger parameters:
+    const double energy = calohits[i]->get_energy();
+    if (hitModels[i]->aboveHighThreshold(energy)) {
       high_threshold = true;
       break;
     }
   }
 
   if (high_threshold) {
-    // Search and erase for low threshold hits:
-    // Awkward because we have to handle all hit categories together
-    for (auto iCheckedHit = calohits.begin(); iCheckedHit != calohits.end(); /**/) {
-      const std::string& category_name = (*iCheckedHit)->get_auxiliaries().fetch_string("category");
-      const CalorimeterModel& the_calo_regime = caloModels.at(category_name);
-      const double energy = (*iCheckedHit)->get_energy();
+    // Search and erase for low threshold hits, keeping the order of the
+    // remaining hits and their models in step:
+    size_t nkept = 0;
+    for (size_t i = 0; i < calohits.size(); ++i) {
       // If energy hit is too low then remove calorimeter hit
-      if (!the_calo_regime.aboveLowThreshold(energy)) {
-        iCheckedHit = calohits.erase(iCheckedHit);
-      } else {
-        ++iCheckedHit;
+      if (!hitModels[i]->aboveLowThreshold(calohits[i]->get_energy())) {
+        continue;
+      }
+      if (nkept != i) {
+        std::swap(calohits[nkept], calohits[i]);
+        hitModels[nkept] = hitModels[i];
       }
+      ++nkept;
     }
+    calohits.erase(calohits.begin() + nkept, calohits.end());
+    hitModels.resize(nkept);
   } else {
     calohits.clear();
+    hitModels.clear();
   }
 }
 
@@ -348,6 +368,42 @@ DOCD_CLASS_IMPLEMENT_LOAD_BEGIN(snemo::processing::mock_calorimeter_s2c_module,
             "                                       \n");
   }
 
+  {
+    // Description of the 'random.event_seeding' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("random.event_seeding")
+        .set_terse_description("Flag to reseed the embedded PRNG for each event")
+        .set_traits(datatools::TYPE_BOOLEAN)
+        .set_mandatory(false)
+        .set_long_description(
+            "The seed of each event is derived from ``random.seed``,  \n"
+            "the run and event numbers of the event header and the    \n"
+            "module name. Hits then no longer depend on which events  \n"
+            "were processed before, nor in which order.               \n")
+        .set_default_value_boolean(false)
+        .add_example(
+            "Reseed the PRNG for each event::       \n"
+            "                                       \n"
+            "  random.event_seeding : boolean = 1   \n"
+            "                                       \n");
+  }
+
+  {
+    // Description of the 'EH_label' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("EH_label")
+        .set_terse_description("The label/name of the 'event header' bank")
+        .set_traits(datatools::TYPE_STRING)
+        .set_mandatory(false)
+        .set_long_description("Only used if ``random.event_seeding`` is set.")
+        .set_default_value_string(snedm::labels::event_header())
+        .add_example(
+            "Use an alternative name for the 'event header' bank:: \n"
+            "                                \n"
+            "  EH_label : string = \"EH2\"   \n"
+            "                                \n");
+  }
+
   {
     // Description of the 'random.id' configuration property :
     datatools::configuration_property_description& cpd = ocd_.add_property_info();
@@ -448,6 +504,7 @@ DOCD_CLASS_IMPLEMENT_LOAD_BEGIN(snemo::processing::mock_calorimeter_s2c_module,
       "  Geo_label   : string = \"geometry\"                          \n"
       "  random.seed : integer = 314159                               \n"
       "  random.id   : string = \"taus2\"                             \n"
+      "  random.event_seeding : boolean = 0                           \n"
       "  cluster_time_width : real as time = 100 ns                   \n"
       "  alpha_quenching    : boolean = 1                             \n"
       "  store_mc_hit_id    : boolean = 0                             \n"
@@ -20,6 +20,7 @@
 // Standard library:
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // Third party:
@@ -32,6 +33,7 @@
 
 // This project :
 #include <falaise/snemo/datamodels/calibrated_data.h>
+#include <falaise/snemo/geometry/utils.h>
 #include <falaise/snemo/processing/calorimeter_regime.h>
 
 namespace geomtools {
@@ -63,7 +65,7 @@ class mock_calorimeter_s2c_module : public dpp::base_module {
   virtual process_status process(datatools::things& event);
 
  private:
-  /// Digitize calorimeter hits
+  /// Digitize calorimeter hits, recording the calorimeter model of each hit
   void digitizeHits(const mctools::simulated_data& simdata,
                     snemo::datamodel::CalorimeterHitHdlCollection& calohits);
 
@@ -79,6 +81,9 @@ class mock_calorimeter_s2c_module : public dpp::base_module {
 
  private:
   mygsl::rng RNG_{};                     //!< PRN generator
+  int32_t baseSeed_{0};                  //!< Seed of RNG_, from which event seeds are derived
+  bool eventSeeding_{false};             //!< Flag to reseed RNG_ for each event
+  std::string ehInputTag{};              //!< The label of the event header bank
   std::vector<std::string> caloTypes{};  //!< Calorimeter hit categories
   typedef std::map<std::string, CalorimeterModel> CaloModelMap;
   CaloModelMap caloModels{};            //!< Calorimeter regime tools
@@ -88,6 +93,11 @@ class mock_calorimeter_s2c_module : public dpp::base_module {
   bool quenchAlphas{true};              //!< Flag to (dis)activate the alpha quenching
   bool assocMCHitId{false};             //!< The flag to reference MC true hit
 
+  // Per-event working data, kept to reuse its storage across events
+  std::vector<const CalorimeterModel*> hitModels{};  //!< Calorimeter model of each hit
+  std::unordered_map<geomtools::geom_id, size_t, geometry::geom_id_hash>
+      hitsByGeomID{};  //!< Rank of the hit in each calorimeter block
+
   // Macro to automate the registration of the module :
   DPP_MODULE_REGISTRATION_INTERFACE(mock_calorimeter_s2c_module)
 };
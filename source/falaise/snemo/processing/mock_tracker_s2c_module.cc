@@ -19,15 +19,15 @@
 #include <mctools/simulated_data.h>
 #include <mctools/utils.h>
 
-// Try enumerations with Boost iterator/range until we have range-v3
-#include <boost/range/adaptor/indexed.hpp>
-
 // This project :
 #include <falaise/snemo/datamodels/data_model.h>
+#include <falaise/snemo/datamodels/event_header.h>
+#include <falaise/snemo/datamodels/handle_pool.h>
+#include <falaise/snemo/processing/event_seed.h>
 #include <falaise/snemo/services/services.h>
-#include "detail/mock_raw_tracker_hit.h"
 #include "falaise/property_set.h"
 #include "falaise/quantity.h"
+#include "falaise/snemo/processing/profiler.h"
 
 namespace snemo {
 
@@ -62,6 +62,9 @@ void mock_tracker_s2c_module::initialize(const datatools::properties& ps,
   int random_seed = fps.get<int>("random.seed", 12345);
   std::string random_id = fps.get<std::string>("random.id", "mt19937");
   RNG_.init(random_id, random_seed);
+  baseSeed_ = random_seed;
+  eventSeeding_ = fps.get<bool>("random.event_seeding", false);
+  ehInputTag = fps.get<std::string>("EH_label", snedm::labels::event_header());
 
   // Initialize the Geiger regime algorithm:
   _geiger_ = geiger_regime{ps};
@@ -98,11 +101,22 @@ void mock_tracker_s2c_module::reset() { this->base_module::_set_initialized(fals
 
 // Processing :
 dpp::base_module::process_status mock_tracker_s2c_module::process(datatools::things& event) {
+  falaise::processing::scoped_profile profile{get_name()};
   DT_THROW_IF(!is_initialized(), std::logic_error,
               "Module '" << get_name() << "' is not initialized !");
 
+  if (eventSeeding_) {
+    DT_THROW_IF(!event.has(ehInputTag), std::logic_error,
+                "Module '" << get_name() << "' cannot seed its PRNG without the '" << ehInputTag
+                           << "' bank !");
+    const auto& eventID =
+        snedm::getFromEvent<snemo::datamodel::event_header>(ehInputTag, event).get_id();
+    RNG_.set_seed(event_seed(baseSeed_, eventID.get_run_number(), eventID.get_event_number(),
+                             get_name()));
+  }
+
   // Get the 'simulated_data' entry from the data model :
-  auto& simulatedData = event.get<mctools::simulated_data>(sdInputTag);
+  auto& simulatedData = snedm::getFromEvent<mctools::simulated_data>(sdInputTag, event);
 
   // Only process if the data we need is present
   if (simulatedData.has_step_hits(_hit_category_)) {
@@ -115,288 +129,202 @@ dpp::base_module::process_status mock_tracker_s2c_module::process(datatools::thi
     calTrackerHits = process_(simTrackerHits);
   }
 
-  return dpp::base_module::PROCESS_SUCCESS;
+  return profile.result(dpp::base_module::PROCESS_SUCCESS);
 }
 
 /**
  * Here collect the Geiger raw hits from the simulation data source
  * and build the final list of digitized 'tracker' hits.
  *
+ * Geometry is computed for all steps first, then steps are smeared and merged
+ * into cells in their original order, so that random numbers are drawn in the
+ * same sequence as when processing one step at a time.
  */
-mock_tracker_s2c_module::raw_tracker_hit_col_t mock_tracker_s2c_module::digitizeHits_(
-    const sim_tracker_hit_col_t& steps) {
-  // reset the output raw tracker hits collection:
-  raw_tracker_hit_col_t rawTrackerDigits{};
+void mock_tracker_s2c_module::digitizeHits_(const sim_tracker_hit_col_t& steps) {
+  // reset the output digits, keeping the buffers:
+  digits_.clear();
+  cellRows_.clear();
 
   // pickup the ID mapping from the geometry manager:
   const geomtools::mapping& the_mapping = geoManager->get_mapping();
 
-  // Loop on Geiger step hits:
-  for (auto const& step : steps | boost::adaptors::indexed(0)) {
-    // Does work, but wait for C++17 structured bindings!
-    // boost::tie(a_tracker_hit, raw_tracker_hit_id) = hit;
-    auto& a_tracker_hit = step.value();
-    uint32_t const& raw_tracker_hit_id = step.index();
-
-    int true_tracker_hit_id = a_tracker_hit->get_hit_id();
-    int true_tracker_truth_track_id = a_tracker_hit->get_track_id();
-    int true_tracker_truth_parent_track_id = a_tracker_hit->get_parent_track_id();
-    // extract the corresponding geom ID:
-    const geomtools::geom_id& gid = a_tracker_hit->get_geom_id();
+  // Geometry of the Geiger step hits:
+  steps_.resize(steps.size());
+  for (size_t i = 0; i < steps.size(); i++) {
+    const mctools::base_step_hit& a_tracker_hit = steps[i].get();
 
     // extract the geom info of the corresponding cell:
-    const geomtools::geom_info& ginfo = the_mapping.get_geom_info(gid);
+    const geomtools::geom_info& ginfo = the_mapping.get_geom_info(a_tracker_hit.get_geom_id());
+    steps_.cellInfos[i] = &ginfo;
 
     // the position of the ion/electron pair creation within the cell volume:
-    const geomtools::vector_3d& ionization_world_pos = a_tracker_hit->get_position_start();
+    const geomtools::vector_3d& ionization_world_pos = a_tracker_hit.get_position_start();
     // the position of the Geiger avalanche impact on the anode wire:
-    const geomtools::vector_3d& avalanche_impact_world_pos = a_tracker_hit->get_position_stop();
+    const geomtools::vector_3d& avalanche_impact_world_pos = a_tracker_hit.get_position_stop();
 
     // compute the position of the anode impact in the drift cell coordinates reference frame:
     geomtools::vector_3d avalanche_impact_cell_pos;
     ginfo.get_world_placement().mother_to_child(avalanche_impact_world_pos,
                                                 avalanche_impact_cell_pos);
     // longitudinal position:
-    const double longitudinal_position = avalanche_impact_cell_pos.z();
+    steps_.longitudinalPositions[i] = avalanche_impact_cell_pos.z();
 
     // true drift distance:
     const double drift_distance = (avalanche_impact_world_pos - ionization_world_pos).mag();
-    const double anode_efficiency = _geiger_.getAnodeEfficiency(drift_distance);
+    steps_.driftDistances[i] = drift_distance;
+    steps_.anodeEfficiencies[i] = _geiger_.getAnodeEfficiency(drift_distance);
+
+    // the time of the ion/electron pair creation:
+    steps_.ionizationTimes[i] = a_tracker_hit.get_time_start();
+  }
+
+  const double cathode_efficiency = _geiger_.getCathodeEfficiency();
+  const double half_cell_length = 0.5 * _geiger_.getCellLength();
+  const double plasma_speed = _geiger_.getPlasmaSpeed();
+
+  // Smear and merge the Geiger step hits:
+  for (size_t i = 0; i < steps_.size(); i++) {
     const double r = RNG_.uniform();
-    if (r > anode_efficiency) {
+    if (r > steps_.anodeEfficiencies[i]) {
       // This hit is lost due to anode signal inefficiency:
       continue;
     }
 
-    // the time of the ion/electron pair creation:
-    const double ionization_time = a_tracker_hit->get_time_start();
-
     /*** Anode TDC ***/
     // randomize the expected Geiger drift time:
-    const double expected_drift_time = _geiger_.getRandomTimeGivenRadius(RNG_, drift_distance);
-    const double anode_time = ionization_time + expected_drift_time;
-    const double sigma_anode_time = _geiger_.getAnodeTimeResolution(anode_time);
+    const double expected_drift_time =
+        _geiger_.getRandomTimeGivenRadius(RNG_, steps_.driftDistances[i]);
+    const double anode_time = steps_.ionizationTimes[i] + expected_drift_time;
 
     /*** Cathodes TDCs ***/
-    const double cathode_efficiency = _geiger_.getCathodeEfficiency();
+    const double longitudinal_position = steps_.longitudinalPositions[i];
     double bottom_cathode_time{datatools::invalid_real_double()};
     double top_cathode_time{datatools::invalid_real_double()};
-    const double sigma_cathode_time = _geiger_.getCathodeTimeResolution();
-    size_t missing_cathodes = 2;
     const double r1 = RNG_.uniform();
     if (r1 < cathode_efficiency) {
-      const double l_bottom = longitudinal_position + 0.5 * _geiger_.getCellLength();
-      const double mean_bottom_cathode_time = l_bottom / _geiger_.getPlasmaSpeed();
+      const double l_bottom = longitudinal_position + half_cell_length;
+      const double mean_bottom_cathode_time = l_bottom / plasma_speed;
       const double sigma_bottom_cathode_time = 0.0;
       bottom_cathode_time = RNG_.gaussian(mean_bottom_cathode_time, sigma_bottom_cathode_time);
       if (bottom_cathode_time < 0.0) {
         bottom_cathode_time = 0.0;
       }
-      missing_cathodes--;
     }
     const double r2 = RNG_.uniform();
     if (r2 < cathode_efficiency) {
-      const double l_top = 0.5 * _geiger_.getCellLength() - longitudinal_position;
-      const double mean_top_cathode_time = l_top / _geiger_.getPlasmaSpeed();
+      const double l_top = half_cell_length - longitudinal_position;
+      const double mean_top_cathode_time = l_top / plasma_speed;
       const double sigma_top_cathode_time = 0.0;
       top_cathode_time = RNG_.gaussian(mean_top_cathode_time, sigma_top_cathode_time);
       if (top_cathode_time < 0.0) {
         top_cathode_time = 0.0;
       }
-      missing_cathodes--;
     }
 
     // find if some tracker hit already uses this geom ID:
-    geomtools::base_hit::has_geom_id_predicate pred_has_gid(gid);
-    auto found = std::find_if(rawTrackerDigits.begin(), rawTrackerDigits.end(), pred_has_gid);
-    if (found == rawTrackerDigits.end()) {
+    const mctools::base_step_hit& a_tracker_hit = steps[i].get();
+    const geomtools::geom_id& gid = a_tracker_hit.get_geom_id();
+    auto found = cellRows_.find(gid);
+    size_t row = 0;
+    if (found == cellRows_.end()) {
       // This geom_id is not used by any previous tracker hit: we create a new tracker hit !
-      rawTrackerDigits.emplace_back(snreco::detail::mock_raw_tracker_hit{});
-      snreco::detail::mock_raw_tracker_hit& new_raw_tracker_hit = rawTrackerDigits.back();
-
-      // assign a hit ID and the geometry ID to the hit:
-      new_raw_tracker_hit.set_hit_id(raw_tracker_hit_id);
-      new_raw_tracker_hit.set_geom_id(a_tracker_hit->get_geom_id());
-      // 2012-07-26 FM : support reference to the MC truth hit ID
-      if (_store_mc_hit_id_ && true_tracker_hit_id > geomtools::base_hit::INVALID_HIT_ID) {
-        new_raw_tracker_hit.grab_auxiliaries().store(mctools::hit_utils::HIT_MC_HIT_ID_KEY,
-                                                     true_tracker_hit_id);
-      }
-      // 2014-04-06 FM : support reference to the MC truth track and parent track IDs
-      if (_store_mc_truth_track_ids_) {
-        if (true_tracker_truth_track_id > mctools::track_utils::INVALID_TRACK_ID) {
-          new_raw_tracker_hit.grab_auxiliaries().store(mctools::track_utils::TRACK_ID_KEY,
-                                                       true_tracker_truth_track_id);
-        }
-        if (true_tracker_truth_parent_track_id > mctools::track_utils::INVALID_TRACK_ID) {
-          new_raw_tracker_hit.grab_auxiliaries().store(mctools::track_utils::PARENT_TRACK_ID_KEY,
-                                                       true_tracker_truth_parent_track_id);
-        }
-      }
-
-      if (datatools::is_valid(anode_time)) {
-        new_raw_tracker_hit.set_drift_time(anode_time);
-        new_raw_tracker_hit.set_sigma_drift_time(sigma_anode_time);
-        if (datatools::is_valid(top_cathode_time)) {
-          new_raw_tracker_hit.set_top_time(top_cathode_time);
-          new_raw_tracker_hit.set_sigma_top_time(sigma_cathode_time);
-        }
-        if (datatools::is_valid(bottom_cathode_time)) {
-          new_raw_tracker_hit.set_bottom_time(bottom_cathode_time);
-          new_raw_tracker_hit.set_sigma_bottom_time(sigma_cathode_time);
-        }
-      }
-    } else {
+      row = digits_.addCell(gid, steps_.cellInfos[i]);
+      cellRows_.emplace(gid, row);
+    } else if (datatools::is_valid(anode_time) && anode_time < digits_.anodeTimes[found->second]) {
       // This geom_id is already used by some previous tracker hit: we update this hit !
-      snreco::detail::mock_raw_tracker_hit& some_raw_tracker_hit = *found;
-
-      if (datatools::is_valid(anode_time)) {
-        if (anode_time < some_raw_tracker_hit.get_drift_time()) {
-          // reset TDC infos for the current hit:
-          some_raw_tracker_hit.invalidate_times();
-          // update TDC infos:
-          some_raw_tracker_hit.set_drift_time(anode_time);
-          some_raw_tracker_hit.set_sigma_drift_time(sigma_anode_time);
-          if (datatools::is_valid(top_cathode_time)) {
-            some_raw_tracker_hit.set_top_time(top_cathode_time);
-            some_raw_tracker_hit.set_sigma_top_time(sigma_cathode_time);
-          }
-          if (datatools::is_valid(bottom_cathode_time)) {
-            some_raw_tracker_hit.set_bottom_time(bottom_cathode_time);
-            some_raw_tracker_hit.set_sigma_bottom_time(sigma_cathode_time);
-          }
-
-          // 2012-07-26 FM : support reference to the MC true hit ID
-          if (_store_mc_hit_id_ && true_tracker_hit_id > geomtools::base_hit::INVALID_HIT_ID) {
-            some_raw_tracker_hit.grab_auxiliaries().update(mctools::hit_utils::HIT_MC_HIT_ID_KEY,
-                                                           true_tracker_hit_id);
-          }
-
-          // 2014-04-06 FM : support reference to the MC truth track and parent track IDs
-          if (_store_mc_truth_track_ids_) {
-            if (true_tracker_truth_track_id > mctools::track_utils::INVALID_TRACK_ID) {
-              some_raw_tracker_hit.grab_auxiliaries().update(mctools::track_utils::TRACK_ID_KEY,
-                                                             true_tracker_truth_track_id);
-            }
-            if (true_tracker_truth_parent_track_id > mctools::track_utils::INVALID_TRACK_ID) {
-              some_raw_tracker_hit.grab_auxiliaries().update(
-                  mctools::track_utils::PARENT_TRACK_ID_KEY, true_tracker_truth_parent_track_id);
-            }
-          }
-        }
-      }
+      row = found->second;
+    } else {
+      continue;
     }
-  }
-
-  return rawTrackerDigits;
-}
 
-/** Calibrate tracker hits from digitization informations:
- */
-mock_tracker_s2c_module::cal_tracker_hit_col_t mock_tracker_s2c_module::calibrateHits_(
-    const raw_tracker_hit_col_t& digits) {
-  cal_tracker_hit_col_t calTrackerHits{};
-  calTrackerHits.reserve(digits.size());
-
-  // pickup the ID mapping from the geometry manager:
-  const geomtools::mapping& the_mapping = geoManager->get_mapping();
-  const geomtools::id_mgr& the_id_mgr = geoManager->get_id_mgr();
-
-  // current module geometry ID and information:
-  int module_number = geomtools::geom_id::INVALID_ADDRESS;
-  const geomtools::geom_info* module_ginfo = nullptr;
-  const geomtools::placement* module_placement = nullptr;
-
-  // Loop on raw tracker hits:
-  for (auto const& hit : digits | boost::adaptors::indexed(0)) {
-    // Does work, but wait for C++17 structured bindings!
-    // boost::tie(a_tracker_hit, raw_tracker_hit_id) = hit;
-    auto& the_raw_tracker_hit = hit.value();
-
-    auto calTrackerHit = datatools::make_handle<snemo::datamodel::calibrated_tracker_hit>();
-
-    // Hit and GeomIDs
-    calTrackerHit->set_hit_id(hit.index());
-    const geomtools::geom_id& gid = the_raw_tracker_hit.get_geom_id();
-    calTrackerHit->set_geom_id(gid);
-
-    // Use the anode time :
-    const double anode_time = the_raw_tracker_hit.get_drift_time();
-
-    // Calibrate the transverse drift distance:
-    double radius{datatools::invalid_real_double()};
-    double sigma_radius{datatools::invalid_real_double()};
+    // 2012-07-26 FM : support reference to the MC truth hit ID
+    const int true_tracker_hit_id = a_tracker_hit.get_hit_id();
+    if (_store_mc_hit_id_ && true_tracker_hit_id > geomtools::base_hit::INVALID_HIT_ID) {
+      digits_.mcHitIDs[row] = true_tracker_hit_id;
+    }
 
-    if (datatools::is_valid(anode_time)) {
-      if (anode_time <= _delayed_drift_time_threshold_) {
-        // Case of a normal/prompt hit :
-        _geiger_.calibrateRadiusFromTime(anode_time, radius, sigma_radius);
-        calTrackerHit->set_anode_time(anode_time);
-        if (anode_time > _peripheral_drift_time_threshold_) {
-          calTrackerHit->set_peripheral(true);
-        }
-      } else {
-        // 2012-03-29 FM : store the anode_time as the reference delayed time
-        calTrackerHit->set_delayed_time(anode_time, _geiger_.getAnodeTimeResolution(anode_time));
+    // 2014-04-06 FM : support reference to the MC truth track and parent track IDs
+    if (_store_mc_truth_track_ids_) {
+      if (a_tracker_hit.get_track_id() > mctools::track_utils::INVALID_TRACK_ID) {
+        digits_.mcTrackIDs[row] = a_tracker_hit.get_track_id();
+      }
+      if (a_tracker_hit.get_parent_track_id() > mctools::track_utils::INVALID_TRACK_ID) {
+        digits_.mcParentTrackIDs[row] = a_tracker_hit.get_parent_track_id();
       }
-    } else {
-      calTrackerHit->set_noisy(true);
     }
 
-    if (datatools::is_valid(radius)) {
-      calTrackerHit->set_r(radius);
+    if (datatools::is_valid(anode_time)) {
+      digits_.anodeTimes[row] = anode_time;
+      digits_.bottomCathodeTimes[row] = bottom_cathode_time;
+      digits_.topCathodeTimes[row] = top_cathode_time;
     }
+  }
+}
 
-    if (datatools::is_valid(sigma_radius)) {
-      calTrackerHit->set_sigma_r(sigma_radius);
+/** Calibrate tracker hits from digitization informations:
+ *
+ * Each quantity is calibrated for all cells in turn, and the calibrated hits
+ * are only built at the end.
+ */
+mock_tracker_s2c_module::cal_tracker_hit_col_t mock_tracker_s2c_module::calibrateHits_() {
+  const size_t ncells = digits_.size();
+  digits_.resetCalibration();
+
+  // Calibrate the transverse drift distance of prompt hits:
+  for (size_t i = 0; i < ncells; i++) {
+    const double anode_time = digits_.anodeTimes[i];
+    if (datatools::is_valid(anode_time) && anode_time <= _delayed_drift_time_threshold_) {
+      _geiger_.calibrateRadiusFromTime(anode_time, digits_.radii[i], digits_.sigmaRadii[i]);
     }
+  }
 
-    // Calibrate the longitudinal drift distance:
-    const double t1 = the_raw_tracker_hit.get_bottom_time();
-    const double t2 = the_raw_tracker_hit.get_top_time();
-    double z{datatools::invalid_real_double()};
-    double sigma_z{datatools::invalid_real_double()};
+  // Calibrate the longitudinal drift distance:
+  const double plasma_propagation_speed = _geiger_.getPlasmaSpeed();
+  const double cell_length = _geiger_.getCellLength();
+  for (size_t i = 0; i < ncells; i++) {
+    const double t1 = digits_.bottomCathodeTimes[i];
+    const double t2 = digits_.topCathodeTimes[i];
+    double& z = digits_.zs[i];
+    double& sigma_z = digits_.sigmaZs[i];
 
-    const double plasma_propagation_speed = _geiger_.getPlasmaSpeed();
     size_t missing_cathodes = 0;
     if (!datatools::is_valid(t1) && !datatools::is_valid(t2)) {
       // missing top/bottom cathode signals:
       missing_cathodes = 2;
       sigma_z = _geiger_.getLongitudinalResolution(z, missing_cathodes);
       z = 0.0;
-      calTrackerHit->set_top_cathode_missing(true);
-      calTrackerHit->set_bottom_cathode_missing(true);
     } else if (!datatools::is_valid(t1) && datatools::is_valid(t2)) {
       // missing bottom cathode signal:
       missing_cathodes = 1;
-      const double mean_z = 0.5 * _geiger_.getCellLength() - t2 * plasma_propagation_speed;
+      const double mean_z = 0.5 * cell_length - t2 * plasma_propagation_speed;
       sigma_z = _geiger_.getLongitudinalResolution(mean_z, missing_cathodes);
       z = _geiger_.smearZ(RNG_, mean_z, sigma_z);
-      calTrackerHit->set_bottom_cathode_missing(true);
     } else if (datatools::is_valid(t1) && !datatools::is_valid(t2)) {
       // missing top cathode signal:
       missing_cathodes = 1;
-      const double mean_z = t1 * plasma_propagation_speed - 0.5 * _geiger_.getCellLength();
+      const double mean_z = t1 * plasma_propagation_speed - 0.5 * cell_length;
       sigma_z = _geiger_.getLongitudinalResolution(mean_z, missing_cathodes);
       z = _geiger_.smearZ(RNG_, mean_z, sigma_z);
-      calTrackerHit->set_top_cathode_missing(true);
     } else {
       missing_cathodes = 0;
-      const double plasma_propagation_speed_2 = _geiger_.getCellLength() / (t1 + t2);
-      const double mean_z = 0.5 * _geiger_.getCellLength() - t2 * plasma_propagation_speed_2;
+      const double plasma_propagation_speed_2 = cell_length / (t1 + t2);
+      const double mean_z = 0.5 * cell_length - t2 * plasma_propagation_speed_2;
       sigma_z = _geiger_.getLongitudinalResolution(mean_z, missing_cathodes);
       z = _geiger_.smearZ(RNG_, mean_z, sigma_z);
     }
+  }
 
-    // set values in the calibrated tracker hit:
-    if (datatools::is_valid(z)) {
-      calTrackerHit->set_z(z);
-    }
-    if (datatools::is_valid(sigma_z)) {
-      calTrackerHit->set_sigma_z(sigma_z);
-    }
+  // COORDINATES...
+  // pickup the ID mapping from the geometry manager:
+  const geomtools::mapping& the_mapping = geoManager->get_mapping();
+  const geomtools::id_mgr& the_id_mgr = geoManager->get_id_mgr();
+
+  // current module geometry ID and information:
+  int module_number = geomtools::geom_id::INVALID_ADDRESS;
+  const geomtools::placement* module_placement = nullptr;
 
-    // COORDINATES...
+  for (size_t i = 0; i < ncells; i++) {
+    const geomtools::geom_id& gid = digits_.cellIDs[i];
     // int this_cell_module_number = geom_manager_->get_id_mgr().get(gid, "module");
     const int this_cell_module_number = gid.get(0);
     if (this_cell_module_number != module_number) {
@@ -405,41 +333,100 @@ mock_tracker_s2c_module::cal_tracker_hit_col_t mock_tracker_s2c_module::calibrat
       the_id_mgr.make_id(_module_category_, module_gid);
       the_id_mgr.extract(gid, module_gid);
       module_number = this_cell_module_number;
-      module_ginfo = &the_mapping.get_geom_info(module_gid);
-      module_placement = &(module_ginfo->get_world_placement());
+      module_placement = &(the_mapping.get_geom_info(module_gid).get_world_placement());
     }
 
-    // extract the geom info of the corresponding cell:
-    const geomtools::geom_info& ginfo = the_mapping.get_geom_info(gid);
     // store the X-Y position of the cell within the module coordinate system:
     geomtools::vector_3d cell_self_pos(0.0, 0.0, 0.0);
     geomtools::vector_3d cell_world_pos;
-    ginfo.get_world_placement().child_to_mother(cell_self_pos, cell_world_pos);
+    digits_.cellInfos[i]->get_world_placement().child_to_mother(cell_self_pos, cell_world_pos);
     geomtools::vector_3d cell_module_pos;
     module_placement->mother_to_child(cell_world_pos, cell_module_pos);
-    calTrackerHit->set_xy(cell_module_pos.getX(), cell_module_pos.getY());
+    digits_.xs[i] = cell_module_pos.getX();
+    digits_.ys[i] = cell_module_pos.getY();
+  }
+
+  // Build the calibrated tracker hits:
+  cal_tracker_hit_col_t calTrackerHits{};
+  calTrackerHits.reserve(ncells);
+  for (size_t i = 0; i < ncells; i++) {
+    auto calTrackerHit =
+        snemo::datamodel::make_pooled_handle<snemo::datamodel::calibrated_tracker_hit>();
+
+    // Hit and GeomIDs
+    calTrackerHit->set_hit_id(i);
+    calTrackerHit->set_geom_id(digits_.cellIDs[i]);
+
+    const double anode_time = digits_.anodeTimes[i];
+    if (datatools::is_valid(anode_time)) {
+      if (anode_time <= _delayed_drift_time_threshold_) {
+        // Case of a normal/prompt hit :
+        calTrackerHit->set_anode_time(anode_time);
+        if (anode_time > _peripheral_drift_time_threshold_) {
+          calTrackerHit->set_peripheral(true);
+        }
+      } else {
+        // 2012-03-29 FM : store the anode_time as the reference delayed time
+        calTrackerHit->set_delayed_time(anode_time, _geiger_.getAnodeTimeResolution(anode_time));
+      }
+    } else {
+      calTrackerHit->set_noisy(true);
+    }
+
+    if (datatools::is_valid(digits_.radii[i])) {
+      calTrackerHit->set_r(digits_.radii[i]);
+    }
+
+    if (datatools::is_valid(digits_.sigmaRadii[i])) {
+      calTrackerHit->set_sigma_r(digits_.sigmaRadii[i]);
+    }
+
+    if (!datatools::is_valid(digits_.bottomCathodeTimes[i])) {
+      calTrackerHit->set_bottom_cathode_missing(true);
+    }
+    if (!datatools::is_valid(digits_.topCathodeTimes[i])) {
+      calTrackerHit->set_top_cathode_missing(true);
+    }
+
+    // set values in the calibrated tracker hit:
+    if (datatools::is_valid(digits_.zs[i])) {
+      calTrackerHit->set_z(digits_.zs[i]);
+    }
+    if (datatools::is_valid(digits_.sigmaZs[i])) {
+      calTrackerHit->set_sigma_z(digits_.sigmaZs[i]);
+    }
+
+    calTrackerHit->set_xy(digits_.xs[i], digits_.ys[i]);
 
     // 2012-07-26 FM : add a reference to the MC true hit ID
-    if (_store_mc_hit_id_) {
-      if (the_raw_tracker_hit.get_auxiliaries().has_key(mctools::hit_utils::HIT_MC_HIT_ID_KEY)) {
-        const int true_tracker_hit_id = the_raw_tracker_hit.get_auxiliaries().fetch_integer(
-            mctools::hit_utils::HIT_MC_HIT_ID_KEY);
-        calTrackerHit->grab_auxiliaries().update(mctools::hit_utils::HIT_MC_HIT_ID_KEY,
-                                                 true_tracker_hit_id);
+    if (_store_mc_hit_id_ && digits_.mcHitIDs[i] > geomtools::base_hit::INVALID_HIT_ID) {
+      calTrackerHit->grab_auxiliaries().update(mctools::hit_utils::HIT_MC_HIT_ID_KEY,
+                                               digits_.mcHitIDs[i]);
+    }
+
+    // 2014-04-06 FM : add references to the MC truth track and parent track IDs
+    if (_store_mc_truth_track_ids_) {
+      if (digits_.mcTrackIDs[i] > mctools::track_utils::INVALID_TRACK_ID) {
+        calTrackerHit->grab_auxiliaries().update(mctools::track_utils::TRACK_ID_KEY,
+                                                 digits_.mcTrackIDs[i]);
+      }
+      if (digits_.mcParentTrackIDs[i] > mctools::track_utils::INVALID_TRACK_ID) {
+        calTrackerHit->grab_auxiliaries().update(mctools::track_utils::PARENT_TRACK_ID_KEY,
+                                                 digits_.mcParentTrackIDs[i]);
       }
     }
 
     // save the calibrate tracker hit:
     calTrackerHits.emplace_back(calTrackerHit);
-  }  // loop over raw tracker hits
+  }
 
   return calTrackerHits;
 }
 
 mock_tracker_s2c_module::cal_tracker_hit_col_t mock_tracker_s2c_module::process_(
     const sim_tracker_hit_col_t& hits) {
-  raw_tracker_hit_col_t rawTrackerHits{digitizeHits_(hits)};
-  return calibrateHits_(rawTrackerHits);
+  digitizeHits_(hits);
+  return calibrateHits_();
 }
 
 }  // end of namespace processing
@@ -519,6 +506,42 @@ DOCD_CLASS_IMPLEMENT_LOAD_BEGIN(snemo::processing::mock_tracker_s2c_module, ocd_
             "                                       \n");
   }
 
+  {
+    // Description of the 'random.event_seeding' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("random.event_seeding")
+        .set_terse_description("Flag to reseed the embedded PRNG for each event")
+        .set_traits(datatools::TYPE_BOOLEAN)
+        .set_mandatory(false)
+        .set_long_description(
+            "The seed of each event is derived from ``random.seed``,  \n"
+            "the run and event numbers of the event header and the    \n"
+            "module name. Hits then no longer depend on which events  \n"
+            "were processed before, nor in which order.               \n")
+        .set_default_value_boolean(false)
+        .add_example(
+            "Reseed the PRNG for each event::       \n"
+            "                                       \n"
+            "  random.event_seeding : boolean = 1   \n"
+            "                                       \n");
+  }
+
+  {
+    // Description of the 'EH_label' configuration property :
+    datatools::configuration_property_description& cpd = ocd_.add_property_info();
+    cpd.set_name_pattern("EH_label")
+        .set_terse_description("The label/name of the 'event header' bank")
+        .set_traits(datatools::TYPE_STRING)
+        .set_mandatory(false)
+        .set_long_description("Only used if ``random.event_seeding`` is set.")
+        .set_default_value_string(snedm::labels::event_header())
+        .add_example(
+            "Use an alternative name for the 'event header' bank:: \n"
+            "                                \n"
+            "  EH_label : string = \"EH2\"   \n"
+            "                                \n");
+  }
+
   {
     // Description of the 'random.id' configuration property :
     datatools::configuration_property_description& cpd = ocd_.add_property_info();
@@ -608,11 +631,12 @@ DOCD_CLASS_IMPLEMENT_LOAD_BEGIN(snemo::processing::mock_tracker_s2c_module, ocd_
   }
 
   {
-    // Description of the 'store_mc_track_id' configuration property :
+    // Description of the 'store_mc_truth_track_ids' configuration property :
     datatools::configuration_property_description& cpd = ocd_.add_property_info();
-    cpd.set_name_pattern("store_mc_track_id")
+    cpd.set_name_pattern("store_mc_truth_track_ids")
         .set_terse_description(
-            "Flag to activate the storage of the truth track Id in the calibrated hits")
+            "Flag to activate the storage of the truth track and parent track Ids in the "
+            "calibrated hits")
         .set_traits(datatools::TYPE_BOOLEAN)
         .set_mandatory(false)
         .set_long_description(
@@ -621,10 +645,10 @@ DOCD_CLASS_IMPLEMENT_LOAD_BEGIN(snemo::processing::mock_tracker_s2c_module, ocd_
             "this information from the MC engine (Geant4).        \n")
         .set_default_value_boolean(false)
         .add_example(
-            "Use the default value::          \n"
-            "                                 \n"
-            "  store_mc_track_id : boolean = 0  \n"
-            "                                 \n");
+            "Use the default value::                   \n"
+            "                                          \n"
+            "  store_mc_truth_track_ids : boolean = 0  \n"
+            "                                          \n");
   }
 
   {
@@ -656,11 +680,12 @@ DOCD_CLASS_IMPLEMENT_LOAD_BEGIN(snemo::processing::mock_tracker_s2c_module, ocd_
       "  CD_label        : string = \"CD\"                          \n"
       "  random.seed     : integer = 314159                         \n"
       "  random.id       : string = \"taus2\"                       \n"
+      "  random.event_seeding : boolean = 0                         \n"
       "  module_category : string = \"module\"                      \n"
       "  peripheral_drift_time_threshold : real = 4.0 us            \n"
       "  delayed_drift_time_threshold    : real = 10.0 us           \n"
       "  store_mc_hit_id  : boolean = 0                             \n"
-      "  store_mc_track_id : boolean = 0                            \n"
+      "  store_mc_truth_track_ids : boolean = 0                     \n"
       "  hit_category     : string = \"gg\"                         \n"
       "  cell_diameter    : real as length = 44 mm                  \n"
       "  cell_length      : real as length = 2900 mm                \n"
@@ -20,6 +20,7 @@
 // Standard library:
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // Third party:
@@ -29,6 +30,8 @@
 
 // This project :
 #include <falaise/snemo/datamodels/calibrated_data.h>
+#include <falaise/snemo/geometry/utils.h>
+#include <falaise/snemo/processing/detail/mock_tracker_digits.h>
 #include <falaise/snemo/processing/geiger_regime.h>
 #include <falaise/snemo/services/geometry.h>
 #include <falaise/snemo/services/service_handle.h>
@@ -37,12 +40,6 @@ namespace geomtools {
 class manager;
 }
 
-namespace snreco {
-namespace detail {
-class mock_raw_tracker_hit;
-}
-}  // namespace snreco
-
 namespace snemo {
 
 namespace processing {
@@ -67,14 +64,13 @@ class mock_tracker_s2c_module : public dpp::base_module {
  private:
   // Rationalized typenames
   using sim_tracker_hit_col_t = mctools::simulated_data::hit_handle_collection_type;
-  using raw_tracker_hit_col_t = std::list<snreco::detail::mock_raw_tracker_hit>;
   using cal_tracker_hit_col_t = snemo::datamodel::TrackerHitHdlCollection;
 
-  /// Digitize tracker hits
-  raw_tracker_hit_col_t digitizeHits_(const sim_tracker_hit_col_t& steps);
+  /// Digitize tracker hits into digits_
+  void digitizeHits_(const sim_tracker_hit_col_t& steps);
 
-  /// Calibrate tracker hits (longitudinal and transverse spread)
-  cal_tracker_hit_col_t calibrateHits_(const raw_tracker_hit_col_t& digits);
+  /// Calibrate digits_ (longitudinal and transverse spread) and build the calibrated hits
+  cal_tracker_hit_col_t calibrateHits_();
 
   /// Main process function
   cal_tracker_hit_col_t process_(const sim_tracker_hit_col_t& hits);
@@ -84,6 +80,9 @@ class mock_tracker_s2c_module : public dpp::base_module {
   std::string _hit_category_{};     //!< The category of the input Geiger hits
   geiger_regime _geiger_{};         //!< Geiger regime tools
   mygsl::rng RNG_{};                //!< internal PRN generator
+  int32_t baseSeed_{0};             //!< Seed of RNG_, from which event seeds are derived
+  bool eventSeeding_{false};        //!< Flag to reseed RNG_ for each event
+  std::string ehInputTag{};         //!< The label of the event header bank
   double _peripheral_drift_time_threshold_{
       datatools::invalid_real_double()};  //!< Peripheral drift time threshold
   double _delayed_drift_time_threshold_{
@@ -94,6 +93,12 @@ class mock_tracker_s2c_module : public dpp::base_module {
   bool _store_mc_truth_track_ids_{false};  //!< The flag to reference the MC engine track and parent
                                            //!< track IDs associated to this calibrated Geiger hit
 
+  // Working buffers, reused from one event to the next
+  snreco::detail::mock_tracker_steps steps_{};    //!< Step hits of the current event
+  snreco::detail::mock_tracker_digits digits_{};  //!< Cells hit in the current event
+  std::unordered_map<geomtools::geom_id, size_t, geometry::geom_id_hash>
+      cellRows_{};  //!< Row of each hit cell in digits_
+
   // Macro to automate the registration of the module :
   DPP_MODULE_REGISTRATION_INTERFACE(mock_tracker_s2c_module)
 };
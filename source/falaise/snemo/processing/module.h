@@ -10,6 +10,7 @@
 #include <bayeux/dpp/base_module.h>
 
 #include "falaise/property_set.h"
+#include "falaise/snemo/processing/profiler.h"
 
 namespace falaise {
 namespace processing {
@@ -154,11 +155,15 @@ class module : public dpp::base_module {
 
   //! Process the input data
   /*!
-   *  The data is passed to the process member function of the wrapped type
+   *  The data is passed to the process member function of the wrapped type.
+   *  The call is sampled by the @ref profiler when it is active.
    *  \param data Reference to the input data
    *  \return An enum reflecting the success/failure/other of the processing
    */
-  status process(datatools::things& data) override { return wrappedModule.process(data); };
+  status process(datatools::things& data) override {
+    scoped_profile profile{get_name()};
+    return profile.result(wrappedModule.process(data));
+  };
 
  private:
   T wrappedModule{};  //! Implementation of the processing algorithm
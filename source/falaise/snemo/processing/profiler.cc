@@ -0,0 +1,194 @@
+// falaise/snemo/processing/profiler.cc
+
+// Ourselves:
+#include "falaise/snemo/processing/profiler.h"
+
+// Standard library:
+#include <algorithm>
+#include <ctime>
+#include <numeric>
+#include <ostream>
+
+namespace {
+
+//! Return the CPU time consumed by the calling thread, in ns
+double thread_cpu_time() {
+  timespec ts{};
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return 1.e9 * static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec);
+}
+
+//! Return a readable label for a processing status
+std::string status_label(dpp::base_module::process_status status) {
+  if (status == dpp::base_module::PROCESS_OK) {
+    return "PROCESS_OK";
+  }
+  if (status == dpp::base_module::PROCESS_ERROR) {
+    return "PROCESS_ERROR";
+  }
+  if (status == dpp::base_module::PROCESS_STOP) {
+    return "PROCESS_STOP";
+  }
+  if (status == dpp::base_module::PROCESS_ERROR_STOP) {
+    return "PROCESS_ERROR_STOP";
+  }
+  if (status == dpp::base_module::PROCESS_FATAL) {
+    return "PROCESS_FATAL";
+  }
+  if (status == dpp::base_module::PROCESS_INVALID) {
+    return "PROCESS_INVALID";
+  }
+  return std::to_string(static_cast<int>(status));
+}
+
+//! Return the value below which the fraction q of the sorted samples lie
+double percentile(const std::vector<double>& sorted, double q) {
+  if (sorted.empty()) {
+    return 0.0;
+  }
+  auto rank = static_cast<std::size_t>(q * static_cast<double>(sorted.size() - 1) + 0.5);
+  return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+//! Write a JSON string, escaping the characters JSON requires to be escaped
+void write_json_string(std::ostream& out, const std::string& s) {
+  out << '"';
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      out << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      out << ' ';
+    } else {
+      out << c;
+    }
+  }
+  out << '"';
+}
+
+//! Write the summary statistics of a set of samples as a JSON object
+void write_json_summary(std::ostream& out, std::vector<double> values, const std::string& unit) {
+  std::sort(values.begin(), values.end());
+  double total = std::accumulate(values.begin(), values.end(), 0.0);
+  double mean = values.empty() ? 0.0 : total / static_cast<double>(values.size());
+  out << "{\"unit\": ";
+  write_json_string(out, unit);
+  out << ", \"total\": " << total << ", \"mean\": " << mean
+      << ", \"min\": " << (values.empty() ? 0.0 : values.front())
+      << ", \"p50\": " << percentile(values, 0.50) << ", \"p90\": " << percentile(values, 0.90)
+      << ", \"p99\": " << percentile(values, 0.99)
+      << ", \"max\": " << (values.empty() ? 0.0 : values.back()) << "}";
+}
+
+}  // namespace
+
+namespace falaise {
+namespace processing {
+
+std::atomic<bool> profiler::active_{false};
+
+profiler& profiler::instance() {
+  static profiler theProfiler;
+  return theProfiler;
+}
+
+void profiler::set_enabled(bool enabled) { active_ = enabled; }
+
+void profiler::set_allocation_probe(allocation_probe probe) { probe_ = probe; }
+
+allocation_probe profiler::get_allocation_probe() const { return probe_; }
+
+void profiler::record(const std::string& module, const profile_sample& sample) {
+  std::lock_guard<std::mutex> lock{mutex_};
+  module_samples& s = samples_[module];
+  s.wall_time.push_back(sample.wall_time);
+  s.cpu_time.push_back(sample.cpu_time);
+  s.allocations.push_back(static_cast<double>(sample.allocations));
+  s.allocated_bytes.push_back(static_cast<double>(sample.allocated_bytes));
+  s.statuses[status_label(sample.result)]++;
+}
+
+void profiler::record_timer(const std::string& timer, double wall_time) {
+  std::lock_guard<std::mutex> lock{mutex_};
+  timers_[timer].push_back(wall_time);
+}
+
+void profiler::clear() {
+  std::lock_guard<std::mutex> lock{mutex_};
+  samples_.clear();
+  timers_.clear();
+}
+
+void profiler::write_json(std::ostream& out) const {
+  std::lock_guard<std::mutex> lock{mutex_};
+  auto oldPrecision = out.precision(12);
+  out << "{\n  \"allocations_counted\": " << std::boolalpha << (probe_ != nullptr)
+      << ",\n  \"modules\": {";
+  bool firstModule = true;
+  for (const auto& entry : samples_) {
+    const module_samples& s = entry.second;
+    out << (firstModule ? "\n" : ",\n") << "    ";
+    firstModule = false;
+    write_json_string(out, entry.first);
+    out << ": {\n      \"calls\": " << s.wall_time.size() << ",\n      \"wall_time\": ";
+    write_json_summary(out, s.wall_time, "ns");
+    out << ",\n      \"cpu_time\": ";
+    write_json_summary(out, s.cpu_time, "ns");
+    out << ",\n      \"allocations\": ";
+    write_json_summary(out, s.allocations, "count");
+    out << ",\n      \"allocated_bytes\": ";
+    write_json_summary(out, s.allocated_bytes, "bytes");
+    out << ",\n      \"status\": {";
+    bool firstStatus = true;
+    for (const auto& status : s.statuses) {
+      out << (firstStatus ? "" : ", ");
+      firstStatus = false;
+      write_json_string(out, status.first);
+      out << ": " << status.second;
+    }
+    out << "}\n    }";
+  }
+  out << "\n  },\n  \"timers\": {";
+  bool firstTimer = true;
+  for (const auto& entry : timers_) {
+    out << (firstTimer ? "\n" : ",\n") << "    ";
+    firstTimer = false;
+    write_json_string(out, entry.first);
+    out << ": {\n      \"laps\": " << entry.second.size() << ",\n      \"wall_time\": ";
+    write_json_summary(out, entry.second, "ns");
+    out << "\n    }";
+  }
+  out << "\n  }\n}\n";
+  out.precision(oldPrecision);
+}
+
+scoped_profile::scoped_profile(const std::string& module) : active_(profiler::is_active()) {
+  if (!active_) {
+    return;
+  }
+  module_ = module;
+  if (allocation_probe probe = profiler::instance().get_allocation_probe()) {
+    probe(sample_.allocations, sample_.allocated_bytes);
+  }
+  cpuStart_ = thread_cpu_time();
+  wallStart_ = std::chrono::steady_clock::now();
+}
+
+scoped_profile::~scoped_profile() {
+  if (!active_) {
+    return;
+  }
+  std::chrono::duration<double, std::nano> wall = std::chrono::steady_clock::now() - wallStart_;
+  sample_.wall_time = wall.count();
+  sample_.cpu_time = thread_cpu_time() - cpuStart_;
+  if (allocation_probe probe = profiler::instance().get_allocation_probe()) {
+    std::size_t count = 0;
+    std::size_t bytes = 0;
+    probe(count, bytes);
+    sample_.allocations = count - sample_.allocations;
+    sample_.allocated_bytes = bytes - sample_.allocated_bytes;
+  }
+  profiler::instance().record(module_, sample_);
+}
+
+}  // namespace processing
+}  // namespace falaise
@@ -0,0 +1,140 @@
+//! \file falaise/snemo/processing/profiler.h
+//! \brief Per-module timing and memory profiling of processing calls
+#ifndef FALAISE_SNEMO_PROCESSING_PROFILER_H
+#define FALAISE_SNEMO_PROCESSING_PROFILER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <bayeux/dpp/base_module.h>
+
+namespace falaise {
+namespace processing {
+
+//! Resources used by a single call to a module's process member function
+struct profile_sample {
+  double wall_time = 0.0;            //!< Elapsed wall clock time (ns)
+  double cpu_time = 0.0;             //!< CPU time consumed by the calling thread (ns)
+  std::size_t allocations = 0;       //!< Number of heap allocations
+  std::size_t allocated_bytes = 0;   //!< Number of bytes allocated on the heap
+  dpp::base_module::process_status result = dpp::base_module::PROCESS_INVALID;  //!< Returned status
+};
+
+//! Function reporting the cumulative heap allocations made by the calling thread
+/*!
+ * Counting allocations requires replacing the global `operator new`, which
+ * only an application can do. Applications that do so can register a probe
+ * with @ref profiler::set_allocation_probe. Without a probe, allocations are
+ * reported as zero.
+ */
+using allocation_probe = void (*)(std::size_t& count, std::size_t& bytes);
+
+//! \brief Collect profile samples of processing modules
+/*!
+ * The profiler is a process wide singleton, disabled by default. Once
+ * enabled, every call to the process member function of modules wrapped by
+ * @ref falaise::processing::module, or instrumented with @ref scoped_profile,
+ * is timed and recorded under the module's name. Recording is thread safe.
+ *
+ * Modules may also record the laps of their internal timers with
+ * @ref profiler::record_timer. Timers are reported apart from the modules,
+ * and do not count as processing calls.
+ *
+ * At the end of a run, @ref profiler::write_json summarises the samples of
+ * each module as totals and p50/p90/p99 percentiles, plus the distribution
+ * of returned statuses, and the wall time of each timer.
+ */
+class profiler {
+ public:
+  //! Return the process wide instance
+  static profiler& instance();
+
+  //! Return true if samples are recorded
+  static bool is_active() { return active_.load(std::memory_order_relaxed); }
+
+  //! Start or stop recording samples
+  void set_enabled(bool enabled);
+
+  //! Set the function used to count heap allocations
+  void set_allocation_probe(allocation_probe probe);
+
+  //! Return the function used to count heap allocations, if any
+  allocation_probe get_allocation_probe() const;
+
+  //! Store a sample for the named module
+  void record(const std::string& module, const profile_sample& sample);
+
+  //! Store the wall time (ns) of one lap of the named timer
+  void record_timer(const std::string& timer, double wall_time);
+
+  //! Discard all samples
+  void clear();
+
+  //! Write the summary of all samples in JSON format
+  void write_json(std::ostream& out) const;
+
+ private:
+  profiler() = default;
+
+  //! Samples of one module, stored by quantity
+  struct module_samples {
+    std::vector<double> wall_time;
+    std::vector<double> cpu_time;
+    std::vector<double> allocations;
+    std::vector<double> allocated_bytes;
+    std::map<std::string, std::size_t> statuses;
+  };
+
+  static std::atomic<bool> active_;
+  std::atomic<allocation_probe> probe_{nullptr};
+  mutable std::mutex mutex_;
+  std::map<std::string, module_samples> samples_;
+  std::map<std::string, std::vector<double>> timers_;
+};
+
+//! \brief Measure the resources used by one processing call
+/*!
+ * Sampling starts at construction and the sample is recorded in the
+ * @ref profiler on destruction, also when the call ends with an exception.
+ * Nothing is measured when the profiler is inactive.
+ *
+ * ```cpp
+ * dpp::base_module::process_status my_module::process(datatools::things& event) {
+ *   falaise::processing::scoped_profile profile{get_name()};
+ *   ...
+ *   return profile.result(dpp::base_module::PROCESS_OK);
+ * }
+ * ```
+ */
+class scoped_profile {
+ public:
+  explicit scoped_profile(const std::string& module);
+  ~scoped_profile();
+
+  scoped_profile(const scoped_profile&) = delete;
+  scoped_profile& operator=(const scoped_profile&) = delete;
+
+  //! Register the status returned by the call, and return it
+  dpp::base_module::process_status result(dpp::base_module::process_status status) {
+    sample_.result = status;
+    return status;
+  }
+
+ private:
+  bool active_;
+  std::string module_;
+  std::chrono::steady_clock::time_point wallStart_;
+  double cpuStart_ = 0.0;
+  profile_sample sample_;
+};
+
+}  // namespace processing
+}  // namespace falaise
+
+#endif  // FALAISE_SNEMO_PROCESSING_PROFILER_H
@@ -5,6 +5,8 @@
 
 // Standard library:
 #include <fstream>
+#include <unordered_map>
+#include <vector>
 
 // Third party:
 // - Bayeux/mygsl:
@@ -16,9 +18,16 @@
 
 // This project:
 #include <falaise/snemo/datamodels/gg_track_utils.h>
+#include <falaise/snemo/geometry/utils.h>
 #include "falaise/property_set.h"
 #include "falaise/quantity.h"
 
+namespace {
+// Ranks in the output collection of the Geiger hits in each drift cell, in insertion order
+typedef std::unordered_map<geomtools::geom_id, std::vector<size_t>, snemo::geometry::geom_id_hash>
+    gg_hit_index_type;
+}  // namespace
+
 namespace snemo {
 
 namespace simulation {
@@ -281,6 +290,21 @@ void gg_step_hit_processor::_process(
 
   const double locator_tolerance = 0.1 * CLHEP::micrometer;
 
+  // Only Geiger hits in the same drift cell can match a step hit, so candidate
+  // hits are looked up by cell rather than by scanning the whole collection.
+  // Ranks are stored instead of addresses as plain hits may be reallocated.
+  gg_hit_index_type gg_hit_index;
+  auto gg_hit_at = [&](size_t rank_) -> mctools::base_step_hit & {
+    return useHandles ? (*handleHits)[rank_].grab() : (*plainHits)[rank_];
+  };
+  const size_t nhits_in = useHandles ? handleHits->size() : plainHits->size();
+  for (size_t rank = 0; rank < nhits_in; rank++) {
+    if (useHandles && !(*handleHits)[rank].has_data()) {
+      continue;
+    }
+    gg_hit_index[gg_hit_at(rank).get_geom_id()].push_back(rank);
+  }
+
   for (auto ihit : hitPtrCollection) {
     auto &the_step_hit = const_cast<mctools::base_step_hit &>(*ihit);
 
@@ -775,22 +799,12 @@ void gg_step_hit_processor::_process(
         matching_gg = current_gg_hit;
       }
     }
-    // else we scan the whole list of gg hits to find a match :
+    // else we scan the gg hits in the same drift cell to find a match :
     if (matching_gg == nullptr) {
-      if (useHandles) {
-        for (auto &gg_hit : *handleHits) {
-          if (!gg_hit.has_data()) {
-            continue;
-          }
-          mctools::base_step_hit &matching_hit = gg_hit.grab();
-          if (match_gg_hit(matching_hit, the_step_hit)) {
-            // pick up the first matching gg hit :
-            matching_gg = &matching_hit;
-            break;
-          }
-        }
-      } else {
-        for (auto &matching_hit : *plainHits) {
+      auto found = gg_hit_index.find(gid);
+      if (found != gg_hit_index.end()) {
+        for (size_t rank : found->second) {
+          mctools::base_step_hit &matching_hit = gg_hit_at(rank);
           if (match_gg_hit(matching_hit, the_step_hit)) {
             // pick up the first matching gg hit :
             matching_gg = &matching_hit;
@@ -817,6 +831,7 @@ void gg_step_hit_processor::_process(
         // get a reference to the last inserted GG hit :
         current_gg_hit = &(plainHits->back());
       }
+      gg_hit_index[gid].push_back(useHandles ? handleHits->size() - 1 : plainHits->size() - 1);
       // update the attributes of the hit :
       current_gg_hit->set_hit_id(gg_hit_count);
       current_gg_hit->set_geom_id(gid);
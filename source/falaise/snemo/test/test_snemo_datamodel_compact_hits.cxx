@@ -0,0 +1,212 @@
+// Catch
+#include "catch.hpp"
+
+#include "falaise/snemo/datamodels/calibrated_data.h"
+#include "falaise/snemo/datamodels/event.h"
+#include "falaise/snemo/datamodels/hit_encoding.h"
+#include "falaise/snemo/datamodels/packed_bank.h"
+
+#include "bayeux/datatools/clhep_units.h"
+#include "bayeux/datatools/utils.h"
+
+#include <boost/archive/xml_iarchive.hpp>
+
+#include <fstream>
+
+namespace sdm = snemo::datamodel;
+
+namespace {
+// Fill the calibrated data of record with hits having all kinds of fields
+void add_hits(datatools::things& record) {
+  auto& calibratedData = record.add<sdm::calibrated_data>("CD");
+
+  sdm::TrackerHitHdl trackerHit{new sdm::calibrated_tracker_hit};
+  trackerHit->set_hit_id(12);
+  trackerHit->set_geom_id(geomtools::geom_id(1204, 0, 1, 7, 35));
+  trackerHit->set_r(13.4 * CLHEP::mm);
+  trackerHit->set_sigma_r(0.7 * CLHEP::mm);
+  trackerHit->set_z(45.6 * CLHEP::cm);
+  trackerHit->set_sigma_z(0.7 * CLHEP::cm);
+  trackerHit->set_xy(10.0 * CLHEP::mm, 20.0 * CLHEP::mm);
+  trackerHit->set_delayed_time(12.5 * CLHEP::microsecond, 20 * CLHEP::ns);
+  trackerHit->set_peripheral(true);
+  calibratedData.tracker_hits().push_back(trackerHit);
+
+  // A prompt hit without auxiliaries nor cell position
+  sdm::TrackerHitHdl promptHit{new sdm::calibrated_tracker_hit};
+  promptHit->set_hit_id(13);
+  promptHit->set_geom_id(geomtools::geom_id(1204, 0, 0, 2, 100));
+  promptHit->set_r(2.0 * CLHEP::mm);
+  calibratedData.tracker_hits().push_back(promptHit);
+
+  sdm::CalorimeterHitHdl caloHit{new sdm::calibrated_calorimeter_hit};
+  caloHit->set_hit_id(3);
+  caloHit->set_geom_id(geomtools::geom_id(1302, 0, 1, 4, 7, geomtools::geom_id::ANY_ADDRESS));
+  caloHit->grab_auxiliaries().store("mascot", "snaily");
+  caloHit->set_energy(1.234 * CLHEP::MeV);
+  caloHit->set_sigma_energy(0.08 * CLHEP::MeV);
+  caloHit->set_time(25.0 * CLHEP::ns);
+  caloHit->set_sigma_time(0.25 * CLHEP::ns);
+  calibratedData.calorimeter_hits().push_back(caloHit);
+}
+
+// Write the calibrated data to a portable binary archive and read it back
+// Return the size of the archive
+std::size_t round_trip(datatools::things& record) {
+  sdm::pack_bank(record, "CD");
+  const std::size_t size = record.get<sdm::packed_bank>("CD").size();
+  snedm::getFromEvent<sdm::calibrated_data>("CD", record);
+  return size;
+}
+
+// Read hits from a sample XML archive of the tests
+void load_sample(const std::string& name, sdm::calibrated_tracker_hit& trackerHit,
+                 sdm::calibrated_calorimeter_hit* caloHit = nullptr) {
+  std::string path = "${FALAISE_TESTING_DIR}/samples/" + name;
+  datatools::fetch_path_with_env(path);
+  std::ifstream input(path);
+  REQUIRE(input);
+  boost::archive::xml_iarchive archive(input);
+  archive >> boost::serialization::make_nvp("tracker_hit", trackerHit);
+  if (caloHit != nullptr) {
+    archive >> boost::serialization::make_nvp("calorimeter_hit", *caloHit);
+  }
+}
+}  // namespace
+
+TEST_CASE("Calibrated hits are written at full precision by default", "[falaise][datamodel]") {
+  REQUIRE_FALSE(sdm::is_compact_hit_encoding());
+  datatools::things record;
+  add_hits(record);
+  round_trip(record);
+  const auto& loaded = snedm::getFromEvent<sdm::calibrated_data>("CD", record);
+  REQUIRE(loaded.tracker_hits().size() == 2);
+  REQUIRE(loaded.calorimeter_hits().size() == 1);
+
+  const sdm::calibrated_tracker_hit& gg = *loaded.tracker_hits()[0];
+  REQUIRE(gg.get_geom_id() == geomtools::geom_id(1204, 0, 1, 7, 35));
+  REQUIRE(gg.get_r() == 13.4 * CLHEP::mm);
+  REQUIRE(gg.get_sigma_r() == 0.7 * CLHEP::mm);
+  REQUIRE(gg.get_z() == 45.6 * CLHEP::cm);
+  REQUIRE(gg.get_sigma_z() == 0.7 * CLHEP::cm);
+  REQUIRE(gg.get_x() == 10.0 * CLHEP::mm);
+  REQUIRE(gg.get_delayed_time() == 12.5 * CLHEP::microsecond);
+  REQUIRE(gg.is_peripheral());
+
+  const sdm::calibrated_calorimeter_hit& calo = *loaded.calorimeter_hits()[0];
+  REQUIRE(calo.get_energy() == 1.234 * CLHEP::MeV);
+  REQUIRE(calo.get_sigma_energy() == 0.08 * CLHEP::MeV);
+  REQUIRE(calo.get_auxiliaries().fetch_string("mascot") == "snaily");
+}
+
+TEST_CASE("Calibrated hits round trip through their compact encoding", "[falaise][datamodel]") {
+  datatools::things fullRecord;
+  add_hits(fullRecord);
+  const std::size_t fullSize = round_trip(fullRecord);
+
+  sdm::set_compact_hit_encoding(true);
+  datatools::things record;
+  add_hits(record);
+  const std::size_t compactSize = round_trip(record);
+  sdm::set_compact_hit_encoding(false);
+  REQUIRE(compactSize < fullSize);
+
+  const auto& loaded = snedm::getFromEvent<sdm::calibrated_data>("CD", record);
+  REQUIRE(loaded.tracker_hits().size() == 2);
+  REQUIRE(loaded.calorimeter_hits().size() == 1);
+
+  const sdm::calibrated_tracker_hit& gg = *loaded.tracker_hits()[0];
+  REQUIRE(gg.get_hit_id() == 12);
+  REQUIRE(gg.get_geom_id() == geomtools::geom_id(1204, 0, 1, 7, 35));
+  REQUIRE(gg.get_r() == Approx(13.4 * CLHEP::mm));
+  REQUIRE(gg.get_sigma_r() == Approx(0.7 * CLHEP::mm));
+  REQUIRE(gg.get_z() == Approx(45.6 * CLHEP::cm));
+  REQUIRE(gg.get_sigma_z() == Approx(0.7 * CLHEP::cm));
+  REQUIRE(gg.has_xy());
+  REQUIRE(gg.get_x() == Approx(10.0 * CLHEP::mm));
+  REQUIRE(gg.get_y() == Approx(20.0 * CLHEP::mm));
+  REQUIRE(gg.is_delayed());
+  REQUIRE(gg.is_peripheral());
+  REQUIRE(gg.get_delayed_time() == Approx(12.5 * CLHEP::microsecond));
+  REQUIRE(gg.get_delayed_time_error() == Approx(20 * CLHEP::ns));
+  REQUIRE_FALSE(gg.has_auxiliaries());
+
+  const sdm::calibrated_tracker_hit& prompt = *loaded.tracker_hits()[1];
+  REQUIRE(prompt.get_row() == 100);
+  REQUIRE(prompt.is_prompt());
+  REQUIRE_FALSE(prompt.has_xy());
+  REQUIRE_FALSE(datatools::is_valid(prompt.get_sigma_r()));
+
+  const sdm::calibrated_calorimeter_hit& calo = *loaded.calorimeter_hits()[0];
+  REQUIRE(calo.get_hit_id() == 3);
+  REQUIRE(calo.get_geom_id() ==
+          geomtools::geom_id(1302, 0, 1, 4, 7, geomtools::geom_id::ANY_ADDRESS));
+  REQUIRE(calo.get_geom_id().get(4) == geomtools::geom_id::ANY_ADDRESS);
+  REQUIRE(calo.get_auxiliaries().fetch_string("mascot") == "snaily");
+  REQUIRE(calo.get_energy() == Approx(1.234 * CLHEP::MeV));
+  REQUIRE(calo.get_sigma_energy() == Approx(0.08 * CLHEP::MeV));
+  REQUIRE(calo.get_time() == Approx(25.0 * CLHEP::ns));
+  REQUIRE(calo.get_sigma_time() == Approx(0.25 * CLHEP::ns));
+}
+
+TEST_CASE("Large geometry addresses are stored in full", "[falaise][datamodel]") {
+  sdm::set_compact_hit_encoding(true);
+  datatools::things record;
+  auto& calibratedData = record.add<sdm::calibrated_data>("CD");
+  sdm::CalorimeterHitHdl caloHit{new sdm::calibrated_calorimeter_hit};
+  const geomtools::geom_id wideId(1302, 0, 70000, 3);
+  caloHit->set_geom_id(wideId);
+  calibratedData.calorimeter_hits().push_back(caloHit);
+  round_trip(record);
+  sdm::set_compact_hit_encoding(false);
+
+  const auto& loaded = snedm::getFromEvent<sdm::calibrated_data>("CD", record);
+  REQUIRE(loaded.calorimeter_hits()[0]->get_geom_id() == wideId);
+  REQUIRE_FALSE(loaded.calorimeter_hits()[0]->has_hit_id());
+}
+
+TEST_CASE("Hits written by earlier class versions are read", "[falaise][datamodel]") {
+  SECTION("Tracker hit version 0 and calorimeter hit version 0") {
+    sdm::calibrated_tracker_hit gg;
+    sdm::calibrated_calorimeter_hit calo;
+    load_sample("calibrated_hits_v0.xml", gg, &calo);
+    REQUIRE(gg.get_hit_id() == 12);
+    REQUIRE(gg.get_geom_id() == geomtools::geom_id(1204, 0, 1, 7, 35));
+    REQUIRE(gg.get_r() == 13.4 * CLHEP::mm);
+    REQUIRE(gg.get_sigma_r() == 0.7 * CLHEP::mm);
+    REQUIRE(gg.get_z() == 45.6 * CLHEP::cm);
+    REQUIRE(gg.get_sigma_z() == 0.7 * CLHEP::cm);
+    REQUIRE(gg.has_xy());
+    REQUIRE(gg.get_x() == 10.0 * CLHEP::mm);
+    REQUIRE(gg.get_y() == 20.0 * CLHEP::mm);
+    REQUIRE(gg.is_prompt());
+    REQUIRE_FALSE(gg.is_peripheral());
+
+    REQUIRE(calo.get_hit_id() == 3);
+    REQUIRE(calo.get_geom_id() ==
+            geomtools::geom_id(1302, 0, 1, 4, 7, geomtools::geom_id::ANY_ADDRESS));
+    REQUIRE(calo.get_auxiliaries().fetch_string("mascot") == "snaily");
+    REQUIRE(calo.get_energy() == 1.234 * CLHEP::MeV);
+    REQUIRE(calo.get_sigma_energy() == 0.08 * CLHEP::MeV);
+    REQUIRE(calo.get_time() == 25.0 * CLHEP::ns);
+    REQUIRE(calo.get_sigma_time() == 0.25 * CLHEP::ns);
+  }
+
+  SECTION("Tracker hit version 1") {
+    sdm::calibrated_tracker_hit gg;
+    load_sample("calibrated_hits_v1.xml", gg);
+    REQUIRE(gg.get_hit_id() == 12);
+    REQUIRE(gg.get_geom_id() == geomtools::geom_id(1204, 0, 1, 7, 35));
+    REQUIRE(gg.get_r() == 13.4 * CLHEP::mm);
+    REQUIRE(gg.get_sigma_r() == 0.7 * CLHEP::mm);
+    REQUIRE(gg.get_z() == 45.6 * CLHEP::cm);
+    REQUIRE(gg.get_sigma_z() == 0.7 * CLHEP::cm);
+    REQUIRE(gg.has_xy());
+    REQUIRE(gg.get_x() == 10.0 * CLHEP::mm);
+    REQUIRE(gg.get_y() == 20.0 * CLHEP::mm);
+    REQUIRE(gg.is_delayed());
+    REQUIRE(gg.is_peripheral());
+    REQUIRE(gg.get_delayed_time() == 12.5 * CLHEP::microsecond);
+    REQUIRE(gg.get_delayed_time_error() == 20 * CLHEP::ns);
+  }
+}
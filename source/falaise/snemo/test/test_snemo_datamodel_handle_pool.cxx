@@ -0,0 +1,91 @@
+// Catch
+#include "catch.hpp"
+
+#include "falaise/snemo/datamodels/calibrated_tracker_hit.h"
+#include "falaise/snemo/datamodels/handle_pool.h"
+
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace sdm = snemo::datamodel;
+
+TEST_CASE("Pooled handles own their objects", "[falaise][datamodel]") {
+  sdm::handle_pool::release();
+  auto hit = sdm::make_pooled_handle<sdm::calibrated_tracker_hit>();
+  hit->set_r(2.5);
+  REQUIRE(hit.unique());
+  sdm::TrackerHitHdl copy = hit;
+  REQUIRE(copy->get_r() == 2.5);
+  REQUIRE(sdm::handle_pool::free_blocks() == 0);
+}
+
+TEST_CASE("Blocks freed by an event are reused by the next one", "[falaise][datamodel]") {
+  sdm::handle_pool::release();
+  std::vector<sdm::TrackerHitHdl> hits;
+  for (int i = 0; i < 100; ++i) {
+    hits.push_back(sdm::make_pooled_handle<sdm::calibrated_tracker_hit>());
+  }
+  std::set<const sdm::calibrated_tracker_hit*> addresses;
+  for (const auto& hit : hits) {
+    addresses.insert(&hit.get());
+  }
+  hits.clear();
+  REQUIRE(sdm::handle_pool::free_blocks() == 100);
+
+  for (int i = 0; i < 100; ++i) {
+    hits.push_back(sdm::make_pooled_handle<sdm::calibrated_tracker_hit>());
+    REQUIRE(addresses.count(&hits.back().get()) == 1);
+  }
+  REQUIRE(sdm::handle_pool::free_blocks() == 0);
+
+  SECTION("blocks freed on another thread go back to the allocating thread") {
+    std::size_t otherFreeBlocks = 1;
+    std::thread other{[&hits, &otherFreeBlocks]() {
+      hits.clear();
+      otherFreeBlocks = sdm::handle_pool::free_blocks();
+    }};
+    other.join();
+    REQUIRE(otherFreeBlocks == 0);
+    REQUIRE(sdm::handle_pool::free_blocks() == 100);
+
+    for (int i = 0; i < 100; ++i) {
+      hits.push_back(sdm::make_pooled_handle<sdm::calibrated_tracker_hit>());
+      REQUIRE(addresses.count(&hits.back().get()) == 1);
+    }
+    REQUIRE(sdm::handle_pool::free_blocks() == 0);
+  }
+
+  SECTION("blocks of a thread which has exited are freed safely") {
+    std::thread other{[&hits]() {
+      for (int i = 0; i < 10; ++i) {
+        hits.push_back(sdm::make_pooled_handle<sdm::calibrated_tracker_hit>());
+      }
+    }};
+    other.join();
+    hits.clear();
+    REQUIRE(sdm::handle_pool::free_blocks() == 100);
+  }
+
+  hits.clear();
+  sdm::handle_pool::release();
+  REQUIRE(sdm::handle_pool::free_blocks() == 0);
+}
+
+TEST_CASE("Free blocks are bounded per size class", "[falaise][datamodel]") {
+  sdm::handle_pool::release();
+  const std::size_t n = sdm::handle_pool::kMaxFreeBlocks + 10;
+  std::vector<void*> blocks;
+  for (std::size_t i = 0; i < n; ++i) {
+    blocks.push_back(sdm::handle_pool::allocate(64));
+  }
+  for (void* block : blocks) {
+    sdm::handle_pool::deallocate(block, 64);
+  }
+  REQUIRE(sdm::handle_pool::free_blocks() == sdm::handle_pool::kMaxFreeBlocks);
+
+  // Large blocks are not pooled
+  sdm::handle_pool::deallocate(sdm::handle_pool::allocate(4096), 4096);
+  REQUIRE(sdm::handle_pool::free_blocks() == sdm::handle_pool::kMaxFreeBlocks);
+  sdm::handle_pool::release();
+}
@@ -0,0 +1,75 @@
+// Catch
+#include "catch.hpp"
+
+#include "falaise/snemo/datamodels/calibrated_data.h"
+#include "falaise/snemo/datamodels/data_model.h"
+#include "falaise/snemo/datamodels/event.h"
+#include "falaise/snemo/datamodels/event_header.h"
+#include "falaise/snemo/datamodels/packed_bank.h"
+
+namespace sdm = snemo::datamodel;
+
+namespace {
+void fill_record(datatools::things& record) {
+  auto& header = record.add<sdm::event_header>(snedm::labels::event_header(), "Event Header Bank");
+  header.set_id(datatools::event_id{1, 42});
+  auto& calibratedData = record.add<sdm::calibrated_data>(snedm::labels::calibrated_data());
+  for (int i = 0; i < 3; ++i) {
+    sdm::TrackerHitHdl hit{new sdm::calibrated_tracker_hit};
+    hit->set_r(1.5 * i);
+    calibratedData.tracker_hits().push_back(hit);
+  }
+}
+}  // namespace
+
+TEST_CASE("Packed banks are decoded on first access", "[falaise][datamodel]") {
+  datatools::things record;
+  fill_record(record);
+  const std::string& cdLabel = snedm::labels::calibrated_data();
+  const std::string& ehLabel = snedm::labels::event_header();
+
+  sdm::pack_bank(record, cdLabel);
+  sdm::pack_bank(record, ehLabel);
+  REQUIRE(record.size() == 2);
+  REQUIRE(sdm::is_packed_bank(record, cdLabel));
+  REQUIRE(record.get<sdm::packed_bank>(cdLabel).get_bank_serial_tag() ==
+          sdm::calibrated_data::SERIAL_TAG);
+  REQUIRE(record.get<sdm::packed_bank>(cdLabel).size() > 0);
+
+  SECTION("packing twice keeps the packed bank") {
+    const std::string bytes = record.get<sdm::packed_bank>(cdLabel).get_bytes();
+    sdm::pack_bank(record, cdLabel);
+    REQUIRE(record.get<sdm::packed_bank>(cdLabel).get_bytes() == bytes);
+  }
+
+  SECTION("getFromEvent decodes only the bank it reads") {
+    const auto& calibratedData = snedm::getFromEvent<sdm::calibrated_data>(cdLabel, record);
+    REQUIRE(calibratedData.tracker_hits().size() == 3);
+    REQUIRE(calibratedData.tracker_hits()[2]->get_r() == Approx(3.0));
+    REQUIRE_FALSE(sdm::is_packed_bank(record, cdLabel));
+    REQUIRE(sdm::is_packed_bank(record, ehLabel));
+  }
+
+  SECTION("getOrAddToEvent decodes the bank it reads") {
+    auto& header = snedm::getOrAddToEvent<sdm::event_header>(ehLabel, record);
+    REQUIRE(header.get_id() == datatools::event_id(1, 42));
+    REQUIRE(record.get_entry_description(ehLabel) == "Event Header Bank");
+  }
+
+  SECTION("all banks can be decoded at once") {
+    sdm::unpack_banks(record);
+    REQUIRE(record.is_a<sdm::event_header>(ehLabel));
+    REQUIRE(record.is_a<sdm::calibrated_data>(cdLabel));
+  }
+}
+
+TEST_CASE("Only standard banks can be packed", "[falaise][datamodel]") {
+  datatools::things record;
+  record.add<datatools::properties>("UDD");
+  REQUIRE_THROWS_AS(sdm::pack_bank(record, "UDD"), std::logic_error);
+  REQUIRE(record.is_a<datatools::properties>("UDD"));
+
+  // Unpacking a bank which is not packed does nothing
+  REQUIRE_NOTHROW(sdm::unpack_bank(record, "UDD"));
+  REQUIRE(record.is_a<datatools::properties>("UDD"));
+}
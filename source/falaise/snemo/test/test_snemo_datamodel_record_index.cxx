@@ -0,0 +1,142 @@
+// Catch
+#include "catch.hpp"
+
+#include "falaise/snemo/datamodels/data_model.h"
+#include "falaise/snemo/datamodels/event_header.h"
+#include "falaise/snemo/datamodels/packed_bank.h"
+#include "falaise/snemo/datamodels/record_index.h"
+
+#include "bayeux/datatools/temporary_files.h"
+
+#include <cstdio>
+#include <fstream>
+
+namespace sdm = snemo::datamodel;
+
+namespace {
+void add_header(datatools::things& record, int run, int event) {
+  auto& header = record.add<sdm::event_header>(snedm::labels::event_header());
+  header.set_id(datatools::event_id{run, event});
+}
+
+// Index of 4 records with different banks
+sdm::record_index make_index() {
+  sdm::record_index index;
+  datatools::things record;
+  add_header(record, 1, 10);
+  index.add(record);
+
+  record.clear();
+  add_header(record, 1, 11);
+  record.add<datatools::properties>("UDD");
+  index.add(record);
+
+  record.clear();
+  index.add(record);
+
+  record.clear();
+  add_header(record, 2, 0);
+  record.add<datatools::properties>(snedm::labels::calibrated_data());
+  index.add(record);
+  return index;
+}
+
+std::string temporary_path(datatools::temp_file& tmp) {
+  tmp.set_remove_at_destroy(true);
+  tmp.create("/tmp", "test_snemo_datamodel_record_index_");
+  tmp.out() << "fake data file contents";
+  tmp.close();
+  return tmp.get_filename();
+}
+}  // namespace
+
+TEST_CASE("Records are indexed in order with their event ID and banks", "") {
+  const sdm::record_index index = make_index();
+  REQUIRE(index.size() == 4);
+  for (std::size_t i = 0; i < index.size(); ++i) {
+    REQUIRE(index.entries()[i].entry == i);
+  }
+
+  REQUIRE(index.entries()[0].banks == sdm::BANK_EH);
+  REQUIRE(index.entries()[1].banks == (sdm::BANK_EH | sdm::BANK_OTHER));
+  REQUIRE(index.entries()[2].banks == 0);
+  REQUIRE(index.entries()[2].run == -1);
+  REQUIRE(index.entries()[3].banks == (sdm::BANK_EH | sdm::BANK_CD));
+
+  REQUIRE(index.find(1, 11) == 1);
+  REQUIRE(index.find(2, 0) == 3);
+  REQUIRE(index.find(2, 1) == sdm::record_index::npos);
+  REQUIRE(index.find(-1, -1) == 2);
+
+  REQUIRE(index.select(sdm::BANK_EH) == std::vector<std::size_t>{0, 1, 3});
+  REQUIRE(index.select(sdm::BANK_EH | sdm::BANK_CD) == std::vector<std::size_t>{3});
+  REQUIRE(index.select(0).size() == 4);
+}
+
+TEST_CASE("Packed event headers are indexed with their event ID", "") {
+  sdm::record_index index;
+  datatools::things record;
+  add_header(record, 3, 42);
+  sdm::pack_bank(record, snedm::labels::event_header());
+  index.add(record);
+
+  REQUIRE(index.entries()[0].banks == sdm::BANK_EH);
+  REQUIRE(index.entries()[0].run == 3);
+  REQUIRE(index.entries()[0].event == 42);
+  REQUIRE(index.find(3, 42) == 0);
+  // The record is left packed
+  REQUIRE(sdm::is_packed_bank(record, snedm::labels::event_header()));
+}
+
+TEST_CASE("Events indexed more than once are found at their first record", "") {
+  sdm::record_index index;
+  datatools::things record;
+  for (int event : {5, 6, 5}) {
+    record.clear();
+    add_header(record, 1, event);
+    index.add(record);
+  }
+  REQUIRE(index.find(1, 5) == 0);
+  REQUIRE(index.find(1, 6) == 1);
+
+  index.clear();
+  REQUIRE(index.find(1, 5) == sdm::record_index::npos);
+}
+
+TEST_CASE("Record indices round trip through their sidecar file", "") {
+  datatools::temp_file data;
+  const std::string dataPath = temporary_path(data);
+  const std::string indexPath = sdm::record_index::sidecar_path(dataPath);
+  const sdm::record_index index = make_index();
+  index.write(dataPath);
+
+  sdm::record_index loaded;
+  REQUIRE(loaded.read(dataPath));
+  REQUIRE(loaded.size() == index.size());
+  for (std::size_t i = 0; i < index.size(); ++i) {
+    REQUIRE(loaded.entries()[i].run == index.entries()[i].run);
+    REQUIRE(loaded.entries()[i].event == index.entries()[i].event);
+    REQUIRE(loaded.entries()[i].entry == index.entries()[i].entry);
+    REQUIRE(loaded.entries()[i].banks == index.entries()[i].banks);
+  }
+  REQUIRE(loaded.find(1, 11) == 1);
+  REQUIRE(loaded.find(2, 0) == 3);
+
+  SECTION("modified data file") {
+    std::ofstream f{dataPath, std::ios::app};
+    f << "more records";
+    f.close();
+    REQUIRE_FALSE(loaded.read(dataPath));
+    REQUIRE(loaded.size() == 0);
+  }
+
+  SECTION("truncated index") {
+    std::ofstream f{indexPath, std::ios::binary | std::ios::trunc};
+    f << "SNRINDEX";
+    f.close();
+    REQUIRE_FALSE(loaded.read(dataPath));
+  }
+
+  std::remove(indexPath.c_str());
+  REQUIRE_FALSE(loaded.read(dataPath));
+}
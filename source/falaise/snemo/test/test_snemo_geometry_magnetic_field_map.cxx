@@ -0,0 +1,304 @@
+// Catch
+#include "catch.hpp"
+
+#include "falaise/snemo/geometry/magnetic_field_map.h"
+#include "falaise/snemo/geometry/mapped_magnetic_field.h"
+
+#include "bayeux/datatools/clhep_units.h"
+#include "bayeux/datatools/temporary_files.h"
+
+#include <fstream>
+
+namespace sgeo = snemo::geometry;
+
+namespace {
+// Small map whose components differ at every node
+sgeo::field_map_layout make_layout() {
+  sgeo::field_map_layout layout;
+  layout.nx = 4;
+  layout.ny = 3;
+  layout.nz = 3;
+  layout.origin.set(0., 0., 0.);
+  layout.step.set(2. * CLHEP::cm, 2. * CLHEP::cm, 2. * CLHEP::cm);
+  layout.fieldUnit = CLHEP::gauss;
+  return layout;
+}
+
+int32_t component(size_t ax, size_t ix, size_t iy, size_t iz) {
+  return static_cast<int32_t>(1000 * ax + 100 * iz + 10 * iy + ix) - 500;
+}
+
+// Write the map as a "csv_map_0" text file
+void write_csv(std::ostream& out, const sgeo::field_map_layout& layout) {
+  out << layout.nx << ',' << layout.ny << ',' << layout.nz << ",0,0,0,0.02,0.02,0.02\n";
+  for (size_t ax = 0; ax < 3; ++ax) {
+    for (size_t iz = 0; iz < layout.nz; ++iz) {
+      for (size_t iy = 0; iy < layout.ny; ++iy) {
+        out << ax << ',' << iy << ',' << iz;
+        for (size_t ix = 0; ix < layout.nx; ++ix) {
+          out << ',' << component(ax, ix, iy, iz);
+        }
+        out << '\n';
+      }
+    }
+  }
+}
+
+std::vector<int32_t> make_components(const sgeo::field_map_layout& layout) {
+  std::vector<int32_t> components(layout.size());
+  for (size_t ax = 0; ax < 3; ++ax) {
+    for (size_t iz = 0; iz < layout.nz; ++iz) {
+      for (size_t iy = 0; iy < layout.ny; ++iy) {
+        for (size_t ix = 0; ix < layout.nx; ++ix) {
+          components[layout.index(ix, iy, iz) + ax] = component(ax, ix, iy, iz);
+        }
+      }
+    }
+  }
+  return components;
+}
+
+std::string temporary_path(datatools::temp_file& tmp) {
+  tmp.set_remove_at_destroy(true);
+  tmp.create("/tmp", "test_snemo_geometry_magnetic_field_map_");
+  tmp.close();
+  return tmp.get_filename();
+}
+}  // namespace
+
+TEST_CASE("Text maps are read with interleaved components", "") {
+  datatools::temp_file csv;
+  const std::string csvPath = temporary_path(csv);
+  const sgeo::field_map_layout expected = make_layout();
+  {
+    std::ofstream out{csvPath};
+    write_csv(out, expected);
+  }
+
+  sgeo::field_map_layout layout;
+  std::vector<int32_t> components = sgeo::read_csv_field_map(csvPath, layout);
+  REQUIRE(layout.nx == expected.nx);
+  REQUIRE(layout.ny == expected.ny);
+  REQUIRE(layout.nz == expected.nz);
+  REQUIRE(layout.step.x() == Approx(2. * CLHEP::cm));
+  REQUIRE(layout.fieldUnit == Approx(0.001 * CLHEP::gauss));
+  REQUIRE(components == make_components(expected));
+}
+
+TEST_CASE("Binary maps round trip", "") {
+  datatools::temp_file bin;
+  const std::string binPath = temporary_path(bin);
+  const sgeo::field_map_layout layout = make_layout();
+  const std::vector<int32_t> components = make_components(layout);
+  sgeo::write_binary_field_map(binPath, layout, components);
+
+  sgeo::binary_field_map map{binPath};
+  REQUIRE(map.layout().nx == layout.nx);
+  REQUIRE(map.layout().ny == layout.ny);
+  REQUIRE(map.layout().nz == layout.nz);
+  REQUIRE(map.layout().origin == layout.origin);
+  REQUIRE(map.layout().step == layout.step);
+  REQUIRE(map.layout().fieldUnit == layout.fieldUnit);
+  REQUIRE(std::vector<int32_t>(map.data(), map.data() + layout.size()) == components);
+}
+
+TEST_CASE("Invalid binary maps are rejected", "") {
+  datatools::temp_file bin;
+  const std::string binPath = temporary_path(bin);
+  const sgeo::field_map_layout layout = make_layout();
+  sgeo::write_binary_field_map(binPath, layout, make_components(layout));
+
+  SECTION("corrupted components") {
+    std::fstream f{binPath, std::ios::in | std::ios::out | std::ios::binary};
+    f.seekp(-1, std::ios::end);
+    f.put('\x7f');
+    f.close();
+    // Only found when the checksum is verified
+    REQUIRE_NOTHROW(sgeo::binary_field_map{binPath});
+    REQUIRE_THROWS_AS((sgeo::binary_field_map{binPath, true}), std::runtime_error);
+  }
+
+  SECTION("grid size overflowing 64 bits") {
+    // 3 * nx * ny * nz wraps around to the 108 components of the file in 64 bits
+    std::fstream f{binPath, std::ios::in | std::ios::out | std::ios::binary};
+    const uint32_t nx = 1554672908u;
+    const uint32_t ny = 3316282721u;
+    const uint32_t nz = 4078033059u;
+    f.seekp(16);
+    f.write(reinterpret_cast<const char*>(&nx), sizeof(nx));
+    f.write(reinterpret_cast<const char*>(&ny), sizeof(ny));
+    f.write(reinterpret_cast<const char*>(&nz), sizeof(nz));
+    f.close();
+    REQUIRE_THROWS_AS(sgeo::binary_field_map{binPath}, std::runtime_error);
+  }
+
+  SECTION("truncated file") {
+    std::ofstream f{binPath, std::ios::binary | std::ios::trunc};
+    f << "SNBFMAP";
+    f.close();
+    REQUIRE_THROWS_AS(sgeo::binary_field_map{binPath}, std::runtime_error);
+  }
+
+  SECTION("text map") {
+    std::ofstream f{binPath, std::ios::trunc};
+    write_csv(f, layout);
+    f.close();
+    REQUIRE_THROWS_AS(sgeo::binary_field_map{binPath}, std::runtime_error);
+  }
+}
+
+TEST_CASE("Text and binary maps give the same field", "") {
+  datatools::temp_file csv;
+  const std::string csvPath = temporary_path(csv);
+  datatools::temp_file bin;
+  const std::string binPath = temporary_path(bin);
+  {
+    std::ofstream out{csvPath};
+    write_csv(out, make_layout());
+  }
+  sgeo::field_map_layout layout;
+  std::vector<int32_t> components = sgeo::read_csv_field_map(csvPath, layout);
+  sgeo::write_binary_field_map(binPath, layout, components);
+
+  sgeo::mapped_magnetic_field fromText;
+  fromText.setMapMode(sgeo::mapped_magnetic_field::map_mode_t::IMPORT_CSV_MAP_0);
+  fromText.setMapFilename(csvPath);
+  fromText.setZeroFieldOutsideMap(false);
+  fromText.initialize_simple();
+
+  sgeo::mapped_magnetic_field fromBinary;
+  fromBinary.setMapMode(sgeo::mapped_magnetic_field::map_mode_t::IMPORT_BINARY_MAP);
+  fromBinary.setMapFilename(binPath);
+  fromBinary.setZeroFieldOutsideMap(false);
+  fromBinary.initialize_simple();
+
+  // Points in all octants, inside and outside of the mapped volume
+  for (double x : {-3.3, -0.5, 0.7, 3.9}) {
+    for (double y : {-5.1, -1.2, 2.5, 4.4}) {
+      for (double z : {-3.7, 0.2, 3.1, 9.0}) {
+        const geomtools::vector_3d position{x * CLHEP::cm, y * CLHEP::cm, z * CLHEP::cm};
+        geomtools::vector_3d bText;
+        geomtools::vector_3d bBinary;
+        const int statusText = fromText.compute_magnetic_field(position, 0., bText);
+        const int statusBinary = fromBinary.compute_magnetic_field(position, 0., bBinary);
+        REQUIRE(statusText == statusBinary);
+        if (statusText == sgeo::mapped_magnetic_field::STATUS_SUCCESS) {
+          REQUIRE(bText == bBinary);
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("Batched field computation matches single positions", "") {
+  datatools::temp_file bin;
+  const std::string binPath = temporary_path(bin);
+  const sgeo::field_map_layout layout = make_layout();
+  sgeo::write_binary_field_map(binPath, layout, make_components(layout));
+
+  for (bool zeroOutside : {false, true}) {
+    sgeo::mapped_magnetic_field mmf;
+    mmf.setMapMode(sgeo::mapped_magnetic_field::map_mode_t::IMPORT_BINARY_MAP);
+    mmf.setMapFilename(binPath);
+    mmf.setZeroFieldOutsideMap(zeroOutside);
+    mmf.setInvertedZ(true);
+    mmf.initialize_simple();
+
+    // Includes points in the last cell of the grid and outside of the map
+    std::vector<geomtools::vector_3d> positions;
+    for (double x : {-5.9, -0.5, 0.7, 3.9}) {
+      for (double y : {-3.9, -1.2, 2.5, 5.9}) {
+        for (double z : {-3.7, 0.2, 3.1, 9.0}) {
+          positions.emplace_back(x * CLHEP::cm, y * CLHEP::cm, z * CLHEP::cm);
+        }
+      }
+    }
+
+    std::vector<geomtools::vector_3d> fields;
+    const int batchStatus = mmf.compute_magnetic_field(positions, 0., fields);
+    REQUIRE(fields.size() == positions.size());
+    int expectedStatus = sgeo::mapped_magnetic_field::STATUS_SUCCESS;
+    for (size_t i = 0; i < positions.size(); ++i) {
+      geomtools::vector_3d B;
+      const int status = mmf.compute_magnetic_field(positions[i], 0., B);
+      if (status == sgeo::mapped_magnetic_field::STATUS_SUCCESS) {
+        REQUIRE(fields[i] == B);
+      } else {
+        REQUIRE_FALSE(geomtools::is_valid(fields[i]));
+        expectedStatus = status;
+      }
+    }
+    REQUIRE(batchStatus == expectedStatus);
+    if (zeroOutside) {
+      REQUIRE(batchStatus == sgeo::mapped_magnetic_field::STATUS_SUCCESS);
+    }
+  }
+}
+
+TEST_CASE("Interpolation kernels give the known field of a linear map", "") {
+  // The components of the test map are linear in the node indices, so that the
+  // trilinear interpolation between nodes gives their exact value
+  datatools::temp_file bin;
+  const std::string binPath = temporary_path(bin);
+  const sgeo::field_map_layout layout = make_layout();
+  sgeo::write_binary_field_map(binPath, layout, make_components(layout));
+
+  using kernel_t = sgeo::mapped_magnetic_field::kernel_t;
+  REQUIRE(sgeo::mapped_magnetic_field::isKernelSupported(kernel_t::SCALAR));
+  std::vector<kernel_t> kernels{kernel_t::AUTOMATIC, kernel_t::SCALAR};
+  if (sgeo::mapped_magnetic_field::isKernelSupported(kernel_t::AVX2)) {
+    kernels.push_back(kernel_t::AVX2);
+  } else {
+    sgeo::mapped_magnetic_field mmf;
+    REQUIRE_THROWS_AS(mmf.setKernel(kernel_t::AVX2), std::logic_error);
+  }
+
+  // Points of the positive octant between nodes, in the last cells too
+  std::vector<geomtools::vector_3d> positions;
+  for (double x : {0.1, 1.3, 2.5, 3.9}) {
+    for (double y : {0.05, 2.7, 4.4, 5.95}) {
+      for (double z : {0.3, 1.0, 3.3}) {
+        positions.emplace_back(x * CLHEP::cm, y * CLHEP::cm, z * CLHEP::cm);
+      }
+    }
+  }
+
+  std::vector<std::vector<geomtools::vector_3d>> fields;
+  for (kernel_t kernel : kernels) {
+    sgeo::mapped_magnetic_field mmf;
+    mmf.setMapMode(sgeo::mapped_magnetic_field::map_mode_t::IMPORT_BINARY_MAP);
+    mmf.setMapFilename(binPath);
+    mmf.setZeroFieldOutsideMap(false);
+    mmf.setKernel(kernel);
+    mmf.initialize_simple();
+
+    fields.emplace_back();
+    for (const geomtools::vector_3d& position : positions) {
+      geomtools::vector_3d B;
+      REQUIRE(mmf.compute_magnetic_field(position, 0., B) ==
+              sgeo::mapped_magnetic_field::STATUS_SUCCESS);
+      fields.back().push_back(B);
+
+      // Map axes are the (y, z, x) axes of the demonstrator, and B is (b2, b0, b1)
+      const double fx = position.y() / layout.step.x();
+      const double fy = position.z() / layout.step.y();
+      const double fz = position.x() / layout.step.z();
+      double b[3];
+      for (size_t ax = 0; ax < 3; ++ax) {
+        b[ax] = (1000. * ax + 100. * fz + 10. * fy + fx - 500.) * layout.fieldUnit;
+      }
+      REQUIRE(B.x() == Approx(b[2]).epsilon(1e-12));
+      REQUIRE(B.y() == Approx(b[0]).epsilon(1e-12));
+      REQUIRE(B.z() == Approx(b[1]).epsilon(1e-12));
+    }
+  }
+
+  // Kernels only differ by rounding
+  for (size_t k = 1; k < fields.size(); ++k) {
+    for (size_t i = 0; i < positions.size(); ++i) {
+      REQUIRE(fields[k][i].x() == Approx(fields[0][i].x()).epsilon(1e-14));
+      REQUIRE(fields[k][i].y() == Approx(fields[0][i].y()).epsilon(1e-14));
+      REQUIRE(fields[k][i].z() == Approx(fields[0][i].z()).epsilon(1e-14));
+    }
+  }
+}
@@ -0,0 +1,41 @@
+// Catch
+#include "catch.hpp"
+
+#include "falaise/snemo/processing/event_seed.h"
+
+#include <set>
+
+namespace sproc = snemo::processing;
+
+TEST_CASE("Philox matches the reference implementation", "") {
+  // Known answers of the Random123 library (kat_vectors)
+  REQUIRE(sproc::philox4x32({{0, 0, 0, 0}}, {{0, 0}}) ==
+          std::array<uint32_t, 4>{{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}});
+  REQUIRE(sproc::philox4x32({{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}},
+                            {{0xffffffff, 0xffffffff}}) ==
+          std::array<uint32_t, 4>{{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}});
+  REQUIRE(sproc::philox4x32({{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}},
+                            {{0xa4093822, 0x299f31d0}}) ==
+          std::array<uint32_t, 4>{{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}});
+}
+
+TEST_CASE("Event seeds are reproducible and distinct", "") {
+  const int32_t seed = sproc::event_seed(12345, 1, 42, "CalibrateTracker");
+  REQUIRE(seed == sproc::event_seed(12345, 1, 42, "CalibrateTracker"));
+  REQUIRE(seed >= 0);
+
+  REQUIRE(seed != sproc::event_seed(12346, 1, 42, "CalibrateTracker"));
+  REQUIRE(seed != sproc::event_seed(12345, 2, 42, "CalibrateTracker"));
+  REQUIRE(seed != sproc::event_seed(12345, 1, 43, "CalibrateTracker"));
+  REQUIRE(seed != sproc::event_seed(12345, 1, 42, "CalibrateCalorimeters"));
+
+  std::set<int32_t> seeds;
+  for (int32_t run = 0; run < 10; ++run) {
+    for (int32_t event = 0; event < 1000; ++event) {
+      const int32_t s = sproc::event_seed(12345, run, event, "CalibrateTracker");
+      REQUIRE(s >= 0);
+      seeds.insert(s);
+    }
+  }
+  REQUIRE(seeds.size() == 10000);
+}
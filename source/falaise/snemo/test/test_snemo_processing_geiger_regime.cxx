@@ -0,0 +1,84 @@
+// Catch
+#include "catch.hpp"
+
+#include "falaise/snemo/processing/geiger_regime.h"
+
+#include "bayeux/datatools/clhep_units.h"
+#include "bayeux/datatools/properties.h"
+#include "bayeux/mygsl/rng.h"
+
+#include <cmath>
+
+namespace sproc = snemo::processing;
+
+namespace {
+// Maximum differences between interpolated and exact values which the tables
+// guarantee with their default 4096 bins, over the whole drift time range
+const double kRadiusTolerance = 0.25 * CLHEP::micrometer;
+const double kSigmaRadiusTolerance = 0.025 * CLHEP::micrometer;
+// Random drift times are drawn from a gaussian whose mean and width are
+// interpolated within these. The largest differences are found beyond the
+// cell radius, where the drift time grows fastest with the radius
+const double kMeanTimeTolerance = 4.0 * CLHEP::ns;
+const double kSigmaTimeTolerance = 5.0 * CLHEP::ns;
+
+sproc::geiger_regime make_regime(bool useLookupTables) {
+  datatools::properties config;
+  if (useLookupTables) {
+    config.store_flag("use_lookup_tables");
+  }
+  return sproc::geiger_regime{config};
+}
+}  // namespace
+
+TEST_CASE("Lookup tables are off by default", "") {
+  REQUIRE_FALSE(sproc::geiger_regime{}.usesLookupTables());
+  REQUIRE(make_regime(true).usesLookupTables());
+
+  datatools::properties config;
+  config.store_flag("use_lookup_tables");
+  config.store_integer("lookup_table_bins", 0);
+  REQUIRE_THROWS_AS(sproc::geiger_regime{config}, std::range_error);
+}
+
+TEST_CASE("Interpolated radii match the drift model", "") {
+  const sproc::geiger_regime exact = make_regime(false);
+  const sproc::geiger_regime table = make_regime(true);
+
+  // Covers both sides of the transition at the cell radius and the time cut
+  for (double t = 0.0; t < 12.0 * CLHEP::microsecond; t += 1.3 * CLHEP::ns) {
+    double r = 0.0;
+    double sigma_r = 0.0;
+    exact.calibrateRadiusFromTime(t, r, sigma_r);
+    double rTable = 0.0;
+    double sigma_rTable = 0.0;
+    table.calibrateRadiusFromTime(t, rTable, sigma_rTable);
+    if (!std::isfinite(r)) {
+      REQUIRE_FALSE(std::isfinite(rTable));
+      REQUIRE_FALSE(std::isfinite(sigma_rTable));
+      continue;
+    }
+    INFO("drift time = " << t / CLHEP::ns << " ns");
+    REQUIRE(std::abs(rTable - r) < kRadiusTolerance);
+    REQUIRE(std::abs(sigma_rTable - sigma_r) < kSigmaRadiusTolerance);
+  }
+}
+
+TEST_CASE("Interpolated drift times match the drift model", "") {
+  const sproc::geiger_regime exact = make_regime(false);
+  const sproc::geiger_regime table = make_regime(true);
+
+  // Identically seeded generators draw the same deviates in both modes, and a
+  // third one the unit gaussian deviate scaled by the width of the drift time
+  mygsl::rng exactRNG{"taus2", 314159};
+  mygsl::rng tableRNG{"taus2", 314159};
+  mygsl::rng deviateRNG{"taus2", 314159};
+  const double rMax = exact.getCellRadius() + 3.0 * CLHEP::mm;
+  for (double r = 0.0; r < rMax; r += 0.011 * CLHEP::mm) {
+    const double t = exact.getRandomTimeGivenRadius(exactRNG, r);
+    const double tTable = table.getRandomTimeGivenRadius(tableRNG, r);
+    const double deviate = deviateRNG.gaussian(0.0, 1.0);
+    INFO("drift radius = " << r / CLHEP::mm << " mm, deviate = " << deviate);
+    REQUIRE(std::abs(tTable - t) < kMeanTimeTolerance + std::abs(deviate) * kSigmaTimeTolerance);
+  }
+}
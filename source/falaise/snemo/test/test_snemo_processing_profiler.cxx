@@ -0,0 +1,101 @@
+// Catch
+#include "catch.hpp"
+
+#include "falaise/snemo/processing/module.h"
+#include "falaise/snemo/processing/profiler.h"
+
+#include <sstream>
+
+namespace flp = falaise::processing;
+
+namespace {
+// Fake allocation counter
+void fake_probe(std::size_t& count, std::size_t& bytes) {
+  static std::size_t calls = 0;
+  ++calls;
+  count = 2 * calls;
+  bytes = 16 * calls;
+}
+}  // namespace
+
+// A module returning a different status on each call
+class AlternatingModule {
+ public:
+  AlternatingModule() = default;
+  AlternatingModule(falaise::property_set const& /*unused*/,
+                    datatools::service_manager& /*unused*/)
+      : AlternatingModule() {}
+
+  flp::status process(datatools::things& /*unused*/) {
+    return (ncalls++ % 2 == 0) ? flp::status::PROCESS_OK : flp::status::PROCESS_STOP;
+  }
+
+ private:
+  int ncalls = 0;
+};
+FALAISE_REGISTER_MODULE(AlternatingModule)
+
+TEST_CASE("Inactive profiler records nothing", "") {
+  flp::profiler& p = flp::profiler::instance();
+  p.clear();
+  p.set_enabled(false);
+  { flp::scoped_profile profile{"inactive"}; }
+
+  std::ostringstream oss;
+  p.write_json(oss);
+  REQUIRE(oss.str().find("inactive") == std::string::npos);
+}
+
+TEST_CASE("Wrapped modules are profiled", "") {
+  flp::profiler& p = flp::profiler::instance();
+  p.clear();
+  p.set_enabled(true);
+  p.set_allocation_probe(&fake_probe);
+
+  flp::module<AlternatingModule> mod;
+  mod.set_name("alternating");
+  datatools::properties dummyConfig{};
+  datatools::service_manager dummyServices{};
+  dpp::module_handle_dict_type dummyWhatever{};
+  REQUIRE_NOTHROW(mod.initialize(dummyConfig, dummyServices, dummyWhatever));
+
+  datatools::things event{};
+  for (int i = 0; i < 5; ++i) {
+    mod.process(event);
+  }
+
+  p.set_enabled(false);
+  p.set_allocation_probe(nullptr);
+
+  std::ostringstream oss;
+  p.write_json(oss);
+  std::string report = oss.str();
+  REQUIRE(report.find("\"alternating\"") != std::string::npos);
+  REQUIRE(report.find("\"calls\": 5") != std::string::npos);
+  REQUIRE(report.find("\"PROCESS_OK\": 3") != std::string::npos);
+  REQUIRE(report.find("\"PROCESS_STOP\": 2") != std::string::npos);
+  REQUIRE(report.find("\"allocations\": {\"unit\": \"count\", \"total\": 10") != std::string::npos);
+  REQUIRE(report.find("\"p99\"") != std::string::npos);
+}
+
+TEST_CASE("Timers are reported apart from module calls", "") {
+  flp::profiler& p = flp::profiler::instance();
+  p.clear();
+  p.set_enabled(true);
+  { flp::scoped_profile profile{"clustering"}; }
+  p.record_timer("CAT/sequentiate", 1500.0);
+  p.record_timer("CAT/sequentiate", 500.0);
+  p.set_enabled(false);
+
+  std::ostringstream oss;
+  p.write_json(oss);
+  std::string report = oss.str();
+  const std::size_t timers = report.find("\"timers\"");
+  REQUIRE(timers != std::string::npos);
+  REQUIRE(report.find("\"clustering\"") < timers);
+  REQUIRE(report.find("\"CAT/sequentiate\"") > timers);
+  REQUIRE(report.find("\"laps\": 2") != std::string::npos);
+  REQUIRE(report.find("\"wall_time\": {\"unit\": \"ns\", \"total\": 2000") != std::string::npos);
+  REQUIRE(report.find("\"calls\": 1") != std::string::npos);
+  REQUIRE(report.find("\"calls\": 2") == std::string::npos);
+}